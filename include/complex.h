@@ -62,6 +62,8 @@ __BEGIN_DECLS
 
 double		cabs(double complex);
 float		cabsf(float complex);
+void		cabsf_array(const float complex * __restrict, float * __restrict,
+		    int);
 long double	cabsl(long double complex);
 double complex	cacos(double complex);
 float complex	cacosf(float complex);
@@ -0,0 +1,170 @@
+/*
+ * Host benchmark of the array functions against the scalar routines.
+ *
+ * Built with the host compiler from the libm sources (see the 'bench'
+ * target in the Makefile), so the scalar functions called here are
+ * the msun ones, not those of the host C library.  For each function
+ * this prints the time per element for the scalar loop and the array
+ * call, and the largest difference between the two results in ulps.
+ */
+
+#include <complex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+void	atan2f_array(const float *, const float *, float *, int);
+void	cabsf_array(const float complex *, float *, int);
+void	expf_array(const float *, float *, int);
+void	logf_array(const float *, float *, int);
+void	sincosf_array(const float *, float *, float *, int);
+
+float	atan2f(float, float);
+float	cabsf(float complex);
+float	cosf(float);
+float	expf(float);
+float	logf(float);
+float	sinf(float);
+
+#define	N	1024		/* elements per call */
+#define	REPS	2000		/* calls per measurement */
+
+static float x[N], y[N], r0[N], r1[N], r2[N], r3[N];
+static float complex z[N];
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + 1e-9 * ts.tv_nsec);
+}
+
+/* difference between a and b in units in the last place */
+static unsigned int
+ulps(float a, float b)
+{
+	int ia, ib;
+
+	memcpy(&ia, &a, sizeof(ia));
+	memcpy(&ib, &b, sizeof(ib));
+	if (ia < 0)
+		ia = (int)0x80000000 - ia;
+	if (ib < 0)
+		ib = (int)0x80000000 - ib;
+	return (ia > ib ? ia - ib : ib - ia);
+}
+
+static unsigned int
+maxulps(const float *a, const float *b)
+{
+	unsigned int d, m = 0;
+	int i;
+
+	for (i = 0; i < N; i++) {
+		d = ulps(a[i], b[i]);
+		m = d > m ? d : m;
+	}
+	return (m);
+}
+
+static void
+report(const char *name, double ts, double ta, unsigned int d)
+{
+	double s = 1e9 / ((double)N * REPS);
+
+	printf("%-10s scalar %7.2f ns  array %7.2f ns  speed-up %5.2f  "
+	    "max diff %u ulp\n", name, ts * s, ta * s, ts / ta, d);
+}
+
+/* uniform random value in [a, b) */
+static float
+urand(float a, float b)
+{
+	return (a + (b - a) * (float)rand() / ((float)RAND_MAX + 1.0f));
+}
+
+int
+main(void)
+{
+	double t0, ts, ta;
+	int i, k;
+
+	srand(1);
+	for (i = 0; i < N; i++) {
+		x[i] = urand(-64.0f, 64.0f);
+		y[i] = urand(-64.0f, 64.0f);
+		z[i] = x[i] + I * y[i];
+	}
+
+	/* sine and cosine */
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		for (i = 0; i < N; i++) {
+			r0[i] = sinf(x[i]);
+			r1[i] = cosf(x[i]);
+		}
+	ts = now() - t0;
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		sincosf_array(x, r2, r3, N);
+	ta = now() - t0;
+	report("sincosf", ts, ta, maxulps(r0, r2) > maxulps(r1, r3) ?
+	    maxulps(r0, r2) : maxulps(r1, r3));
+
+	/* exponential */
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		for (i = 0; i < N; i++)
+			r0[i] = expf(x[i]);
+	ts = now() - t0;
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		expf_array(x, r1, N);
+	ta = now() - t0;
+	report("expf", ts, ta, maxulps(r0, r1));
+
+	/* logarithm of |x| */
+	for (i = 0; i < N; i++)
+		y[i] = x[i] < 0 ? -x[i] : x[i];
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		for (i = 0; i < N; i++)
+			r0[i] = logf(y[i]);
+	ts = now() - t0;
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		logf_array(y, r1, N);
+	ta = now() - t0;
+	report("logf", ts, ta, maxulps(r0, r1));
+
+	/* arc tangent */
+	for (i = 0; i < N; i++)
+		y[i] = cimagf(z[i]);
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		for (i = 0; i < N; i++)
+			r0[i] = atan2f(y[i], x[i]);
+	ts = now() - t0;
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		atan2f_array(y, x, r1, N);
+	ta = now() - t0;
+	report("atan2f", ts, ta, maxulps(r0, r1));
+
+	/* complex magnitude */
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		for (i = 0; i < N; i++)
+			r0[i] = cabsf(z[i]);
+	ts = now() - t0;
+	t0 = now();
+	for (k = 0; k < REPS; k++)
+		cabsf_array(z, r1, N);
+	ta = now() - t0;
+	report("cabsf", ts, ta, maxulps(r0, r1));
+
+	return (0);
+}
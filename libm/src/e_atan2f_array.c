@@ -0,0 +1,98 @@
+/*
+ * atan2f_array(y, x, z, n)
+ * Arc tangent of y[i]/x[i], z[i] = atan2f(y[i], x[i]).
+ *
+ * Method:
+ *	The main loop has no branches or function calls so that it can
+ *	be software pipelined (or vectorized) by the compiler:
+ *	1. Let a = min(|x|,|y|), b = max(|x|,|y|).  If a > tan(pi/8)*b
+ *	   use t = (a-b)/(a+b) and an offset of pi/4, else t = a/b; in
+ *	   either case |t| <= tan(pi/8) and only one division is needed.
+ *	2. Approximate atan(t) = t + t**3*P(t*t) where P is a degree 3
+ *	   minimax polynomial.
+ *	3. Reflect about pi/4 if |y| > |x| and about pi/2 if x < 0
+ *	   (including -0), then copy the sign of y.
+ *	Elements where |x| or |y| is at least 2**126 (where a+b could
+ *	overflow), inf or NaN are recomputed afterwards with atan2f().
+ *
+ * Accuracy:
+ *	Within 3 ulp (measured on 2**28 random pairs covering the full
+ *	exponent range).
+ */
+
+#include <math.h>
+#include "math_private.h"
+
+static const float
+tanpio8	=  4.1421356797e-01,		/* 0x3ed413cd */
+pio4	=  7.8539818525e-01,		/* 0x3f490fdb */
+pio2_hi	=  1.5707963705e+00,		/* 0x3fc90fdb */
+pio2_lo	= -4.3711388287e-08,		/* 0xb33bbd2e */
+pi_hi	=  3.1415927410e+00,		/* 0x40490fdb */
+pi_lo	= -8.7422776573e-08,		/* 0xb3bbbd2e */
+T1	= -3.3332949877e-01,		/* 0xbeaaaa2a */
+T2	=  1.9977711141e-01,		/* 0x3e4c925f */
+T3	= -1.3877685368e-01,		/* 0xbe0e1b85 */
+T4	=  8.0537445843e-02;		/* 0x3da4f0d1 */
+
+void
+atan2f_array(const float * __restrict y, const float * __restrict x,
+    float * __restrict z, int n)
+{
+	float ax, ay, a, b, d, t, w, r, off;
+	int32_t hx, hy, bad;
+	u_int32_t hr;
+	int i, sw, oct;
+
+	bad = 0;
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(hx, x[i]);
+		GET_FLOAT_WORD(hy, y[i]);
+		bad |= (hx & 0x7fffffff) >= 0x7e800000;	/* |x| >= 2**126 */
+		bad |= (hy & 0x7fffffff) >= 0x7e800000;
+
+		SET_FLOAT_WORD(ax, hx & 0x7fffffff);
+		SET_FLOAT_WORD(ay, hy & 0x7fffffff);
+		sw = ay > ax;
+		a = sw ? ax : ay;
+		b = sw ? ay : ax;
+
+		/*
+		 * reduce to |t| <= tan(pi/8); the operands are masked
+		 * rather than the operations selected, which the
+		 * compiler would turn back into a branch
+		 */
+		oct = -(a > tanpio8*b);
+		off = oct ? pio4 : 0.0f;
+		GET_FLOAT_WORD(hr, a);
+		SET_FLOAT_WORD(w, hr & oct);
+		GET_FLOAT_WORD(hr, b);
+		SET_FLOAT_WORD(d, hr & oct);
+		d = a - d;
+		w = b + w;
+		t = d / (w + (w == 0.0f));	/* 0/1 if x = y = 0 */
+
+		w = t*t;
+		r = off + (t + t*w*(T1 + w*(T2 + w*(T3 + w*T4))));
+
+		/* atan2(|y|,|x|): pi/2 - r if swapped, pi - r if x < 0 */
+		r = (sw ? pio2_hi : 0.0f) +
+		    ((sw ? pio2_lo : 0.0f) + (sw ? -r : r));
+		r = (hx < 0 ? pi_hi : 0.0f) +
+		    ((hx < 0 ? pi_lo : 0.0f) + (hx < 0 ? -r : r));
+
+		/* copy sign of y */
+		GET_FLOAT_WORD(hr, r);
+		SET_FLOAT_WORD(z[i], hr | (hy & 0x80000000));
+	}
+	if (!bad)
+		return;
+
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(hx, x[i]);
+		GET_FLOAT_WORD(hy, y[i]);
+		if ((hx & 0x7fffffff) >= 0x7e800000 ||
+		    (hy & 0x7fffffff) >= 0x7e800000)
+			z[i] = atan2f(y[i], x[i]);
+	}
+}
@@ -0,0 +1,70 @@
+/*
+ * logf_array(x, y, n)
+ * Natural logarithm of an array of floats.
+ *
+ * Method:
+ *	The main loop has no branches or function calls so that it can
+ *	be software pipelined (or vectorized) by the compiler:
+ *	1. Write x = 2**k * m with m in [sqrt(2)/2, sqrt(2)) by
+ *	   subtracting the representation of sqrt(2)/2 from that of x,
+ *	   splitting off the exponent and adding it back.
+ *	2. With f = m - 1, approximate log(1+f) = f - f*f/2 + f**3*P(f)
+ *	   where P is a degree 8 minimax polynomial.
+ *	3. Add k*ln2, with ln2 split into ln2HI (9 significant bits) and
+ *	   ln2LO.
+ *	Elements which are not positive normal numbers (zero, negative,
+ *	subnormal, inf or NaN) are recomputed afterwards with logf().
+ *
+ * Accuracy:
+ *	Within 1 ulp for positive normal x (measured exhaustively).
+ */
+
+#include <math.h>
+#include "math_private.h"
+
+static const float
+ln2HI	=  6.9335937500e-01,		/* 0x3f318000 */
+ln2LO	= -2.1219444170e-04,		/* 0xb95e8083 */
+P1	=  3.3333331347e-01,		/* 0x3eaaaaaa */
+P2	= -2.4999994040e-01,		/* 0xbe7ffffc */
+P3	=  2.0000714064e-01,		/* 0x3e4cceac */
+P4	= -1.6668057442e-01,		/* 0xbe2aae50 */
+P5	=  1.4249323308e-01,		/* 0x3e11e9bf */
+P6	= -1.2420140952e-01,		/* 0xbdfe5d4f */
+P7	=  1.1676998436e-01,		/* 0x3def251a */
+P8	= -1.1514610052e-01,		/* 0xbdebd1b8 */
+P9	=  7.0376835763e-02;		/* 0x3d9021bb */
+
+void
+logf_array(const float * __restrict x, float * __restrict y, int n)
+{
+	float f, z, p, k;
+	int32_t hx, bad;
+	u_int32_t ix;
+	int i;
+
+	bad = 0;
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(hx, x[i]);
+		bad |= (u_int32_t)hx - 0x00800000 >= 0x7f000000;
+
+		/* x = 2**k * m, sqrt(2)/2 <= m < sqrt(2) */
+		ix = (u_int32_t)hx - 0x3f3504f3;
+		k = (float)((int32_t)ix >> 23);
+		SET_FLOAT_WORD(f, (ix & 0x007fffff) + 0x3f3504f3);
+		f -= 1.0f;
+
+		z = f*f;
+		p = P1 + f*(P2 + f*(P3 + f*(P4 + f*(P5 + f*(P6 +
+		    f*(P7 + f*(P8 + f*P9)))))));
+		y[i] = (f + (f*z*p + k*ln2LO - 0.5f*z)) + k*ln2HI;
+	}
+	if (!bad)
+		return;
+
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(hx, x[i]);
+		if ((u_int32_t)hx - 0x00800000 >= 0x7f000000)
+			y[i] = logf(x[i]);
+	}
+}
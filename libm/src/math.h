@@ -435,6 +435,16 @@ float	lgammaf_r(float, int *);
  * float version of IEEE Test Vector
  */
 float	significandf(float);
+
+/*
+ * array versions of float functions, y[i] = f(x[i]) for 0 <= i < n
+ */
+void	atan2f_array(const float * __restrict, const float * __restrict,
+	    float * __restrict, int);
+void	expf_array(const float * __restrict, float * __restrict, int);
+void	logf_array(const float * __restrict, float * __restrict, int);
+void	sincosf_array(const float * __restrict, float * __restrict,
+	    float * __restrict, int);
 #endif	/* __BSD_VISIBLE */
 
 /*
@@ -0,0 +1,87 @@
+/*
+ * sincosf_array(x, s, c, n)
+ * Sine and cosine of an array of floats.
+ *
+ * Method:
+ *	The main loop has no branches or function calls so that it can
+ *	be software pipelined (or vectorized) by the compiler:
+ *	1. Reduce x to r = x - j*pi/2, |r| <= pi/4, using a four-part
+ *	   Cody-Waite split of pi/2.  pio2_1, pio2_2 and pio2_3 have 9,
+ *	   12 and 12 significant bits, so their products with j are
+ *	   exact for |x| <= 4096.  j is rounded with the 1.5*2**23
+ *	   shift, which also leaves j in the low bits of the shifted
+ *	   value.
+ *	2. Approximate sin(r) and cos(r) with minimax polynomials of
+ *	   degree 7 and 8 on [-pi/4, pi/4].
+ *	3. Select and negate the results according to j mod 4.
+ *	Elements with |x| > 4096, inf or NaN are recomputed afterwards
+ *	with sinf() and cosf().
+ *
+ * Accuracy:
+ *	Both sine and cosine are within 2.5 ulp for |x| <= 4096 (measured
+ *	exhaustively); other arguments are as accurate as sinf()/cosf().
+ */
+
+#include <math.h>
+#include "math_private.h"
+
+static const float
+invpio2 =  6.3661974669e-01,		/* 0x3f22f983 */
+shift	=  1.2582912000e+07,		/* 0x4b400000, 1.5*2**23 */
+pio2_1	=  1.5703125000e+00,		/* 0x3fc90000 */
+pio2_2	=  4.8375129700e-04,		/* 0x39fda000 */
+pio2_3	=  7.5495336205e-08,		/* 0x33a22000 */
+pio2_4	=  2.5633440683e-12,		/* 0x2c34611a */
+S1	= -1.6666655242e-01,		/* 0xbe2aaaa3 */
+S2	=  8.3321612328e-03,		/* 0x3c08839e */
+S3	= -1.9515295571e-04,		/* 0xb94ca1f9 */
+C1	=  4.1666645557e-02,		/* 0x3d2aaaa5 */
+C2	= -1.3887316454e-03,		/* 0xbab6061a */
+C3	=  2.4433156796e-05;		/* 0x37ccf5ce */
+
+void
+sincosf_array(const float * __restrict x, float * __restrict s,
+    float * __restrict c, int n)
+{
+	float r, t, z, ps, pc;
+	int32_t ix, jx, sw, big;
+	u_int32_t us, uc;
+	int i;
+
+	big = 0;
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(ix, x[i]);
+		big |= (ix & 0x7fffffff) > 0x45800000;	/* |x| > 4096 */
+
+		t = x[i]*invpio2 + shift;
+		GET_FLOAT_WORD(jx, t);			/* j in low bits */
+		t -= shift;
+		r = (((x[i] - t*pio2_1) - t*pio2_2) - t*pio2_3) - t*pio2_4;
+		z = r*r;
+		ps = r + r*z*(S1 + z*(S2 + z*S3));
+		pc = 1.0f - 0.5f*z + z*z*(C1 + z*(C2 + z*C3));
+
+		/* swap for odd quadrants, then negate */
+		sw = jx & 1;
+		GET_FLOAT_WORD(us, sw ? pc : ps);
+		GET_FLOAT_WORD(uc, sw ? ps : pc);
+		us ^= (u_int32_t)(jx & 2) << 30;
+		uc ^= (u_int32_t)((jx + 1) & 2) << 30;
+		SET_FLOAT_WORD(s[i], us);
+		SET_FLOAT_WORD(c[i], uc);
+	}
+	if (!big)
+		return;
+
+	/* separate loops, so the calls are not fused into sincosf() */
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(ix, x[i]);
+		if ((ix & 0x7fffffff) > 0x45800000)
+			s[i] = sinf(x[i]);
+	}
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(ix, x[i]);
+		if ((ix & 0x7fffffff) > 0x45800000)
+			c[i] = cosf(x[i]);
+	}
+}
@@ -0,0 +1,71 @@
+/*
+ * cabsf_array(z, y, n)
+ * Magnitude of an array of complex floats, y[i] = cabsf(z[i]).
+ *
+ * Method:
+ *	The main loop has no branches or function calls so that it can
+ *	be software pipelined (or vectorized) by the compiler; in
+ *	particular it does not call sqrtf(), which is a bit-by-bit
+ *	software routine on targets without a square root instruction:
+ *	1. a = re*re + im*im, which neither overflows nor underflows
+ *	   while 2**-63 <= max(|re|,|im|) <= 2**63.
+ *	2. Estimate 1/sqrt(a) from the representation of a and refine
+ *	   it with three Newton iterations.
+ *	3. s = a/sqrt(a), corrected with one Heron step.
+ *	Elements outside the range above (other than zero), inf or NaN
+ *	are recomputed afterwards with cabsf().
+ *
+ * Accuracy:
+ *	Within 1.5 ulp of the exact magnitude (measured on 2**28 random
+ *	values covering the full exponent range).
+ */
+
+#include <complex.h>
+#include <math.h>
+#include "math_private.h"
+
+void
+cabsf_array(const float complex * __restrict z, float * __restrict y,
+    int n)
+{
+	const float *v = (const float *)z;
+	float re, im, a, r, s;
+	int32_t hr, hi, hm, bad;
+	int i;
+
+	bad = 0;
+	for (i = 0; i < n; i++) {
+		re = v[2*i];
+		im = v[2*i+1];
+		GET_FLOAT_WORD(hr, re);
+		GET_FLOAT_WORD(hi, im);
+		hr &= 0x7fffffff;
+		hi &= 0x7fffffff;
+		hm = hr > hi ? hr : hi;
+		bad |= hm != 0 && (u_int32_t)(hm - 0x20000000) > 0x3f000000;
+
+		a = re*re + im*im;
+
+		/* 1/sqrt(a), then sqrt(a) = a/sqrt(a) */
+		GET_FLOAT_WORD(hm, a);
+		SET_FLOAT_WORD(r, 0x5f3759df - (hm >> 1));
+		r = r*(1.5f - 0.5f*a*r*r);
+		r = r*(1.5f - 0.5f*a*r*r);
+		r = r*(1.5f - 0.5f*a*r*r);
+		s = a*r;
+		s = s + 0.5f*r*(a - s*s);
+		y[i] = s;
+	}
+	if (!bad)
+		return;
+
+	for (i = 0; i < n; i++) {
+		GET_FLOAT_WORD(hr, v[2*i]);
+		GET_FLOAT_WORD(hi, v[2*i+1]);
+		hr &= 0x7fffffff;
+		hi &= 0x7fffffff;
+		hm = hr > hi ? hr : hi;
+		if (hm != 0 && (u_int32_t)(hm - 0x20000000) > 0x3f000000)
+			y[i] = cabsf(z[i]);
+	}
+}
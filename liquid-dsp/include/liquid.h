@@ -132,6 +132,20 @@ void AGC(_apply_gain)(AGC() _q, TC * _y);                       \
 /* same as running push(), apply_gain() */                      \
 void AGC(_execute)(AGC() _q, TC _x, TC *_y);                    \
                                                                 \
+/* execute on block of samples: estimate energy over block, */  \
+/* step the loop filter once (with the same time constant   */  \
+/* as _n single-sample updates) and apply a gain linearly   */  \
+/* interpolated from the previous to the new value; squelch */  \
+/* is updated once per block                                */  \
+/*  _q  :   agc object                                      */  \
+/*  _x  :   input samples [size: _n x 1]                    */  \
+/*  _n  :   number of input, output samples                 */  \
+/*  _y  :   output samples [size: _n x 1], may equal _x     */  \
+void AGC(_execute_block)(AGC()        _q,                       \
+                         TC *         _x,                       \
+                         unsigned int _n,                       \
+                         TC *         _y);                      \
+                                                                \
 /* Return signal level (linear) relative to unity energy */     \
 T AGC(_get_signal_level)(AGC() _q);                             \
                                                                 \
@@ -155,6 +169,52 @@ int  AGC(_squelch_get_status)(AGC() _q);
 LIQUID_AGC_DEFINE_API(AGC_MANGLE_CRCF, float, liquid_float_complex)
 LIQUID_AGC_DEFINE_API(AGC_MANGLE_RRRF, float, float)
 
+// 
+// agc bank: independent gain control of many channels, with
+// per-channel state kept in structure-of-arrays form
+//
+
+#define AGC_BANK_MANGLE_CRCF(name)  LIQUID_CONCAT(agc_bank_crcf, name)
+#define AGC_BANK_MANGLE_RRRF(name)  LIQUID_CONCAT(agc_bank_rrrf, name)
+
+// large macro
+//   AGC_BANK   : name-mangling macro
+//   T          : primitive data type
+//   TC         : input/output data type
+#define LIQUID_AGC_BANK_DEFINE_API(AGC_BANK,T,TC)               \
+typedef struct AGC_BANK(_s) * AGC_BANK();                       \
+                                                                \
+/* create bank of _num_channels gain controllers            */  \
+AGC_BANK() AGC_BANK(_create)(unsigned int _num_channels);       \
+void AGC_BANK(_destroy)(AGC_BANK() _q);                         \
+void AGC_BANK(_print)(AGC_BANK() _q);                           \
+void AGC_BANK(_reset)(AGC_BANK() _q);                           \
+                                                                \
+/* set gain limits, loop filter bandwidth (all channels)    */  \
+void AGC_BANK(_set_gain_limits)(AGC_BANK() _q,                  \
+                                T          _gmin,               \
+                                T          _gmax);              \
+void AGC_BANK(_set_bandwidth)(AGC_BANK() _q, T _bt);            \
+                                                                \
+/* execute on a block of samples from all channels, with    */  \
+/* the same block semantics as agc_xxxt_execute_block()     */  \
+/*  _q  :   agc bank object                                 */  \
+/*  _x  :   input, time-major [size: _n x _num_channels]    */  \
+/*  _n  :   number of samples per channel                   */  \
+/*  _y  :   output, time-major [size: _n x _num_channels]   */  \
+/*          (may equal _x)                                  */  \
+void AGC_BANK(_execute_block)(AGC_BANK()   _q,                  \
+                              TC *         _x,                  \
+                              unsigned int _n,                  \
+                              TC *         _y);                 \
+                                                                \
+/* return gain, signal level (dB) of a particular channel   */  \
+T AGC_BANK(_get_gain)(AGC_BANK() _q, unsigned int _channel);    \
+T AGC_BANK(_get_rssi)(AGC_BANK() _q, unsigned int _channel);
+
+LIQUID_AGC_BANK_DEFINE_API(AGC_BANK_MANGLE_CRCF, float, liquid_float_complex)
+LIQUID_AGC_BANK_DEFINE_API(AGC_BANK_MANGLE_RRRF, float, float)
+
 
 
 //
@@ -462,6 +522,32 @@ void EQLMS(_step)(EQLMS() _q,                                   \
                   T       _d,                                   \
                   T       _d_hat);                              \
                                                                 \
+/* set number of symbols per weight update: _step()         */  \
+/* accumulates the update and applies its average once      */  \
+/* every _n calls (default: 1, update every symbol)         */  \
+/*  _q      :   equalizer object                            */  \
+/*  _n      :   block length, _n > 0                        */  \
+void EQLMS(_set_block_len)(EQLMS()      _q,                     \
+                           unsigned int _n);                    \
+                                                                \
+/* push block of _p samples (equalizer length) and compute  */  \
+/* outputs with the current weights using fast convolution  */  \
+/*  _q      :   equalizer object                            */  \
+/*  _x      :   input samples  [size: _p x 1]               */  \
+/*  _y      :   output samples [size: _p x 1]               */  \
+void EQLMS(_execute_block)(EQLMS() _q,                          \
+                           T *     _x,                          \
+                           T *     _y);                         \
+                                                                \
+/* step equalizer training over the block from the last     */  \
+/* call to _execute_block() (frequency-domain block LMS)    */  \
+/*  _q      :   equalizer object                            */  \
+/*  _d      :   desired outputs [size: _p x 1]              */  \
+/*  _d_hat  :   actual outputs  [size: _p x 1]              */  \
+void EQLMS(_step_block)(EQLMS() _q,                             \
+                        T *     _d,                             \
+                        T *     _d_hat);                        \
+                                                                \
 /* reset equalizer object, clearing internal state          */  \
 void EQLMS(_get_weights)(EQLMS() _q,                            \
                          T *     _w);                           \
@@ -570,9 +656,34 @@ int crc_validate_message(crc_scheme _scheme,
                          unsigned int _n,
                          unsigned int _key);
 
+// initialize streaming error-detection state; the key of a message
+// split into several pieces is computed by passing each piece in
+// order to crc_update() and the final state to crc_finalize()
+//
+//  _scheme     :   error-detection scheme
+unsigned int crc_init(crc_scheme _scheme);
+
+// update streaming error-detection state with message piece
+//
+//  _scheme     :   error-detection scheme
+//  _state      :   current state (from crc_init() or crc_update())
+//  _msg        :   input data message piece, [size: _n x 1]
+//  _n          :   input data message piece size
+unsigned int crc_update(crc_scheme _scheme,
+                        unsigned int _state,
+                        unsigned char * _msg,
+                        unsigned int _n);
+
+// finalize streaming error-detection state, returning key
+//
+//  _scheme     :   error-detection scheme
+//  _state      :   current state
+unsigned int crc_finalize(crc_scheme _scheme,
+                          unsigned int _state);
+
 
 // available FEC schemes
-#define LIQUID_FEC_NUM_SCHEMES  28
+#define LIQUID_FEC_NUM_SCHEMES  31
 typedef enum {
     LIQUID_FEC_UNKNOWN=0,       // unknown/unsupported scheme
     LIQUID_FEC_NONE,            // no error-correction
@@ -609,7 +720,12 @@ typedef enum {
     LIQUID_FEC_CONV_V29P78,     // r7/8, K=9, dfree=4
 
     // Reed-Solomon codes
-    LIQUID_FEC_RS_M8            // m=8, n=255, k=223
+    LIQUID_FEC_RS_M8,           // m=8, n=255, k=223
+
+    // low-density parity check codes (quasi-cyclic, n=768)
+    LIQUID_FEC_LDPC_R12,        // r1/2, n=768, k=384
+    LIQUID_FEC_LDPC_R23,        // r2/3, n=768, k=512
+    LIQUID_FEC_LDPC_R34         // r3/4, n=768, k=576
 } fec_scheme;
 
 // pretty names for fec schemes
@@ -865,6 +981,10 @@ typedef enum {
     LIQUID_FFT_IMDCT    =  31,  // IMDCT
 } liquid_fft_type;
 
+// fft planner flags
+#define LIQUID_FFT_ESTIMATE     (0)     // choose method heuristically (default)
+#define LIQUID_FFT_MEASURE      (1<<0)  // benchmark candidate methods
+
 #define LIQUID_FFT_MANGLE_FLOAT(name)   LIQUID_CONCAT(fft,name)
 
 // Macro    :   FFT
@@ -880,7 +1000,7 @@ typedef struct FFT(plan_s) * FFT(plan);                         \
 /*  _x      :   pointer to input array  [size: _n x 1]      */  \
 /*  _y      :   pointer to output array [size: _n x 1]      */  \
 /*  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)         */  \
-/*  _flags  :   options, optimization                       */  \
+/*  _flags  :   planner flags (e.g. LIQUID_FFT_MEASURE)     */  \
 FFT(plan) FFT(_create_plan)(unsigned int _n,                    \
                             TC *         _x,                    \
                             TC *         _y,                    \
@@ -941,6 +1061,26 @@ void FFT(_shift)(TC *         _x,                               \
 
 LIQUID_FFT_DEFINE_API(LIQUID_FFT_MANGLE_FLOAT,float,liquid_float_complex)
 
+// fft planner wisdom: methods chosen with LIQUID_FFT_MEASURE are
+// remembered (keyed by size and direction) and re-used by every
+// subsequent plan of the same size, regardless of its flags
+
+// clear all accumulated wisdom
+void liquid_fft_wisdom_forget();
+
+// get number of wisdom entries
+unsigned int liquid_fft_wisdom_get_num_entries();
+
+// print accumulated wisdom to stdout
+void liquid_fft_wisdom_print();
+
+// save accumulated wisdom to file, returning 0 on success
+int liquid_fft_wisdom_export(const char * _filename);
+
+// load wisdom from file, merging with existing entries and
+// returning 0 on success
+int liquid_fft_wisdom_import(const char * _filename);
+
 // antiquated fft methods
 // FFT(plan) FFT(_create_plan_mdct)(unsigned int _n,
 //                                  T * _x,
@@ -1736,6 +1876,18 @@ void FIRFILT(_push)(FIRFILT() _q,                               \
 void FIRFILT(_execute)(FIRFILT() _q,                            \
                        TO *      _y);                           \
                                                                 \
+/* execute the filter on a block of input samples; result  */  \
+/* and internal state are equivalent to running _push() and */  \
+/* _execute() on each sample                                */  \
+/*  _q      : filter object                                 */  \
+/*  _x      : input array [size: _n x 1]                    */  \
+/*  _n      : number of input, output samples               */  \
+/*  _y      : output array [size: _n x 1]                   */  \
+void FIRFILT(_execute_block)(FIRFILT()    _q,                   \
+                             TI *         _x,                   \
+                             unsigned int _n,                   \
+                             TO *         _y);                  \
+                                                                \
 /* return length of filter object                           */  \
 unsigned int FIRFILT(_get_length)(FIRFILT() _q);                \
                                                                 \
@@ -1768,6 +1920,74 @@ LIQUID_FIRFILT_DEFINE_API(FIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+//
+// FFT-based finite impulse response filter
+//
+
+#define FFTFILT_MANGLE_RRRF(name)  LIQUID_CONCAT(fftfilt_rrrf,name)
+#define FFTFILT_MANGLE_CRCF(name)  LIQUID_CONCAT(fftfilt_crcf,name)
+#define FFTFILT_MANGLE_CCCF(name)  LIQUID_CONCAT(fftfilt_cccf,name)
+
+// Macro:
+//   FFTFILT : name-mangling macro
+//   TO         : output data type
+//   TC         : coefficients data type
+//   TI         : input data type
+#define LIQUID_FFTFILT_DEFINE_API(FFTFILT,TO,TC,TI)             \
+typedef struct FFTFILT(_s) * FFTFILT();                         \
+                                                                \
+/* create FFT-based FIR filter using external coefficients  */  \
+/*  _h      : filter coefficients [size: _h_len x 1]        */  \
+/*  _h_len  : filter length, _h_len > 0                     */  \
+/*  _n      : block size = nfft/2, at least _h_len-1        */  \
+FFTFILT() FFTFILT(_create)(TC *         _h,                     \
+                           unsigned int _h_len,                 \
+                           unsigned int _n);                    \
+                                                                \
+/* destroy filter object and free all internal memory       */  \
+void FFTFILT(_destroy)(FFTFILT() _q);                           \
+                                                                \
+/* reset filter object's internal buffer                    */  \
+void FFTFILT(_reset)(FFTFILT() _q);                             \
+                                                                \
+/* print filter object information                          */  \
+void FFTFILT(_print)(FFTFILT() _q);                             \
+                                                                \
+/* set output scaling for filter                            */  \
+void FFTFILT(_set_scale)(FFTFILT() _q,                          \
+                         TC        _g);                         \
+                                                                \
+/* execute the filter on one block of input samples;        */  \
+/* in-place operation is permitted (_x and _y may be the    */  \
+/* same array)                                              */  \
+/*  _q      : filter object                                 */  \
+/*  _x      : pointer to input data array  [size: _n x 1]   */  \
+/*  _y      : pointer to output data array [size: _n x 1]   */  \
+void FFTFILT(_execute)(FFTFILT() _q,                            \
+                       TI *      _x,                            \
+                       TO *      _y);                           \
+                                                                \
+/* return length of filter object's internal coefficients   */  \
+unsigned int FFTFILT(_get_length)(FFTFILT() _q);                \
+                                                                \
+/* return block size (number of samples per _execute())     */  \
+unsigned int FFTFILT(_get_block_size)(FFTFILT() _q);            \
+
+LIQUID_FFTFILT_DEFINE_API(FFTFILT_MANGLE_RRRF,
+                          float,
+                          float,
+                          float)
+
+LIQUID_FFTFILT_DEFINE_API(FFTFILT_MANGLE_CRCF,
+                          liquid_float_complex,
+                          float,
+                          liquid_float_complex)
+
+LIQUID_FFTFILT_DEFINE_API(FFTFILT_MANGLE_CCCF,
+                          liquid_float_complex,
+                          liquid_float_complex,
+                          liquid_float_complex)
+
 //
 // FIR Hilbert transform
 //  2:1 real-to-complex decimator
@@ -3397,6 +3617,28 @@ int detector_cccf_correlate(detector_cccf        _q,
                             float *              _dphi_hat,
                             float *              _gamma_hat);
 
+// Run block of samples through pre-demod detector, stopping at the
+// first detection; searches all carrier offsets at once with
+// FFT-based correlators, only refining candidate peaks (gated by the
+// coarse search) in the time domain. Equivalent in practice to
+// running each sample through detector_cccf_correlate(), but not
+// sample-exact. Returns '1' if signal was detected, '0' otherwise
+//  _q          :   pre-demod detector
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _num_read   :   number of samples consumed (up to and including
+//                  the detection, otherwise _n)
+//  _tau_hat    :   fractional sample offset estimate (set when detected)
+//  _dphi_hat   :   carrier frequency offset estimate (set when detected)
+//  _gamma_hat  :   channel gain estimate (set when detected)
+int detector_cccf_correlate_block(detector_cccf          _q,
+                                  liquid_float_complex * _x,
+                                  unsigned int           _n,
+                                  unsigned int *         _num_read,
+                                  float *                _tau_hat,
+                                  float *                _dphi_hat,
+                                  float *                _gamma_hat);
+
 
 //
 // MODULE : math
@@ -3837,6 +4079,32 @@ void MATRIX(_ludecomp_doolittle)(T * _x,                        \
                                  T * _L,                        \
                                  T * _U,                        \
                                  T * _P);                       \
+                                                                \
+/* L/U decomposition with partial pivoting, in place: on    */  \
+/* return _x holds U on and above the diagonal and the      */  \
+/* unit-diagonal L below it                                 */  \
+/*  _x      : input/output matrix [size: _n x _n]           */  \
+/*  _n      : matrix size                                   */  \
+/*  _piv    : row interchanges [size: _n x 1], row k is     */  \
+/*            swapped with row _piv[k] at step k            */  \
+void MATRIX(_lufactor)(T *            _x,                       \
+                       unsigned int   _n,                       \
+                       unsigned int * _piv);                    \
+                                                                \
+/* solve _A*_y = _b given the factors of _A from            */  \
+/* _lufactor(), so that one factorization can be reused     */  \
+/*  _x      : factored matrix [size: _n x _n]               */  \
+/*  _n      : matrix size                                   */  \
+/*  _piv    : row interchanges from _lufactor()             */  \
+/*  _b      : right-hand sides, overwritten with solution   */  \
+/*            [size: _n x _nrhs]                            */  \
+/*  _nrhs   : number of right-hand sides (columns of _b)    */  \
+void MATRIX(_lusolve)(T *            _x,                        \
+                      unsigned int   _n,                        \
+                      unsigned int * _piv,                      \
+                      T *            _b,                        \
+                      unsigned int   _nrhs);                    \
+                                                                \
 void MATRIX(_gramschmidt)(T * _A,                               \
                           unsigned int _rx,                     \
                           unsigned int _cx,                     \
@@ -3849,6 +4117,43 @@ void MATRIX(_qrdecomp_gramschmidt)(T * _x,                      \
 void MATRIX(_chol)(T * _A,                                      \
                    unsigned int _n,                             \
                    T * _L);                                     \
+                                                                \
+/* Batched operations on _num independent small matrices,  */  \
+/* stored as structure-of-arrays: element (r,c) of matrix   */  \
+/* k is at _A[(r*_n+c)*_num + k] and element r of vector k  */  \
+/* is at _b[r*_num + k]. A singular matrix in the batch     */  \
+/* produces a warning, not an error; the other results are  */  \
+/* unaffected.                                              */  \
+                                                                \
+/* solve linear systems _A[k]*_x[k] = _b[k]                 */  \
+/*  _A      : input matrices [size: _n x _n x _num]         */  \
+/*  _n      : system size                                   */  \
+/*  _b      : equality vectors [size: _n x _num]            */  \
+/*  _x      : solution vectors [size: _n x _num]            */  \
+/*  _num    : number of systems                             */  \
+void MATRIX(_linsolve_batch)(T *          _A,                   \
+                             unsigned int _n,                   \
+                             T *          _b,                   \
+                             T *          _x,                   \
+                             unsigned int _num);                \
+                                                                \
+/* invert square matrices in place                          */  \
+/*  _X      : input/output matrices [size: _n x _n x _num]  */  \
+/*  _n      : matrix size                                   */  \
+/*  _num    : number of matrices                            */  \
+void MATRIX(_inv_batch)(T *          _X,                        \
+                        unsigned int _n,                        \
+                        unsigned int _num);                     \
+                                                                \
+/* Cholesky decomposition of positive-definite matrices     */  \
+/*  _A      : input matrices [size: _n x _n x _num]         */  \
+/*  _n      : matrix size                                   */  \
+/*  _L      : output lower-triangular matrices              */  \
+/*  _num    : number of matrices                            */  \
+void MATRIX(_chol_batch)(T *          _A,                       \
+                         unsigned int _n,                       \
+                         T *          _L,                       \
+                         unsigned int _num);                    \
 
 #define matrix_access(X,R,C,r,c) ((X)[(r)*(C)+(c)])
 
@@ -3906,6 +4211,15 @@ int SMATRIX(_isset)(SMATRIX()    _q,                            \
                     unsigned int _m,                            \
                     unsigned int _n);                           \
                                                                 \
+/* get column indices of non-zero elements in row _m, sorted */ \
+/* in ascending order, returning the number of elements      */ \
+/*  _q      :   sparse matrix                                */ \
+/*  _m      :   row index                                    */ \
+/*  _idx    :   output indices [size: _N x 1]                */ \
+unsigned int SMATRIX(_get_row_indices)(SMATRIX()      _q,       \
+                                       unsigned int   _m,       \
+                                       unsigned int * _idx);    \
+                                                                \
 /* inserts/deletes element at index (memory allocation) */      \
 void SMATRIX(_insert)(SMATRIX()    _q,                          \
                       unsigned int _m,                          \
@@ -4153,6 +4467,40 @@ void MODEM(_demodulate_soft)(MODEM() _q,                        \
                              unsigned int  * _s,                \
                              unsigned char * _soft_bits);       \
                                                                 \
+/* modulate block of symbols                                */  \
+/*  _q  :   modem object                                    */  \
+/*  _s  :   input symbols [size: _n x 1]                    */  \
+/*  _n  :   number of symbols                               */  \
+/*  _y  :   output samples [size: _n x 1]                   */  \
+void MODEM(_modulate_block)(MODEM()        _q,                  \
+                            unsigned int * _s,                  \
+                            unsigned int   _n,                  \
+                            TC *           _y);                 \
+                                                                \
+/* hard-decision demodulation of block of samples; the      */  \
+/* demodulator state (e.g. phase error) is that of the last */  \
+/* sample in the block                                      */  \
+/*  _q  :   modem object                                    */  \
+/*  _x  :   input samples [size: _n x 1]                    */  \
+/*  _n  :   number of samples                               */  \
+/*  _s  :   output symbols [size: _n x 1]                   */  \
+void MODEM(_demodulate_block)(MODEM()        _q,                \
+                              TC *           _x,                \
+                              unsigned int   _n,                \
+                              unsigned int * _s);               \
+                                                                \
+/* soft-decision demodulation of block of samples           */  \
+/*  _q          :   modem object                            */  \
+/*  _x          :   input samples [size: _n x 1]            */  \
+/*  _n          :   number of samples                       */  \
+/*  _s          :   output hard symbols [size: _n x 1]      */  \
+/*  _soft_bits  :   output soft bits [size: _n*bps x 1]     */  \
+void MODEM(_demodulate_soft_block)(MODEM()         _q,          \
+                                   TC *            _x,          \
+                                   unsigned int    _n,          \
+                                   unsigned int *  _s,          \
+                                   unsigned char * _soft_bits); \
+                                                                \
 /* get demodulator's estimated transmit sample */               \
 void MODEM(_get_demodulator_sample)(MODEM() _q,                 \
                                     TC * _x_hat);               \
@@ -4257,6 +4605,23 @@ typedef enum {
     LIQUID_FREQDEM_DELAYCONJ    // delay/conjugate method
 } liquid_freqdem_type;
 
+// frequency discriminator for delay/conjugate demodulator
+typedef enum {
+    LIQUID_FREQDEM_DISC_ARG=0,  // cargf() of conjugate product (default)
+    LIQUID_FREQDEM_DISC_ATAN3,  // 3rd-order arctan, error < 5e-3 rad
+    LIQUID_FREQDEM_DISC_ATAN7,  // 7th-order arctan, error < 1e-4 rad
+    LIQUID_FREQDEM_DISC_ATAN11, // 11th-order arctan, error < 2e-6 rad
+    LIQUID_FREQDEM_DISC_QUAD    // quadrature, sin(dphi), no arctan
+} liquid_freqdem_disc;
+
+// The quadrature discriminator computes Im{conj(x[n-1])*x[n]}
+// normalized by the mean energy 0.5*(|x[n-1]|^2 + |x[n]|^2) rather
+// than the one-multiply (unnormalized) form, so its output does not
+// scale with the signal power; this costs one divide per sample. It
+// returns sin(dphi), with error dphi - sin(dphi) ~ dphi^3/6 (about
+// 2e-2 rad at dphi = 0.5) plus any envelope change between samples,
+// and is roughly 2.5x cheaper than ATAN11 on the SIMD kernels.
+
 #define LIQUID_FREQDEM_MANGLE_FLOAT(name) LIQUID_CONCAT(freqdem,name)
 
 // Macro    :   FREQDEM (analog frequency modulator)
@@ -4283,6 +4648,16 @@ void FREQDEM(_print)(FREQDEM() _q);                             \
 /* reset state                                              */  \
 void FREQDEM(_reset)(FREQDEM() _q);                             \
                                                                 \
+/* set discriminator used by the delay/conjugate method;    */  \
+/* the polynomial arctangents and the quadrature method     */  \
+/* trade accuracy for speed, the latter approximating the   */  \
+/* phase difference by its sine (valid for small deviation  */  \
+/* and constant envelope)                                   */  \
+/*  _q      :   frequency demodulator object                */  \
+/*  _disc   :   discriminator type                          */  \
+void FREQDEM(_set_discriminator)(FREQDEM()          _q,         \
+                                 liquid_freqdem_disc _disc);    \
+                                                                \
 /* demodulate sample                                        */  \
 /*  _q      :   frequency modulator object                  */  \
 /*  _r      :   received signal r(t)                        */  \
@@ -4290,6 +4665,17 @@ void FREQDEM(_reset)(FREQDEM() _q);                             \
 void FREQDEM(_demodulate)(FREQDEM() _q,                         \
                           TC        _r,                         \
                           T *       _m);                        \
+                                                                \
+/* demodulate block of samples; result and internal state   */  \
+/* are equivalent to running _demodulate() on each sample   */  \
+/*  _q      :   frequency demodulator object                */  \
+/*  _r      :   received signal r(t) [size: _n x 1]         */  \
+/*  _n      :   number of input, output samples             */  \
+/*  _m      :   output message signal m(t) [size: _n x 1]   */  \
+void FREQDEM(_demodulate_block)(FREQDEM()    _q,                \
+                                TC *         _r,                \
+                                unsigned int _n,                \
+                                T *          _m);               \
 
 // define freqmod APIs
 LIQUID_FREQDEM_DEFINE_API(LIQUID_FREQDEM_MANGLE_FLOAT,float,liquid_float_complex)
@@ -4406,6 +4792,16 @@ void FIRPFBCH(_reset)(FIRPFBCH() _q);                           \
 /* print firpfbch internal parameters to stdout             */  \
 void FIRPFBCH(_print)(FIRPFBCH() _q);                           \
                                                                 \
+/* set active channels; analyzer outputs on inactive       */  \
+/* channels are zero and synthesizer inputs on them are     */  \
+/* ignored. An analyzer with few active channels computes   */  \
+/* them directly rather than with the full transform.       */  \
+/*  _q      : filterbank channelizer object                 */  \
+/*  _mask   : active channel mask [size: num_channels x 1], */  \
+/*            or NULL to activate all channels              */  \
+void FIRPFBCH(_set_channel_mask)(FIRPFBCH()      _q,            \
+                                 unsigned char * _mask);        \
+                                                                \
 /* execute filterbank as synthesizer on block of samples    */  \
 /*  _q      : filterbank channelizer object                 */  \
 /*  _x      : channelized input, [size: num_channels x 1]   */  \
@@ -4421,6 +4817,19 @@ void FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,              \
 void FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,                 \
                                  TI *       _x,                 \
                                  TO *       _y);                \
+                                                                \
+/* execute filterbank as analyzer on several frames; same   */  \
+/* result as running _analyzer_execute() on each frame      */  \
+/*  _q          : filterbank channelizer object             */  \
+/*  _x          : input time series                         */  \
+/*                [size: _num_frames*num_channels x 1]      */  \
+/*  _num_frames : number of frames                          */  \
+/*  _y          : channelized output                        */  \
+/*                [size: _num_frames*num_channels x 1]      */  \
+void FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,         \
+                                       TI *         _x,         \
+                                       unsigned int _num_frames,\
+                                       TO *         _y);        \
 
 
 LIQUID_FIRPFBCH_DEFINE_API(FIRPFBCH_MANGLE_CRCF,
@@ -4478,6 +4887,16 @@ void FIRPFBCH2(_reset)(FIRPFBCH2() _q);                         \
 /* print firpfbch2 object internals                         */  \
 void FIRPFBCH2(_print)(FIRPFBCH2() _q);                         \
                                                                 \
+/* set active channels; analyzer outputs on inactive       */  \
+/* channels are zero and synthesizer inputs on them are     */  \
+/* ignored. An analyzer with few active channels computes   */  \
+/* them directly rather than with the full transform.       */  \
+/*  _q      :   filterbank channelizer object               */  \
+/*  _mask   :   active channel mask [size: M x 1], or NULL  */  \
+/*              to activate all channels                    */  \
+void FIRPFBCH2(_set_channel_mask)(FIRPFBCH2()     _q,           \
+                                  unsigned char * _mask);       \
+                                                                \
 /* execute filterbank channelizer                           */  \
 /* LIQUID_ANALYZER:     input: M/2, output: M               */  \
 /* LIQUID_SYNTHESIZER:  input: M,   output: M/2             */  \
@@ -4486,6 +4905,18 @@ void FIRPFBCH2(_print)(FIRPFBCH2() _q);                         \
 void FIRPFBCH2(_execute)(FIRPFBCH2() _q,                        \
                          TI *        _x,                        \
                          TO *        _y);                       \
+                                                                \
+/* execute filterbank channelizer on several frames; same   */  \
+/* result as running _execute() on each frame               */  \
+/*  _x          :   input [size: _num_frames*M/2 x 1]       */  \
+/*                  (synthesizer: _num_frames*M x 1)        */  \
+/*  _num_frames :   number of frames                        */  \
+/*  _y          :   output [size: _num_frames*M x 1]        */  \
+/*                  (synthesizer: _num_frames*M/2 x 1)      */  \
+void FIRPFBCH2(_execute_block)(FIRPFBCH2()  _q,                 \
+                               TI *         _x,                 \
+                               unsigned int _num_frames,        \
+                               TO *         _y);                \
 
 
 LIQUID_FIRPFBCH2_DEFINE_API(FIRPFBCH2_MANGLE_CRCF,
@@ -4611,11 +5042,14 @@ void ofdmframesync_debug_print(ofdmframesync _q, const char * _filename);
 //
 
 // oscillator type
-//  LIQUID_NCO  :   numerically-controlled oscillator (fast)
-//  LIQUID_VCO  :   "voltage"-controlled oscillator (precise)
+//  LIQUID_NCO      :   numerically-controlled oscillator (fast)
+//  LIQUID_VCO      :   "voltage"-controlled oscillator (precise)
+//  LIQUID_NCO_FIXED:   32-bit fixed-point phase accumulator with
+//                      two-level sine table (fast, high resolution)
 typedef enum {
     LIQUID_NCO=0,
-    LIQUID_VCO
+    LIQUID_VCO,
+    LIQUID_NCO_FIXED
 } liquid_ncotype;
 
 #define NCO_MANGLE_FLOAT(name)  LIQUID_CONCAT(nco_crcf, name)
@@ -4651,6 +5085,10 @@ T NCO(_cos)(NCO() _q);                                          \
 void NCO(_sincos)(NCO() _q, T* _s, T* _c);                      \
 void NCO(_cexpf)(NCO() _q, TC * _y);                            \
                                                                 \
+/* compute complex exponential of internal phase for    */      \
+/* each of _N samples (stepping)                        */      \
+void NCO(_cexpf_block)(NCO() _q, TC * _y, unsigned int _N);     \
+                                                                \
 /* pll : phase-locked loop                              */      \
 void NCO(_pll_set_bandwidth)(NCO() _q, T _b);                   \
 void NCO(_pll_step)(NCO() _q, T _dphi);                         \
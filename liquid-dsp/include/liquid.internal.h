@@ -84,6 +84,30 @@ LIQUID_AGC_DEFINE_INTERNAL_API(AGC_MANGLE_RRRF, float, float)
 // MODULE : dotprod
 //
 
+// x86 SIMD kernel levels, selected at run time
+#define LIQUID_SIMD_SSE     (0) // SSE2/SSE3 (always available)
+#define LIQUID_SIMD_AVX2    (1) // AVX2 with fused multiply-add
+#define LIQUID_SIMD_AVX512  (2) // AVX-512F
+
+// string names for SIMD levels
+extern const char * liquid_simd_str[3];
+
+// highest SIMD level supported by both the build and the host CPU
+int liquid_simd_level(void);
+
+// AVX2/FMA kernels (src/dotprod/src/*.avx.c); complex coefficients
+// are stored with each value repeated as in the *.mmx.c objects
+void dotprod_rrrf_run_avx(float * _h, float * _x, unsigned int _n, float * _y);
+void dotprod_crcf_run_avx(float * _h, float complex * _x, unsigned int _n, float complex * _y);
+void dotprod_cccf_run_avx(float * _hi, float * _hq, float complex * _x, unsigned int _n, float complex * _y);
+float liquid_sumsqf_avx(float * _v, unsigned int _n);
+
+// AVX-512 kernels (src/dotprod/src/*.avx512.c)
+void dotprod_rrrf_run_avx512(float * _h, float * _x, unsigned int _n, float * _y);
+void dotprod_crcf_run_avx512(float * _h, float complex * _x, unsigned int _n, float complex * _y);
+void dotprod_cccf_run_avx512(float * _hi, float * _hq, float complex * _x, unsigned int _n, float complex * _y);
+float liquid_sumsqf_avx512(float * _v, unsigned int _n);
+
 
 //
 // MODULE : fec (forward error-correction)
@@ -102,6 +126,18 @@ unsigned int crc16_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc24_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc32_generate_key(unsigned char * _msg, unsigned int _msg_len);
 
+// update running crc register with message (slicing-by-8)
+unsigned int crc8_update(unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+unsigned int crc16_update(unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+unsigned int crc24_update(unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+unsigned int crc32_update(unsigned int _key, unsigned char * _msg, unsigned int _msg_len);
+
+// slicing-by-8 lookup tables (see sandbox/crc_gentab.c)
+extern const unsigned char      crc8_gentab[8][256];
+extern const unsigned short int crc16_gentab[8][256];
+extern const unsigned int       crc24_gentab[8][256];
+extern const unsigned int       crc32_gentab[8][256];
+
 
 // fec : basic object
 struct fec_s {
@@ -155,6 +191,16 @@ struct fec_s {
     int * derrlocs;             // decoded error locations [size: 1 x n]
     int erasures;               // number of erasures
 
+    // LDPC (quasi-cyclic, dual-diagonal parity; uses the block
+    // lengths above)
+    const signed char * ldpc_base;  // base matrix shifts (-1: zero block)
+    unsigned int ldpc_mb;       // base matrix rows
+    unsigned int ldpc_nb;       // base matrix columns
+    unsigned int ldpc_Z;        // circulant (lifting) size
+    struct ldpc_s * ldpc;       // LDPC decoder object
+    unsigned char * ldpc_bits;  // codeword bits [size: nb*Z x 1]
+    float * ldpc_LLR;           // codeword log-likelihoods [size: nb*Z x 1]
+
     // encode function pointer
     void (*encode_func)(fec _q,
                         unsigned int _dec_msg_len,
@@ -180,6 +226,7 @@ int fec_scheme_is_punctured(fec_scheme _scheme);
 int fec_scheme_is_reedsolomon(fec_scheme _scheme);
 int fec_scheme_is_hamming(fec_scheme _scheme);
 int fec_scheme_is_repeat(fec_scheme _scheme);
+int fec_scheme_is_ldpc(fec_scheme _scheme);
 
 // Pass
 fec fec_pass_create(void *_opts);
@@ -322,6 +369,27 @@ unsigned int golay2412_matrix_mul(unsigned int   _v,
 // search for p[i] such that w(v+p[i]) <= 2, return -1 on fail
 int golay2412_parity_search(unsigned int _v);
 
+// estimate 24-bit error vector from 12-bit syndrome (reference
+// algorithm used to generate golay2412_dec_gentab)
+unsigned int golay2412_estimate_ehat(unsigned int _s);
+
+// byte-sliced encoding/syndrome tables and syndrome-to-error-pattern
+// table (see sandbox/fec_syndrome_gentab.c)
+extern const unsigned int       golay2412_enc_gentab[2][64];
+extern const unsigned short int golay2412_syndrome_gentab[3][256];
+extern const unsigned short int golay2412_dec_gentab[4096];
+
+// encode/decode arrays of three-byte blocks, each as two symbols
+//  _msg_dec    :   decoded message [size: 3*_n x 1]
+//  _n          :   number of blocks
+//  _msg_enc    :   encoded message [size: 6*_n x 1]
+void fec_golay2412_encode_array(unsigned char * _msg_dec,
+                                unsigned int    _n,
+                                unsigned char * _msg_enc);
+void fec_golay2412_decode_array(unsigned char * _msg_enc,
+                                unsigned int    _n,
+                                unsigned char * _msg_dec);
+
 fec fec_golay2412_create(void *_opts);
 void fec_golay2412_destroy(fec _q);
 void fec_golay2412_print(fec _q);
@@ -366,6 +434,20 @@ extern unsigned char secded2216_P[12];
 // syndrome vectors of errors with weight exactly equal to 1
 extern unsigned char secded2216_syndrome_w1[22];
 
+// byte-sliced parity tables and weight-1 error location table,
+// indexed by syndrome (see sandbox/fec_syndrome_gentab.c)
+extern const unsigned char secded2216_syndrome_gentab[2][256];
+extern const unsigned char secded2216_ehat_gentab[64];
+
+// decode array of encoded symbols, returning the number of symbols
+// for which multiple errors were detected
+//  _msg_enc    :   encoded message [size: 3*_n x 1]
+//  _n          :   number of symbols
+//  _msg_dec    :   decoded message [size: 2*_n x 1]
+unsigned int fec_secded2216_decode_array(unsigned char * _msg_enc,
+                                         unsigned int    _n,
+                                         unsigned char * _msg_dec);
+
 fec fec_secded2216_create(void *_opts);
 void fec_secded2216_destroy(fec _q);
 void fec_secded2216_print(fec _q);
@@ -410,6 +492,20 @@ extern unsigned char secded3932_P[28];
 // syndrome vectors of errors with weight exactly equal to 1
 extern unsigned char secded3932_syndrome_w1[39];
 
+// byte-sliced parity tables and weight-1 error location table,
+// indexed by syndrome (see sandbox/fec_syndrome_gentab.c)
+extern const unsigned char secded3932_syndrome_gentab[4][256];
+extern const unsigned char secded3932_ehat_gentab[128];
+
+// decode array of encoded symbols, returning the number of symbols
+// for which multiple errors were detected
+//  _msg_enc    :   encoded message [size: 5*_n x 1]
+//  _n          :   number of symbols
+//  _msg_dec    :   decoded message [size: 4*_n x 1]
+unsigned int fec_secded3932_decode_array(unsigned char * _msg_enc,
+                                         unsigned int    _n,
+                                         unsigned char * _msg_dec);
+
 fec fec_secded3932_create(void *_opts);
 void fec_secded3932_destroy(fec _q);
 void fec_secded3932_print(fec _q);
@@ -451,6 +547,20 @@ int fec_secded7264_decode_symbol(unsigned char * _sym_enc,
 extern unsigned char secded7264_P[64];
 extern unsigned char secded7264_syndrome_w1[72];
 
+// byte-sliced parity tables and weight-1 error location table,
+// indexed by syndrome (see sandbox/fec_syndrome_gentab.c)
+extern const unsigned char secded7264_syndrome_gentab[8][256];
+extern const unsigned char secded7264_ehat_gentab[256];
+
+// decode array of encoded symbols, returning the number of symbols
+// for which multiple errors were detected
+//  _msg_enc    :   encoded message [size: 9*_n x 1]
+//  _n          :   number of symbols
+//  _msg_dec    :   decoded message [size: 8*_n x 1]
+unsigned int fec_secded7264_decode_array(unsigned char * _msg_enc,
+                                         unsigned int    _n,
+                                         unsigned char * _msg_dec);
+
 fec fec_secded7264_create(void *_opts);
 void fec_secded7264_destroy(fec _q);
 void fec_secded7264_print(fec _q);
@@ -567,6 +677,108 @@ void fec_conv_init_v29p56(fec _q);
 void fec_conv_init_v29p67(fec _q);
 void fec_conv_init_v29p78(fec _q);
 
+// native Viterbi decoder, used for convolutional codes when libfec
+// is not available; methods match the viterbi function pointers
+// in struct fec_s
+typedef struct viterbi_s * viterbi;
+
+// add-compare-select kernel for one trellis step
+//  _m0     :   previous path metrics [size: _n x 1]
+//  _m1     :   new path metrics [size: _n x 1]
+//  _mask   :   expected polynomial outputs for even states, either
+//              0 or 0xff [size: _R x _n/2]
+//  _sym    :   soft input symbols [size: _R x 1]
+//  _R      :   primitive rate, inverted
+//  _n      :   number of states, 2^(K-1), multiple of 32
+//  _dec    :   packed path decisions [size: _n/32 x 1]
+typedef void (*viterbi_acs_kernel)(short int *     _m0,
+                                   short int *     _m1,
+                                   short int *     _mask,
+                                   unsigned char * _sym,
+                                   unsigned int    _R,
+                                   unsigned int    _n,
+                                   unsigned int *  _dec);
+
+struct viterbi_s {
+    unsigned int K;             // constraint length
+    unsigned int R;             // primitive rate, inverted
+    unsigned int num_states;    // number of states, 2^(K-1)
+    unsigned int num_words;     // decision words per step
+
+    short int * mask;           // expected outputs [R x num_states/2]
+    short int * metric[2];      // path metrics (ping-pong)
+    unsigned int * dec;         // decision history [window_len x num_words]
+    unsigned int window_len;    // decision history length (steps)
+    unsigned int tb_len;        // traceback depth before output (steps)
+
+    unsigned int len;           // decoded message length (bits)
+    unsigned char * out;        // decoded message [size: len/8 x 1]
+    unsigned int num_steps;     // number of trellis steps so far
+    unsigned int num_stored;    // number of steps in history
+    unsigned int dec_index;     // history index of next step
+
+    viterbi_acs_kernel acs;     // add-compare-select kernel
+};
+
+void * viterbi_create(unsigned int _K,
+                      unsigned int _R,
+                      int *        _poly,
+                      int          _len);
+void * viterbi_create27(int _len);
+void * viterbi_create29(int _len);
+void * viterbi_create39(int _len);
+void * viterbi_create615(int _len);
+int  viterbi_init(void * _q, int _starting_state);
+int  viterbi_update_blk(void * _q, unsigned char * _sym, int _nbits);
+int  viterbi_chainback(void * _q, unsigned char * _data, unsigned int _nbits, unsigned int _endstate);
+void viterbi_destroy(void * _q);
+
+// add-compare-select kernels
+void viterbi_acs_port(short int * _m0, short int * _m1, short int * _mask, unsigned char * _sym,
+                      unsigned int _R, unsigned int _n, unsigned int * _dec);
+void viterbi_acs_sse2(short int * _m0, short int * _m1, short int * _mask, unsigned char * _sym,
+                      unsigned int _R, unsigned int _n, unsigned int * _dec);
+void viterbi_acs_avx2(short int * _m0, short int * _m1, short int * _mask, unsigned char * _sym,
+                      unsigned int _R, unsigned int _n, unsigned int * _dec);
+
+// native Reed-Solomon codec over GF(2^m), used when libfec is not
+// available; methods match libfec's *_rs_char() interface
+typedef struct reedsolomon_s * reedsolomon;
+
+struct reedsolomon_s {
+    unsigned int mm;            // bits per symbol
+    unsigned int nn;            // symbols per block, 2^mm - 1
+    unsigned int fcr;           // first consecutive root, index form
+    unsigned int prim;          // primitive element, index form
+    unsigned int nroots;        // number of parity symbols
+    unsigned int pad;           // implicit leading zeros (shortened)
+
+    unsigned char * alpha_to;   // antilog table [size: 2*nn x 1]
+    unsigned int *  index_of;   // log table [size: nn+1 x 1]
+    unsigned char * genpoly;    // generator polynomial [size: nroots+1 x 1]
+
+    unsigned char * enc_tab;    // feedback products [size: nn+1 x enc_stride]
+    unsigned int    enc_stride; // nroots rounded up to multiple of 8
+    unsigned char * enc_buf;    // sliding parity window
+
+    unsigned char * parity;     // re-encoded parity/remainder [size: nroots x 1]
+    unsigned char * syndrome;   // syndromes [size: nroots x 1]
+    unsigned char * lambda;     // error locator [size: nroots+1 x 1]
+    unsigned char * b;          // Berlekamp-Massey correction polynomial
+    unsigned char * t;          // Berlekamp-Massey temporary polynomial
+    unsigned char * omega;      // error evaluator [size: nroots+1 x 1]
+};
+
+void * reedsolomon_create(int _symsize,
+                          int _gfpoly,
+                          int _fcr,
+                          int _prim,
+                          int _nroots,
+                          int _pad);
+void reedsolomon_destroy(void * _q);
+void reedsolomon_encode(void * _q, unsigned char * _data, unsigned char * _parity);
+int  reedsolomon_decode(void * _q, unsigned char * _data, int * _eras_pos, int _no_eras);
+
 // Reed-Solomon
 
 // compute encoded message length for Reed-Solomon codes
@@ -581,6 +793,7 @@ unsigned int fec_rs_get_enc_msg_len(unsigned int _dec_msg_len,
 
 
 fec fec_rs_create(fec_scheme _fs);
+void fec_rs_destroy(fec _q);
 void fec_rs_init_p8(fec _q);
 void fec_rs_setlength(fec _q,
                       unsigned int _dec_msg_len);
@@ -633,6 +846,114 @@ int fec_sumproduct_step(unsigned int    _m,
                         float *         _LQ,
                         unsigned char * _parity);
 
+// layered normalized min-sum LDPC decoder; the parity check matrix
+// row lists are stored as a single compressed-row edge array
+typedef struct ldpc_s * ldpc;
+
+struct ldpc_s {
+    unsigned int M;             // number of parity checks (rows)
+    unsigned int N;             // codeword length (columns)
+    unsigned int num_edges;     // number of non-zero entries
+    unsigned int max_row_weight;// maximum check node degree
+
+    unsigned int * row_ptr;     // first edge of each row [size: M+1 x 1]
+    unsigned int * col_idx;     // column of each edge [size: num_edges x 1]
+    float * R;                  // check-to-variable messages [size: num_edges x 1]
+    float * L;                  // posterior log-likelihoods [size: N x 1]
+    float * t;                  // variable-to-check messages, one row
+    float scale;                // min-sum normalization factor
+    unsigned int num_iterations;// iterations used by last decode
+};
+
+// create LDPC decoder from sparse parity check matrix
+ldpc ldpc_create(smatrixb _H);
+void ldpc_destroy(ldpc _q);
+
+// run parity check on hard-decision codeword, returning 1 if all
+// checks pass, 0 otherwise
+int ldpc_check(ldpc            _q,
+               unsigned char * _c);
+
+// decode received codeword, returning 1 if parity checks, 0 otherwise
+//  _q              :   LDPC decoder object
+//  _LLR            :   channel log-likelihoods, positive values favor
+//                      '0' bits [size: N x 1]
+//  _c_hat          :   estimated transmitted codeword [size: N x 1]
+//  _max_iterations :   maximum number of iterations before bailing
+int ldpc_decode(ldpc            _q,
+                float *         _LLR,
+                unsigned char * _c_hat,
+                unsigned int    _max_iterations);
+
+// LDPC codes (quasi-cyclic)
+fec fec_ldpc_create(fec_scheme _fs);
+void fec_ldpc_destroy(fec _q);
+void fec_ldpc_setlength(fec _q,
+                        unsigned int _dec_msg_len);
+void fec_ldpc_encode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char * _msg_dec,
+                     unsigned char * _msg_enc);
+void fec_ldpc_decode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char * _msg_enc,
+                     unsigned char * _msg_dec);
+void fec_ldpc_decode_soft(fec _q,
+                          unsigned int _dec_msg_len,
+                          unsigned char * _msg_enc,
+                          unsigned char * _msg_dec);
+
+// expand quasi-cyclic base matrix into sparse parity check matrix
+//  _base   :   base matrix shifts, -1 for zero block [size: _mb x _nb]
+//  _mb     :   base matrix rows
+//  _nb     :   base matrix columns
+//  _Z      :   circulant size
+smatrixb fec_ldpc_expand(const signed char * _base,
+                         unsigned int        _mb,
+                         unsigned int        _nb,
+                         unsigned int        _Z);
+
+//
+// interleaver
+//
+
+// permute one iteration
+void interleaver_permute(unsigned char * _x,
+                         unsigned int    _n,
+                         unsigned int    _M,
+                         unsigned int    _N);
+
+// permute one iteration (soft bit input)
+void interleaver_permute_soft(unsigned char * _x,
+                              unsigned int    _n,
+                              unsigned int    _M,
+                              unsigned int    _N);
+
+// permute one iteration with mask
+void interleaver_permute_mask(unsigned char * _x,
+                              unsigned int    _n,
+                              unsigned int    _M,
+                              unsigned int    _N,
+                              unsigned char   _mask);
+
+// permute one iteration (soft bit input) with mask
+void interleaver_permute_mask_soft(unsigned char * _x,
+                                   unsigned int    _n,
+                                   unsigned int    _M,
+                                   unsigned int    _N,
+                                   unsigned char   _mask);
+
+// permute one iteration on bit-position indices with mask
+//  _x      :   source byte index of each bit [size: 8*_n x 1]
+void interleaver_permute_index(unsigned int * _x,
+                               unsigned int   _n,
+                               unsigned int   _M,
+                               unsigned int   _N,
+                               unsigned char  _mask);
+
+// compute composite permutation tables for current depth
+void interleaver_compute_index(interleaver _q);
+
 //
 // packetizer
 //
@@ -701,6 +1022,20 @@ typedef FFT(plan)(FFT(_create_t)) (unsigned int _nfft,          \
 typedef void (FFT(_destroy_t))(FFT(plan) _q);                   \
 typedef void (FFT(_execute_t))(FFT(plan) _q);                   \
                                                                 \
+/* type definition for self-sorting radix-4 stage kernel    */  \
+/*  _x      :   input array [size: _n x 1]                  */  \
+/*  _y      :   output array [size: _n x 1]                 */  \
+/*  _n      :   transform size                              */  \
+/*  _s      :   stage stride (product of previous radices)  */  \
+/*  _w      :   stage twiddle factors                       */  \
+/*  _dir    :   fft direction                               */  \
+typedef void (FFT(_stage_t))(TC *         _x,                   \
+                             TC *         _y,                   \
+                             unsigned int _n,                   \
+                             unsigned int _s,                   \
+                             TC *         _w,                   \
+                             int          _dir);                \
+                                                                \
 /* FFT create methods */                                        \
 FFT(_create_t) FFT(_create_plan_dft);                           \
 FFT(_create_t) FFT(_create_plan_radix2);                        \
@@ -722,6 +1057,9 @@ FFT(_execute_t) FFT(_execute_mixed_radix);                      \
 FFT(_execute_t) FFT(_execute_rader);                            \
 FFT(_execute_t) FFT(_execute_rader2);                           \
                                                                 \
+/* radix-4 stage kernel (portable C) */                        \
+FFT(_stage_t) FFT(_radix4_stage);                               \
+                                                                \
 /* specific codelets for small DFTs */                          \
 FFT(_execute_t) FFT(_execute_dft_2);                            \
 FFT(_execute_t) FFT(_execute_dft_3);                            \
@@ -732,9 +1070,40 @@ FFT(_execute_t) FFT(_execute_dft_7);                            \
 FFT(_execute_t) FFT(_execute_dft_8);                            \
 FFT(_execute_t) FFT(_execute_dft_16);                           \
                                                                 \
+/* create plan using specific method (_radix=0 to estimate) */  \
+FFT(plan) FFT(_create_plan_method)(unsigned int      _nfft,     \
+                                   TC *              _x,        \
+                                   TC *              _y,        \
+                                   int               _dir,      \
+                                   int               _flags,    \
+                                   liquid_fft_method _method,   \
+                                   unsigned int      _radix);   \
+                                                                \
+/* create mixed-radix plan with specific split, _nfft=P*_Q */   \
+FFT(plan) FFT(_create_plan_mixed_radix_split)(                  \
+                                        unsigned int _nfft,     \
+                                        TC *         _x,        \
+                                        TC *         _y,        \
+                                        int          _dir,      \
+                                        int          _flags,    \
+                                        unsigned int _Q);       \
+                                                                \
 /* additional methods */                                        \
 unsigned int FFT(_estimate_mixed_radix)(unsigned int _nfft);    \
                                                                 \
+/* benchmark candidate methods for transform, saving the    */  \
+/* fastest as wisdom                                        */  \
+/*  _nfft   :   transform size                              */  \
+/*  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)         */  \
+/*  _flags  :   planner flags                               */  \
+/*  _method :   resulting method                            */  \
+/*  _radix  :   resulting mixed-radix split (0 otherwise)   */  \
+void FFT(_plan_measure)(unsigned int        _nfft,              \
+                        int                 _dir,               \
+                        int                 _flags,             \
+                        liquid_fft_method * _method,            \
+                        unsigned int *      _radix);            \
+                                                                \
 /* discrete cosine transform (DCT) prototypes */                \
 void FFT(_execute_REDFT00)(FFT(plan) _q);   /* DCT-I   */       \
 void FFT(_execute_REDFT10)(FFT(plan) _q);   /* DCT-II  */       \
@@ -762,9 +1131,30 @@ int fft_is_radix2(unsigned int _n);
 // miscellaneous functions
 unsigned int fft_reverse_index(unsigned int _i, unsigned int _n);
 
+// look up wisdom for transform, returning 1 if found
+//  _nfft   :   transform size
+//  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)
+//  _method :   resulting method
+//  _radix  :   resulting mixed-radix split (0 otherwise)
+int liquid_fft_wisdom_lookup(unsigned int        _nfft,
+                             int                 _dir,
+                             liquid_fft_method * _method,
+                             unsigned int *      _radix);
+
+// add/replace wisdom for transform
+void liquid_fft_wisdom_add(unsigned int      _nfft,
+                           int               _dir,
+                           liquid_fft_method _method,
+                           unsigned int      _radix);
+
 
 LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_complex)
 
+// x86 SIMD radix-4 stage kernels (src/fft/src/fft_radix4.*.c) for
+// transforms of at least 16 points, selected at run time
+fft_stage_t fft_radix4_stage_sse;
+fft_stage_t fft_radix4_stage_avx;
+
 // Use fftw library if installed (and not overridden with configuration),
 // otherwise use internal (less efficient) fft library.
 #if HAVE_FFTW3_H && !defined LIQUID_FFTOVERRIDE
@@ -807,6 +1197,28 @@ float estimate_req_filter_len_Herrmann(float _df,
                                        float _As);
 
 
+// firfilt
+#define LIQUID_FIRFILT_DEFINE_INTERNAL_API(FIRFILT,TO,TC,TI)    \
+void FIRFILT(_execute_linear)(FIRFILT()    _q,                  \
+                              TI *         _x,                  \
+                              unsigned int _n,                  \
+                              TO *         _y);
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(FIRFILT_MANGLE_RRRF,
+                                   float,
+                                   float,
+                                   float)
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(FIRFILT_MANGLE_CRCF,
+                                   liquid_float_complex,
+                                   float,
+                                   liquid_float_complex)
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(FIRFILT_MANGLE_CCCF,
+                                   liquid_float_complex,
+                                   liquid_float_complex,
+                                   liquid_float_complex)
+
 // fir_farrow
 #define LIQUID_FIRFARROW_DEFINE_INTERNAL_API(FIRFARROW,TO,TC,TI)  \
 void FIRFARROW(_genpoly)(FIRFARROW() _q);
@@ -1240,6 +1652,55 @@ void ofdmflexframesync_rxpayload(ofdmflexframesync _q,
 // complex rotation vector: cexpf(_Complex_I*THETA)
 #define liquid_cexpjf(THETA) (cosf(THETA) + _Complex_I*sinf(THETA))
 
+// complex arithmetic helpers
+//
+// The C99 '*' and '/' operators on complex values recover infinities
+// from NaN results (Annex G), which compilers implement with calls to
+// __mulsc3() and __divsc3() that inhibit inlining and vectorization.
+// When configured with --enable-fast-complex (LIQUID_FAST_COMPLEX)
+// the helpers below use the textbook (limited-range) formulas;
+// otherwise they defer to the operators. cabsf() and cargf() are
+// left to the platform libm in either mode; loops that only compare
+// magnitudes use liquid_cabsf2() instead.
+
+// squared magnitude |_x|^2, for comparisons not requiring cabsf()
+static inline float liquid_cabsf2(float complex _x)
+{
+    float xr = crealf(_x);
+    float xi = cimagf(_x);
+    return xr*xr + xi*xi;
+}
+
+#if LIQUID_FAST_COMPLEX
+// complex multiply, _a*_b
+static inline float complex liquid_cmulf(float complex _a,
+                                         float complex _b)
+{
+    float ar = crealf(_a), ai = cimagf(_a);
+    float br = crealf(_b), bi = cimagf(_b);
+    float complex y;
+    ((float*)&y)[0] = ar*br - ai*bi;
+    ((float*)&y)[1] = ar*bi + ai*br;
+    return y;
+}
+
+// complex divide, _a/_b
+static inline float complex liquid_cdivf(float complex _a,
+                                         float complex _b)
+{
+    float ar = crealf(_a), ai = cimagf(_a);
+    float br = crealf(_b), bi = cimagf(_b);
+    float g = 1.0f / (br*br + bi*bi);
+    float complex y;
+    ((float*)&y)[0] = (ar*br + ai*bi)*g;
+    ((float*)&y)[1] = (ai*br - ar*bi)*g;
+    return y;
+}
+#else
+#  define liquid_cmulf(A,B) ((A)*(B))
+#  define liquid_cdivf(A,B) ((A)/(B))
+#endif
+
 
 //
 // MODULE : matrix
@@ -1368,6 +1829,9 @@ void MODEM(_arb_scale)(MODEM() _q);                             \
 /* Balance I/Q */                                               \
 void MODEM(_arb_balance_iq)(MODEM() _q);                        \
                                                                 \
+/* Build spatial index for arbitrary modem demodulation */      \
+void MODEM(_arb_init_index)(MODEM() _q);                        \
+                                                                \
 /* modulate using symbol map (look-up table) */                 \
 void MODEM(_modulate_map)(MODEM()      _q,                      \
                           unsigned int _sym_in,                 \
@@ -1399,6 +1863,24 @@ void MODEM(_demodulate_ook)    ( MODEM(), TC, unsigned int *);  \
 void MODEM(_demodulate_sqam32) ( MODEM(), TC, unsigned int *);  \
 void MODEM(_demodulate_sqam128)( MODEM(), TC, unsigned int *);  \
                                                                 \
+/* modem demodulate (block) routines; if _x_hat is not NULL   */ \
+/* the re-modulated samples are also stored                     */ \
+void MODEM(_demodulate_block_ask)(MODEM()        _q,            \
+                                  TC *           _x,            \
+                                  unsigned int   _n,            \
+                                  unsigned int * _s,            \
+                                  TC *           _x_hat);       \
+void MODEM(_demodulate_block_qam)(MODEM()        _q,            \
+                                  TC *           _x,            \
+                                  unsigned int   _n,            \
+                                  unsigned int * _s,            \
+                                  TC *           _x_hat);       \
+void MODEM(_demodulate_block_psk)(MODEM()        _q,            \
+                                  TC *           _x,            \
+                                  unsigned int   _n,            \
+                                  unsigned int * _s,            \
+                                  TC *           _x_hat);       \
+                                                                \
 /* modem demodulate (soft) routines */                          \
 void MODEM(_demodulate_soft_bpsk)(MODEM()         _q,           \
                                   TC              _x,           \
@@ -1424,6 +1906,19 @@ void MODEM(_demodulate_soft_table)(MODEM()         _q,          \
                                    unsigned int *  _sym_out,    \
                                    unsigned char * _soft_bits); \
                                                                 \
+/* compute soft bits from nearest-neighbors look-up table    */ \
+/* given hard decision                                       */ \
+/*  _q          :   modem object                             */ \
+/*  _x          :   input sample                             */ \
+/*  _s          :   hard-decision symbol                     */ \
+/*  _x_hat      :   re-modulated hard-decision symbol        */ \
+/*  _soft_bits  :   output soft bits [size: bps x 1]         */ \
+void MODEM(_demodsoft_table)(MODEM()         _q,                \
+                             TC              _x,                \
+                             unsigned int    _s,                \
+                             TC              _x_hat,            \
+                             unsigned char * _soft_bits);       \
+                                                                \
 /* Demodulate a linear symbol constellation using dynamic   */  \
 /* threshold calculation                                    */  \
 /*  _v      :   input value             */                      \
@@ -1449,6 +1944,20 @@ void MODEM(_demodulate_linear_array_ref)(T              _v,     \
                                          T *            _ref,   \
                                          unsigned int * _s,     \
                                          T *            _res);  \
+                                                                \
+/* Demodulate block of values on a linear symbol            */  \
+/* constellation using referenced lookup table; the inputs  */  \
+/* are replaced by their residuals                          */  \
+/*  _v      :   input values/residuals [size: _n x 1]   */      \
+/*  _n      :   number of values        */                      \
+/*  _m      :   bits per symbol         */                      \
+/*  _ref    :   array of thresholds     */                      \
+/*  _s      :   demodulated symbols [size: _n x 1]      */      \
+void MODEM(_demodulate_linear_array_ref_block)(T *            _v,   \
+                                               unsigned int   _n,   \
+                                               unsigned int   _m,   \
+                                               T *            _ref, \
+                                               unsigned int * _s);  \
 
 
 
@@ -1494,6 +2003,29 @@ extern const float complex modem_arb64opt[64];
 extern const float complex modem_arb128opt[128];
 extern const float complex modem_arb256opt[256];
 
+// delay/conjugate FM discriminator kernel: phase differences of
+// consecutive samples using a polynomial arctangent, atan(t) =
+// t*P(t^2) with _nc coefficients, or the quadrature discriminator
+// for _nc = 0 (see freqdem.c)
+//  _x0     :   sample preceding _x[0]
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples
+//  _c      :   polynomial coefficients [size: _nc x 1]
+//  _nc     :   number of coefficients, _nc <= FREQDEM_DISC_MAX_COEFFS
+//  _y      :   phase differences [size: _n x 1]
+#define FREQDEM_DISC_MAX_COEFFS (6)
+typedef void (freqdem_disc_kernel_t)(float complex   _x0,
+                                     float complex * _x,
+                                     unsigned int    _n,
+                                     const float *   _c,
+                                     unsigned int    _nc,
+                                     float *         _y);
+
+// x86 SIMD discriminator kernels (src/modem/src/freqdem_disc.*.c),
+// selected at run time
+freqdem_disc_kernel_t freqdem_disc_kernel_sse;
+freqdem_disc_kernel_t freqdem_disc_kernel_avx;
+
 
 //
 // MODULE : multichannel
@@ -1533,12 +2065,23 @@ void ofdmframesync_cpcorrelate(ofdmframesync _q);
 void ofdmframesync_findrxypeak(ofdmframesync _q);
 void ofdmframesync_rxpayload(ofdmframesync _q);
 
+void ofdmframesync_execute_sample(ofdmframesync _q,
+                                  float complex _x);
 void ofdmframesync_execute_seekplcp(ofdmframesync _q);
 void ofdmframesync_execute_S0a(ofdmframesync _q);
 void ofdmframesync_execute_S0b(ofdmframesync _q);
 void ofdmframesync_execute_S1( ofdmframesync _q);
 void ofdmframesync_execute_rxsymbols(ofdmframesync _q);
 
+// receive payload symbols from block of samples, returning the number
+// of samples consumed (at most one symbol is received per call)
+unsigned int ofdmframesync_execute_rxsymbols_block(ofdmframesync   _q,
+                                                   float complex * _x,
+                                                   unsigned int    _n);
+
+// run transform, recover symbol, and invoke callback
+void ofdmframesync_rxsymbol_fft(ofdmframesync _q);
+
 void ofdmframesync_S0_metrics(ofdmframesync _q,
                               float complex * _G,
                               float complex * _s_hat);
@@ -1589,15 +2132,81 @@ void NCO(_constrain_frequency)(NCO() _q);                       \
 /* compute trigonometric functions for nco/vco type     */      \
 void NCO(_compute_sincos_nco)(NCO() _q);                        \
 void NCO(_compute_sincos_vco)(NCO() _q);                        \
+void NCO(_compute_sincos_fixed)(NCO() _q);                      \
                                                                 \
 /* reset internal phase-locked loop filter              */      \
 void NCO(_pll_reset)(NCO() _q);                                 \
+                                                                \
+/* convert phase (radians) to/from 32-bit fixed point   */      \
+unsigned int NCO(_phase_to_fixed)(T _theta);                    \
+T NCO(_phase_from_fixed)(unsigned int _theta);                  \
+                                                                \
+/* compute block-mixing rotation tables for frequency   */      \
+void NCO(_update_rotation)(NCO() _q);                           \
+                                                                \
+/* mix block with fixed-point phase (LIQUID_NCO_FIXED)  */      \
+/*  _q      :   nco object                              */      \
+/*  _x      :   input array (NULL to generate exp{j*theta}) */  \
+/*  _y      :   output array [size: _n x 1]             */      \
+/*  _n      :   number of samples                       */      \
+/*  _down   :   mix down (exp{-j*theta}) rather than up */      \
+void NCO(_mix_block_fixed)(NCO()        _q,                     \
+                           TC *         _x,                     \
+                           TC *         _y,                     \
+                           unsigned int _n,                     \
+                           int          _down);                 \
+                                                                \
+/* block-mixing kernel: computes exp{j*theta} from the  */      \
+/* two-level table once per group, and rotates by the   */      \
+/* per-sample phase steps in _rot within the group      */      \
+/*  _tab    :   two-level table [size: 2*NCO_FIXED_TABLE_LEN] */\
+/*  _rot    :   exp{j*k*d_theta} [size: NCO_FIXED_GROUP_LEN] */ \
+/*  _theta  :   initial phase (fixed point)             */      \
+/*  _d_theta:   phase step (fixed point)                */      \
+/*  _x      :   input array (NULL to generate exp{j*theta}) */  \
+/*  _y      :   output array [size: _n x 1]             */      \
+/*  _n      :   number of samples, multiple of group length */  \
+typedef void (NCO(_mix_kernel_t))(TC *         _tab,            \
+                                  TC *         _rot,            \
+                                  unsigned int _theta,          \
+                                  unsigned int _d_theta,        \
+                                  TC *         _x,              \
+                                  TC *         _y,              \
+                                  unsigned int _n);             \
+NCO(_mix_kernel_t) NCO(_mix_kernel);                            \
+
+// fixed-point phase nco: the 32-bit phase is rounded to 20 bits and
+// exp{j*theta} is computed as the product of coarse (upper 10 bits)
+// and fine (lower 10 bits) table entries
+#define NCO_FIXED_TABLE_LEN     (1024)  // entries in each table level
+#define NCO_FIXED_GROUP_LEN     (16)    // samples per block-mixing group
+
+// look up exp{j*theta} from two-level table
+//  TAB     :   two-level table [size: 2*NCO_FIXED_TABLE_LEN]
+//  THETA   :   phase (unsigned int, fixed point)
+//  RE, IM  :   real, imaginary output components
+#define NCO_FIXED_LOOKUP(TAB,THETA,RE,IM)                       \
+{                                                               \
+    unsigned int  nco_i = (THETA) + (1u << 11);                 \
+    float complex nco_c = (TAB)[nco_i >> 22];                   \
+    float complex nco_f = (TAB)[NCO_FIXED_TABLE_LEN +           \
+                                ((nco_i >> 12) & 0x3ff)];       \
+    float nco_cr = crealf(nco_c), nco_ci = cimagf(nco_c);       \
+    float nco_fr = crealf(nco_f), nco_fi = cimagf(nco_f);       \
+    RE = nco_cr*nco_fr - nco_ci*nco_fi;                         \
+    IM = nco_cr*nco_fi + nco_ci*nco_fr;                         \
+}
 
 // Define nco internal APIs
 LIQUID_NCO_DEFINE_INTERNAL_API(NCO_MANGLE_FLOAT,
                                float,
                                float complex)
 
+// x86 SIMD block-mixing kernels (src/nco/src/nco_mix.*.c), selected
+// at run time
+nco_crcf_mix_kernel_t nco_crcf_mix_kernel_sse;
+nco_crcf_mix_kernel_t nco_crcf_mix_kernel_avx;
+
 // 
 // MODULE : optim (non-linear optimization)
 //
@@ -1801,6 +2410,13 @@ extern struct msequence_s msequence_default[16];
 // MODULE : utility
 //
 
+// allocate _n bytes aligned to _align bytes (a power of two)
+void * liquid_malloc_aligned(unsigned int _n,
+                             unsigned int _align);
+
+// free memory allocated with liquid_malloc_aligned()
+void liquid_free_aligned(void * _p);
+
 // number of ones in a byte
 //  0   0000 0000   :   0
 //  1   0000 0001   :   1
@@ -20,45 +20,122 @@
 //
 // CRC table generator
 //
+// Generates the slicing-by-8 lookup tables for the reflected crc8,
+// crc16, crc24 and crc32 schemes in src/fec/src/crc_gentab.c:
+//
+//   ./sandbox/crc_gentab > src/fec/src/crc_gentab.c
+//
+// Table k holds the key of input byte i followed by k zero bytes,
+// computed bit-by-bit from an all-zero register.
+//
 
 #include <stdio.h>
 #include <stdlib.h>
 
-// generator polynomial
-#define CRC32_POLY 0xEDB88320 // 0x04C11DB7
+// generator polynomials (normal representation)
+#define CRC8_POLY   0x07
+#define CRC16_POLY  0x8005
+#define CRC24_POLY  0x5D6DCB
+#define CRC32_POLY  0x04C11DB7
 
-int main() {
-    unsigned int crc;
-    unsigned int mask;
-    unsigned int crcpoly = CRC32_POLY;
+// reverse lowest _n bits of _x
+unsigned int reverse_bits(unsigned int _x, unsigned int _n)
+{
+    unsigned int i, y = 0;
+    for (i=0; i<_n; i++) {
+        y = (y << 1) | (_x & 1);
+        _x >>= 1;
+    }
+    return y;
+}
 
-    unsigned int crc_gentab[256];
+// print table for one scheme
+//  _name   :   scheme name (e.g. "crc16")
+//  _type   :   storage type of table entries
+//  _poly   :   generator polynomial
+//  _width  :   width of key (bits)
+void print_table(const char * _name,
+                 const char * _type,
+                 unsigned int _poly,
+                 unsigned int _width)
+{
+    unsigned int poly = reverse_bits(_poly, _width);
+    unsigned int table[8][256];
 
-    // generate table
-    unsigned int i, j;
+    // generate table 0 bit-by-bit, and remaining tables by
+    // advancing each entry of the previous table by one zero byte
+    unsigned int i, j, k;
     for (i=0; i<256; i++) {
-        crc = i;
-        for (j=0; j<8; j++) {
-            mask = -(crc & 0x01);
-            crc = (crc >> 1) ^ (crcpoly & mask);
+        unsigned int key = i;
+        for (j=0; j<8; j++)
+            key = (key >> 1) ^ (poly & -(key & 1));
+        table[0][i] = key;
+    }
+    for (k=1; k<8; k++) {
+        for (i=0; i<256; i++) {
+            unsigned int key = table[k-1][i];
+            table[k][i] = (key >> 8) ^ table[0][key & 0xff];
         }
-        crc_gentab[i] = crc;
     }
 
-    printf("\n");
-    printf("unsigned char crc_gentab[%u] = {\n    ", 256);
-    for (i=0; i<256; i++) {
-        printf("0x%.2x", crc_gentab[i]);
-        if (i==255)
-            printf("};\n");
-        else if (((i+1)%8)==0)
-            printf(",\n    ");
-        else
-            printf(", ");
+    // number of hex digits to print per entry
+    unsigned int nd = (_width + 3) / 4;
+    unsigned int nc = nd > 4 ? 6 : 8;   // entries per line
+
+    printf("// %s slicing-by-8 table (polynomial 0x%.*X)\n", _name, nd, _poly);
+    printf("const %s %s_gentab[8][256] = {\n", _type, _name);
+    for (k=0; k<8; k++) {
+        printf("  {\n    ");
+        for (i=0; i<256; i++) {
+            printf("0x%.*x", nd, table[k][i]);
+            if (i == 255)
+                printf("}");
+            else if ( ((i+1)%nc)==0 )
+                printf(",\n    ");
+            else
+                printf(", ");
+        }
+        printf("%s\n", k==7 ? "};\n" : ",");
     }
+}
 
-    // test it...
+int main()
+{
+    // print license header
+    printf("/*\n");
+    printf(" * Copyright (c) 2007 - 2014 Joseph Gaeddert\n");
+    printf(" *\n");
+    printf(" * This file is part of liquid.\n");
+    printf(" *\n");
+    printf(" * liquid is free software: you can redistribute it and/or modify\n");
+    printf(" * it under the terms of the GNU General Public License as published by\n");
+    printf(" * the Free Software Foundation, either version 3 of the License, or\n");
+    printf(" * (at your option) any later version.\n");
+    printf(" *\n");
+    printf(" * liquid is distributed in the hope that it will be useful,\n");
+    printf(" * but WITHOUT ANY WARRANTY; without even the implied warranty of\n");
+    printf(" * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n");
+    printf(" * GNU General Public License for more details.\n");
+    printf(" *\n");
+    printf(" * You should have received a copy of the GNU General Public License\n");
+    printf(" * along with liquid.  If not, see <http://www.gnu.org/licenses/>.\n");
+    printf(" */\n");
+    printf("\n");
+    printf("//\n");
+    printf("// cyclic redundancy check generated tables\n");
+    printf("// auto-generated file (do not edit); see sandbox/crc_gentab.c\n");
+    printf("//\n");
+    printf("\n");
+    printf("#include \"liquid.internal.h\"\n");
+    printf("\n");
+
+    print_table("crc8",  "unsigned char",      CRC8_POLY,   8);
+    printf("\n");
+    print_table("crc16", "unsigned short int", CRC16_POLY, 16);
+    printf("\n");
+    print_table("crc24", "unsigned int",       CRC24_POLY, 24);
+    printf("\n");
+    print_table("crc32", "unsigned int",       CRC32_POLY, 32);
 
     return 0;
 }
-
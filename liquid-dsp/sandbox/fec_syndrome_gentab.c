@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Syndrome table generator for the Golay(24,12) and SEC-DED codes
+//
+// Generates the byte-sliced encoding/syndrome tables and the
+// syndrome-to-error-pattern tables in src/fec/src/fec_syndrome_gentab.c:
+//
+//   ./sandbox/fec_syndrome_gentab > src/fec/src/fec_syndrome_gentab.c
+//
+// All codes are linear, so the syndrome of a received word is the
+// exclusive-or of the syndromes of its individual bytes. The error
+// pattern tables are computed with the reference (search-based)
+// decoders.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// print comma-separated table values, closing with a brace
+//  _v      :   table values [size: _n x 1]
+//  _n      :   number of entries
+//  _nd     :   number of hex digits to print per entry
+//  _indent :   indentation prefix for each line
+void print_values(unsigned int * _v,
+                  unsigned int   _n,
+                  unsigned int   _nd,
+                  const char *   _indent)
+{
+    unsigned int nc = _nd > 4 ? 6 : 8;   // entries per line
+    unsigned int i;
+    printf("%s", _indent);
+    for (i=0; i<_n; i++) {
+        printf("0x%.*x", _nd, _v[i]);
+        if (i == _n-1)
+            printf("}");
+        else if ( ((i+1)%nc)==0 )
+            printf(",\n%s", _indent);
+        else
+            printf(", ");
+    }
+}
+
+// print one-dimensional table
+void print_table(const char *   _comment,
+                 const char *   _type,
+                 const char *   _name,
+                 unsigned int * _v,
+                 unsigned int   _n,
+                 unsigned int   _nd)
+{
+    printf("// %s\n", _comment);
+    printf("const %s %s[%u] = {\n", _type, _name, _n);
+    print_values(_v, _n, _nd, "    ");
+    printf(";\n");
+}
+
+// print byte-sliced table [_m x 256]
+void print_table_sliced(const char *   _comment,
+                        const char *   _type,
+                        const char *   _name,
+                        unsigned int * _v,
+                        unsigned int   _m,
+                        unsigned int   _nd)
+{
+    unsigned int k;
+    printf("// %s\n", _comment);
+    printf("const %s %s[%u][256] = {\n", _type, _name, _m);
+    for (k=0; k<_m; k++) {
+        printf("  {\n");
+        print_values(&_v[256*k], 256, _nd, "    ");
+        printf("%s\n", k==_m-1 ? "};" : ",");
+    }
+}
+
+// Golay(24,12) tables
+void print_golay2412()
+{
+    unsigned int i, k;
+
+    // encoder: codeword contribution of upper/lower 6 bits of message
+    unsigned int enc[2*64];
+    for (i=0; i<64; i++) {
+        enc[     i] = golay2412_matrix_mul(i << 6, golay2412_Gt, 24);
+        enc[64 + i] = golay2412_matrix_mul(i,      golay2412_Gt, 24);
+    }
+
+    // syndrome contribution of each received byte
+    unsigned int syn[3*256];
+    for (k=0; k<3; k++) {
+        for (i=0; i<256; i++)
+            syn[256*k+i] = golay2412_matrix_mul(i << (16-8*k), golay2412_H, 12);
+    }
+
+    // error pattern over message bits for each syndrome
+    unsigned int dec[4096];
+    for (i=0; i<4096; i++)
+        dec[i] = golay2412_estimate_ehat(i) & 0x0fff;
+
+    printf("// Golay(24,12) encoder: codeword contribution of message bits [11:6] and [5:0]\n");
+    printf("const unsigned int golay2412_enc_gentab[2][64] = {\n");
+    printf("  {\n");
+    print_values(&enc[ 0], 64, 6, "    ");
+    printf(",\n  {\n");
+    print_values(&enc[64], 64, 6, "    ");
+    printf("};\n\n");
+    print_table_sliced("Golay(24,12) syndrome of received bits [23:16], [15:8] and [7:0]",
+                       "unsigned short int", "golay2412_syndrome_gentab", syn, 3, 3);
+    printf("\n");
+    print_table("Golay(24,12) estimated error pattern over message bits, indexed by syndrome",
+                "unsigned short int", "golay2412_dec_gentab", dec, 4096, 3);
+}
+
+// SEC-DED tables
+//  _name   :   code name (e.g. "secded7264")
+//  _P      :   parity matrix [_np x _nb bytes]
+//  _w1     :   syndromes of weight-1 errors [size: _n x 1]
+//  _np     :   number of parity bits
+//  _nb     :   number of message bytes
+//  _n      :   encoded symbol length (bits)
+void print_secded(const char *    _name,
+                  unsigned char * _P,
+                  unsigned char * _w1,
+                  unsigned int    _np,
+                  unsigned int    _nb,
+                  unsigned int    _n)
+{
+    unsigned int i, j, k;
+
+    // syndrome contribution of each message byte
+    unsigned int syn[_nb*256];
+    for (k=0; k<_nb; k++) {
+        for (i=0; i<256; i++) {
+            unsigned int s = 0;
+            for (j=0; j<_np; j++)
+                s = (s << 1) | (liquid_c_ones[_P[_nb*j+k] & i] & 1);
+            syn[256*k+i] = s;
+        }
+    }
+
+    // weight-1 error location for each syndrome (0xff if none)
+    unsigned int ns = 1 << _np;
+    unsigned int loc[ns];
+    for (i=0; i<ns; i++)
+        loc[i] = 0xff;
+    for (i=0; i<_n; i++)
+        loc[_w1[i]] = i;
+
+    char comment[256];
+    char table[64];
+    sprintf(comment, "SEC-DED (%u,%u) syndrome of message bytes", _n, 8*_nb);
+    sprintf(table, "%s_syndrome_gentab", _name);
+    print_table_sliced(comment, "unsigned char", table, syn, _nb, 2);
+    printf("\n");
+
+    sprintf(comment, "SEC-DED (%u,%u) single error location, indexed by syndrome (0xff: none)", _n, 8*_nb);
+    sprintf(table, "%s_ehat_gentab", _name);
+    print_table(comment, "unsigned char", table, loc, ns, 2);
+}
+
+int main()
+{
+    // print license header
+    printf("/*\n");
+    printf(" * Copyright (c) 2007 - 2014 Joseph Gaeddert\n");
+    printf(" *\n");
+    printf(" * This file is part of liquid.\n");
+    printf(" *\n");
+    printf(" * liquid is free software: you can redistribute it and/or modify\n");
+    printf(" * it under the terms of the GNU General Public License as published by\n");
+    printf(" * the Free Software Foundation, either version 3 of the License, or\n");
+    printf(" * (at your option) any later version.\n");
+    printf(" *\n");
+    printf(" * liquid is distributed in the hope that it will be useful,\n");
+    printf(" * but WITHOUT ANY WARRANTY; without even the implied warranty of\n");
+    printf(" * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n");
+    printf(" * GNU General Public License for more details.\n");
+    printf(" *\n");
+    printf(" * You should have received a copy of the GNU General Public License\n");
+    printf(" * along with liquid.  If not, see <http://www.gnu.org/licenses/>.\n");
+    printf(" */\n");
+    printf("\n");
+    printf("//\n");
+    printf("// Golay and SEC-DED syndrome generated tables\n");
+    printf("// auto-generated file (do not edit); see sandbox/fec_syndrome_gentab.c\n");
+    printf("//\n");
+    printf("\n");
+    printf("#include \"liquid.internal.h\"\n");
+    printf("\n");
+
+    print_golay2412();
+    printf("\n");
+    print_secded("secded2216", secded2216_P, secded2216_syndrome_w1, 6, 2, 22);
+    printf("\n");
+    print_secded("secded3932", secded3932_P, secded3932_syndrome_w1, 7, 4, 39);
+    printf("\n");
+    print_secded("secded7264", secded7264_P, secded7264_syndrome_w1, 8, 8, 72);
+
+    return 0;
+}
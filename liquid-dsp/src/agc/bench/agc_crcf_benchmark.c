@@ -77,3 +77,57 @@ void benchmark_agc_crcf                 AGC_CRCF_BENCHMARK_API(0, 0)
 void benchmark_agc_crcf_squelch         AGC_CRCF_BENCHMARK_API(1, 0)
 void benchmark_agc_crcf_locked          AGC_CRCF_BENCHMARK_API(0, 1)
 
+
+// helper function for block execution
+//  _num_channels   :   number of channels (0: single agc object)
+void agc_crcf_block_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _num_channels)
+{
+    unsigned int n = 64;    // samples per block (per channel)
+    unsigned int M = _num_channels > 0 ? _num_channels : 1;
+
+    // normalize number of iterations
+    *_num_iterations /= n*M / 8;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned long int i;
+    unsigned int j;
+
+    // create objects
+    agc_crcf      q    = agc_crcf_create();
+    agc_bank_crcf bank = agc_bank_crcf_create(M);
+    agc_crcf_set_bandwidth(q,0.05f);
+    agc_bank_crcf_set_bandwidth(bank,0.05f);
+
+    float complex x[n*M];   // input samples
+    float complex y[n*M];   // output samples
+    for (j=0; j<n*M; j++)
+        x[j] = 1e-3f*cexpf(_Complex_I*0.1f*j);
+
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_num_channels == 0)
+            agc_crcf_execute_block(q, x, n, y);
+        else
+            agc_bank_crcf_execute_block(bank, x, n, y);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    *_num_iterations *= n*M;
+
+    // destroy objects
+    agc_crcf_destroy(q);
+    agc_bank_crcf_destroy(bank);
+}
+
+#define AGC_CRCF_BLOCK_BENCHMARK_API(NUM_CHANNELS)  \
+(   struct rusage *_start,                          \
+    struct rusage *_finish,                         \
+    unsigned long int *_num_iterations)             \
+{ agc_crcf_block_bench(_start, _finish, _num_iterations, NUM_CHANNELS); }
+
+void benchmark_agc_crcf_block           AGC_CRCF_BLOCK_BENCHMARK_API(0)
+void benchmark_agc_bank_crcf_M16        AGC_CRCF_BLOCK_BENCHMARK_API(16)
+void benchmark_agc_bank_crcf_M256       AGC_CRCF_BLOCK_BENCHMARK_API(256)
@@ -261,6 +261,102 @@ void AGC(_execute)(AGC() _q,
 #endif
 }
 
+// execute automatic gain control loop on block of samples
+//  _q      :   agc object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y      :   output samples [size: _n x 1]
+void AGC(_execute_block)(AGC()        _q,
+                         TC *         _x,
+                         unsigned int _n,
+                         TC *         _y)
+{
+    if (_n == 0)
+        return;
+
+    unsigned int i;
+    T g0 = _q->g;
+
+    if (!_q->is_locked) {
+        // estimate average signal energy over block
+        T e = 0.0f;
+        for (i=0; i<_n; i++) {
+#if TC_COMPLEX
+            e += crealf(_x[i])*crealf(_x[i]) + cimagf(_x[i])*cimagf(_x[i]);
+#else
+            e += _x[i]*_x[i];
+#endif
+        }
+        e /= (T)_n;
+
+        // keep internal energy buffer consistent with the end of the
+        // block for subsequent calls to _push() and _execute()
+        for (i = _n > _q->buffer_len ? _n - _q->buffer_len : 0; i<_n; i++)
+            AGC(_estimate_input_energy)(_q, _x[i]);
+
+        // compute instantaneous gain
+        _q->g_hat = 1.0f / (sqrtf(e) + 1e-12f);
+
+        // update gain according to recursive filter, equivalent to
+        // _n updates with the same instantaneous gain
+        T beta_n = powf(_q->beta, (T)_n);
+        _q->g = beta_n*_q->g + (1.0f - beta_n)*_q->g_hat;
+
+        // limit gain
+        AGC(_limit_gain)(_q);
+
+        // update squelch control, if activated
+        if (_q->squelch_activated)
+            AGC(_execute_squelch)(_q);
+    }
+
+    // apply gain to input, interpolating linearly from the previous
+    // value such that the last sample receives the new gain; samples
+    // are processed as groups of four real values, loaded before any
+    // are stored, so that the groups vectorize at -O2 (and _x may
+    // equal _y for in-place operation)
+    T g  = _q->g;
+    T dg = (g - g0) / (T)_n;
+    T k  = (T)(_n-1);   // samples remaining after current
+    const T * x = (const T *) _x;
+    T *       y = (T *)       _y;
+#if TC_COMPLEX
+    for (i=0; i<_n/2; i++) {
+        T ga = g - dg*k;
+        T gb = g - dg*(k-1.0f);
+        T x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+        y[0] = x0*ga;
+        y[1] = x1*ga;
+        y[2] = x2*gb;
+        y[3] = x3*gb;
+        x += 4;
+        y += 4;
+        k -= 2.0f;
+    }
+    if (_n % 2) {
+        y[0] = x[0]*(g - dg*k);
+        y[1] = x[1]*(g - dg*k);
+    }
+#else
+    for (i=0; i<_n/4; i++) {
+        T x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+        y[0] = x0*(g - dg*k);
+        y[1] = x1*(g - dg*(k-1.0f));
+        y[2] = x2*(g - dg*(k-2.0f));
+        y[3] = x3*(g - dg*(k-3.0f));
+        x += 4;
+        y += 4;
+        k -= 4.0f;
+    }
+    for (i=0; i<_n%4; i++)
+        y[i] = x[i]*(g - dg*(k-(T)i));
+#endif
+#if AGC_SQUELCH_GAIN
+    for (i=0; i<_n; i++)
+        _y[i] *= _q->g_squelch;
+#endif
+}
+
 // get estimated signal level (linear)
 T AGC(_get_signal_level)(AGC() _q)
 {
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+//
+// Automatic gain control bank
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// agc bank structure object; the per-channel state is kept in separate
+// arrays so that the inner loops run across channels
+struct AGC_BANK(_s) {
+    unsigned int num_channels;  // number of channels
+
+    // per-channel state
+    T * g;          // current gain value [size: num_channels x 1]
+    T * e;          // block energy estimate [size: num_channels x 1]
+    T * dg;         // gain step across block [size: num_channels x 1]
+
+    // gain and step for each real component of the time-major
+    // samples (twice per channel for complex samples)
+    T * g_re;       // [size: (1+TC_COMPLEX)*num_channels x 1]
+    T * dg_re;      // [size: (1+TC_COMPLEX)*num_channels x 1]
+
+    // common parameters
+    T g_min;        // minimum gain value
+    T g_max;        // maximum gain value
+    T BT;           // bandwidth-time constant
+    T alpha;        // feed-back gain
+    T beta;         // feed-forward gain
+};
+
+// create agc bank object
+//  _num_channels   :   number of channels
+AGC_BANK() AGC_BANK(_create)(unsigned int _num_channels)
+{
+    // validate input
+    if (_num_channels == 0) {
+        fprintf(stderr,"error: agc_bank_%s_create(), number of channels must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create object and allocate per-channel state
+    AGC_BANK() q = (AGC_BANK()) malloc(sizeof(struct AGC_BANK(_s)));
+    q->num_channels = _num_channels;
+    q->g  = (T*) malloc(_num_channels*sizeof(T));
+    q->e  = (T*) malloc(_num_channels*sizeof(T));
+    q->dg = (T*) malloc(_num_channels*sizeof(T));
+    q->g_re  = (T*) malloc((1+TC_COMPLEX)*_num_channels*sizeof(T));
+    q->dg_re = (T*) malloc((1+TC_COMPLEX)*_num_channels*sizeof(T));
+
+    // set default parameters (same as agc object)
+    q->g_min = 1e-6f;
+    q->g_max = 1e+6f;
+    AGC_BANK(_set_bandwidth)(q, 0.0f);
+
+    // reset object
+    AGC_BANK(_reset)(q);
+
+    // return object
+    return q;
+}
+
+// destroy agc bank object, freeing all internally-allocated memory
+void AGC_BANK(_destroy)(AGC_BANK() _q)
+{
+    free(_q->g);
+    free(_q->e);
+    free(_q->dg);
+    free(_q->g_re);
+    free(_q->dg_re);
+    free(_q);
+}
+
+// print agc bank object internals
+void AGC_BANK(_print)(AGC_BANK() _q)
+{
+    printf("agc_bank_%s [%u channels, bandwidth: %12.4e]:\n",
+            EXTENSION_FULL, _q->num_channels, _q->BT);
+}
+
+// reset gain of all channels
+void AGC_BANK(_reset)(AGC_BANK() _q)
+{
+    unsigned int c;
+    for (c=0; c<_q->num_channels; c++)
+        _q->g[c] = 1.0f;
+}
+
+// set gain limits of all channels
+//  _q      :   agc bank object
+//  _g_min  :   minimum allowable gain
+//  _g_max  :   maximum allowable gain
+void AGC_BANK(_set_gain_limits)(AGC_BANK() _q,
+                                T          _g_min,
+                                T          _g_max)
+{
+    // validate input
+    if (_g_min > _g_max) {
+        fprintf(stderr,"error: agc_bank_%s_set_gain_limits(), _g_min < _g_max\n", EXTENSION_FULL);
+        exit(-1);
+    }
+
+    _q->g_min = _g_min;
+    _q->g_max = _g_max;
+}
+
+// set loop bandwidth of all channels
+//  _q      :   agc bank object
+//  _BT     :   bandwidth
+void AGC_BANK(_set_bandwidth)(AGC_BANK() _q,
+                              T          _BT)
+{
+    // check to ensure _BT is reasonable
+    if ( _BT < 0 ) {
+        fprintf(stderr,"error: agc_bank_%s_set_bandwidth(), bandwidth must be positive\n", EXTENSION_FULL);
+        exit(-1);
+    } else if ( _BT > 1.0f ) {
+        fprintf(stderr,"error: agc_bank_%s_set_bandwidth(), bandwidth must less than 1.0\n", EXTENSION_FULL);
+        exit(-1);
+    }
+
+    // set internal bandwidth
+    _q->BT = _BT;
+
+    // ensure normalized bandwidth is less than one
+    float bt = _q->BT;
+    if (bt >= 1.0f) bt = 0.99f;
+
+    // compute coefficients
+    _q->alpha = sqrtf(bt);
+    _q->beta = 1 - _q->alpha;
+}
+
+// execute gain control on a block of samples from all channels
+//  _q      :   agc bank object
+//  _x      :   input, time-major [size: _n x num_channels]
+//  _n      :   number of samples per channel
+//  _y      :   output, time-major [size: _n x num_channels]
+void AGC_BANK(_execute_block)(AGC_BANK()   _q,
+                              TC *         _x,
+                              unsigned int _n,
+                              TC *         _y)
+{
+    if (_n == 0)
+        return;
+
+    unsigned int M = _q->num_channels;
+    T * g  = _q->g;
+    T * e  = _q->e;
+    T * dg = _q->dg;
+    unsigned int i;
+    unsigned int c;
+
+    // estimate signal energy of each channel over block
+    for (c=0; c<M; c++)
+        e[c] = 0.0f;
+    for (i=0; i<_n; i++) {
+        TC * x = &_x[i*M];
+        for (c=0; c<M; c++) {
+#if TC_COMPLEX
+            e[c] += crealf(x[c])*crealf(x[c]) + cimagf(x[c])*cimagf(x[c]);
+#else
+            e[c] += x[c]*x[c];
+#endif
+        }
+    }
+
+    // update gains; the loop filter is stepped once, equivalent to
+    // _n updates with the same instantaneous gain
+    T beta_n = powf(_q->beta, (T)_n);
+    T n_inv  = 1.0f / (T)_n;
+    for (c=0; c<M; c++) {
+        T g_hat = 1.0f / (sqrtf(e[c]*n_inv) + 1e-12f);
+        T g_new = beta_n*g[c] + (1.0f - beta_n)*g_hat;
+
+        // limit gain
+        g_new = g_new > _q->g_max ? _q->g_max : g_new;
+        g_new = g_new < _q->g_min ? _q->g_min : g_new;
+
+        dg[c] = (g_new - g[c]) * n_inv;
+        g[c]  = g_new;
+    }
+
+    // expand gains to each real component
+    T * g_re  = _q->g_re;
+    T * dg_re = _q->dg_re;
+    for (c=0; c<M; c++) {
+#if TC_COMPLEX
+        g_re[2*c] = g_re[2*c+1] = g[c];
+        dg_re[2*c] = dg_re[2*c+1] = dg[c];
+#else
+        g_re[c]  = g[c];
+        dg_re[c] = dg[c];
+#endif
+    }
+
+    // apply gains, interpolating linearly from the previous values
+    // such that the last sample of each channel receives the new gain;
+    // the real components are processed in groups of four, loaded
+    // before any are stored, so that the groups vectorize at -O2 (and
+    // _x may equal _y for in-place operation)
+    unsigned int L = (1+TC_COMPLEX)*M;
+    for (i=0; i<_n; i++) {
+        const T * x  = (const T *) &_x[i*M];
+        T *       y  = (T *)       &_y[i*M];
+        const T * gc = g_re;
+        const T * dc = dg_re;
+        T k = (T)(_n-1-i);
+        for (c=0; c<L/4; c++) {
+            T g0 = gc[0] - dc[0]*k;
+            T g1 = gc[1] - dc[1]*k;
+            T g2 = gc[2] - dc[2]*k;
+            T g3 = gc[3] - dc[3]*k;
+            T x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3];
+            y[0] = x0*g0;
+            y[1] = x1*g1;
+            y[2] = x2*g2;
+            y[3] = x3*g3;
+            x  += 4;
+            y  += 4;
+            gc += 4;
+            dc += 4;
+        }
+        for (c=0; c<L%4; c++)
+            y[c] = x[c]*(gc[c] - dc[c]*k);
+    }
+}
+
+// get gain of a particular channel
+T AGC_BANK(_get_gain)(AGC_BANK()   _q,
+                      unsigned int _channel)
+{
+    if (_channel >= _q->num_channels) {
+        fprintf(stderr,"error: agc_bank_%s_get_gain(), channel index exceeds number of channels\n", EXTENSION_FULL);
+        exit(1);
+    }
+    return _q->g[_channel];
+}
+
+// get estimated signal level (dB) of a particular channel
+T AGC_BANK(_get_rssi)(AGC_BANK()   _q,
+                      unsigned int _channel)
+{
+    return -20.0*log10(AGC_BANK(_get_gain)(_q, _channel));
+}
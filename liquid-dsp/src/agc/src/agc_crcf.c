@@ -29,6 +29,7 @@
 
 // macros
 #define AGC(name)           LIQUID_CONCAT(agc_crcf,name)
+#define AGC_BANK(name)      LIQUID_CONCAT(agc_bank_crcf,name)
 
 #define T                   float           // general
 #define TC                  float complex   // input/output
@@ -37,3 +38,4 @@
 
 // source files
 #include "agc.c"
+#include "agc_bank.c"
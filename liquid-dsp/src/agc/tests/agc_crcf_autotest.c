@@ -167,3 +167,155 @@ void autotest_agc_crcf_rssi_noise()
 
 
 
+
+// 
+// Test AC gain control, block execution
+//
+void autotest_agc_crcf_block_gain_control()
+{
+    // set paramaters
+    float gamma = 0.1f;             // nominal signal level
+    float bt = 0.01f;               // bandwidth-time product
+    float tol = 0.001f;             // error tolerance
+    float dphi = 0.1f;              // NCO frequency
+    unsigned int n = 32;            // block size
+
+    // create AGC object and initialize
+    agc_crcf q = agc_crcf_create();
+    agc_crcf_set_bandwidth(q, bt);
+
+    unsigned int i;
+    unsigned int j;
+    float complex x[n];
+    float complex y[n];
+    for (i=0; i<16; i++) {
+        for (j=0; j<n; j++)
+            x[j] = gamma * cexpf(_Complex_I*(i*n+j)*dphi);
+        agc_crcf_execute_block(q, x, n, y);
+    }
+
+    // Check results
+    CONTEND_DELTA( agc_crcf_get_gain(q), 1.0f/gamma, tol);
+    CONTEND_DELTA( cabsf(y[n-1]), 1.0f, tol);
+
+    // lock: gain applied without change
+    agc_crcf_lock(q);
+    float g = agc_crcf_get_gain(q);
+    agc_crcf_execute_block(q, x, n, y);
+    for (j=0; j<n; j++)
+        CONTEND_DELTA( cabsf(y[j] - g*x[j]), 0.0f, 1e-6f );
+
+    // destroy AGC object
+    agc_crcf_destroy(q);
+}
+
+// 
+// Test bank of AGCs against individual objects
+//
+void autotest_agc_bank_crcf()
+{
+    // set paramaters
+    unsigned int M = 7;             // number of channels
+    unsigned int n = 24;            // block size
+    float bt = 0.01f;               // bandwidth-time product
+    float tol = 0.001f;             // error tolerance
+
+    // create objects
+    agc_bank_crcf bank = agc_bank_crcf_create(M);
+    agc_bank_crcf_set_bandwidth(bank, bt);
+    agc_crcf q[M];
+    unsigned int c;
+    for (c=0; c<M; c++) {
+        q[c] = agc_crcf_create();
+        agc_crcf_set_bandwidth(q[c], bt);
+    }
+
+    unsigned int i;
+    unsigned int j;
+    float complex x[n*M];           // time-major input
+    float complex y[n*M];           // time-major output
+    float complex xc[n];            // single-channel input
+    float complex yc[n];            // single-channel output
+    for (i=0; i<12; i++) {
+        // channel c has level 0.05*(c+1) and frequency 0.03*c
+        for (j=0; j<n; j++) {
+            for (c=0; c<M; c++)
+                x[j*M+c] = 0.05f*(c+1) * cexpf(_Complex_I*0.03f*c*(i*n+j));
+        }
+        agc_bank_crcf_execute_block(bank, x, n, y);
+
+        // compare to individual objects
+        for (c=0; c<M; c++) {
+            for (j=0; j<n; j++)
+                xc[j] = x[j*M+c];
+            agc_crcf_execute_block(q[c], xc, n, yc);
+            for (j=0; j<n; j++)
+                CONTEND_DELTA( cabsf(y[j*M+c] - yc[j]), 0.0f, 1e-4f );
+        }
+    }
+
+    // Check results
+    for (c=0; c<M; c++) {
+        CONTEND_DELTA( agc_bank_crcf_get_gain(bank,c), 1.0f/(0.05f*(c+1)), 20*tol);
+        CONTEND_DELTA( cabsf(y[(n-1)*M+c]), 1.0f, tol);
+    }
+
+    // destroy objects
+    agc_bank_crcf_destroy(bank);
+    for (c=0; c<M; c++)
+        agc_crcf_destroy(q[c]);
+}
+
+// 
+// Test in-place block execution (_x == _y) of agc and agc bank
+//
+void autotest_agc_crcf_block_inplace()
+{
+    // set paramaters
+    unsigned int M = 7;             // number of bank channels
+    unsigned int n = 37;            // block size (not a multiple of 4)
+    float bt = 0.01f;               // bandwidth-time product
+
+    // create objects: one of each run out of place, one in place
+    agc_crcf      q0 = agc_crcf_create();
+    agc_crcf      q1 = agc_crcf_create();
+    agc_bank_crcf b0 = agc_bank_crcf_create(M);
+    agc_bank_crcf b1 = agc_bank_crcf_create(M);
+    agc_crcf_set_bandwidth(q0, bt);
+    agc_crcf_set_bandwidth(q1, bt);
+    agc_bank_crcf_set_bandwidth(b0, bt);
+    agc_bank_crcf_set_bandwidth(b1, bt);
+
+    unsigned int i;
+    unsigned int j;
+    float complex x[n*M];
+    float complex y[n*M];
+    float complex z[n*M];           // input, overwritten with output
+    for (i=0; i<4; i++) {
+        // single object
+        for (j=0; j<n; j++)
+            x[j] = z[j] = 0.2f*(i+1) * cexpf(_Complex_I*0.1f*(i*n+j));
+        agc_crcf_execute_block(q0, x, n, y);
+        agc_crcf_execute_block(q1, z, n, z);
+        for (j=0; j<n; j++) {
+            CONTEND_EQUALITY( crealf(y[j]), crealf(z[j]) );
+            CONTEND_EQUALITY( cimagf(y[j]), cimagf(z[j]) );
+        }
+
+        // bank
+        for (j=0; j<n*M; j++)
+            x[j] = z[j] = 0.05f*(j%M+1) * cexpf(_Complex_I*0.03f*(i*n*M+j));
+        agc_bank_crcf_execute_block(b0, x, n, y);
+        agc_bank_crcf_execute_block(b1, z, n, z);
+        for (j=0; j<n*M; j++) {
+            CONTEND_EQUALITY( crealf(y[j]), crealf(z[j]) );
+            CONTEND_EQUALITY( cimagf(y[j]), cimagf(z[j]) );
+        }
+    }
+
+    // destroy objects
+    agc_crcf_destroy(q0);
+    agc_crcf_destroy(q1);
+    agc_bank_crcf_destroy(b0);
+    agc_bank_crcf_destroy(b1);
+}
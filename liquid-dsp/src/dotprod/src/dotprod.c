@@ -46,7 +46,7 @@ void DOTPROD(_run)(TC *         _h,
 
     unsigned int i;
     for (i=0; i<_n; i++)
-        r += _h[i] * _x[i];
+        r += TMUL(_h[i], _x[i]);
 
     // return result
     *_y = r;
@@ -71,15 +71,15 @@ void DOTPROD(_run4)(TC *         _h,
     // compute dotprod in groups of 4
     unsigned int i;
     for (i=0; i<t; i+=4) {
-        r += _h[i]   * _x[i];
-        r += _h[i+1] * _x[i+1];
-        r += _h[i+2] * _x[i+2];
-        r += _h[i+3] * _x[i+3];
+        r += TMUL(_h[i],   _x[i]);
+        r += TMUL(_h[i+1], _x[i+1]);
+        r += TMUL(_h[i+2], _x[i+2]);
+        r += TMUL(_h[i+3], _x[i+3]);
     }
 
     // clean up remaining
     for ( ; i<_n; i++)
-        r += _h[i] * _x[i];
+        r += TMUL(_h[i], _x[i]);
 
     // return result
     *_y = r;
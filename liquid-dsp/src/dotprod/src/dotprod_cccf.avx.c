@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 
+// Floating-point dot product (AVX2/FMA)
+//
+// NOTE: this file is compiled with -mavx2 -mfma and must only be
+//       called after the CPU has been verified to support these
+//       extensions (see liquid_simd_level() in dotprod_simd.mmx.c)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// fold eight-value AVX register down to { sum(even), sum(odd) }
+static inline __m128 dotprod_cccf_fold_avx(__m256 _v)
+{
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(_v),
+                          _mm256_extractf128_ps(_v, 1));
+    return _mm_add_ps(s, _mm_movehl_ps(s, s));
+}
+
+// run dot product using AVX2/FMA extensions
+//
+// (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+//
+// Input samples are multiplied by the repeated real (hi) and
+// imaginary (hq) coefficients arrays and accumulated separately:
+//
+//  sumi = { x.real*h.real, x.imag*h.real, ... }
+//  sumq = { x.real*h.imag, x.imag*h.imag, ... }
+//
+// and combined once at the end of the loop.
+//
+//  _hi     :   real coefficients, repeated [size: 1 x 2*_n]
+//  _hq     :   imag coefficients, repeated [size: 1 x 2*_n]
+//  _x      :   input array [size: 1 x _n]
+//  _n      :   input lengths
+//  _y      :   output dot product
+void dotprod_cccf_run_avx(float *         _hi,
+                          float *         _hq,
+                          float complex * _x,
+                          unsigned int    _n,
+                          float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_n;
+
+    __m256 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m256 sumi0 = _mm256_setzero_ps();
+    __m256 sumi1 = _mm256_setzero_ps();
+    __m256 sumq0 = _mm256_setzero_ps();
+    __m256 sumq1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16)
+    unsigned int r = (n >> 4) << 4;
+
+    // unrolled loop, two independent accumulators per component
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        v0 = _mm256_loadu_ps(&x[i  ]);
+        v1 = _mm256_loadu_ps(&x[i+8]);
+
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_loadu_ps(&_hi[i  ]), sumi0);
+        sumi1 = _mm256_fmadd_ps(v1, _mm256_loadu_ps(&_hi[i+8]), sumi1);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_loadu_ps(&_hq[i  ]), sumq0);
+        sumq1 = _mm256_fmadd_ps(v1, _mm256_loadu_ps(&_hq[i+8]), sumq1);
+    }
+
+    // t = 8*floor(n/8)
+    unsigned int t = (n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0 = _mm256_loadu_ps(&x[i]);
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_loadu_ps(&_hi[i]), sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_loadu_ps(&_hq[i]), sumq0);
+    }
+
+    // fold down to { even, odd } sums
+    float wi[4] __attribute__((aligned(16)));
+    float wq[4] __attribute__((aligned(16)));
+    _mm_store_ps(wi, dotprod_cccf_fold_avx(_mm256_add_ps(sumi0, sumi1)));
+    _mm_store_ps(wq, dotprod_cccf_fold_avx(_mm256_add_ps(sumq0, sumq1)));
+
+    // combine
+    float complex total = (wi[0] - wq[1]) + (wi[1] + wq[0]) * _Complex_I;
+
+    // cleanup
+    for (i=t/2; i<_n; i++)
+        total += _x[i] * ( _hi[2*i] + _hq[2*i]*_Complex_I );
+
+    // set return value
+    *_y = total;
+}
+
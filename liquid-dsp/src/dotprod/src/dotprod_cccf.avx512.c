@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 
+// Floating-point dot product (AVX-512)
+//
+// NOTE: this file is compiled with -mavx512f and must only be
+//       called after the CPU has been verified to support these
+//       extensions (see liquid_simd_level() in dotprod_simd.mmx.c)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// run dot product using AVX-512 extensions (see dotprod_cccf.avx.c
+// for a description of the repeated coefficients layout)
+//  _hi     :   real coefficients, repeated [size: 1 x 2*_n]
+//  _hq     :   imag coefficients, repeated [size: 1 x 2*_n]
+//  _x      :   input array [size: 1 x _n]
+//  _n      :   input lengths
+//  _y      :   output dot product
+void dotprod_cccf_run_avx512(float *         _hi,
+                             float *         _hq,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_n;
+
+    __m512 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m512 sumi0 = _mm512_setzero_ps();
+    __m512 sumi1 = _mm512_setzero_ps();
+    __m512 sumq0 = _mm512_setzero_ps();
+    __m512 sumq1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (n >> 5) << 5;
+
+    // unrolled loop, two independent accumulators per component
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        v0 = _mm512_loadu_ps(&x[i   ]);
+        v1 = _mm512_loadu_ps(&x[i+16]);
+
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_loadu_ps(&_hi[i   ]), sumi0);
+        sumi1 = _mm512_fmadd_ps(v1, _mm512_loadu_ps(&_hi[i+16]), sumi1);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_loadu_ps(&_hq[i   ]), sumq0);
+        sumq1 = _mm512_fmadd_ps(v1, _mm512_loadu_ps(&_hq[i+16]), sumq1);
+    }
+
+    // t = 16*floor(n/16)
+    unsigned int t = (n >> 4) << 4;
+    for ( ; i<t; i+=16) {
+        v0 = _mm512_loadu_ps(&x[i]);
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_loadu_ps(&_hi[i]), sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_loadu_ps(&_hq[i]), sumq0);
+    }
+
+    // cleanup using masked loads (remaining values are zero)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        v1 = _mm512_maskz_loadu_ps(m, &x[i]);
+        sumi1 = _mm512_fmadd_ps(v1, _mm512_maskz_loadu_ps(m, &_hi[i]), sumi1);
+        sumq1 = _mm512_fmadd_ps(v1, _mm512_maskz_loadu_ps(m, &_hq[i]), sumq1);
+    }
+
+    // fold down
+    sumi0 = _mm512_add_ps(sumi0, sumi1);
+    sumq0 = _mm512_add_ps(sumq0, sumq1);
+
+    // combine: (xi*hi - xq*hq) + j(xq*hi + xi*hq)
+    float yi = _mm512_mask_reduce_add_ps(0x5555, sumi0) -
+               _mm512_mask_reduce_add_ps(0xaaaa, sumq0);
+    float yq = _mm512_mask_reduce_add_ps(0xaaaa, sumi0) +
+               _mm512_mask_reduce_add_ps(0x5555, sumq0);
+
+    // set return value
+    *_y = yi + _Complex_I*yq;
+}
+
@@ -28,5 +28,6 @@
 #define TO              float complex
 #define TC              float complex
 #define TI              float complex
+#define TMUL(H,X)       liquid_cmulf(H,X)
 
 #include "dotprod.c"
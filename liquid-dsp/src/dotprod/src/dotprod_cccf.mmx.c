@@ -56,6 +56,19 @@ void dotprod_cccf_execute_mmx(dotprod_cccf    _q,
 void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
                                float complex * _x,
                                float complex * _y);
+void dotprod_cccf_execute_sse(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y);
+#if LIQUID_DOTPROD_AVX2
+void dotprod_cccf_execute_avx(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y);
+#endif
+#if LIQUID_DOTPROD_AVX512
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_cccf_run(float complex * _h,
@@ -66,7 +79,7 @@ void dotprod_cccf_run(float complex * _h,
     float complex r = 0;
     unsigned int i;
     for (i=0; i<_n; i++)
-        r += _h[i] * _x[i];
+        r += liquid_cmulf(_h[i], _x[i]);
     *_y = r;
 }
 
@@ -84,15 +97,15 @@ void dotprod_cccf_run4(float complex * _h,
     // compute dotprod in groups of 4
     unsigned int i;
     for (i=0; i<t; i+=4) {
-        r += _h[i]   * _x[i];
-        r += _h[i+1] * _x[i+1];
-        r += _h[i+2] * _x[i+2];
-        r += _h[i+3] * _x[i+3];
+        r += liquid_cmulf(_h[i],   _x[i]);
+        r += liquid_cmulf(_h[i+1], _x[i+1]);
+        r += liquid_cmulf(_h[i+2], _x[i+2]);
+        r += liquid_cmulf(_h[i+3], _x[i+3]);
     }
 
     // clean up remaining
     for ( ; i<_n; i++)
-        r += _h[i] * _x[i];
+        r += liquid_cmulf(_h[i], _x[i]);
 
     *_y = r;
 }
@@ -106,6 +119,9 @@ struct dotprod_cccf_s {
     unsigned int n;     // length
     float * hi;         // in-phase
     float * hq;         // quadrature
+
+    // execute method, selected at create time (see liquid_simd_level())
+    void (*execute)(dotprod_cccf _q, float complex * _x, float complex * _y);
 };
 
 dotprod_cccf dotprod_cccf_create(float complex * _h,
@@ -114,9 +130,9 @@ dotprod_cccf dotprod_cccf_create(float complex * _h,
     dotprod_cccf q = (dotprod_cccf)malloc(sizeof(struct dotprod_cccf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
-    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
+    // allocate memory for coefficients, 64-byte aligned
+    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
+    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
 
     // set coefficients, repeated
     //  hi = { crealf(_h[0]), crealf(_h[0]), ... crealf(_h[n-1]), crealf(_h[n-1])}
@@ -130,6 +146,17 @@ dotprod_cccf dotprod_cccf_create(float complex * _h,
         q->hq[2*i+1] = cimagf(_h[i]);
     }
 
+    // select execute method based on host CPU
+    switch (liquid_simd_level()) {
+#if LIQUID_DOTPROD_AVX512
+    case LIQUID_SIMD_AVX512: q->execute = dotprod_cccf_execute_avx512; break;
+#endif
+#if LIQUID_DOTPROD_AVX2
+    case LIQUID_SIMD_AVX2:   q->execute = dotprod_cccf_execute_avx;    break;
+#endif
+    default:                 q->execute = dotprod_cccf_execute_sse;
+    }
+
     // return object
     return q;
 }
@@ -154,7 +181,8 @@ void dotprod_cccf_destroy(dotprod_cccf _q)
 
 void dotprod_cccf_print(dotprod_cccf _q)
 {
-    printf("dotprod_cccf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_cccf [%s, %u coefficients]\n",
+            liquid_simd_str[liquid_simd_level()], _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("  %3u : %12.9f +j%12.9f\n", i, _q->hi[i], _q->hq[i]);
@@ -167,6 +195,34 @@ void dotprod_cccf_print(dotprod_cccf _q)
 void dotprod_cccf_execute(dotprod_cccf    _q,
                           float complex * _x,
                           float complex * _y)
+{
+    _q->execute(_q, _x, _y);
+}
+
+#if LIQUID_DOTPROD_AVX2
+// use AVX2/FMA extensions
+void dotprod_cccf_execute_avx(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y)
+{
+    dotprod_cccf_run_avx(_q->hi, _q->hq, _x, _q->n, _y);
+}
+#endif
+
+#if LIQUID_DOTPROD_AVX512
+// use AVX-512 extensions
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    dotprod_cccf_run_avx512(_q->hi, _q->hq, _x, _q->n, _y);
+}
+#endif
+
+// use MMX/SSE extensions, switching based on size
+void dotprod_cccf_execute_sse(dotprod_cccf    _q,
+                              float complex * _x,
+                              float complex * _y)
 {
     // switch based on size
     if (_q->n < 32) {
@@ -50,7 +50,7 @@ void dotprod_cccf_run(float complex * _h,
     float complex r = 0;
     unsigned int i;
     for (i=0; i<_n; i++)
-        r += _h[i] * _x[i];
+        r += liquid_cmulf(_h[i], _x[i]);
     *_y = r;
 }
 
@@ -68,15 +68,15 @@ void dotprod_cccf_run4(float complex * _h,
     // compute dotprod in groups of 4
     unsigned int i;
     for (i=0; i<t; i+=4) {
-        r += _h[i]   * _x[i];
-        r += _h[i+1] * _x[i+1];
-        r += _h[i+2] * _x[i+2];
-        r += _h[i+3] * _x[i+3];
+        r += liquid_cmulf(_h[i],   _x[i]);
+        r += liquid_cmulf(_h[i+1], _x[i+1]);
+        r += liquid_cmulf(_h[i+2], _x[i+2]);
+        r += liquid_cmulf(_h[i+3], _x[i+3]);
     }
 
     // clean up remaining
     for ( ; i<_n; i++)
-        r += _h[i] * _x[i];
+        r += liquid_cmulf(_h[i], _x[i]);
 
     *_y = r;
 }
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 
+// Floating-point dot product (AVX-512)
+//
+// NOTE: this file is compiled with -mavx512f and must only be
+//       called after the CPU has been verified to support these
+//       extensions (see liquid_simd_level() in dotprod_simd.mmx.c)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// run dot product using AVX-512 extensions
+//  _h      :   coefficients array, each value repeated [size: 1 x 2*_n]
+//              h = { h[0], h[0], h[1], h[1], ... h[n-1], h[n-1] }
+//  _x      :   input array [size: 1 x _n]
+//  _n      :   input lengths
+//  _y      :   output dot product
+void dotprod_crcf_run_avx512(float *         _h,
+                             float complex * _x,
+                             unsigned int    _n,
+                             float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_n;
+
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+
+    // r = 64*floor(n/64)
+    unsigned int r = (n >> 6) << 6;
+
+    // unrolled loop, four independent accumulators [re, im, re, im, ...]
+    unsigned int i;
+    for (i=0; i<r; i+=64) {
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i   ]), _mm512_loadu_ps(&_h[i   ]), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+16]), _mm512_loadu_ps(&_h[i+16]), sum1);
+        sum2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+32]), _mm512_loadu_ps(&_h[i+32]), sum2);
+        sum3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+48]), _mm512_loadu_ps(&_h[i+48]), sum3);
+    }
+
+    // t = 16*floor(n/16)
+    unsigned int t = (n >> 4) << 4;
+    for ( ; i<t; i+=16)
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i]), _mm512_loadu_ps(&_h[i]), sum0);
+
+    // cleanup using masked loads (remaining values are zero)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x[i]),
+                               _mm512_maskz_loadu_ps(m, &_h[i]),
+                               sum1);
+    }
+
+    // fold down into single register
+    sum0 = _mm512_add_ps(sum0, sum1);
+    sum2 = _mm512_add_ps(sum2, sum3);
+    sum0 = _mm512_add_ps(sum0, sum2);
+
+    // separate in-phase (even) and quadrature (odd) components
+    float yi = _mm512_mask_reduce_add_ps(0x5555, sum0);
+    float yq = _mm512_mask_reduce_add_ps(0xaaaa, sum0);
+
+    // set return value
+    *_y = yi + _Complex_I*yq;
+}
+
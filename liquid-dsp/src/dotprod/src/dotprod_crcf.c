@@ -28,5 +28,6 @@
 #define TO              float complex
 #define TC              float
 #define TI              float complex
+#define TMUL(H,X)       ((H)*(X))
 
 #include "dotprod.c"
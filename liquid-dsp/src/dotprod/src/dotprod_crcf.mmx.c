@@ -38,6 +38,19 @@ void dotprod_crcf_execute_mmx(dotprod_crcf    _q,
 void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
                                float complex * _x,
                                float complex * _y);
+void dotprod_crcf_execute_sse(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y);
+#if LIQUID_DOTPROD_AVX2
+void dotprod_crcf_execute_avx(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y);
+#endif
+#if LIQUID_DOTPROD_AVX512
+void dotprod_crcf_execute_avx512(dotprod_crcf    _q,
+                                 float complex * _x,
+                                 float complex * _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_crcf_run(float *         _h,
@@ -87,6 +100,9 @@ void dotprod_crcf_run4(float *         _h,
 struct dotprod_crcf_s {
     unsigned int n;     // length
     float * h;          // coefficients array
+
+    // execute method, selected at create time (see liquid_simd_level())
+    void (*execute)(dotprod_crcf _q, float complex * _x, float complex * _y);
 };
 
 dotprod_crcf dotprod_crcf_create(float *      _h,
@@ -95,8 +111,8 @@ dotprod_crcf dotprod_crcf_create(float *      _h,
     dotprod_crcf q = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
+    // allocate memory for coefficients, 64-byte aligned
+    q->h = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
 
     // set coefficients, repeated
     //  h = { _h[0], _h[0], _h[1], _h[1], ... _h[n-1], _h[n-1]}
@@ -106,6 +122,17 @@ dotprod_crcf dotprod_crcf_create(float *      _h,
         q->h[2*i+1] = _h[i];
     }
 
+    // select execute method based on host CPU
+    switch (liquid_simd_level()) {
+#if LIQUID_DOTPROD_AVX512
+    case LIQUID_SIMD_AVX512: q->execute = dotprod_crcf_execute_avx512; break;
+#endif
+#if LIQUID_DOTPROD_AVX2
+    case LIQUID_SIMD_AVX2:   q->execute = dotprod_crcf_execute_avx;    break;
+#endif
+    default:                 q->execute = dotprod_crcf_execute_sse;
+    }
+
     // return object
     return q;
 }
@@ -131,7 +158,8 @@ void dotprod_crcf_print(dotprod_crcf _q)
 {
     // print coefficients to screen, skipping odd entries (due
     // to repeated coefficients)
-    printf("dotprod_crcf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_crcf [%s, %u coefficients]\n",
+            liquid_simd_str[liquid_simd_level()], _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("  %3u : %12.9f\n", i, _q->h[2*i]);
@@ -141,6 +169,34 @@ void dotprod_crcf_print(dotprod_crcf _q)
 void dotprod_crcf_execute(dotprod_crcf    _q,
                           float complex * _x,
                           float complex * _y)
+{
+    _q->execute(_q, _x, _y);
+}
+
+#if LIQUID_DOTPROD_AVX2
+// use AVX2/FMA extensions
+void dotprod_crcf_execute_avx(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y)
+{
+    dotprod_crcf_run_avx(_q->h, _x, _q->n, _y);
+}
+#endif
+
+#if LIQUID_DOTPROD_AVX512
+// use AVX-512 extensions
+void dotprod_crcf_execute_avx512(dotprod_crcf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    dotprod_crcf_run_avx512(_q->h, _x, _q->n, _y);
+}
+#endif
+
+// use MMX/SSE extensions, switching based on size
+void dotprod_crcf_execute_sse(dotprod_crcf    _q,
+                              float complex * _x,
+                              float complex * _y)
 {
     // switch based on size
     if (_q->n < 32) {
@@ -27,5 +27,6 @@
 #define TO              float
 #define TC              float
 #define TI              float
+#define TMUL(H,X)       ((H)*(X))
 
 #include "dotprod.c"
@@ -56,6 +56,19 @@ void dotprod_rrrf_execute_mmx(dotprod_rrrf _q,
 void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
                                float *      _x,
                                float *      _y);
+void dotprod_rrrf_execute_sse(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y);
+#if LIQUID_DOTPROD_AVX2
+void dotprod_rrrf_execute_avx(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y);
+#endif
+#if LIQUID_DOTPROD_AVX512
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_rrrf_run(float *      _h,
@@ -105,6 +118,9 @@ void dotprod_rrrf_run4(float *      _h,
 struct dotprod_rrrf_s {
     unsigned int n;     // length
     float * h;          // coefficients array
+
+    // execute method, selected at create time (see liquid_simd_level())
+    void (*execute)(dotprod_rrrf _q, float * _x, float * _y);
 };
 
 dotprod_rrrf dotprod_rrrf_create(float *      _h,
@@ -113,12 +129,23 @@ dotprod_rrrf dotprod_rrrf_create(float *      _h,
     dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( q->n*sizeof(float), 16);
+    // allocate memory for coefficients, 64-byte aligned
+    q->h = (float*) _mm_malloc( q->n*sizeof(float), 64);
 
     // set coefficients
     memmove(q->h, _h, _n*sizeof(float));
 
+    // select execute method based on host CPU
+    switch (liquid_simd_level()) {
+#if LIQUID_DOTPROD_AVX512
+    case LIQUID_SIMD_AVX512: q->execute = dotprod_rrrf_execute_avx512; break;
+#endif
+#if LIQUID_DOTPROD_AVX2
+    case LIQUID_SIMD_AVX2:   q->execute = dotprod_rrrf_execute_avx;    break;
+#endif
+    default:                 q->execute = dotprod_rrrf_execute_sse;
+    }
+
     // return object
     return q;
 }
@@ -142,7 +169,8 @@ void dotprod_rrrf_destroy(dotprod_rrrf _q)
 
 void dotprod_rrrf_print(dotprod_rrrf _q)
 {
-    printf("dotprod_rrrf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_rrrf [%s, %u coefficients]\n",
+            liquid_simd_str[liquid_simd_level()], _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("%3u : %12.9f\n", i, _q->h[i]);
@@ -152,6 +180,34 @@ void dotprod_rrrf_print(dotprod_rrrf _q)
 void dotprod_rrrf_execute(dotprod_rrrf _q,
                           float *      _x,
                           float *      _y)
+{
+    _q->execute(_q, _x, _y);
+}
+
+#if LIQUID_DOTPROD_AVX2
+// use AVX2/FMA extensions
+void dotprod_rrrf_execute_avx(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y)
+{
+    dotprod_rrrf_run_avx(_q->h, _x, _q->n, _y);
+}
+#endif
+
+#if LIQUID_DOTPROD_AVX512
+// use AVX-512 extensions
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y)
+{
+    dotprod_rrrf_run_avx512(_q->h, _x, _q->n, _y);
+}
+#endif
+
+// use MMX/SSE extensions, switching based on size
+void dotprod_rrrf_execute_sse(dotprod_rrrf _q,
+                              float *      _x,
+                              float *      _y)
 {
     // switch based on size
     if (_q->n < 16) {
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Run-time selection of x86 SIMD dot product kernels
+//
+// The SSE kernels in the *.mmx.c files are always available; the
+// AVX2/FMA (*.avx.c) and AVX-512 (*.avx512.c) kernels are compiled
+// with their own instruction-set flags when the compiler supports
+// them and are only selected when the host CPU does as well. This
+// allows the same library binary to run on any x86 host while still
+// taking advantage of wider vectors where present.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// string names for each SIMD level
+const char * liquid_simd_str[3] = {"sse", "avx2", "avx512"};
+
+// determine the highest SIMD kernel level supported by both this
+// build and the host CPU; the result is computed once and cached.
+// The level may be capped by setting the LIQUID_SIMD environment
+// variable to "sse" or "avx2", e.g. to obtain identical results
+// across hosts with different instruction sets.
+int liquid_simd_level(void)
+{
+    static int level = -1;
+    if (level >= 0)
+        return level;
+
+    int l = LIQUID_SIMD_SSE;
+
+#if LIQUID_DOTPROD_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        l = LIQUID_SIMD_AVX2;
+#endif
+
+#if LIQUID_DOTPROD_AVX2 && LIQUID_DOTPROD_AVX512
+    if (l == LIQUID_SIMD_AVX2 && __builtin_cpu_supports("avx512f"))
+        l = LIQUID_SIMD_AVX512;
+#endif
+
+    // apply user-specified cap, if any
+    char * env = getenv("LIQUID_SIMD");
+    if (env != NULL) {
+        int i;
+        for (i=LIQUID_SIMD_SSE; i<=LIQUID_SIMD_AVX512; i++) {
+            if (strcmp(env, liquid_simd_str[i])==0 && i < l) {
+                l = i;
+                break;
+            }
+        }
+    }
+
+    level = l;
+    return level;
+}
+
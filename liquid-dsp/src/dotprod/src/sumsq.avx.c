@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// sumsq.avx.c : floating-point sum of squares (AVX2/FMA)
+//
+// NOTE: this file is compiled with -mavx2 -mfma and must only be
+//       called after the CPU has been verified to support these
+//       extensions (see liquid_simd_level() in dotprod_simd.mmx.c)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// sum squares using AVX2/FMA extensions
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqf_avx(float *      _v,
+                        unsigned int _n)
+{
+    __m256 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16)
+    unsigned int r = (_n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        v0 = _mm256_loadu_ps(&_v[i  ]);
+        v1 = _mm256_loadu_ps(&_v[i+8]);
+        sum0 = _mm256_fmadd_ps(v0, v0, sum0);
+        sum1 = _mm256_fmadd_ps(v1, v1, sum1);
+    }
+
+    // t = 8*floor(n/8)
+    unsigned int t = (_n >> 3) << 3;
+    for ( ; i<t; i+=8) {
+        v0 = _mm256_loadu_ps(&_v[i]);
+        sum0 = _mm256_fmadd_ps(v0, v0, sum0);
+    }
+
+    // fold down into single value
+    sum0 = _mm256_add_ps(sum0, sum1);
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(sum0),
+                          _mm256_extractf128_ps(sum0, 1));
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1,1,1,1)));
+    float total = _mm_cvtss_f32(s);
+
+    // cleanup
+    for (; i<_n; i++)
+        total += _v[i] * _v[i];
+
+    // set return value
+    return total;
+}
+
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// sumsq.avx512.c : floating-point sum of squares (AVX-512)
+//
+// NOTE: this file is compiled with -mavx512f and must only be
+//       called after the CPU has been verified to support these
+//       extensions (see liquid_simd_level() in dotprod_simd.mmx.c)
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// sum squares using AVX-512 extensions
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqf_avx512(float *      _v,
+                           unsigned int _n)
+{
+    __m512 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32)
+    unsigned int r = (_n >> 5) << 5;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        v0 = _mm512_loadu_ps(&_v[i   ]);
+        v1 = _mm512_loadu_ps(&_v[i+16]);
+        sum0 = _mm512_fmadd_ps(v0, v0, sum0);
+        sum1 = _mm512_fmadd_ps(v1, v1, sum1);
+    }
+
+    // t = 16*floor(n/16)
+    unsigned int t = (_n >> 4) << 4;
+    for ( ; i<t; i+=16) {
+        v0 = _mm512_loadu_ps(&_v[i]);
+        sum0 = _mm512_fmadd_ps(v0, v0, sum0);
+    }
+
+    // cleanup using masked load (remaining values are zero)
+    if (i < _n) {
+        __mmask16 m = (__mmask16)((1u << (_n - i)) - 1);
+        v1 = _mm512_maskz_loadu_ps(m, &_v[i]);
+        sum1 = _mm512_fmadd_ps(v1, v1, sum1);
+    }
+
+    // set return value
+    return _mm512_reduce_add_ps(_mm512_add_ps(sum0, sum1));
+}
+
@@ -46,11 +46,40 @@
 #include <pmmintrin.h>  // SSE3
 #endif
 
+// sum squares using MMX/SSE extensions
+float liquid_sumsqf_mmx(float *      _v,
+                        unsigned int _n);
+
+// sum squares kernel, selected on first use (see liquid_simd_level())
+static float (*liquid_sumsqf_kernel)(float *, unsigned int) = NULL;
+
 // sum squares, basic loop
 //  _v      :   input array [size: 1 x _n]
 //  _n      :   input length
 float liquid_sumsqf(float *      _v,
                     unsigned int _n)
+{
+    // select kernel based on host CPU
+    if (liquid_sumsqf_kernel == NULL) {
+        switch (liquid_simd_level()) {
+#if LIQUID_DOTPROD_AVX512
+        case LIQUID_SIMD_AVX512: liquid_sumsqf_kernel = liquid_sumsqf_avx512; break;
+#endif
+#if LIQUID_DOTPROD_AVX2
+        case LIQUID_SIMD_AVX2:   liquid_sumsqf_kernel = liquid_sumsqf_avx;    break;
+#endif
+        default:                 liquid_sumsqf_kernel = liquid_sumsqf_mmx;
+        }
+    }
+
+    return liquid_sumsqf_kernel(_v, _n);
+}
+
+// sum squares using MMX/SSE extensions
+//  _v      :   input array [size: 1 x _n]
+//  _n      :   input length
+float liquid_sumsqf_mmx(float *      _v,
+                        unsigned int _n)
 {
     // first cut: ...
     __m128 v;   // input vector
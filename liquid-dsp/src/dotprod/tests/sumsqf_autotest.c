@@ -51,6 +51,26 @@ void autotest_sumsqf_8()    {   sumsqf_runtest( sumsqf_test_x8,  8,  sumsqf_test
 void autotest_sumsqf_15()   {   sumsqf_runtest( sumsqf_test_x15, 15, sumsqf_test_y15 ); }
 void autotest_sumsqf_16()   {   sumsqf_runtest( sumsqf_test_x16, 16, sumsqf_test_y16 ); }
 
+// compare against ordinal computation for many lengths (exercises
+// unrolled loops and cleanup of each SIMD kernel)
+void autotest_sumsqf_lengths()
+{
+    float tol = 1e-4f;
+    float x[257];
+    unsigned int i;
+    for (i=0; i<257; i++)
+        x[i] = randnf();
+
+    unsigned int n;
+    for (n=1; n<=257; n++) {
+        float y_test = 0.0f;
+        for (i=0; i<n; i++)
+            y_test += x[i]*x[i];
+
+        CONTEND_DELTA( liquid_sumsqf(x, n) / y_test, 1.0f, tol );
+    }
+}
+
 float sumsqf_test_x3[3] = {
   -0.4546496371984978f,
    0.4451201395218938f,
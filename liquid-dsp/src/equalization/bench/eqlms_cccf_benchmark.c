@@ -80,4 +80,55 @@ void benchmark_eqlms_cccf_n8    EQLMS_CCCF_TRAIN_BENCH_API(8)
 void benchmark_eqlms_cccf_n16   EQLMS_CCCF_TRAIN_BENCH_API(16)
 void benchmark_eqlms_cccf_n32   EQLMS_CCCF_TRAIN_BENCH_API(32)
 void benchmark_eqlms_cccf_n64   EQLMS_CCCF_TRAIN_BENCH_API(64)
+void benchmark_eqlms_cccf_n128  EQLMS_CCCF_TRAIN_BENCH_API(128)
+void benchmark_eqlms_cccf_n256  EQLMS_CCCF_TRAIN_BENCH_API(256)
+
+#define EQLMS_CCCF_BLOCK_BENCH_API(N)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ eqlms_cccf_block_bench(_start, _finish, _num_iterations, N); }
+
+// frequency-domain block training; one iteration is one symbol
+void eqlms_cccf_block_bench(struct rusage *_start,
+                            struct rusage *_finish,
+                            unsigned long int *_num_iterations,
+                            unsigned int _h_len)
+{
+    // scale number of iterations appropriately
+    *_num_iterations *= 8;
+    *_num_iterations = (*_num_iterations < _h_len) ? _h_len : *_num_iterations;
+    unsigned long int num_blocks = *_num_iterations / _h_len;
+    *_num_iterations = num_blocks * _h_len;
+
+    eqlms_cccf eq = eqlms_cccf_create(NULL,_h_len);
+    
+    unsigned long int i;
+
+    // set up initial arrays to 'randomize' inputs/outputs
+    float complex x[_h_len];
+    float complex d[_h_len];
+    float complex y[_h_len];
+    for (i=0; i<_h_len; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        d[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_blocks; i++) {
+        eqlms_cccf_execute_block(eq, x, y); // compute block of outputs
+        eqlms_cccf_step_block(eq, d, y);    // step equalizer internals
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    eqlms_cccf_destroy(eq);
+}
+
+// 
+void benchmark_eqlms_cccf_block_n16     EQLMS_CCCF_BLOCK_BENCH_API(16)
+void benchmark_eqlms_cccf_block_n32     EQLMS_CCCF_BLOCK_BENCH_API(32)
+void benchmark_eqlms_cccf_block_n64     EQLMS_CCCF_BLOCK_BENCH_API(64)
+void benchmark_eqlms_cccf_block_n128    EQLMS_CCCF_BLOCK_BENCH_API(128)
+void benchmark_eqlms_cccf_block_n256    EQLMS_CCCF_BLOCK_BENCH_API(256)
 
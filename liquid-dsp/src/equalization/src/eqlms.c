@@ -33,17 +33,39 @@ struct EQLMS(_s) {
 
     // internal matrices
     T * h0;             // initial coefficients
-    T * w0, * w1;       // weights [px1]
+    T * w0;             // weights [px1]
 
     unsigned int n;     // input counter
     WINDOW() buffer;    // input buffer
     wdelayf x2;         // buffer of |x|^2 values
     float x2_sum;       // sum{ |x|^2 }
+
+    // block LMS
+    unsigned int block_len; // number of symbols per weight update
+    unsigned int block_n;   // symbols accumulated in current block
+    T * dw;                 // accumulated weight update [px1]
+
+    // frequency-domain block LMS (overlap-save, transform size 2p),
+    // allocated on first use of _execute_block()
+    float complex * time_buf;   // time-domain buffer [size: 2p x 1]
+    float complex * freq_buf;   // freq-domain buffer [size: 2p x 1]
+    float complex * U;          // transform of last 2p inputs
+    float complex * W;          // transform of zero-padded weights
+    float * x2_block;           // sum{ |x|^2 } at each sample of block
+    FFT_PLAN fft;               // forward transform (time_buf -> freq_buf)
+    FFT_PLAN ifft;              // reverse transform (freq_buf -> time_buf)
+    int W_valid;                // W is up to date with weights
 };
 
 // update sum{|x|^2}
 void EQLMS(_update_sumsq)(EQLMS() _eq, T _x);
 
+// accumulate scaled input: _w[i] += _g*_x[i], i in [0,_n)
+static void EQLMS(_axpy)(T _g, T * _x, T * _w, unsigned int _n);
+
+// allocate buffers and transforms for frequency-domain operation
+static void EQLMS(_fd_init)(EQLMS() _eq);
+
 // create least mean-squares (LMS) equalizer object
 //  _h      :   initial coefficients [size: _p x 1], default if NULL
 //  _p      :   equalizer length (number of taps)
@@ -58,10 +80,16 @@ EQLMS() EQLMS(_create)(T *          _h,
 
     eq->h0 = (T*) malloc((eq->p)*sizeof(T));
     eq->w0 = (T*) malloc((eq->p)*sizeof(T));
-    eq->w1 = (T*) malloc((eq->p)*sizeof(T));
+    eq->dw = (T*) malloc((eq->p)*sizeof(T));
     eq->buffer = WINDOW(_create)(eq->p);
     eq->x2     = wdelayf_create(eq->p);
 
+    // per-symbol update by default
+    eq->block_len = 1;
+
+    // frequency-domain buffers are allocated on first use
+    eq->time_buf = NULL;
+
     // copy coefficients (if not NULL)
     if (_h == NULL) {
         // initial coefficients with delta at first index
@@ -152,7 +180,17 @@ void EQLMS(_destroy)(EQLMS() _eq)
 {
     free(_eq->h0);
     free(_eq->w0);
-    free(_eq->w1);
+    free(_eq->dw);
+
+    if (_eq->time_buf != NULL) {
+        FFT_DESTROY_PLAN(_eq->fft);
+        FFT_DESTROY_PLAN(_eq->ifft);
+        free(_eq->time_buf);
+        free(_eq->freq_buf);
+        free(_eq->U);
+        free(_eq->W);
+        free(_eq->x2_block);
+    }
 
     WINDOW(_destroy)(_eq->buffer);
     wdelayf_destroy(_eq->x2);
@@ -189,6 +227,30 @@ float EQLMS(_get_bw)(EQLMS() _eq)
     return _eq->mu;
 }
 
+// set number of symbols per weight update (block LMS)
+//  _eq     :   equalizer object
+//  _n      :   block length, _n > 0
+void EQLMS(_set_block_len)(EQLMS()      _eq,
+                           unsigned int _n)
+{
+    if (_n == 0) {
+        fprintf(stderr,"error: eqlms_%s_set_block_len(), block length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // apply any partially accumulated update
+    if (_eq->block_n > 0) {
+        unsigned int i;
+        for (i=0; i<_eq->p; i++)
+            _eq->w0[i] += _eq->dw[i] / (float)(_eq->block_n);
+        _eq->W_valid = 0;
+    }
+
+    _eq->block_len = _n;
+    _eq->block_n   = 0;
+    memset(_eq->dw, 0x00, (_eq->p)*sizeof(T));
+}
+
 // reset equalizer
 void EQLMS(_reset)(EQLMS() _eq)
 {
@@ -197,7 +259,13 @@ void EQLMS(_reset)(EQLMS() _eq)
 
     WINDOW(_clear)(_eq->buffer);
     wdelayf_clear(_eq->x2);
+    _eq->x2_sum = 0.0f;
     _eq->n=0;
+
+    // clear accumulated block update
+    memset(_eq->dw, 0x00, (_eq->p)*sizeof(T));
+    _eq->block_n = 0;
+    _eq->W_valid = 0;
 }
 
 // push sample into equalizer internal buffer
@@ -223,13 +291,52 @@ void EQLMS(_execute)(EQLMS() _eq,
     T * r;      // read buffer
     WINDOW(_read)(_eq->buffer, &r);
 
-    // compute conjugate vector dot product
-    //DOTPROD(_run)(_eq->w0, r, _eq->p, &y);
+    // compute conjugate vector dot product, y = sum{ conj(w[i]) r[i] },
+    // accumulating in independent lanes which the compiler vectorizes
     unsigned int i;
-    for (i=0; i<_eq->p; i++) {
-        T sum = conj(_eq->w0[i])*r[i];
-        y += sum;
+    unsigned int p = _eq->p;
+#if T_COMPLEX
+    // operate on (real,imag) pairs: a holds w_r*r_r and w_i*r_i
+    // (real part), b holds w_r*r_i and w_i*r_r (imaginary part)
+    float * w = (float*)_eq->w0;
+    float * x = (float*)r;
+    float a0=0, a1=0, a2=0, a3=0;
+    float b0=0, b1=0, b2=0, b3=0;
+    for (i=0; i<p/2; i++) {
+        a0 += w[0]*x[0];
+        a1 += w[1]*x[1];
+        a2 += w[2]*x[2];
+        a3 += w[3]*x[3];
+        b0 += w[0]*x[1];
+        b1 += w[1]*x[0];
+        b2 += w[2]*x[3];
+        b3 += w[3]*x[2];
+        w += 4;
+        x += 4;
+    }
+    float yr = (a0 + a2) + (a1 + a3);
+    float yi = (b0 + b2) - (b1 + b3);
+    if (p % 2) {
+        yr += w[0]*x[0] + w[1]*x[1];
+        yi += w[0]*x[1] - w[1]*x[0];
     }
+    ((float*)&y)[0] = yr;
+    ((float*)&y)[1] = yi;
+#else
+    float * w = _eq->w0;
+    float a0=0, a1=0, a2=0, a3=0;
+    for (i=0; i<p/4; i++) {
+        a0 += w[0]*r[0];
+        a1 += w[1]*r[1];
+        a2 += w[2]*r[2];
+        a3 += w[3]*r[3];
+        w += 4;
+        r += 4;
+    }
+    y = (a0 + a2) + (a1 + a3);
+    for (i=0; i<p%4; i++)
+        y += w[i]*r[i];
+#endif
 
     // set output
     *_y = y;
@@ -253,26 +360,125 @@ void EQLMS(_step)(EQLMS() _eq,
     T * r;      // read buffer
     WINDOW(_read)(_eq->buffer, &r);
 
-    // update weighting vector
+    // update weighting vector in place
     // w[n+1] = w[n] + mu*conj(d-d_hat)*x[n]/(x[n]' * conj(x[n]))
-    for (i=0; i<p; i++)
-        _eq->w1[i] = _eq->w0[i] + (_eq->mu)*conj(alpha)*r[i]/_eq->x2_sum;
+    T g = TCONJ(alpha) * (_eq->mu / _eq->x2_sum);
+    if (_eq->block_len == 1) {
+        EQLMS(_axpy)(g, r, _eq->w0, p);
+        _eq->W_valid = 0;
+        return;
+    }
+
+    // block LMS: accumulate update and apply its average once per
+    // block
+    EQLMS(_axpy)(g, r, _eq->dw, p);
+    _eq->block_n++;
+    if (_eq->block_n == _eq->block_len) {
+        float s = 1.0f / (float)(_eq->block_len);
+        for (i=0; i<p; i++)
+            _eq->w0[i] += _eq->dw[i] * s;
+        memset(_eq->dw, 0x00, p*sizeof(T));
+        _eq->block_n = 0;
+        _eq->W_valid = 0;
+    }
+}
+
+// execute equalizer on a block of _p input samples with the current
+// weights, computing the outputs with fast (FFT) convolution; the
+// samples are pushed into the internal buffer as with _push()
+//  _eq     :   equalizer object
+//  _x      :   input samples [size: _p x 1]
+//  _y      :   output samples [size: _p x 1]
+void EQLMS(_execute_block)(EQLMS() _eq,
+                           T *     _x,
+                           T *     _y)
+{
+    unsigned int i;
+    unsigned int p = _eq->p;
+    unsigned int nfft = 2*p;
+    if (_eq->time_buf == NULL)
+        EQLMS(_fd_init)(_eq);
+
+    // transform of zero-padded weights, folding in the normalization
+    // of the reverse transform
+    if (!_eq->W_valid) {
+        for (i=0; i<nfft; i++)
+            _eq->time_buf[i] = i < p ? _eq->w0[i] : 0.0f;
+        FFT_EXECUTE(_eq->fft);
+        for (i=0; i<nfft; i++)
+            _eq->W[i] = conjf(_eq->freq_buf[i]) / (float)nfft;
+        _eq->W_valid = 1;
+    }
 
-#ifdef DEBUG
-    printf("w0: \n");
+    // last 2p inputs: previous buffer contents and new block
+    T * r;
+    WINDOW(_read)(_eq->buffer, &r);
     for (i=0; i<p; i++) {
-        PRINTVAL(_eq->w0[i]);
-        printf("\n");
+        _eq->time_buf[i]   = r[i];
+        _eq->time_buf[p+i] = _x[i];
     }
-    printf("w1: \n");
+    FFT_EXECUTE(_eq->fft);
+    memmove(_eq->U, _eq->freq_buf, nfft*sizeof(float complex));
+
+    // push samples, recording the normalization at each
     for (i=0; i<p; i++) {
-        PRINTVAL(_eq->w1[i]);
-        printf("\n");
+        EQLMS(_push)(_eq, _x[i]);
+        _eq->x2_block[i] = _eq->x2_sum;
     }
+
+    // outputs: y[m] = sum{ conj(w[i]) u[m+1+i] }, a correlation
+    // evaluated as the product of U with the conjugate transform of w
+    for (i=0; i<nfft; i++)
+        _eq->freq_buf[i] = liquid_cmulf(_eq->U[i], _eq->W[i]);
+    FFT_EXECUTE(_eq->ifft);
+    for (i=0; i<p; i++) {
+#if T_COMPLEX
+        _y[i] = _eq->time_buf[i+1];
+#else
+        _y[i] = crealf(_eq->time_buf[i+1]);
 #endif
+    }
+}
+
+// step equalizer training once over the block from the last call to
+// _execute_block(), computing the weight update with fast (FFT)
+// correlation; equivalent to block LMS with a block length of _p
+//  _eq     :   equalizer object
+//  _d      :   desired outputs [size: _p x 1]
+//  _d_hat  :   outputs from _execute_block() [size: _p x 1]
+void EQLMS(_step_block)(EQLMS() _eq,
+                        T *     _d,
+                        T *     _d_hat)
+{
+    unsigned int i;
+    unsigned int p = _eq->p;
+    unsigned int nfft = 2*p;
+    if (_eq->time_buf == NULL) {
+        fprintf(stderr,"error: eqlms_%s_step_block(), no block executed\n", EXTENSION_FULL);
+        exit(1);
+    }
 
-    // copy old values
-    memmove(_eq->w0, _eq->w1,   p*sizeof(T));
+    // scaled errors, delayed by one sample to align with the outputs
+    float s = _eq->mu / (float)(p*nfft);
+    _eq->time_buf[0] = 0.0f;
+    for (i=0; i<p; i++)
+        _eq->time_buf[i+1] = (_d[i] - _d_hat[i]) * (s / _eq->x2_block[i]);
+    for (i=p+1; i<nfft; i++)
+        _eq->time_buf[i] = 0.0f;
+    FFT_EXECUTE(_eq->fft);
+
+    // update: w[i] += sum{ conj(e[m]) u[m+1+i] }
+    for (i=0; i<nfft; i++)
+        _eq->freq_buf[i] = liquid_cmulf(_eq->U[i], conjf(_eq->freq_buf[i]));
+    FFT_EXECUTE(_eq->ifft);
+    for (i=0; i<p; i++) {
+#if T_COMPLEX
+        _eq->w0[i] += _eq->time_buf[i];
+#else
+        _eq->w0[i] += crealf(_eq->time_buf[i]);
+#endif
+    }
+    _eq->W_valid = 0;
 }
 
 // retrieve internal filter coefficients
@@ -281,7 +487,7 @@ void EQLMS(_get_weights)(EQLMS() _eq, T * _w)
     // copy output weight vector
     unsigned int i, p=_eq->p;
     for (i=0; i<p; i++)
-        _w[i] = conj(_eq->w0[p-i-1]);
+        _w[i] = TCONJ(_eq->w0[p-i-1]);
 }
 
 // train equalizer object
@@ -341,3 +547,60 @@ void EQLMS(_update_sumsq)(EQLMS() _eq, T _x)
     _eq->x2_sum = _eq->x2_sum + x2_n - x2_0;// update sum( |x|^2 ) of last 'n' input samples
 }
 
+// accumulate scaled input: _w[i] += _g*_x[i], i in [0,_n); complex
+// values are operated on as (real,imag) pairs, two at a time, which
+// the compiler vectorizes
+static void EQLMS(_axpy)(T            _g,
+                         T *          _x,
+                         T *          _w,
+                         unsigned int _n)
+{
+    unsigned int i;
+#if T_COMPLEX
+    float   gr = crealf(_g);
+    float   gi = cimagf(_g);
+    float * x  = (float*)_x;
+    float * w  = (float*)_w;
+    for (i=0; i<_n/2; i++) {
+        float x0 = x[0], x1 = x[1];
+        float x2 = x[2], x3 = x[3];
+        w[0] += gr*x0 - gi*x1;
+        w[1] += gr*x1 + gi*x0;
+        w[2] += gr*x2 - gi*x3;
+        w[3] += gr*x3 + gi*x2;
+        w += 4;
+        x += 4;
+    }
+    if (_n % 2) {
+        w[0] += gr*x[0] - gi*x[1];
+        w[1] += gr*x[1] + gi*x[0];
+    }
+#else
+    for (i=0; i<_n/4; i++) {
+        float x0 = _x[0], x1 = _x[1];
+        float x2 = _x[2], x3 = _x[3];
+        _w[0] += _g*x0;
+        _w[1] += _g*x1;
+        _w[2] += _g*x2;
+        _w[3] += _g*x3;
+        _w += 4;
+        _x += 4;
+    }
+    for (i=0; i<_n%4; i++)
+        _w[i] += _g*_x[i];
+#endif
+}
+
+// allocate buffers and transforms for frequency-domain operation
+static void EQLMS(_fd_init)(EQLMS() _eq)
+{
+    unsigned int nfft = 2*_eq->p;
+    _eq->time_buf = (float complex*) malloc(nfft*sizeof(float complex));
+    _eq->freq_buf = (float complex*) malloc(nfft*sizeof(float complex));
+    _eq->U        = (float complex*) malloc(nfft*sizeof(float complex));
+    _eq->W        = (float complex*) malloc(nfft*sizeof(float complex));
+    _eq->x2_block = (float*)         malloc((_eq->p)*sizeof(float));
+    _eq->fft  = FFT_CREATE_PLAN(nfft, _eq->time_buf, _eq->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
+    _eq->ifft = FFT_CREATE_PLAN(nfft, _eq->freq_buf, _eq->time_buf, FFT_DIR_BACKWARD, FFT_METHOD);
+    _eq->W_valid = 0;
+}
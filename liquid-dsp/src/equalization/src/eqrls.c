@@ -254,7 +254,7 @@ void EQRLS(_step)(EQRLS() _eq,
     for (c=0; c<p; c++) {
         _eq->xP0[c] = 0;
         for (r=0; r<p; r++) {
-            _eq->xP0[c] += x[r] * matrix_access(_eq->P0,p,p,r,c);
+            _eq->xP0[c] += TMUL(x[r], matrix_access(_eq->P0,p,p,r,c));
         }
     }
 
@@ -276,7 +276,7 @@ void EQRLS(_step)(EQRLS() _eq,
     // zeta = lambda + [x.']*[P0]*[conj(x)]
     _eq->zeta = 0;
     for (c=0; c<p; c++) {
-        T sum = _eq->xP0[c] * conj(x[c]);
+        T sum = TMUL(_eq->xP0[c], TCONJ(x[c]));
         _eq->zeta += sum;
     }
     _eq->zeta += _eq->lambda;
@@ -288,10 +288,10 @@ void EQRLS(_step)(EQRLS() _eq,
     for (r=0; r<p; r++) {
         _eq->g[r] = 0;
         for (c=0; c<p; c++) {
-            T sum = matrix_access(_eq->P0,p,p,r,c) * conj(x[c]);
+            T sum = TMUL(matrix_access(_eq->P0,p,p,r,c), TCONJ(x[c]));
             _eq->g[r] += sum;
         }
-        _eq->g[r] /= _eq->zeta;
+        _eq->g[r] = TDIV(_eq->g[r], _eq->zeta);
     }
 #ifdef DEBUG
     printf("g: ");
@@ -305,7 +305,7 @@ void EQRLS(_step)(EQRLS() _eq,
     for (r=0; r<p; r++) {
         for (c=0; c<p; c++) {
             // gxl = [g] * [x.'] / lambda
-            matrix_access(_eq->gxl,p,p,r,c) = _eq->g[r] * x[c] / _eq->lambda;
+            matrix_access(_eq->gxl,p,p,r,c) = TMUL(_eq->g[r], x[c]) / _eq->lambda;
         }
     }
     // multiply two [pxp] matrices: gxlP0 = gxl * P0
@@ -318,7 +318,7 @@ void EQRLS(_step)(EQRLS() _eq,
 
     // update weighting vector
     for (i=0; i<p; i++)
-        _eq->w1[i] = _eq->w0[i] + alpha*(_eq->g[i]);
+        _eq->w1[i] = _eq->w0[i] + TMUL(alpha, _eq->g[i]);
 
 #ifdef DEBUG
     printf("w0: \n");
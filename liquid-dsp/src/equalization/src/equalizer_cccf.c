@@ -35,6 +35,10 @@
 #define MATRIX(name)    LIQUID_CONCAT(matrixcf,name)
 
 #define T               float complex
+#define T_COMPLEX       1
+#define TCONJ(X)        conjf(X)
+#define TMUL(A,B)       liquid_cmulf(A,B)
+#define TDIV(A,B)       liquid_cdivf(A,B)
 
 #define PRINTVAL(V)     printf("%5.2f+j%5.2f ", crealf(V), cimagf(V));
 
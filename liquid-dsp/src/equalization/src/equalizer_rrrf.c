@@ -35,6 +35,10 @@
 #define MATRIX(name)    LIQUID_CONCAT(matrixf,name)
 
 #define T               float
+#define T_COMPLEX       0
+#define TCONJ(X)        (X)
+#define TMUL(A,B)       ((A)*(B))
+#define TDIV(A,B)       ((A)/(B))
 
 #define PRINTVAL(V)     printf("%5.2f ", V);
 
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// 
+// AUTOTEST: block update is applied once every _n steps
+//
+void autotest_eqlms_cccf_block_len()
+{
+    unsigned int p = 6;     // equalizer length
+    unsigned int n = 4;     // block length
+
+    eqlms_cccf q = eqlms_cccf_create(NULL, p);
+    eqlms_cccf_set_block_len(q, n);
+
+    float complex w0[p];
+    float complex w1[p];
+    eqlms_cccf_get_weights(q, w0);
+
+    unsigned int i, j;
+    float complex y;
+    for (i=0; i<n; i++) {
+        eqlms_cccf_push(q, randnf() + _Complex_I*randnf());
+        eqlms_cccf_execute(q, &y);
+        eqlms_cccf_step(q, randnf() + _Complex_I*randnf(), y);
+        eqlms_cccf_get_weights(q, w1);
+
+        // weights only change at the end of the block
+        float e = 0.0f;
+        for (j=0; j<p; j++)
+            e += cabsf(w1[j] - w0[j]);
+        if (i < n-1) {
+            CONTEND_DELTA(e, 0.0f, 0.0f);
+        } else {
+            CONTEND_GREATER_THAN(e, 0.0f);
+        }
+    }
+
+    eqlms_cccf_destroy(q);
+}
+
+// 
+// AUTOTEST: frequency-domain block output matches per-sample output
+//
+void autotest_eqlms_cccf_execute_block()
+{
+    float tol = 1e-4f;      // error tolerance
+    unsigned int p = 13;    // equalizer length
+    unsigned int num_blocks = 4;
+
+    // create equalizers with non-trivial weights
+    float complex h[p];
+    unsigned int i, j;
+    for (i=0; i<p; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+    eqlms_cccf q0 = eqlms_cccf_create(h, p);
+    eqlms_cccf q1 = eqlms_cccf_create(h, p);
+
+    float complex x[p];
+    float complex y0[p];
+    float complex y1[p];
+    for (i=0; i<num_blocks; i++) {
+        for (j=0; j<p; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+
+        for (j=0; j<p; j++) {
+            eqlms_cccf_push(q0, x[j]);
+            eqlms_cccf_execute(q0, &y0[j]);
+        }
+        eqlms_cccf_execute_block(q1, x, y1);
+
+        for (j=0; j<p; j++) {
+            CONTEND_DELTA( crealf(y1[j]), crealf(y0[j]), tol );
+            CONTEND_DELTA( cimagf(y1[j]), cimagf(y0[j]), tol );
+        }
+    }
+
+    eqlms_cccf_destroy(q0);
+    eqlms_cccf_destroy(q1);
+}
+
+// 
+// AUTOTEST: frequency-domain block LMS matches time-domain block LMS
+//
+void autotest_eqlms_cccf_step_block()
+{
+    float tol = 1e-4f;      // error tolerance
+    unsigned int p = 16;    // equalizer length
+    unsigned int num_blocks = 8;
+
+    eqlms_cccf q0 = eqlms_cccf_create(NULL, p);
+    eqlms_cccf q1 = eqlms_cccf_create(NULL, p);
+    eqlms_cccf_set_bw(q0, 0.1f);
+    eqlms_cccf_set_bw(q1, 0.1f);
+    eqlms_cccf_set_block_len(q0, p);
+
+    float complex x[p];
+    float complex d[p];
+    float complex y0[p];
+    float complex y1[p];
+    float complex w0[p];
+    float complex w1[p];
+    unsigned int i, j;
+    for (i=0; i<num_blocks; i++) {
+        for (j=0; j<p; j++) {
+            x[j] = randnf() + _Complex_I*randnf();
+            d[j] = randnf() + _Complex_I*randnf();
+        }
+
+        // time domain, one symbol at a time
+        for (j=0; j<p; j++) {
+            eqlms_cccf_push(q0, x[j]);
+            eqlms_cccf_execute(q0, &y0[j]);
+            eqlms_cccf_step(q0, d[j], y0[j]);
+        }
+
+        // frequency domain, one block at a time
+        eqlms_cccf_execute_block(q1, x, y1);
+        eqlms_cccf_step_block(q1, d, y1);
+
+        eqlms_cccf_get_weights(q0, w0);
+        eqlms_cccf_get_weights(q1, w1);
+        for (j=0; j<p; j++) {
+            CONTEND_DELTA( crealf(w1[j]), crealf(w0[j]), tol );
+            CONTEND_DELTA( cimagf(w1[j]), cimagf(w0[j]), tol );
+        }
+    }
+
+    eqlms_cccf_destroy(q0);
+    eqlms_cccf_destroy(q1);
+}
+
+// 
+// AUTOTEST: real frequency-domain block LMS matches time domain
+//
+void autotest_eqlms_rrrf_step_block()
+{
+    float tol = 1e-4f;      // error tolerance
+    unsigned int p = 9;     // equalizer length
+    unsigned int num_blocks = 8;
+
+    eqlms_rrrf q0 = eqlms_rrrf_create(NULL, p);
+    eqlms_rrrf q1 = eqlms_rrrf_create(NULL, p);
+    eqlms_rrrf_set_bw(q0, 0.1f);
+    eqlms_rrrf_set_bw(q1, 0.1f);
+    eqlms_rrrf_set_block_len(q0, p);
+
+    float x[p];
+    float d[p];
+    float y0[p];
+    float y1[p];
+    float w0[p];
+    float w1[p];
+    unsigned int i, j;
+    for (i=0; i<num_blocks; i++) {
+        for (j=0; j<p; j++) {
+            x[j] = randnf();
+            d[j] = randnf();
+        }
+
+        for (j=0; j<p; j++) {
+            eqlms_rrrf_push(q0, x[j]);
+            eqlms_rrrf_execute(q0, &y0[j]);
+            eqlms_rrrf_step(q0, d[j], y0[j]);
+        }
+
+        eqlms_rrrf_execute_block(q1, x, y1);
+        eqlms_rrrf_step_block(q1, d, y1);
+
+        for (j=0; j<p; j++)
+            CONTEND_DELTA( y1[j], y0[j], tol );
+
+        eqlms_rrrf_get_weights(q0, w0);
+        eqlms_rrrf_get_weights(q1, w1);
+        for (j=0; j<p; j++)
+            CONTEND_DELTA( w1[j], w0[j], tol );
+    }
+
+    eqlms_rrrf_destroy(q0);
+    eqlms_rrrf_destroy(q1);
+}
+
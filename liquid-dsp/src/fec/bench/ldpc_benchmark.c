@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// benchmark layered min-sum LDPC decoder on a noisy codeword
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "liquid.internal.h"
+
+#define LDPC_BENCH_API(FS,SIGMA)        \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ ldpc_bench(_start, _finish, _num_iterations, FS, SIGMA); }
+
+// Helper function to keep code base small
+//  _fs     :   LDPC scheme
+//  _sigma  :   noise standard deviation (unit-amplitude BPSK)
+void ldpc_bench(struct rusage *     _start,
+                struct rusage *     _finish,
+                unsigned long int * _num_iterations,
+                fec_scheme          _fs,
+                float               _sigma)
+{
+    // normalize number of iterations
+    *_num_iterations /= 20000;
+    if (*_num_iterations < 1)
+        *_num_iterations = 1;
+
+    fec q = fec_create(_fs, NULL);
+    unsigned int n = 8*q->nn;
+    unsigned int k = q->kk;
+
+    // encode random message of one full block
+    unsigned char msg[k];
+    unsigned char msg_enc[q->nn];
+    unsigned long int i;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+    fec_encode(q, k, msg, msg_enc);
+
+    // compute log-likelihood ratio (LLR)
+    float LLR[n];
+    unsigned char c_hat[n];
+    for (i=0; i<n; i++)
+        LLR[i] = (((msg_enc[i/8] >> (7-(i%8))) & 1) ? -1.0f : 1.0f) + _sigma*randnf();
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        ldpc_decode(q->ldpc, LLR, c_hat, 20);
+        ldpc_decode(q->ldpc, LLR, c_hat, 20);
+        ldpc_decode(q->ldpc, LLR, c_hat, 20);
+        ldpc_decode(q->ldpc, LLR, c_hat, 20);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    fec_destroy(q);
+}
+
+//
+// BENCHMARKS
+//
+void benchmark_ldpc_decode_r12  LDPC_BENCH_API(LIQUID_FEC_LDPC_R12, 0.65f)
+void benchmark_ldpc_decode_r23  LDPC_BENCH_API(LIQUID_FEC_LDPC_R23, 0.50f)
+void benchmark_ldpc_decode_r34  LDPC_BENCH_API(LIQUID_FEC_LDPC_R34, 0.45f)
+
@@ -147,6 +147,88 @@ int crc_validate_message(crc_scheme _scheme,
     return crc_generate_key(_scheme, _msg, _n) == _key;
 }
 
+// initialize streaming error-detection state
+//
+//  _scheme     :   error-detection scheme
+unsigned int crc_init(crc_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_init(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:      return 0;
+    case LIQUID_CRC_CHECKSUM:  return 0;
+    case LIQUID_CRC_8:
+    case LIQUID_CRC_16:
+    case LIQUID_CRC_24:
+    case LIQUID_CRC_32:        return ~0;
+    default:
+        fprintf(stderr,"error: crc_init(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// update streaming error-detection state with message piece
+//
+//  _scheme     :   error-detection scheme
+//  _state      :   current state
+//  _msg        :   input data message piece, [size: _n x 1]
+//  _n          :   input data message piece size
+unsigned int crc_update(crc_scheme _scheme,
+                        unsigned int _state,
+                        unsigned char * _msg,
+                        unsigned int _n)
+{
+    unsigned int i;
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_update(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:
+        return 0;
+    case LIQUID_CRC_CHECKSUM:
+        for (i=0; i<_n; i++)
+            _state += (unsigned int) (_msg[i]);
+        return _state & 0xff;
+    case LIQUID_CRC_8:         return crc8_update( _state, _msg, _n);
+    case LIQUID_CRC_16:        return crc16_update(_state, _msg, _n);
+    case LIQUID_CRC_24:        return crc24_update(_state, _msg, _n);
+    case LIQUID_CRC_32:        return crc32_update(_state, _msg, _n);
+    default:
+        fprintf(stderr,"error: crc_update(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// finalize streaming error-detection state, returning key
+//
+//  _scheme     :   error-detection scheme
+//  _state      :   current state
+unsigned int crc_finalize(crc_scheme _scheme,
+                          unsigned int _state)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_finalize(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:      return 0;
+    case LIQUID_CRC_CHECKSUM:  return (~_state + 1) & 0xff;
+    case LIQUID_CRC_8:         return (~_state) & 0xff;
+    case LIQUID_CRC_16:        return (~_state) & 0xffff;
+    case LIQUID_CRC_24:        return (~_state) & 0xffffff;
+    case LIQUID_CRC_32:        return (~_state) & 0xffffffff;
+    default:
+        fprintf(stderr,"error: crc_finalize(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
 
 //
 // Checksum
@@ -172,127 +254,93 @@ unsigned int checksum_generate_key(unsigned char *_data,
 }
 
 
-// 
-// CRC-8
 //
+// CRC-8/16/24/32
+//
+// All keys are computed least-significant bit first with the reversed
+// generator polynomial (see http://www.hackersdelight.org/crc.pdf) and
+// a 32-bit register initialized to all ones. The register is advanced
+// eight bytes at a time using the slicing-by-8 tables in crc_gentab.c:
+// the first four bytes are folded into the register and each of the
+// eight bytes is then looked up in the table that accounts for its
+// distance from the end of the block. Remaining bytes are processed
+// one at a time with table 0.
+//
+
+// define slicing-by-8 register update method
+//  NAME    :   method name
+//  TABLE   :   slicing-by-8 lookup table
+#define LIQUID_CRC_DEFINE_UPDATE(NAME,TABLE)                            \
+unsigned int NAME(unsigned int    _key,                                 \
+                  unsigned char * _msg,                                 \
+                  unsigned int    _n)                                   \
+{                                                                       \
+    unsigned int i;                                                     \
+    unsigned int t = _n >> 3;                                           \
+    for (i=0; i<t; i++) {                                               \
+        unsigned int x = _key ^ ( (unsigned int)_msg[0]        |        \
+                                 ((unsigned int)_msg[1] <<  8) |        \
+                                 ((unsigned int)_msg[2] << 16) |        \
+                                 ((unsigned int)_msg[3] << 24) );       \
+        _key = TABLE[7][(x      ) & 0xff] ^                             \
+               TABLE[6][(x >>  8) & 0xff] ^                             \
+               TABLE[5][(x >> 16) & 0xff] ^                             \
+               TABLE[4][(x >> 24)       ] ^                             \
+               TABLE[3][_msg[4]] ^                                      \
+               TABLE[2][_msg[5]] ^                                      \
+               TABLE[1][_msg[6]] ^                                      \
+               TABLE[0][_msg[7]];                                       \
+        _msg += 8;                                                      \
+    }                                                                   \
+                                                                        \
+    for (i=0; i<(_n & 7); i++)                                          \
+        _key = (_key >> 8) ^ TABLE[0][(_key ^ _msg[i]) & 0xff];         \
+                                                                        \
+    return _key;                                                        \
+}
+
+LIQUID_CRC_DEFINE_UPDATE(crc8_update,  crc8_gentab)
+LIQUID_CRC_DEFINE_UPDATE(crc16_update, crc16_gentab)
+LIQUID_CRC_DEFINE_UPDATE(crc24_update, crc24_gentab)
+LIQUID_CRC_DEFINE_UPDATE(crc32_update, crc32_gentab)
 
 // generate 8-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc8_generate_key(unsigned char *_msg,
                                unsigned int _n)
 {
-    unsigned int i, j, b, mask, key8=~0;
-    unsigned int poly = liquid_reverse_byte_gentab[CRC8_POLY];
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key8 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key8 & 1);
-            key8 = (key8>>1) ^ (poly & mask);
-        }
-    }
-    return (~key8) & 0xff;
+    return (~crc8_update(~0, _msg, _n)) & 0xff;
 }
 
-
-// 
-// CRC-16
-//
-
 // generate 16-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc16_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key16=~0;
-    unsigned int poly = liquid_reverse_uint16(CRC16_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key16 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key16 & 1);
-            key16 = (key16>>1) ^ (poly & mask);
-        }
-    }
-    return (~key16) & 0xffff;
+    return (~crc16_update(~0, _msg, _n)) & 0xffff;
 }
 
-
-// 
-// CRC-24
-//
-
 // generate 24-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc24_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key24=~0;
-    unsigned int poly = liquid_reverse_uint24(CRC24_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key24 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key24 & 1);
-            key24 = (key24>>1) ^ (poly & mask);
-        }
-    }
-    return (~key24) & 0xffffff;
+    return (~crc24_update(~0, _msg, _n)) & 0xffffff;
 }
 
-
-// 
-// CRC-32
-//
-
 // generate 32-bit cyclic redundancy check key.
 //
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc32_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key32=~0;
-    unsigned int poly = liquid_reverse_uint32(CRC32_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key32 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key32 & 1);
-            key32 = (key32>>1) ^ (poly & mask);
-        }
-    }
-    return (~key32) & 0xffffffff;
-}
-
-#if 0
-void crc32_generate_key(unsigned char *_msg,
-                        unsigned int _n,
-                        unsigned char *_key)
-{
-    unsigned int key32 = crc32_generate_key32(_msg,_n);
-    _key[0] = (key32 & 0xFF000000) >> 24;
-    _key[1] = (key32 & 0x00FF0000) >> 16;
-    _key[2] = (key32 & 0x0000FF00) >> 8;
-    _key[3] = (key32 & 0x000000FF);
+    return (~crc32_update(~0, _msg, _n)) & 0xffffffff;
 }
-#endif
 
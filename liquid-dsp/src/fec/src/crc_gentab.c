@@ -0,0 +1,1273 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// cyclic redundancy check generated tables
+// auto-generated file (do not edit); see sandbox/crc_gentab.c
+//
+
+#include "liquid.internal.h"
+
+// crc8 slicing-by-8 table (polynomial 0x07)
+const unsigned char crc8_gentab[8][256] = {
+  {
+    0x00, 0x91, 0xe3, 0x72, 0x07, 0x96, 0xe4, 0x75,
+    0x0e, 0x9f, 0xed, 0x7c, 0x09, 0x98, 0xea, 0x7b,
+    0x1c, 0x8d, 0xff, 0x6e, 0x1b, 0x8a, 0xf8, 0x69,
+    0x12, 0x83, 0xf1, 0x60, 0x15, 0x84, 0xf6, 0x67,
+    0x38, 0xa9, 0xdb, 0x4a, 0x3f, 0xae, 0xdc, 0x4d,
+    0x36, 0xa7, 0xd5, 0x44, 0x31, 0xa0, 0xd2, 0x43,
+    0x24, 0xb5, 0xc7, 0x56, 0x23, 0xb2, 0xc0, 0x51,
+    0x2a, 0xbb, 0xc9, 0x58, 0x2d, 0xbc, 0xce, 0x5f,
+    0x70, 0xe1, 0x93, 0x02, 0x77, 0xe6, 0x94, 0x05,
+    0x7e, 0xef, 0x9d, 0x0c, 0x79, 0xe8, 0x9a, 0x0b,
+    0x6c, 0xfd, 0x8f, 0x1e, 0x6b, 0xfa, 0x88, 0x19,
+    0x62, 0xf3, 0x81, 0x10, 0x65, 0xf4, 0x86, 0x17,
+    0x48, 0xd9, 0xab, 0x3a, 0x4f, 0xde, 0xac, 0x3d,
+    0x46, 0xd7, 0xa5, 0x34, 0x41, 0xd0, 0xa2, 0x33,
+    0x54, 0xc5, 0xb7, 0x26, 0x53, 0xc2, 0xb0, 0x21,
+    0x5a, 0xcb, 0xb9, 0x28, 0x5d, 0xcc, 0xbe, 0x2f,
+    0xe0, 0x71, 0x03, 0x92, 0xe7, 0x76, 0x04, 0x95,
+    0xee, 0x7f, 0x0d, 0x9c, 0xe9, 0x78, 0x0a, 0x9b,
+    0xfc, 0x6d, 0x1f, 0x8e, 0xfb, 0x6a, 0x18, 0x89,
+    0xf2, 0x63, 0x11, 0x80, 0xf5, 0x64, 0x16, 0x87,
+    0xd8, 0x49, 0x3b, 0xaa, 0xdf, 0x4e, 0x3c, 0xad,
+    0xd6, 0x47, 0x35, 0xa4, 0xd1, 0x40, 0x32, 0xa3,
+    0xc4, 0x55, 0x27, 0xb6, 0xc3, 0x52, 0x20, 0xb1,
+    0xca, 0x5b, 0x29, 0xb8, 0xcd, 0x5c, 0x2e, 0xbf,
+    0x90, 0x01, 0x73, 0xe2, 0x97, 0x06, 0x74, 0xe5,
+    0x9e, 0x0f, 0x7d, 0xec, 0x99, 0x08, 0x7a, 0xeb,
+    0x8c, 0x1d, 0x6f, 0xfe, 0x8b, 0x1a, 0x68, 0xf9,
+    0x82, 0x13, 0x61, 0xf0, 0x85, 0x14, 0x66, 0xf7,
+    0xa8, 0x39, 0x4b, 0xda, 0xaf, 0x3e, 0x4c, 0xdd,
+    0xa6, 0x37, 0x45, 0xd4, 0xa1, 0x30, 0x42, 0xd3,
+    0xb4, 0x25, 0x57, 0xc6, 0xb3, 0x22, 0x50, 0xc1,
+    0xba, 0x2b, 0x59, 0xc8, 0xbd, 0x2c, 0x5e, 0xcf},
+  {
+    0x00, 0x6d, 0xda, 0xb7, 0x75, 0x18, 0xaf, 0xc2,
+    0xea, 0x87, 0x30, 0x5d, 0x9f, 0xf2, 0x45, 0x28,
+    0x15, 0x78, 0xcf, 0xa2, 0x60, 0x0d, 0xba, 0xd7,
+    0xff, 0x92, 0x25, 0x48, 0x8a, 0xe7, 0x50, 0x3d,
+    0x2a, 0x47, 0xf0, 0x9d, 0x5f, 0x32, 0x85, 0xe8,
+    0xc0, 0xad, 0x1a, 0x77, 0xb5, 0xd8, 0x6f, 0x02,
+    0x3f, 0x52, 0xe5, 0x88, 0x4a, 0x27, 0x90, 0xfd,
+    0xd5, 0xb8, 0x0f, 0x62, 0xa0, 0xcd, 0x7a, 0x17,
+    0x54, 0x39, 0x8e, 0xe3, 0x21, 0x4c, 0xfb, 0x96,
+    0xbe, 0xd3, 0x64, 0x09, 0xcb, 0xa6, 0x11, 0x7c,
+    0x41, 0x2c, 0x9b, 0xf6, 0x34, 0x59, 0xee, 0x83,
+    0xab, 0xc6, 0x71, 0x1c, 0xde, 0xb3, 0x04, 0x69,
+    0x7e, 0x13, 0xa4, 0xc9, 0x0b, 0x66, 0xd1, 0xbc,
+    0x94, 0xf9, 0x4e, 0x23, 0xe1, 0x8c, 0x3b, 0x56,
+    0x6b, 0x06, 0xb1, 0xdc, 0x1e, 0x73, 0xc4, 0xa9,
+    0x81, 0xec, 0x5b, 0x36, 0xf4, 0x99, 0x2e, 0x43,
+    0xa8, 0xc5, 0x72, 0x1f, 0xdd, 0xb0, 0x07, 0x6a,
+    0x42, 0x2f, 0x98, 0xf5, 0x37, 0x5a, 0xed, 0x80,
+    0xbd, 0xd0, 0x67, 0x0a, 0xc8, 0xa5, 0x12, 0x7f,
+    0x57, 0x3a, 0x8d, 0xe0, 0x22, 0x4f, 0xf8, 0x95,
+    0x82, 0xef, 0x58, 0x35, 0xf7, 0x9a, 0x2d, 0x40,
+    0x68, 0x05, 0xb2, 0xdf, 0x1d, 0x70, 0xc7, 0xaa,
+    0x97, 0xfa, 0x4d, 0x20, 0xe2, 0x8f, 0x38, 0x55,
+    0x7d, 0x10, 0xa7, 0xca, 0x08, 0x65, 0xd2, 0xbf,
+    0xfc, 0x91, 0x26, 0x4b, 0x89, 0xe4, 0x53, 0x3e,
+    0x16, 0x7b, 0xcc, 0xa1, 0x63, 0x0e, 0xb9, 0xd4,
+    0xe9, 0x84, 0x33, 0x5e, 0x9c, 0xf1, 0x46, 0x2b,
+    0x03, 0x6e, 0xd9, 0xb4, 0x76, 0x1b, 0xac, 0xc1,
+    0xd6, 0xbb, 0x0c, 0x61, 0xa3, 0xce, 0x79, 0x14,
+    0x3c, 0x51, 0xe6, 0x8b, 0x49, 0x24, 0x93, 0xfe,
+    0xc3, 0xae, 0x19, 0x74, 0xb6, 0xdb, 0x6c, 0x01,
+    0x29, 0x44, 0xf3, 0x9e, 0x5c, 0x31, 0x86, 0xeb},
+  {
+    0x00, 0xd0, 0x61, 0xb1, 0xc2, 0x12, 0xa3, 0x73,
+    0x45, 0x95, 0x24, 0xf4, 0x87, 0x57, 0xe6, 0x36,
+    0x8a, 0x5a, 0xeb, 0x3b, 0x48, 0x98, 0x29, 0xf9,
+    0xcf, 0x1f, 0xae, 0x7e, 0x0d, 0xdd, 0x6c, 0xbc,
+    0xd5, 0x05, 0xb4, 0x64, 0x17, 0xc7, 0x76, 0xa6,
+    0x90, 0x40, 0xf1, 0x21, 0x52, 0x82, 0x33, 0xe3,
+    0x5f, 0x8f, 0x3e, 0xee, 0x9d, 0x4d, 0xfc, 0x2c,
+    0x1a, 0xca, 0x7b, 0xab, 0xd8, 0x08, 0xb9, 0x69,
+    0x6b, 0xbb, 0x0a, 0xda, 0xa9, 0x79, 0xc8, 0x18,
+    0x2e, 0xfe, 0x4f, 0x9f, 0xec, 0x3c, 0x8d, 0x5d,
+    0xe1, 0x31, 0x80, 0x50, 0x23, 0xf3, 0x42, 0x92,
+    0xa4, 0x74, 0xc5, 0x15, 0x66, 0xb6, 0x07, 0xd7,
+    0xbe, 0x6e, 0xdf, 0x0f, 0x7c, 0xac, 0x1d, 0xcd,
+    0xfb, 0x2b, 0x9a, 0x4a, 0x39, 0xe9, 0x58, 0x88,
+    0x34, 0xe4, 0x55, 0x85, 0xf6, 0x26, 0x97, 0x47,
+    0x71, 0xa1, 0x10, 0xc0, 0xb3, 0x63, 0xd2, 0x02,
+    0xd6, 0x06, 0xb7, 0x67, 0x14, 0xc4, 0x75, 0xa5,
+    0x93, 0x43, 0xf2, 0x22, 0x51, 0x81, 0x30, 0xe0,
+    0x5c, 0x8c, 0x3d, 0xed, 0x9e, 0x4e, 0xff, 0x2f,
+    0x19, 0xc9, 0x78, 0xa8, 0xdb, 0x0b, 0xba, 0x6a,
+    0x03, 0xd3, 0x62, 0xb2, 0xc1, 0x11, 0xa0, 0x70,
+    0x46, 0x96, 0x27, 0xf7, 0x84, 0x54, 0xe5, 0x35,
+    0x89, 0x59, 0xe8, 0x38, 0x4b, 0x9b, 0x2a, 0xfa,
+    0xcc, 0x1c, 0xad, 0x7d, 0x0e, 0xde, 0x6f, 0xbf,
+    0xbd, 0x6d, 0xdc, 0x0c, 0x7f, 0xaf, 0x1e, 0xce,
+    0xf8, 0x28, 0x99, 0x49, 0x3a, 0xea, 0x5b, 0x8b,
+    0x37, 0xe7, 0x56, 0x86, 0xf5, 0x25, 0x94, 0x44,
+    0x72, 0xa2, 0x13, 0xc3, 0xb0, 0x60, 0xd1, 0x01,
+    0x68, 0xb8, 0x09, 0xd9, 0xaa, 0x7a, 0xcb, 0x1b,
+    0x2d, 0xfd, 0x4c, 0x9c, 0xef, 0x3f, 0x8e, 0x5e,
+    0xe2, 0x32, 0x83, 0x53, 0x20, 0xf0, 0x41, 0x91,
+    0xa7, 0x77, 0xc6, 0x16, 0x65, 0xb5, 0x04, 0xd4},
+  {
+    0x00, 0x8c, 0xd9, 0x55, 0x73, 0xff, 0xaa, 0x26,
+    0xe6, 0x6a, 0x3f, 0xb3, 0x95, 0x19, 0x4c, 0xc0,
+    0x0d, 0x81, 0xd4, 0x58, 0x7e, 0xf2, 0xa7, 0x2b,
+    0xeb, 0x67, 0x32, 0xbe, 0x98, 0x14, 0x41, 0xcd,
+    0x1a, 0x96, 0xc3, 0x4f, 0x69, 0xe5, 0xb0, 0x3c,
+    0xfc, 0x70, 0x25, 0xa9, 0x8f, 0x03, 0x56, 0xda,
+    0x17, 0x9b, 0xce, 0x42, 0x64, 0xe8, 0xbd, 0x31,
+    0xf1, 0x7d, 0x28, 0xa4, 0x82, 0x0e, 0x5b, 0xd7,
+    0x34, 0xb8, 0xed, 0x61, 0x47, 0xcb, 0x9e, 0x12,
+    0xd2, 0x5e, 0x0b, 0x87, 0xa1, 0x2d, 0x78, 0xf4,
+    0x39, 0xb5, 0xe0, 0x6c, 0x4a, 0xc6, 0x93, 0x1f,
+    0xdf, 0x53, 0x06, 0x8a, 0xac, 0x20, 0x75, 0xf9,
+    0x2e, 0xa2, 0xf7, 0x7b, 0x5d, 0xd1, 0x84, 0x08,
+    0xc8, 0x44, 0x11, 0x9d, 0xbb, 0x37, 0x62, 0xee,
+    0x23, 0xaf, 0xfa, 0x76, 0x50, 0xdc, 0x89, 0x05,
+    0xc5, 0x49, 0x1c, 0x90, 0xb6, 0x3a, 0x6f, 0xe3,
+    0x68, 0xe4, 0xb1, 0x3d, 0x1b, 0x97, 0xc2, 0x4e,
+    0x8e, 0x02, 0x57, 0xdb, 0xfd, 0x71, 0x24, 0xa8,
+    0x65, 0xe9, 0xbc, 0x30, 0x16, 0x9a, 0xcf, 0x43,
+    0x83, 0x0f, 0x5a, 0xd6, 0xf0, 0x7c, 0x29, 0xa5,
+    0x72, 0xfe, 0xab, 0x27, 0x01, 0x8d, 0xd8, 0x54,
+    0x94, 0x18, 0x4d, 0xc1, 0xe7, 0x6b, 0x3e, 0xb2,
+    0x7f, 0xf3, 0xa6, 0x2a, 0x0c, 0x80, 0xd5, 0x59,
+    0x99, 0x15, 0x40, 0xcc, 0xea, 0x66, 0x33, 0xbf,
+    0x5c, 0xd0, 0x85, 0x09, 0x2f, 0xa3, 0xf6, 0x7a,
+    0xba, 0x36, 0x63, 0xef, 0xc9, 0x45, 0x10, 0x9c,
+    0x51, 0xdd, 0x88, 0x04, 0x22, 0xae, 0xfb, 0x77,
+    0xb7, 0x3b, 0x6e, 0xe2, 0xc4, 0x48, 0x1d, 0x91,
+    0x46, 0xca, 0x9f, 0x13, 0x35, 0xb9, 0xec, 0x60,
+    0xa0, 0x2c, 0x79, 0xf5, 0xd3, 0x5f, 0x0a, 0x86,
+    0x4b, 0xc7, 0x92, 0x1e, 0x38, 0xb4, 0xe1, 0x6d,
+    0xad, 0x21, 0x74, 0xf8, 0xde, 0x52, 0x07, 0x8b},
+  {
+    0x00, 0xe9, 0x13, 0xfa, 0x26, 0xcf, 0x35, 0xdc,
+    0x4c, 0xa5, 0x5f, 0xb6, 0x6a, 0x83, 0x79, 0x90,
+    0x98, 0x71, 0x8b, 0x62, 0xbe, 0x57, 0xad, 0x44,
+    0xd4, 0x3d, 0xc7, 0x2e, 0xf2, 0x1b, 0xe1, 0x08,
+    0xf1, 0x18, 0xe2, 0x0b, 0xd7, 0x3e, 0xc4, 0x2d,
+    0xbd, 0x54, 0xae, 0x47, 0x9b, 0x72, 0x88, 0x61,
+    0x69, 0x80, 0x7a, 0x93, 0x4f, 0xa6, 0x5c, 0xb5,
+    0x25, 0xcc, 0x36, 0xdf, 0x03, 0xea, 0x10, 0xf9,
+    0x23, 0xca, 0x30, 0xd9, 0x05, 0xec, 0x16, 0xff,
+    0x6f, 0x86, 0x7c, 0x95, 0x49, 0xa0, 0x5a, 0xb3,
+    0xbb, 0x52, 0xa8, 0x41, 0x9d, 0x74, 0x8e, 0x67,
+    0xf7, 0x1e, 0xe4, 0x0d, 0xd1, 0x38, 0xc2, 0x2b,
+    0xd2, 0x3b, 0xc1, 0x28, 0xf4, 0x1d, 0xe7, 0x0e,
+    0x9e, 0x77, 0x8d, 0x64, 0xb8, 0x51, 0xab, 0x42,
+    0x4a, 0xa3, 0x59, 0xb0, 0x6c, 0x85, 0x7f, 0x96,
+    0x06, 0xef, 0x15, 0xfc, 0x20, 0xc9, 0x33, 0xda,
+    0x46, 0xaf, 0x55, 0xbc, 0x60, 0x89, 0x73, 0x9a,
+    0x0a, 0xe3, 0x19, 0xf0, 0x2c, 0xc5, 0x3f, 0xd6,
+    0xde, 0x37, 0xcd, 0x24, 0xf8, 0x11, 0xeb, 0x02,
+    0x92, 0x7b, 0x81, 0x68, 0xb4, 0x5d, 0xa7, 0x4e,
+    0xb7, 0x5e, 0xa4, 0x4d, 0x91, 0x78, 0x82, 0x6b,
+    0xfb, 0x12, 0xe8, 0x01, 0xdd, 0x34, 0xce, 0x27,
+    0x2f, 0xc6, 0x3c, 0xd5, 0x09, 0xe0, 0x1a, 0xf3,
+    0x63, 0x8a, 0x70, 0x99, 0x45, 0xac, 0x56, 0xbf,
+    0x65, 0x8c, 0x76, 0x9f, 0x43, 0xaa, 0x50, 0xb9,
+    0x29, 0xc0, 0x3a, 0xd3, 0x0f, 0xe6, 0x1c, 0xf5,
+    0xfd, 0x14, 0xee, 0x07, 0xdb, 0x32, 0xc8, 0x21,
+    0xb1, 0x58, 0xa2, 0x4b, 0x97, 0x7e, 0x84, 0x6d,
+    0x94, 0x7d, 0x87, 0x6e, 0xb2, 0x5b, 0xa1, 0x48,
+    0xd8, 0x31, 0xcb, 0x22, 0xfe, 0x17, 0xed, 0x04,
+    0x0c, 0xe5, 0x1f, 0xf6, 0x2a, 0xc3, 0x39, 0xd0,
+    0x40, 0xa9, 0x53, 0xba, 0x66, 0x8f, 0x75, 0x9c},
+  {
+    0x00, 0x37, 0x6e, 0x59, 0xdc, 0xeb, 0xb2, 0x85,
+    0x79, 0x4e, 0x17, 0x20, 0xa5, 0x92, 0xcb, 0xfc,
+    0xf2, 0xc5, 0x9c, 0xab, 0x2e, 0x19, 0x40, 0x77,
+    0x8b, 0xbc, 0xe5, 0xd2, 0x57, 0x60, 0x39, 0x0e,
+    0x25, 0x12, 0x4b, 0x7c, 0xf9, 0xce, 0x97, 0xa0,
+    0x5c, 0x6b, 0x32, 0x05, 0x80, 0xb7, 0xee, 0xd9,
+    0xd7, 0xe0, 0xb9, 0x8e, 0x0b, 0x3c, 0x65, 0x52,
+    0xae, 0x99, 0xc0, 0xf7, 0x72, 0x45, 0x1c, 0x2b,
+    0x4a, 0x7d, 0x24, 0x13, 0x96, 0xa1, 0xf8, 0xcf,
+    0x33, 0x04, 0x5d, 0x6a, 0xef, 0xd8, 0x81, 0xb6,
+    0xb8, 0x8f, 0xd6, 0xe1, 0x64, 0x53, 0x0a, 0x3d,
+    0xc1, 0xf6, 0xaf, 0x98, 0x1d, 0x2a, 0x73, 0x44,
+    0x6f, 0x58, 0x01, 0x36, 0xb3, 0x84, 0xdd, 0xea,
+    0x16, 0x21, 0x78, 0x4f, 0xca, 0xfd, 0xa4, 0x93,
+    0x9d, 0xaa, 0xf3, 0xc4, 0x41, 0x76, 0x2f, 0x18,
+    0xe4, 0xd3, 0x8a, 0xbd, 0x38, 0x0f, 0x56, 0x61,
+    0x94, 0xa3, 0xfa, 0xcd, 0x48, 0x7f, 0x26, 0x11,
+    0xed, 0xda, 0x83, 0xb4, 0x31, 0x06, 0x5f, 0x68,
+    0x66, 0x51, 0x08, 0x3f, 0xba, 0x8d, 0xd4, 0xe3,
+    0x1f, 0x28, 0x71, 0x46, 0xc3, 0xf4, 0xad, 0x9a,
+    0xb1, 0x86, 0xdf, 0xe8, 0x6d, 0x5a, 0x03, 0x34,
+    0xc8, 0xff, 0xa6, 0x91, 0x14, 0x23, 0x7a, 0x4d,
+    0x43, 0x74, 0x2d, 0x1a, 0x9f, 0xa8, 0xf1, 0xc6,
+    0x3a, 0x0d, 0x54, 0x63, 0xe6, 0xd1, 0x88, 0xbf,
+    0xde, 0xe9, 0xb0, 0x87, 0x02, 0x35, 0x6c, 0x5b,
+    0xa7, 0x90, 0xc9, 0xfe, 0x7b, 0x4c, 0x15, 0x22,
+    0x2c, 0x1b, 0x42, 0x75, 0xf0, 0xc7, 0x9e, 0xa9,
+    0x55, 0x62, 0x3b, 0x0c, 0x89, 0xbe, 0xe7, 0xd0,
+    0xfb, 0xcc, 0x95, 0xa2, 0x27, 0x10, 0x49, 0x7e,
+    0x82, 0xb5, 0xec, 0xdb, 0x5e, 0x69, 0x30, 0x07,
+    0x09, 0x3e, 0x67, 0x50, 0xd5, 0xe2, 0xbb, 0x8c,
+    0x70, 0x47, 0x1e, 0x29, 0xac, 0x9b, 0xc2, 0xf5},
+  {
+    0x00, 0x51, 0xa2, 0xf3, 0x85, 0xd4, 0x27, 0x76,
+    0xcb, 0x9a, 0x69, 0x38, 0x4e, 0x1f, 0xec, 0xbd,
+    0x57, 0x06, 0xf5, 0xa4, 0xd2, 0x83, 0x70, 0x21,
+    0x9c, 0xcd, 0x3e, 0x6f, 0x19, 0x48, 0xbb, 0xea,
+    0xae, 0xff, 0x0c, 0x5d, 0x2b, 0x7a, 0x89, 0xd8,
+    0x65, 0x34, 0xc7, 0x96, 0xe0, 0xb1, 0x42, 0x13,
+    0xf9, 0xa8, 0x5b, 0x0a, 0x7c, 0x2d, 0xde, 0x8f,
+    0x32, 0x63, 0x90, 0xc1, 0xb7, 0xe6, 0x15, 0x44,
+    0x9d, 0xcc, 0x3f, 0x6e, 0x18, 0x49, 0xba, 0xeb,
+    0x56, 0x07, 0xf4, 0xa5, 0xd3, 0x82, 0x71, 0x20,
+    0xca, 0x9b, 0x68, 0x39, 0x4f, 0x1e, 0xed, 0xbc,
+    0x01, 0x50, 0xa3, 0xf2, 0x84, 0xd5, 0x26, 0x77,
+    0x33, 0x62, 0x91, 0xc0, 0xb6, 0xe7, 0x14, 0x45,
+    0xf8, 0xa9, 0x5a, 0x0b, 0x7d, 0x2c, 0xdf, 0x8e,
+    0x64, 0x35, 0xc6, 0x97, 0xe1, 0xb0, 0x43, 0x12,
+    0xaf, 0xfe, 0x0d, 0x5c, 0x2a, 0x7b, 0x88, 0xd9,
+    0xfb, 0xaa, 0x59, 0x08, 0x7e, 0x2f, 0xdc, 0x8d,
+    0x30, 0x61, 0x92, 0xc3, 0xb5, 0xe4, 0x17, 0x46,
+    0xac, 0xfd, 0x0e, 0x5f, 0x29, 0x78, 0x8b, 0xda,
+    0x67, 0x36, 0xc5, 0x94, 0xe2, 0xb3, 0x40, 0x11,
+    0x55, 0x04, 0xf7, 0xa6, 0xd0, 0x81, 0x72, 0x23,
+    0x9e, 0xcf, 0x3c, 0x6d, 0x1b, 0x4a, 0xb9, 0xe8,
+    0x02, 0x53, 0xa0, 0xf1, 0x87, 0xd6, 0x25, 0x74,
+    0xc9, 0x98, 0x6b, 0x3a, 0x4c, 0x1d, 0xee, 0xbf,
+    0x66, 0x37, 0xc4, 0x95, 0xe3, 0xb2, 0x41, 0x10,
+    0xad, 0xfc, 0x0f, 0x5e, 0x28, 0x79, 0x8a, 0xdb,
+    0x31, 0x60, 0x93, 0xc2, 0xb4, 0xe5, 0x16, 0x47,
+    0xfa, 0xab, 0x58, 0x09, 0x7f, 0x2e, 0xdd, 0x8c,
+    0xc8, 0x99, 0x6a, 0x3b, 0x4d, 0x1c, 0xef, 0xbe,
+    0x03, 0x52, 0xa1, 0xf0, 0x86, 0xd7, 0x24, 0x75,
+    0x9f, 0xce, 0x3d, 0x6c, 0x1a, 0x4b, 0xb8, 0xe9,
+    0x54, 0x05, 0xf6, 0xa7, 0xd1, 0x80, 0x73, 0x22},
+  {
+    0x00, 0xfd, 0x3b, 0xc6, 0x76, 0x8b, 0x4d, 0xb0,
+    0xec, 0x11, 0xd7, 0x2a, 0x9a, 0x67, 0xa1, 0x5c,
+    0x19, 0xe4, 0x22, 0xdf, 0x6f, 0x92, 0x54, 0xa9,
+    0xf5, 0x08, 0xce, 0x33, 0x83, 0x7e, 0xb8, 0x45,
+    0x32, 0xcf, 0x09, 0xf4, 0x44, 0xb9, 0x7f, 0x82,
+    0xde, 0x23, 0xe5, 0x18, 0xa8, 0x55, 0x93, 0x6e,
+    0x2b, 0xd6, 0x10, 0xed, 0x5d, 0xa0, 0x66, 0x9b,
+    0xc7, 0x3a, 0xfc, 0x01, 0xb1, 0x4c, 0x8a, 0x77,
+    0x64, 0x99, 0x5f, 0xa2, 0x12, 0xef, 0x29, 0xd4,
+    0x88, 0x75, 0xb3, 0x4e, 0xfe, 0x03, 0xc5, 0x38,
+    0x7d, 0x80, 0x46, 0xbb, 0x0b, 0xf6, 0x30, 0xcd,
+    0x91, 0x6c, 0xaa, 0x57, 0xe7, 0x1a, 0xdc, 0x21,
+    0x56, 0xab, 0x6d, 0x90, 0x20, 0xdd, 0x1b, 0xe6,
+    0xba, 0x47, 0x81, 0x7c, 0xcc, 0x31, 0xf7, 0x0a,
+    0x4f, 0xb2, 0x74, 0x89, 0x39, 0xc4, 0x02, 0xff,
+    0xa3, 0x5e, 0x98, 0x65, 0xd5, 0x28, 0xee, 0x13,
+    0xc8, 0x35, 0xf3, 0x0e, 0xbe, 0x43, 0x85, 0x78,
+    0x24, 0xd9, 0x1f, 0xe2, 0x52, 0xaf, 0x69, 0x94,
+    0xd1, 0x2c, 0xea, 0x17, 0xa7, 0x5a, 0x9c, 0x61,
+    0x3d, 0xc0, 0x06, 0xfb, 0x4b, 0xb6, 0x70, 0x8d,
+    0xfa, 0x07, 0xc1, 0x3c, 0x8c, 0x71, 0xb7, 0x4a,
+    0x16, 0xeb, 0x2d, 0xd0, 0x60, 0x9d, 0x5b, 0xa6,
+    0xe3, 0x1e, 0xd8, 0x25, 0x95, 0x68, 0xae, 0x53,
+    0x0f, 0xf2, 0x34, 0xc9, 0x79, 0x84, 0x42, 0xbf,
+    0xac, 0x51, 0x97, 0x6a, 0xda, 0x27, 0xe1, 0x1c,
+    0x40, 0xbd, 0x7b, 0x86, 0x36, 0xcb, 0x0d, 0xf0,
+    0xb5, 0x48, 0x8e, 0x73, 0xc3, 0x3e, 0xf8, 0x05,
+    0x59, 0xa4, 0x62, 0x9f, 0x2f, 0xd2, 0x14, 0xe9,
+    0x9e, 0x63, 0xa5, 0x58, 0xe8, 0x15, 0xd3, 0x2e,
+    0x72, 0x8f, 0x49, 0xb4, 0x04, 0xf9, 0x3f, 0xc2,
+    0x87, 0x7a, 0xbc, 0x41, 0xf1, 0x0c, 0xca, 0x37,
+    0x6b, 0x96, 0x50, 0xad, 0x1d, 0xe0, 0x26, 0xdb}};
+
+
+// crc16 slicing-by-8 table (polynomial 0x8005)
+const unsigned short int crc16_gentab[8][256] = {
+  {
+    0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
+    0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440,
+    0xcc01, 0x0cc0, 0x0d80, 0xcd41, 0x0f00, 0xcfc1, 0xce81, 0x0e40,
+    0x0a00, 0xcac1, 0xcb81, 0x0b40, 0xc901, 0x09c0, 0x0880, 0xc841,
+    0xd801, 0x18c0, 0x1980, 0xd941, 0x1b00, 0xdbc1, 0xda81, 0x1a40,
+    0x1e00, 0xdec1, 0xdf81, 0x1f40, 0xdd01, 0x1dc0, 0x1c80, 0xdc41,
+    0x1400, 0xd4c1, 0xd581, 0x1540, 0xd701, 0x17c0, 0x1680, 0xd641,
+    0xd201, 0x12c0, 0x1380, 0xd341, 0x1100, 0xd1c1, 0xd081, 0x1040,
+    0xf001, 0x30c0, 0x3180, 0xf141, 0x3300, 0xf3c1, 0xf281, 0x3240,
+    0x3600, 0xf6c1, 0xf781, 0x3740, 0xf501, 0x35c0, 0x3480, 0xf441,
+    0x3c00, 0xfcc1, 0xfd81, 0x3d40, 0xff01, 0x3fc0, 0x3e80, 0xfe41,
+    0xfa01, 0x3ac0, 0x3b80, 0xfb41, 0x3900, 0xf9c1, 0xf881, 0x3840,
+    0x2800, 0xe8c1, 0xe981, 0x2940, 0xeb01, 0x2bc0, 0x2a80, 0xea41,
+    0xee01, 0x2ec0, 0x2f80, 0xef41, 0x2d00, 0xedc1, 0xec81, 0x2c40,
+    0xe401, 0x24c0, 0x2580, 0xe541, 0x2700, 0xe7c1, 0xe681, 0x2640,
+    0x2200, 0xe2c1, 0xe381, 0x2340, 0xe101, 0x21c0, 0x2080, 0xe041,
+    0xa001, 0x60c0, 0x6180, 0xa141, 0x6300, 0xa3c1, 0xa281, 0x6240,
+    0x6600, 0xa6c1, 0xa781, 0x6740, 0xa501, 0x65c0, 0x6480, 0xa441,
+    0x6c00, 0xacc1, 0xad81, 0x6d40, 0xaf01, 0x6fc0, 0x6e80, 0xae41,
+    0xaa01, 0x6ac0, 0x6b80, 0xab41, 0x6900, 0xa9c1, 0xa881, 0x6840,
+    0x7800, 0xb8c1, 0xb981, 0x7940, 0xbb01, 0x7bc0, 0x7a80, 0xba41,
+    0xbe01, 0x7ec0, 0x7f80, 0xbf41, 0x7d00, 0xbdc1, 0xbc81, 0x7c40,
+    0xb401, 0x74c0, 0x7580, 0xb541, 0x7700, 0xb7c1, 0xb681, 0x7640,
+    0x7200, 0xb2c1, 0xb381, 0x7340, 0xb101, 0x71c0, 0x7080, 0xb041,
+    0x5000, 0x90c1, 0x9181, 0x5140, 0x9301, 0x53c0, 0x5280, 0x9241,
+    0x9601, 0x56c0, 0x5780, 0x9741, 0x5500, 0x95c1, 0x9481, 0x5440,
+    0x9c01, 0x5cc0, 0x5d80, 0x9d41, 0x5f00, 0x9fc1, 0x9e81, 0x5e40,
+    0x5a00, 0x9ac1, 0x9b81, 0x5b40, 0x9901, 0x59c0, 0x5880, 0x9841,
+    0x8801, 0x48c0, 0x4980, 0x8941, 0x4b00, 0x8bc1, 0x8a81, 0x4a40,
+    0x4e00, 0x8ec1, 0x8f81, 0x4f40, 0x8d01, 0x4dc0, 0x4c80, 0x8c41,
+    0x4400, 0x84c1, 0x8581, 0x4540, 0x8701, 0x47c0, 0x4680, 0x8641,
+    0x8201, 0x42c0, 0x4380, 0x8341, 0x4100, 0x81c1, 0x8081, 0x4040},
+  {
+    0x0000, 0x9001, 0x6001, 0xf000, 0xc002, 0x5003, 0xa003, 0x3002,
+    0xc007, 0x5006, 0xa006, 0x3007, 0x0005, 0x9004, 0x6004, 0xf005,
+    0xc00d, 0x500c, 0xa00c, 0x300d, 0x000f, 0x900e, 0x600e, 0xf00f,
+    0x000a, 0x900b, 0x600b, 0xf00a, 0xc008, 0x5009, 0xa009, 0x3008,
+    0xc019, 0x5018, 0xa018, 0x3019, 0x001b, 0x901a, 0x601a, 0xf01b,
+    0x001e, 0x901f, 0x601f, 0xf01e, 0xc01c, 0x501d, 0xa01d, 0x301c,
+    0x0014, 0x9015, 0x6015, 0xf014, 0xc016, 0x5017, 0xa017, 0x3016,
+    0xc013, 0x5012, 0xa012, 0x3013, 0x0011, 0x9010, 0x6010, 0xf011,
+    0xc031, 0x5030, 0xa030, 0x3031, 0x0033, 0x9032, 0x6032, 0xf033,
+    0x0036, 0x9037, 0x6037, 0xf036, 0xc034, 0x5035, 0xa035, 0x3034,
+    0x003c, 0x903d, 0x603d, 0xf03c, 0xc03e, 0x503f, 0xa03f, 0x303e,
+    0xc03b, 0x503a, 0xa03a, 0x303b, 0x0039, 0x9038, 0x6038, 0xf039,
+    0x0028, 0x9029, 0x6029, 0xf028, 0xc02a, 0x502b, 0xa02b, 0x302a,
+    0xc02f, 0x502e, 0xa02e, 0x302f, 0x002d, 0x902c, 0x602c, 0xf02d,
+    0xc025, 0x5024, 0xa024, 0x3025, 0x0027, 0x9026, 0x6026, 0xf027,
+    0x0022, 0x9023, 0x6023, 0xf022, 0xc020, 0x5021, 0xa021, 0x3020,
+    0xc061, 0x5060, 0xa060, 0x3061, 0x0063, 0x9062, 0x6062, 0xf063,
+    0x0066, 0x9067, 0x6067, 0xf066, 0xc064, 0x5065, 0xa065, 0x3064,
+    0x006c, 0x906d, 0x606d, 0xf06c, 0xc06e, 0x506f, 0xa06f, 0x306e,
+    0xc06b, 0x506a, 0xa06a, 0x306b, 0x0069, 0x9068, 0x6068, 0xf069,
+    0x0078, 0x9079, 0x6079, 0xf078, 0xc07a, 0x507b, 0xa07b, 0x307a,
+    0xc07f, 0x507e, 0xa07e, 0x307f, 0x007d, 0x907c, 0x607c, 0xf07d,
+    0xc075, 0x5074, 0xa074, 0x3075, 0x0077, 0x9076, 0x6076, 0xf077,
+    0x0072, 0x9073, 0x6073, 0xf072, 0xc070, 0x5071, 0xa071, 0x3070,
+    0x0050, 0x9051, 0x6051, 0xf050, 0xc052, 0x5053, 0xa053, 0x3052,
+    0xc057, 0x5056, 0xa056, 0x3057, 0x0055, 0x9054, 0x6054, 0xf055,
+    0xc05d, 0x505c, 0xa05c, 0x305d, 0x005f, 0x905e, 0x605e, 0xf05f,
+    0x005a, 0x905b, 0x605b, 0xf05a, 0xc058, 0x5059, 0xa059, 0x3058,
+    0xc049, 0x5048, 0xa048, 0x3049, 0x004b, 0x904a, 0x604a, 0xf04b,
+    0x004e, 0x904f, 0x604f, 0xf04e, 0xc04c, 0x504d, 0xa04d, 0x304c,
+    0x0044, 0x9045, 0x6045, 0xf044, 0xc046, 0x5047, 0xa047, 0x3046,
+    0xc043, 0x5042, 0xa042, 0x3043, 0x0041, 0x9040, 0x6040, 0xf041},
+  {
+    0x0000, 0xc051, 0xc0a1, 0x00f0, 0xc141, 0x0110, 0x01e0, 0xc1b1,
+    0xc281, 0x02d0, 0x0220, 0xc271, 0x03c0, 0xc391, 0xc361, 0x0330,
+    0xc501, 0x0550, 0x05a0, 0xc5f1, 0x0440, 0xc411, 0xc4e1, 0x04b0,
+    0x0780, 0xc7d1, 0xc721, 0x0770, 0xc6c1, 0x0690, 0x0660, 0xc631,
+    0xca01, 0x0a50, 0x0aa0, 0xcaf1, 0x0b40, 0xcb11, 0xcbe1, 0x0bb0,
+    0x0880, 0xc8d1, 0xc821, 0x0870, 0xc9c1, 0x0990, 0x0960, 0xc931,
+    0x0f00, 0xcf51, 0xcfa1, 0x0ff0, 0xce41, 0x0e10, 0x0ee0, 0xceb1,
+    0xcd81, 0x0dd0, 0x0d20, 0xcd71, 0x0cc0, 0xcc91, 0xcc61, 0x0c30,
+    0xd401, 0x1450, 0x14a0, 0xd4f1, 0x1540, 0xd511, 0xd5e1, 0x15b0,
+    0x1680, 0xd6d1, 0xd621, 0x1670, 0xd7c1, 0x1790, 0x1760, 0xd731,
+    0x1100, 0xd151, 0xd1a1, 0x11f0, 0xd041, 0x1010, 0x10e0, 0xd0b1,
+    0xd381, 0x13d0, 0x1320, 0xd371, 0x12c0, 0xd291, 0xd261, 0x1230,
+    0x1e00, 0xde51, 0xdea1, 0x1ef0, 0xdf41, 0x1f10, 0x1fe0, 0xdfb1,
+    0xdc81, 0x1cd0, 0x1c20, 0xdc71, 0x1dc0, 0xdd91, 0xdd61, 0x1d30,
+    0xdb01, 0x1b50, 0x1ba0, 0xdbf1, 0x1a40, 0xda11, 0xdae1, 0x1ab0,
+    0x1980, 0xd9d1, 0xd921, 0x1970, 0xd8c1, 0x1890, 0x1860, 0xd831,
+    0xe801, 0x2850, 0x28a0, 0xe8f1, 0x2940, 0xe911, 0xe9e1, 0x29b0,
+    0x2a80, 0xead1, 0xea21, 0x2a70, 0xebc1, 0x2b90, 0x2b60, 0xeb31,
+    0x2d00, 0xed51, 0xeda1, 0x2df0, 0xec41, 0x2c10, 0x2ce0, 0xecb1,
+    0xef81, 0x2fd0, 0x2f20, 0xef71, 0x2ec0, 0xee91, 0xee61, 0x2e30,
+    0x2200, 0xe251, 0xe2a1, 0x22f0, 0xe341, 0x2310, 0x23e0, 0xe3b1,
+    0xe081, 0x20d0, 0x2020, 0xe071, 0x21c0, 0xe191, 0xe161, 0x2130,
+    0xe701, 0x2750, 0x27a0, 0xe7f1, 0x2640, 0xe611, 0xe6e1, 0x26b0,
+    0x2580, 0xe5d1, 0xe521, 0x2570, 0xe4c1, 0x2490, 0x2460, 0xe431,
+    0x3c00, 0xfc51, 0xfca1, 0x3cf0, 0xfd41, 0x3d10, 0x3de0, 0xfdb1,
+    0xfe81, 0x3ed0, 0x3e20, 0xfe71, 0x3fc0, 0xff91, 0xff61, 0x3f30,
+    0xf901, 0x3950, 0x39a0, 0xf9f1, 0x3840, 0xf811, 0xf8e1, 0x38b0,
+    0x3b80, 0xfbd1, 0xfb21, 0x3b70, 0xfac1, 0x3a90, 0x3a60, 0xfa31,
+    0xf601, 0x3650, 0x36a0, 0xf6f1, 0x3740, 0xf711, 0xf7e1, 0x37b0,
+    0x3480, 0xf4d1, 0xf421, 0x3470, 0xf5c1, 0x3590, 0x3560, 0xf531,
+    0x3300, 0xf351, 0xf3a1, 0x33f0, 0xf241, 0x3210, 0x32e0, 0xf2b1,
+    0xf181, 0x31d0, 0x3120, 0xf171, 0x30c0, 0xf091, 0xf061, 0x3030},
+  {
+    0x0000, 0xfc01, 0xb801, 0x4400, 0x3001, 0xcc00, 0x8800, 0x7401,
+    0x6002, 0x9c03, 0xd803, 0x2402, 0x5003, 0xac02, 0xe802, 0x1403,
+    0xc004, 0x3c05, 0x7805, 0x8404, 0xf005, 0x0c04, 0x4804, 0xb405,
+    0xa006, 0x5c07, 0x1807, 0xe406, 0x9007, 0x6c06, 0x2806, 0xd407,
+    0xc00b, 0x3c0a, 0x780a, 0x840b, 0xf00a, 0x0c0b, 0x480b, 0xb40a,
+    0xa009, 0x5c08, 0x1808, 0xe409, 0x9008, 0x6c09, 0x2809, 0xd408,
+    0x000f, 0xfc0e, 0xb80e, 0x440f, 0x300e, 0xcc0f, 0x880f, 0x740e,
+    0x600d, 0x9c0c, 0xd80c, 0x240d, 0x500c, 0xac0d, 0xe80d, 0x140c,
+    0xc015, 0x3c14, 0x7814, 0x8415, 0xf014, 0x0c15, 0x4815, 0xb414,
+    0xa017, 0x5c16, 0x1816, 0xe417, 0x9016, 0x6c17, 0x2817, 0xd416,
+    0x0011, 0xfc10, 0xb810, 0x4411, 0x3010, 0xcc11, 0x8811, 0x7410,
+    0x6013, 0x9c12, 0xd812, 0x2413, 0x5012, 0xac13, 0xe813, 0x1412,
+    0x001e, 0xfc1f, 0xb81f, 0x441e, 0x301f, 0xcc1e, 0x881e, 0x741f,
+    0x601c, 0x9c1d, 0xd81d, 0x241c, 0x501d, 0xac1c, 0xe81c, 0x141d,
+    0xc01a, 0x3c1b, 0x781b, 0x841a, 0xf01b, 0x0c1a, 0x481a, 0xb41b,
+    0xa018, 0x5c19, 0x1819, 0xe418, 0x9019, 0x6c18, 0x2818, 0xd419,
+    0xc029, 0x3c28, 0x7828, 0x8429, 0xf028, 0x0c29, 0x4829, 0xb428,
+    0xa02b, 0x5c2a, 0x182a, 0xe42b, 0x902a, 0x6c2b, 0x282b, 0xd42a,
+    0x002d, 0xfc2c, 0xb82c, 0x442d, 0x302c, 0xcc2d, 0x882d, 0x742c,
+    0x602f, 0x9c2e, 0xd82e, 0x242f, 0x502e, 0xac2f, 0xe82f, 0x142e,
+    0x0022, 0xfc23, 0xb823, 0x4422, 0x3023, 0xcc22, 0x8822, 0x7423,
+    0x6020, 0x9c21, 0xd821, 0x2420, 0x5021, 0xac20, 0xe820, 0x1421,
+    0xc026, 0x3c27, 0x7827, 0x8426, 0xf027, 0x0c26, 0x4826, 0xb427,
+    0xa024, 0x5c25, 0x1825, 0xe424, 0x9025, 0x6c24, 0x2824, 0xd425,
+    0x003c, 0xfc3d, 0xb83d, 0x443c, 0x303d, 0xcc3c, 0x883c, 0x743d,
+    0x603e, 0x9c3f, 0xd83f, 0x243e, 0x503f, 0xac3e, 0xe83e, 0x143f,
+    0xc038, 0x3c39, 0x7839, 0x8438, 0xf039, 0x0c38, 0x4838, 0xb439,
+    0xa03a, 0x5c3b, 0x183b, 0xe43a, 0x903b, 0x6c3a, 0x283a, 0xd43b,
+    0xc037, 0x3c36, 0x7836, 0x8437, 0xf036, 0x0c37, 0x4837, 0xb436,
+    0xa035, 0x5c34, 0x1834, 0xe435, 0x9034, 0x6c35, 0x2835, 0xd434,
+    0x0033, 0xfc32, 0xb832, 0x4433, 0x3032, 0xcc33, 0x8833, 0x7432,
+    0x6031, 0x9c30, 0xd830, 0x2431, 0x5030, 0xac31, 0xe831, 0x1430},
+  {
+    0x0000, 0xc03d, 0xc079, 0x0044, 0xc0f1, 0x00cc, 0x0088, 0xc0b5,
+    0xc1e1, 0x01dc, 0x0198, 0xc1a5, 0x0110, 0xc12d, 0xc169, 0x0154,
+    0xc3c1, 0x03fc, 0x03b8, 0xc385, 0x0330, 0xc30d, 0xc349, 0x0374,
+    0x0220, 0xc21d, 0xc259, 0x0264, 0xc2d1, 0x02ec, 0x02a8, 0xc295,
+    0xc781, 0x07bc, 0x07f8, 0xc7c5, 0x0770, 0xc74d, 0xc709, 0x0734,
+    0x0660, 0xc65d, 0xc619, 0x0624, 0xc691, 0x06ac, 0x06e8, 0xc6d5,
+    0x0440, 0xc47d, 0xc439, 0x0404, 0xc4b1, 0x048c, 0x04c8, 0xc4f5,
+    0xc5a1, 0x059c, 0x05d8, 0xc5e5, 0x0550, 0xc56d, 0xc529, 0x0514,
+    0xcf01, 0x0f3c, 0x0f78, 0xcf45, 0x0ff0, 0xcfcd, 0xcf89, 0x0fb4,
+    0x0ee0, 0xcedd, 0xce99, 0x0ea4, 0xce11, 0x0e2c, 0x0e68, 0xce55,
+    0x0cc0, 0xccfd, 0xccb9, 0x0c84, 0xcc31, 0x0c0c, 0x0c48, 0xcc75,
+    0xcd21, 0x0d1c, 0x0d58, 0xcd65, 0x0dd0, 0xcded, 0xcda9, 0x0d94,
+    0x0880, 0xc8bd, 0xc8f9, 0x08c4, 0xc871, 0x084c, 0x0808, 0xc835,
+    0xc961, 0x095c, 0x0918, 0xc925, 0x0990, 0xc9ad, 0xc9e9, 0x09d4,
+    0xcb41, 0x0b7c, 0x0b38, 0xcb05, 0x0bb0, 0xcb8d, 0xcbc9, 0x0bf4,
+    0x0aa0, 0xca9d, 0xcad9, 0x0ae4, 0xca51, 0x0a6c, 0x0a28, 0xca15,
+    0xde01, 0x1e3c, 0x1e78, 0xde45, 0x1ef0, 0xdecd, 0xde89, 0x1eb4,
+    0x1fe0, 0xdfdd, 0xdf99, 0x1fa4, 0xdf11, 0x1f2c, 0x1f68, 0xdf55,
+    0x1dc0, 0xddfd, 0xddb9, 0x1d84, 0xdd31, 0x1d0c, 0x1d48, 0xdd75,
+    0xdc21, 0x1c1c, 0x1c58, 0xdc65, 0x1cd0, 0xdced, 0xdca9, 0x1c94,
+    0x1980, 0xd9bd, 0xd9f9, 0x19c4, 0xd971, 0x194c, 0x1908, 0xd935,
+    0xd861, 0x185c, 0x1818, 0xd825, 0x1890, 0xd8ad, 0xd8e9, 0x18d4,
+    0xda41, 0x1a7c, 0x1a38, 0xda05, 0x1ab0, 0xda8d, 0xdac9, 0x1af4,
+    0x1ba0, 0xdb9d, 0xdbd9, 0x1be4, 0xdb51, 0x1b6c, 0x1b28, 0xdb15,
+    0x1100, 0xd13d, 0xd179, 0x1144, 0xd1f1, 0x11cc, 0x1188, 0xd1b5,
+    0xd0e1, 0x10dc, 0x1098, 0xd0a5, 0x1010, 0xd02d, 0xd069, 0x1054,
+    0xd2c1, 0x12fc, 0x12b8, 0xd285, 0x1230, 0xd20d, 0xd249, 0x1274,
+    0x1320, 0xd31d, 0xd359, 0x1364, 0xd3d1, 0x13ec, 0x13a8, 0xd395,
+    0xd681, 0x16bc, 0x16f8, 0xd6c5, 0x1670, 0xd64d, 0xd609, 0x1634,
+    0x1760, 0xd75d, 0xd719, 0x1724, 0xd791, 0x17ac, 0x17e8, 0xd7d5,
+    0x1540, 0xd57d, 0xd539, 0x1504, 0xd5b1, 0x158c, 0x15c8, 0xd5f5,
+    0xd4a1, 0x149c, 0x14d8, 0xd4e5, 0x1450, 0xd46d, 0xd429, 0x1414},
+  {
+    0x0000, 0xd101, 0xe201, 0x3300, 0x8401, 0x5500, 0x6600, 0xb701,
+    0x4801, 0x9900, 0xaa00, 0x7b01, 0xcc00, 0x1d01, 0x2e01, 0xff00,
+    0x9002, 0x4103, 0x7203, 0xa302, 0x1403, 0xc502, 0xf602, 0x2703,
+    0xd803, 0x0902, 0x3a02, 0xeb03, 0x5c02, 0x8d03, 0xbe03, 0x6f02,
+    0x6007, 0xb106, 0x8206, 0x5307, 0xe406, 0x3507, 0x0607, 0xd706,
+    0x2806, 0xf907, 0xca07, 0x1b06, 0xac07, 0x7d06, 0x4e06, 0x9f07,
+    0xf005, 0x2104, 0x1204, 0xc305, 0x7404, 0xa505, 0x9605, 0x4704,
+    0xb804, 0x6905, 0x5a05, 0x8b04, 0x3c05, 0xed04, 0xde04, 0x0f05,
+    0xc00e, 0x110f, 0x220f, 0xf30e, 0x440f, 0x950e, 0xa60e, 0x770f,
+    0x880f, 0x590e, 0x6a0e, 0xbb0f, 0x0c0e, 0xdd0f, 0xee0f, 0x3f0e,
+    0x500c, 0x810d, 0xb20d, 0x630c, 0xd40d, 0x050c, 0x360c, 0xe70d,
+    0x180d, 0xc90c, 0xfa0c, 0x2b0d, 0x9c0c, 0x4d0d, 0x7e0d, 0xaf0c,
+    0xa009, 0x7108, 0x4208, 0x9309, 0x2408, 0xf509, 0xc609, 0x1708,
+    0xe808, 0x3909, 0x0a09, 0xdb08, 0x6c09, 0xbd08, 0x8e08, 0x5f09,
+    0x300b, 0xe10a, 0xd20a, 0x030b, 0xb40a, 0x650b, 0x560b, 0x870a,
+    0x780a, 0xa90b, 0x9a0b, 0x4b0a, 0xfc0b, 0x2d0a, 0x1e0a, 0xcf0b,
+    0xc01f, 0x111e, 0x221e, 0xf31f, 0x441e, 0x951f, 0xa61f, 0x771e,
+    0x881e, 0x591f, 0x6a1f, 0xbb1e, 0x0c1f, 0xdd1e, 0xee1e, 0x3f1f,
+    0x501d, 0x811c, 0xb21c, 0x631d, 0xd41c, 0x051d, 0x361d, 0xe71c,
+    0x181c, 0xc91d, 0xfa1d, 0x2b1c, 0x9c1d, 0x4d1c, 0x7e1c, 0xaf1d,
+    0xa018, 0x7119, 0x4219, 0x9318, 0x2419, 0xf518, 0xc618, 0x1719,
+    0xe819, 0x3918, 0x0a18, 0xdb19, 0x6c18, 0xbd19, 0x8e19, 0x5f18,
+    0x301a, 0xe11b, 0xd21b, 0x031a, 0xb41b, 0x651a, 0x561a, 0x871b,
+    0x781b, 0xa91a, 0x9a1a, 0x4b1b, 0xfc1a, 0x2d1b, 0x1e1b, 0xcf1a,
+    0x0011, 0xd110, 0xe210, 0x3311, 0x8410, 0x5511, 0x6611, 0xb710,
+    0x4810, 0x9911, 0xaa11, 0x7b10, 0xcc11, 0x1d10, 0x2e10, 0xff11,
+    0x9013, 0x4112, 0x7212, 0xa313, 0x1412, 0xc513, 0xf613, 0x2712,
+    0xd812, 0x0913, 0x3a13, 0xeb12, 0x5c13, 0x8d12, 0xbe12, 0x6f13,
+    0x6016, 0xb117, 0x8217, 0x5316, 0xe417, 0x3516, 0x0616, 0xd717,
+    0x2817, 0xf916, 0xca16, 0x1b17, 0xac16, 0x7d17, 0x4e17, 0x9f16,
+    0xf014, 0x2115, 0x1215, 0xc314, 0x7415, 0xa514, 0x9614, 0x4715,
+    0xb815, 0x6914, 0x5a14, 0x8b15, 0x3c14, 0xed15, 0xde15, 0x0f14},
+  {
+    0x0000, 0xc010, 0xc023, 0x0033, 0xc045, 0x0055, 0x0066, 0xc076,
+    0xc089, 0x0099, 0x00aa, 0xc0ba, 0x00cc, 0xc0dc, 0xc0ef, 0x00ff,
+    0xc111, 0x0101, 0x0132, 0xc122, 0x0154, 0xc144, 0xc177, 0x0167,
+    0x0198, 0xc188, 0xc1bb, 0x01ab, 0xc1dd, 0x01cd, 0x01fe, 0xc1ee,
+    0xc221, 0x0231, 0x0202, 0xc212, 0x0264, 0xc274, 0xc247, 0x0257,
+    0x02a8, 0xc2b8, 0xc28b, 0x029b, 0xc2ed, 0x02fd, 0x02ce, 0xc2de,
+    0x0330, 0xc320, 0xc313, 0x0303, 0xc375, 0x0365, 0x0356, 0xc346,
+    0xc3b9, 0x03a9, 0x039a, 0xc38a, 0x03fc, 0xc3ec, 0xc3df, 0x03cf,
+    0xc441, 0x0451, 0x0462, 0xc472, 0x0404, 0xc414, 0xc427, 0x0437,
+    0x04c8, 0xc4d8, 0xc4eb, 0x04fb, 0xc48d, 0x049d, 0x04ae, 0xc4be,
+    0x0550, 0xc540, 0xc573, 0x0563, 0xc515, 0x0505, 0x0536, 0xc526,
+    0xc5d9, 0x05c9, 0x05fa, 0xc5ea, 0x059c, 0xc58c, 0xc5bf, 0x05af,
+    0x0660, 0xc670, 0xc643, 0x0653, 0xc625, 0x0635, 0x0606, 0xc616,
+    0xc6e9, 0x06f9, 0x06ca, 0xc6da, 0x06ac, 0xc6bc, 0xc68f, 0x069f,
+    0xc771, 0x0761, 0x0752, 0xc742, 0x0734, 0xc724, 0xc717, 0x0707,
+    0x07f8, 0xc7e8, 0xc7db, 0x07cb, 0xc7bd, 0x07ad, 0x079e, 0xc78e,
+    0xc881, 0x0891, 0x08a2, 0xc8b2, 0x08c4, 0xc8d4, 0xc8e7, 0x08f7,
+    0x0808, 0xc818, 0xc82b, 0x083b, 0xc84d, 0x085d, 0x086e, 0xc87e,
+    0x0990, 0xc980, 0xc9b3, 0x09a3, 0xc9d5, 0x09c5, 0x09f6, 0xc9e6,
+    0xc919, 0x0909, 0x093a, 0xc92a, 0x095c, 0xc94c, 0xc97f, 0x096f,
+    0x0aa0, 0xcab0, 0xca83, 0x0a93, 0xcae5, 0x0af5, 0x0ac6, 0xcad6,
+    0xca29, 0x0a39, 0x0a0a, 0xca1a, 0x0a6c, 0xca7c, 0xca4f, 0x0a5f,
+    0xcbb1, 0x0ba1, 0x0b92, 0xcb82, 0x0bf4, 0xcbe4, 0xcbd7, 0x0bc7,
+    0x0b38, 0xcb28, 0xcb1b, 0x0b0b, 0xcb7d, 0x0b6d, 0x0b5e, 0xcb4e,
+    0x0cc0, 0xccd0, 0xcce3, 0x0cf3, 0xcc85, 0x0c95, 0x0ca6, 0xccb6,
+    0xcc49, 0x0c59, 0x0c6a, 0xcc7a, 0x0c0c, 0xcc1c, 0xcc2f, 0x0c3f,
+    0xcdd1, 0x0dc1, 0x0df2, 0xcde2, 0x0d94, 0xcd84, 0xcdb7, 0x0da7,
+    0x0d58, 0xcd48, 0xcd7b, 0x0d6b, 0xcd1d, 0x0d0d, 0x0d3e, 0xcd2e,
+    0xcee1, 0x0ef1, 0x0ec2, 0xced2, 0x0ea4, 0xceb4, 0xce87, 0x0e97,
+    0x0e68, 0xce78, 0xce4b, 0x0e5b, 0xce2d, 0x0e3d, 0x0e0e, 0xce1e,
+    0x0ff0, 0xcfe0, 0xcfd3, 0x0fc3, 0xcfb5, 0x0fa5, 0x0f96, 0xcf86,
+    0xcf79, 0x0f69, 0x0f5a, 0xcf4a, 0x0f3c, 0xcf2c, 0xcf1f, 0x0f0f},
+  {
+    0x0000, 0xccc1, 0xd981, 0x1540, 0xf301, 0x3fc0, 0x2a80, 0xe641,
+    0xa601, 0x6ac0, 0x7f80, 0xb341, 0x5500, 0x99c1, 0x8c81, 0x4040,
+    0x0c01, 0xc0c0, 0xd580, 0x1941, 0xff00, 0x33c1, 0x2681, 0xea40,
+    0xaa00, 0x66c1, 0x7381, 0xbf40, 0x5901, 0x95c0, 0x8080, 0x4c41,
+    0x1802, 0xd4c3, 0xc183, 0x0d42, 0xeb03, 0x27c2, 0x3282, 0xfe43,
+    0xbe03, 0x72c2, 0x6782, 0xab43, 0x4d02, 0x81c3, 0x9483, 0x5842,
+    0x1403, 0xd8c2, 0xcd82, 0x0143, 0xe702, 0x2bc3, 0x3e83, 0xf242,
+    0xb202, 0x7ec3, 0x6b83, 0xa742, 0x4103, 0x8dc2, 0x9882, 0x5443,
+    0x3004, 0xfcc5, 0xe985, 0x2544, 0xc305, 0x0fc4, 0x1a84, 0xd645,
+    0x9605, 0x5ac4, 0x4f84, 0x8345, 0x6504, 0xa9c5, 0xbc85, 0x7044,
+    0x3c05, 0xf0c4, 0xe584, 0x2945, 0xcf04, 0x03c5, 0x1685, 0xda44,
+    0x9a04, 0x56c5, 0x4385, 0x8f44, 0x6905, 0xa5c4, 0xb084, 0x7c45,
+    0x2806, 0xe4c7, 0xf187, 0x3d46, 0xdb07, 0x17c6, 0x0286, 0xce47,
+    0x8e07, 0x42c6, 0x5786, 0x9b47, 0x7d06, 0xb1c7, 0xa487, 0x6846,
+    0x2407, 0xe8c6, 0xfd86, 0x3147, 0xd706, 0x1bc7, 0x0e87, 0xc246,
+    0x8206, 0x4ec7, 0x5b87, 0x9746, 0x7107, 0xbdc6, 0xa886, 0x6447,
+    0x6008, 0xacc9, 0xb989, 0x7548, 0x9309, 0x5fc8, 0x4a88, 0x8649,
+    0xc609, 0x0ac8, 0x1f88, 0xd349, 0x3508, 0xf9c9, 0xec89, 0x2048,
+    0x6c09, 0xa0c8, 0xb588, 0x7949, 0x9f08, 0x53c9, 0x4689, 0x8a48,
+    0xca08, 0x06c9, 0x1389, 0xdf48, 0x3909, 0xf5c8, 0xe088, 0x2c49,
+    0x780a, 0xb4cb, 0xa18b, 0x6d4a, 0x8b0b, 0x47ca, 0x528a, 0x9e4b,
+    0xde0b, 0x12ca, 0x078a, 0xcb4b, 0x2d0a, 0xe1cb, 0xf48b, 0x384a,
+    0x740b, 0xb8ca, 0xad8a, 0x614b, 0x870a, 0x4bcb, 0x5e8b, 0x924a,
+    0xd20a, 0x1ecb, 0x0b8b, 0xc74a, 0x210b, 0xedca, 0xf88a, 0x344b,
+    0x500c, 0x9ccd, 0x898d, 0x454c, 0xa30d, 0x6fcc, 0x7a8c, 0xb64d,
+    0xf60d, 0x3acc, 0x2f8c, 0xe34d, 0x050c, 0xc9cd, 0xdc8d, 0x104c,
+    0x5c0d, 0x90cc, 0x858c, 0x494d, 0xaf0c, 0x63cd, 0x768d, 0xba4c,
+    0xfa0c, 0x36cd, 0x238d, 0xef4c, 0x090d, 0xc5cc, 0xd08c, 0x1c4d,
+    0x480e, 0x84cf, 0x918f, 0x5d4e, 0xbb0f, 0x77ce, 0x628e, 0xae4f,
+    0xee0f, 0x22ce, 0x378e, 0xfb4f, 0x1d0e, 0xd1cf, 0xc48f, 0x084e,
+    0x440f, 0x88ce, 0x9d8e, 0x514f, 0xb70e, 0x7bcf, 0x6e8f, 0xa24e,
+    0xe20e, 0x2ecf, 0x3b8f, 0xf74e, 0x110f, 0xddce, 0xc88e, 0x044f}};
+
+
+// crc24 slicing-by-8 table (polynomial 0x5D6DCB)
+const unsigned int crc24_gentab[8][256] = {
+  {
+    0x000000, 0x33d776, 0x67aeec, 0x54799a, 0xcf5dd8, 0xfc8aae,
+    0xa8f334, 0x9b2442, 0x39d6c5, 0x0a01b3, 0x5e7829, 0x6daf5f,
+    0xf68b1d, 0xc55c6b, 0x9125f1, 0xa2f287, 0x73ad8a, 0x407afc,
+    0x140366, 0x27d410, 0xbcf052, 0x8f2724, 0xdb5ebe, 0xe889c8,
+    0x4a7b4f, 0x79ac39, 0x2dd5a3, 0x1e02d5, 0x852697, 0xb6f1e1,
+    0xe2887b, 0xd15f0d, 0xe75b14, 0xd48c62, 0x80f5f8, 0xb3228e,
+    0x2806cc, 0x1bd1ba, 0x4fa820, 0x7c7f56, 0xde8dd1, 0xed5aa7,
+    0xb9233d, 0x8af44b, 0x11d009, 0x22077f, 0x767ee5, 0x45a993,
+    0x94f69e, 0xa721e8, 0xf35872, 0xc08f04, 0x5bab46, 0x687c30,
+    0x3c05aa, 0x0fd2dc, 0xad205b, 0x9ef72d, 0xca8eb7, 0xf959c1,
+    0x627d83, 0x51aaf5, 0x05d36f, 0x360419, 0x69db5d, 0x5a0c2b,
+    0x0e75b1, 0x3da2c7, 0xa68685, 0x9551f3, 0xc12869, 0xf2ff1f,
+    0x500d98, 0x63daee, 0x37a374, 0x047402, 0x9f5040, 0xac8736,
+    0xf8feac, 0xcb29da, 0x1a76d7, 0x29a1a1, 0x7dd83b, 0x4e0f4d,
+    0xd52b0f, 0xe6fc79, 0xb285e3, 0x815295, 0x23a012, 0x107764,
+    0x440efe, 0x77d988, 0xecfdca, 0xdf2abc, 0x8b5326, 0xb88450,
+    0x8e8049, 0xbd573f, 0xe92ea5, 0xdaf9d3, 0x41dd91, 0x720ae7,
+    0x26737d, 0x15a40b, 0xb7568c, 0x8481fa, 0xd0f860, 0xe32f16,
+    0x780b54, 0x4bdc22, 0x1fa5b8, 0x2c72ce, 0xfd2dc3, 0xcefab5,
+    0x9a832f, 0xa95459, 0x32701b, 0x01a76d, 0x55def7, 0x660981,
+    0xc4fb06, 0xf72c70, 0xa355ea, 0x90829c, 0x0ba6de, 0x3871a8,
+    0x6c0832, 0x5fdf44, 0xd3b6ba, 0xe061cc, 0xb41856, 0x87cf20,
+    0x1ceb62, 0x2f3c14, 0x7b458e, 0x4892f8, 0xea607f, 0xd9b709,
+    0x8dce93, 0xbe19e5, 0x253da7, 0x16ead1, 0x42934b, 0x71443d,
+    0xa01b30, 0x93cc46, 0xc7b5dc, 0xf462aa, 0x6f46e8, 0x5c919e,
+    0x08e804, 0x3b3f72, 0x99cdf5, 0xaa1a83, 0xfe6319, 0xcdb46f,
+    0x56902d, 0x65475b, 0x313ec1, 0x02e9b7, 0x34edae, 0x073ad8,
+    0x534342, 0x609434, 0xfbb076, 0xc86700, 0x9c1e9a, 0xafc9ec,
+    0x0d3b6b, 0x3eec1d, 0x6a9587, 0x5942f1, 0xc266b3, 0xf1b1c5,
+    0xa5c85f, 0x961f29, 0x474024, 0x749752, 0x20eec8, 0x1339be,
+    0x881dfc, 0xbbca8a, 0xefb310, 0xdc6466, 0x7e96e1, 0x4d4197,
+    0x19380d, 0x2aef7b, 0xb1cb39, 0x821c4f, 0xd665d5, 0xe5b2a3,
+    0xba6de7, 0x89ba91, 0xddc30b, 0xee147d, 0x75303f, 0x46e749,
+    0x129ed3, 0x2149a5, 0x83bb22, 0xb06c54, 0xe415ce, 0xd7c2b8,
+    0x4ce6fa, 0x7f318c, 0x2b4816, 0x189f60, 0xc9c06d, 0xfa171b,
+    0xae6e81, 0x9db9f7, 0x069db5, 0x354ac3, 0x613359, 0x52e42f,
+    0xf016a8, 0xc3c1de, 0x97b844, 0xa46f32, 0x3f4b70, 0x0c9c06,
+    0x58e59c, 0x6b32ea, 0x5d36f3, 0x6ee185, 0x3a981f, 0x094f69,
+    0x926b2b, 0xa1bc5d, 0xf5c5c7, 0xc612b1, 0x64e036, 0x573740,
+    0x034eda, 0x3099ac, 0xabbdee, 0x986a98, 0xcc1302, 0xffc474,
+    0x2e9b79, 0x1d4c0f, 0x493595, 0x7ae2e3, 0xe1c6a1, 0xd211d7,
+    0x86684d, 0xb5bf3b, 0x174dbc, 0x249aca, 0x70e350, 0x433426,
+    0xd81064, 0xebc712, 0xbfbe88, 0x8c69fe},
+  {
+    0x000000, 0x55ed20, 0xabda40, 0xfe3760, 0xf0d9f5, 0xa534d5,
+    0x5b03b5, 0x0eee95, 0x46de9f, 0x1333bf, 0xed04df, 0xb8e9ff,
+    0xb6076a, 0xe3ea4a, 0x1ddd2a, 0x48300a, 0x8dbd3e, 0xd8501e,
+    0x26677e, 0x738a5e, 0x7d64cb, 0x2889eb, 0xd6be8b, 0x8353ab,
+    0xcb63a1, 0x9e8e81, 0x60b9e1, 0x3554c1, 0x3bba54, 0x6e5774,
+    0x906014, 0xc58d34, 0xbc1709, 0xe9fa29, 0x17cd49, 0x422069,
+    0x4ccefc, 0x1923dc, 0xe714bc, 0xb2f99c, 0xfac996, 0xaf24b6,
+    0x5113d6, 0x04fef6, 0x0a1063, 0x5ffd43, 0xa1ca23, 0xf42703,
+    0x31aa37, 0x644717, 0x9a7077, 0xcf9d57, 0xc173c2, 0x949ee2,
+    0x6aa982, 0x3f44a2, 0x7774a8, 0x229988, 0xdcaee8, 0x8943c8,
+    0x87ad5d, 0xd2407d, 0x2c771d, 0x799a3d, 0xdf4367, 0x8aae47,
+    0x749927, 0x217407, 0x2f9a92, 0x7a77b2, 0x8440d2, 0xd1adf2,
+    0x999df8, 0xcc70d8, 0x3247b8, 0x67aa98, 0x69440d, 0x3ca92d,
+    0xc29e4d, 0x97736d, 0x52fe59, 0x071379, 0xf92419, 0xacc939,
+    0xa227ac, 0xf7ca8c, 0x09fdec, 0x5c10cc, 0x1420c6, 0x41cde6,
+    0xbffa86, 0xea17a6, 0xe4f933, 0xb11413, 0x4f2373, 0x1ace53,
+    0x63546e, 0x36b94e, 0xc88e2e, 0x9d630e, 0x938d9b, 0xc660bb,
+    0x3857db, 0x6dbafb, 0x258af1, 0x7067d1, 0x8e50b1, 0xdbbd91,
+    0xd55304, 0x80be24, 0x7e8944, 0x2b6464, 0xeee950, 0xbb0470,
+    0x453310, 0x10de30, 0x1e30a5, 0x4bdd85, 0xb5eae5, 0xe007c5,
+    0xa837cf, 0xfddaef, 0x03ed8f, 0x5600af, 0x58ee3a, 0x0d031a,
+    0xf3347a, 0xa6d95a, 0x19ebbb, 0x4c069b, 0xb231fb, 0xe7dcdb,
+    0xe9324e, 0xbcdf6e, 0x42e80e, 0x17052e, 0x5f3524, 0x0ad804,
+    0xf4ef64, 0xa10244, 0xafecd1, 0xfa01f1, 0x043691, 0x51dbb1,
+    0x945685, 0xc1bba5, 0x3f8cc5, 0x6a61e5, 0x648f70, 0x316250,
+    0xcf5530, 0x9ab810, 0xd2881a, 0x87653a, 0x79525a, 0x2cbf7a,
+    0x2251ef, 0x77bccf, 0x898baf, 0xdc668f, 0xa5fcb2, 0xf01192,
+    0x0e26f2, 0x5bcbd2, 0x552547, 0x00c867, 0xfeff07, 0xab1227,
+    0xe3222d, 0xb6cf0d, 0x48f86d, 0x1d154d, 0x13fbd8, 0x4616f8,
+    0xb82198, 0xedccb8, 0x28418c, 0x7dacac, 0x839bcc, 0xd676ec,
+    0xd89879, 0x8d7559, 0x734239, 0x26af19, 0x6e9f13, 0x3b7233,
+    0xc54553, 0x90a873, 0x9e46e6, 0xcbabc6, 0x359ca6, 0x607186,
+    0xc6a8dc, 0x9345fc, 0x6d729c, 0x389fbc, 0x367129, 0x639c09,
+    0x9dab69, 0xc84649, 0x807643, 0xd59b63, 0x2bac03, 0x7e4123,
+    0x70afb6, 0x254296, 0xdb75f6, 0x8e98d6, 0x4b15e2, 0x1ef8c2,
+    0xe0cfa2, 0xb52282, 0xbbcc17, 0xee2137, 0x101657, 0x45fb77,
+    0x0dcb7d, 0x58265d, 0xa6113d, 0xf3fc1d, 0xfd1288, 0xa8ffa8,
+    0x56c8c8, 0x0325e8, 0x7abfd5, 0x2f52f5, 0xd16595, 0x8488b5,
+    0x8a6620, 0xdf8b00, 0x21bc60, 0x745140, 0x3c614a, 0x698c6a,
+    0x97bb0a, 0xc2562a, 0xccb8bf, 0x99559f, 0x6762ff, 0x328fdf,
+    0xf702eb, 0xa2efcb, 0x5cd8ab, 0x09358b, 0x07db1e, 0x52363e,
+    0xac015e, 0xf9ec7e, 0xb1dc74, 0xe43154, 0x1a0634, 0x4feb14,
+    0x410581, 0x14e8a1, 0xeadfc1, 0xbf32e1},
+  {
+    0x000000, 0xe70ef9, 0x697087, 0x8e7e7e, 0xd2e10e, 0x35eff7,
+    0xbb9189, 0x5c9f70, 0x02af69, 0xe5a190, 0x6bdfee, 0x8cd117,
+    0xd04e67, 0x37409e, 0xb93ee0, 0x5e3019, 0x055ed2, 0xe2502b,
+    0x6c2e55, 0x8b20ac, 0xd7bfdc, 0x30b125, 0xbecf5b, 0x59c1a2,
+    0x07f1bb, 0xe0ff42, 0x6e813c, 0x898fc5, 0xd510b5, 0x321e4c,
+    0xbc6032, 0x5b6ecb, 0x0abda4, 0xedb35d, 0x63cd23, 0x84c3da,
+    0xd85caa, 0x3f5253, 0xb12c2d, 0x5622d4, 0x0812cd, 0xef1c34,
+    0x61624a, 0x866cb3, 0xdaf3c3, 0x3dfd3a, 0xb38344, 0x548dbd,
+    0x0fe376, 0xe8ed8f, 0x6693f1, 0x819d08, 0xdd0278, 0x3a0c81,
+    0xb472ff, 0x537c06, 0x0d4c1f, 0xea42e6, 0x643c98, 0x833261,
+    0xdfad11, 0x38a3e8, 0xb6dd96, 0x51d36f, 0x157b48, 0xf275b1,
+    0x7c0bcf, 0x9b0536, 0xc79a46, 0x2094bf, 0xaeeac1, 0x49e438,
+    0x17d421, 0xf0dad8, 0x7ea4a6, 0x99aa5f, 0xc5352f, 0x223bd6,
+    0xac45a8, 0x4b4b51, 0x10259a, 0xf72b63, 0x79551d, 0x9e5be4,
+    0xc2c494, 0x25ca6d, 0xabb413, 0x4cbaea, 0x128af3, 0xf5840a,
+    0x7bfa74, 0x9cf48d, 0xc06bfd, 0x276504, 0xa91b7a, 0x4e1583,
+    0x1fc6ec, 0xf8c815, 0x76b66b, 0x91b892, 0xcd27e2, 0x2a291b,
+    0xa45765, 0x43599c, 0x1d6985, 0xfa677c, 0x741902, 0x9317fb,
+    0xcf888b, 0x288672, 0xa6f80c, 0x41f6f5, 0x1a983e, 0xfd96c7,
+    0x73e8b9, 0x94e640, 0xc87930, 0x2f77c9, 0xa109b7, 0x46074e,
+    0x183757, 0xff39ae, 0x7147d0, 0x964929, 0xcad659, 0x2dd8a0,
+    0xa3a6de, 0x44a827, 0x2af690, 0xcdf869, 0x438617, 0xa488ee,
+    0xf8179e, 0x1f1967, 0x916719, 0x7669e0, 0x2859f9, 0xcf5700,
+    0x41297e, 0xa62787, 0xfab8f7, 0x1db60e, 0x93c870, 0x74c689,
+    0x2fa842, 0xc8a6bb, 0x46d8c5, 0xa1d63c, 0xfd494c, 0x1a47b5,
+    0x9439cb, 0x733732, 0x2d072b, 0xca09d2, 0x4477ac, 0xa37955,
+    0xffe625, 0x18e8dc, 0x9696a2, 0x71985b, 0x204b34, 0xc745cd,
+    0x493bb3, 0xae354a, 0xf2aa3a, 0x15a4c3, 0x9bdabd, 0x7cd444,
+    0x22e45d, 0xc5eaa4, 0x4b94da, 0xac9a23, 0xf00553, 0x170baa,
+    0x9975d4, 0x7e7b2d, 0x2515e6, 0xc21b1f, 0x4c6561, 0xab6b98,
+    0xf7f4e8, 0x10fa11, 0x9e846f, 0x798a96, 0x27ba8f, 0xc0b476,
+    0x4eca08, 0xa9c4f1, 0xf55b81, 0x125578, 0x9c2b06, 0x7b25ff,
+    0x3f8dd8, 0xd88321, 0x56fd5f, 0xb1f3a6, 0xed6cd6, 0x0a622f,
+    0x841c51, 0x6312a8, 0x3d22b1, 0xda2c48, 0x545236, 0xb35ccf,
+    0xefc3bf, 0x08cd46, 0x86b338, 0x61bdc1, 0x3ad30a, 0xddddf3,
+    0x53a38d, 0xb4ad74, 0xe83204, 0x0f3cfd, 0x814283, 0x664c7a,
+    0x387c63, 0xdf729a, 0x510ce4, 0xb6021d, 0xea9d6d, 0x0d9394,
+    0x83edea, 0x64e313, 0x35307c, 0xd23e85, 0x5c40fb, 0xbb4e02,
+    0xe7d172, 0x00df8b, 0x8ea1f5, 0x69af0c, 0x379f15, 0xd091ec,
+    0x5eef92, 0xb9e16b, 0xe57e1b, 0x0270e2, 0x8c0e9c, 0x6b0065,
+    0x306eae, 0xd76057, 0x591e29, 0xbe10d0, 0xe28fa0, 0x058159,
+    0x8bff27, 0x6cf1de, 0x32c1c7, 0xd5cf3e, 0x5bb140, 0xbcbfb9,
+    0xe020c9, 0x072e30, 0x89504e, 0x6e5eb7},
+  {
+    0x000000, 0x247dc4, 0x48fb88, 0x6c864c, 0x91f710, 0xb58ad4,
+    0xd90c98, 0xfd715c, 0x848355, 0xa0fe91, 0xcc78dd, 0xe80519,
+    0x157445, 0x310981, 0x5d8fcd, 0x79f209, 0xae6bdf, 0x8a161b,
+    0xe69057, 0xc2ed93, 0x3f9ccf, 0x1be10b, 0x776747, 0x531a83,
+    0x2ae88a, 0x0e954e, 0x621302, 0x466ec6, 0xbb1f9a, 0x9f625e,
+    0xf3e412, 0xd799d6, 0xfbbacb, 0xdfc70f, 0xb34143, 0x973c87,
+    0x6a4ddb, 0x4e301f, 0x22b653, 0x06cb97, 0x7f399e, 0x5b445a,
+    0x37c216, 0x13bfd2, 0xeece8e, 0xcab34a, 0xa63506, 0x8248c2,
+    0x55d114, 0x71acd0, 0x1d2a9c, 0x395758, 0xc42604, 0xe05bc0,
+    0x8cdd8c, 0xa8a048, 0xd15241, 0xf52f85, 0x99a9c9, 0xbdd40d,
+    0x40a551, 0x64d895, 0x085ed9, 0x2c231d, 0x5018e3, 0x746527,
+    0x18e36b, 0x3c9eaf, 0xc1eff3, 0xe59237, 0x89147b, 0xad69bf,
+    0xd49bb6, 0xf0e672, 0x9c603e, 0xb81dfa, 0x456ca6, 0x611162,
+    0x0d972e, 0x29eaea, 0xfe733c, 0xda0ef8, 0xb688b4, 0x92f570,
+    0x6f842c, 0x4bf9e8, 0x277fa4, 0x030260, 0x7af069, 0x5e8dad,
+    0x320be1, 0x167625, 0xeb0779, 0xcf7abd, 0xa3fcf1, 0x878135,
+    0xaba228, 0x8fdfec, 0xe359a0, 0xc72464, 0x3a5538, 0x1e28fc,
+    0x72aeb0, 0x56d374, 0x2f217d, 0x0b5cb9, 0x67daf5, 0x43a731,
+    0xbed66d, 0x9aaba9, 0xf62de5, 0xd25021, 0x05c9f7, 0x21b433,
+    0x4d327f, 0x694fbb, 0x943ee7, 0xb04323, 0xdcc56f, 0xf8b8ab,
+    0x814aa2, 0xa53766, 0xc9b12a, 0xedccee, 0x10bdb2, 0x34c076,
+    0x58463a, 0x7c3bfe, 0xa031c6, 0x844c02, 0xe8ca4e, 0xccb78a,
+    0x31c6d6, 0x15bb12, 0x793d5e, 0x5d409a, 0x24b293, 0x00cf57,
+    0x6c491b, 0x4834df, 0xb54583, 0x913847, 0xfdbe0b, 0xd9c3cf,
+    0x0e5a19, 0x2a27dd, 0x46a191, 0x62dc55, 0x9fad09, 0xbbd0cd,
+    0xd75681, 0xf32b45, 0x8ad94c, 0xaea488, 0xc222c4, 0xe65f00,
+    0x1b2e5c, 0x3f5398, 0x53d5d4, 0x77a810, 0x5b8b0d, 0x7ff6c9,
+    0x137085, 0x370d41, 0xca7c1d, 0xee01d9, 0x828795, 0xa6fa51,
+    0xdf0858, 0xfb759c, 0x97f3d0, 0xb38e14, 0x4eff48, 0x6a828c,
+    0x0604c0, 0x227904, 0xf5e0d2, 0xd19d16, 0xbd1b5a, 0x99669e,
+    0x6417c2, 0x406a06, 0x2cec4a, 0x08918e, 0x716387, 0x551e43,
+    0x39980f, 0x1de5cb, 0xe09497, 0xc4e953, 0xa86f1f, 0x8c12db,
+    0xf02925, 0xd454e1, 0xb8d2ad, 0x9caf69, 0x61de35, 0x45a3f1,
+    0x2925bd, 0x0d5879, 0x74aa70, 0x50d7b4, 0x3c51f8, 0x182c3c,
+    0xe55d60, 0xc120a4, 0xada6e8, 0x89db2c, 0x5e42fa, 0x7a3f3e,
+    0x16b972, 0x32c4b6, 0xcfb5ea, 0xebc82e, 0x874e62, 0xa333a6,
+    0xdac1af, 0xfebc6b, 0x923a27, 0xb647e3, 0x4b36bf, 0x6f4b7b,
+    0x03cd37, 0x27b0f3, 0x0b93ee, 0x2fee2a, 0x436866, 0x6715a2,
+    0x9a64fe, 0xbe193a, 0xd29f76, 0xf6e2b2, 0x8f10bb, 0xab6d7f,
+    0xc7eb33, 0xe396f7, 0x1ee7ab, 0x3a9a6f, 0x561c23, 0x7261e7,
+    0xa5f831, 0x8185f5, 0xed03b9, 0xc97e7d, 0x340f21, 0x1072e5,
+    0x7cf4a9, 0x58896d, 0x217b64, 0x0506a0, 0x6980ec, 0x4dfd28,
+    0xb08c74, 0x94f1b0, 0xf877fc, 0xdc0a38},
+  {
+    0x000000, 0x751442, 0xea2884, 0x9f3cc6, 0x733c7d, 0x06283f,
+    0x9914f9, 0xec00bb, 0xe678fa, 0x936cb8, 0x0c507e, 0x79443c,
+    0x954487, 0xe050c5, 0x7f6c03, 0x0a7841, 0x6b9c81, 0x1e88c3,
+    0x81b405, 0xf4a047, 0x18a0fc, 0x6db4be, 0xf28878, 0x879c3a,
+    0x8de47b, 0xf8f039, 0x67ccff, 0x12d8bd, 0xfed806, 0x8bcc44,
+    0x14f082, 0x61e4c0, 0xd73902, 0xa22d40, 0x3d1186, 0x4805c4,
+    0xa4057f, 0xd1113d, 0x4e2dfb, 0x3b39b9, 0x3141f8, 0x4455ba,
+    0xdb697c, 0xae7d3e, 0x427d85, 0x3769c7, 0xa85501, 0xdd4143,
+    0xbca583, 0xc9b1c1, 0x568d07, 0x239945, 0xcf99fe, 0xba8dbc,
+    0x25b17a, 0x50a538, 0x5add79, 0x2fc93b, 0xb0f5fd, 0xc5e1bf,
+    0x29e104, 0x5cf546, 0xc3c980, 0xb6ddc2, 0x091f71, 0x7c0b33,
+    0xe337f5, 0x9623b7, 0x7a230c, 0x0f374e, 0x900b88, 0xe51fca,
+    0xef678b, 0x9a73c9, 0x054f0f, 0x705b4d, 0x9c5bf6, 0xe94fb4,
+    0x767372, 0x036730, 0x6283f0, 0x1797b2, 0x88ab74, 0xfdbf36,
+    0x11bf8d, 0x64abcf, 0xfb9709, 0x8e834b, 0x84fb0a, 0xf1ef48,
+    0x6ed38e, 0x1bc7cc, 0xf7c777, 0x82d335, 0x1deff3, 0x68fbb1,
+    0xde2673, 0xab3231, 0x340ef7, 0x411ab5, 0xad1a0e, 0xd80e4c,
+    0x47328a, 0x3226c8, 0x385e89, 0x4d4acb, 0xd2760d, 0xa7624f,
+    0x4b62f4, 0x3e76b6, 0xa14a70, 0xd45e32, 0xb5baf2, 0xc0aeb0,
+    0x5f9276, 0x2a8634, 0xc6868f, 0xb392cd, 0x2cae0b, 0x59ba49,
+    0x53c208, 0x26d64a, 0xb9ea8c, 0xccfece, 0x20fe75, 0x55ea37,
+    0xcad6f1, 0xbfc2b3, 0x123ee2, 0x672aa0, 0xf81666, 0x8d0224,
+    0x61029f, 0x1416dd, 0x8b2a1b, 0xfe3e59, 0xf44618, 0x81525a,
+    0x1e6e9c, 0x6b7ade, 0x877a65, 0xf26e27, 0x6d52e1, 0x1846a3,
+    0x79a263, 0x0cb621, 0x938ae7, 0xe69ea5, 0x0a9e1e, 0x7f8a5c,
+    0xe0b69a, 0x95a2d8, 0x9fda99, 0xeacedb, 0x75f21d, 0x00e65f,
+    0xece6e4, 0x99f2a6, 0x06ce60, 0x73da22, 0xc507e0, 0xb013a2,
+    0x2f2f64, 0x5a3b26, 0xb63b9d, 0xc32fdf, 0x5c1319, 0x29075b,
+    0x237f1a, 0x566b58, 0xc9579e, 0xbc43dc, 0x504367, 0x255725,
+    0xba6be3, 0xcf7fa1, 0xae9b61, 0xdb8f23, 0x44b3e5, 0x31a7a7,
+    0xdda71c, 0xa8b35e, 0x378f98, 0x429bda, 0x48e39b, 0x3df7d9,
+    0xa2cb1f, 0xd7df5d, 0x3bdfe6, 0x4ecba4, 0xd1f762, 0xa4e320,
+    0x1b2193, 0x6e35d1, 0xf10917, 0x841d55, 0x681dee, 0x1d09ac,
+    0x82356a, 0xf72128, 0xfd5969, 0x884d2b, 0x1771ed, 0x6265af,
+    0x8e6514, 0xfb7156, 0x644d90, 0x1159d2, 0x70bd12, 0x05a950,
+    0x9a9596, 0xef81d4, 0x03816f, 0x76952d, 0xe9a9eb, 0x9cbda9,
+    0x96c5e8, 0xe3d1aa, 0x7ced6c, 0x09f92e, 0xe5f995, 0x90edd7,
+    0x0fd111, 0x7ac553, 0xcc1891, 0xb90cd3, 0x263015, 0x532457,
+    0xbf24ec, 0xca30ae, 0x550c68, 0x20182a, 0x2a606b, 0x5f7429,
+    0xc048ef, 0xb55cad, 0x595c16, 0x2c4854, 0xb37492, 0xc660d0,
+    0xa78410, 0xd29052, 0x4dac94, 0x38b8d6, 0xd4b86d, 0xa1ac2f,
+    0x3e90e9, 0x4b84ab, 0x41fcea, 0x34e8a8, 0xabd46e, 0xdec02c,
+    0x32c097, 0x47d4d5, 0xd8e813, 0xadfc51},
+  {
+    0x000000, 0x0e00a5, 0x1c014a, 0x1201ef, 0x380294, 0x360231,
+    0x2403de, 0x2a037b, 0x700528, 0x7e058d, 0x6c0462, 0x6204c7,
+    0x4807bc, 0x460719, 0x5406f6, 0x5a0653, 0xe00a50, 0xee0af5,
+    0xfc0b1a, 0xf20bbf, 0xd808c4, 0xd60861, 0xc4098e, 0xca092b,
+    0x900f78, 0x9e0fdd, 0x8c0e32, 0x820e97, 0xa80dec, 0xa60d49,
+    0xb40ca6, 0xba0c03, 0x6779d5, 0x697970, 0x7b789f, 0x75783a,
+    0x5f7b41, 0x517be4, 0x437a0b, 0x4d7aae, 0x177cfd, 0x197c58,
+    0x0b7db7, 0x057d12, 0x2f7e69, 0x217ecc, 0x337f23, 0x3d7f86,
+    0x877385, 0x897320, 0x9b72cf, 0x95726a, 0xbf7111, 0xb171b4,
+    0xa3705b, 0xad70fe, 0xf776ad, 0xf97608, 0xeb77e7, 0xe57742,
+    0xcf7439, 0xc1749c, 0xd37573, 0xdd75d6, 0xcef3aa, 0xc0f30f,
+    0xd2f2e0, 0xdcf245, 0xf6f13e, 0xf8f19b, 0xeaf074, 0xe4f0d1,
+    0xbef682, 0xb0f627, 0xa2f7c8, 0xacf76d, 0x86f416, 0x88f4b3,
+    0x9af55c, 0x94f5f9, 0x2ef9fa, 0x20f95f, 0x32f8b0, 0x3cf815,
+    0x16fb6e, 0x18fbcb, 0x0afa24, 0x04fa81, 0x5efcd2, 0x50fc77,
+    0x42fd98, 0x4cfd3d, 0x66fe46, 0x68fee3, 0x7aff0c, 0x74ffa9,
+    0xa98a7f, 0xa78ada, 0xb58b35, 0xbb8b90, 0x9188eb, 0x9f884e,
+    0x8d89a1, 0x838904, 0xd98f57, 0xd78ff2, 0xc58e1d, 0xcb8eb8,
+    0xe18dc3, 0xef8d66, 0xfd8c89, 0xf38c2c, 0x49802f, 0x47808a,
+    0x558165, 0x5b81c0, 0x7182bb, 0x7f821e, 0x6d83f1, 0x638354,
+    0x398507, 0x3785a2, 0x25844d, 0x2b84e8, 0x018793, 0x0f8736,
+    0x1d86d9, 0x13867c, 0x3a8a21, 0x348a84, 0x268b6b, 0x288bce,
+    0x0288b5, 0x0c8810, 0x1e89ff, 0x10895a, 0x4a8f09, 0x448fac,
+    0x568e43, 0x588ee6, 0x728d9d, 0x7c8d38, 0x6e8cd7, 0x608c72,
+    0xda8071, 0xd480d4, 0xc6813b, 0xc8819e, 0xe282e5, 0xec8240,
+    0xfe83af, 0xf0830a, 0xaa8559, 0xa485fc, 0xb68413, 0xb884b6,
+    0x9287cd, 0x9c8768, 0x8e8687, 0x808622, 0x5df3f4, 0x53f351,
+    0x41f2be, 0x4ff21b, 0x65f160, 0x6bf1c5, 0x79f02a, 0x77f08f,
+    0x2df6dc, 0x23f679, 0x31f796, 0x3ff733, 0x15f448, 0x1bf4ed,
+    0x09f502, 0x07f5a7, 0xbdf9a4, 0xb3f901, 0xa1f8ee, 0xaff84b,
+    0x85fb30, 0x8bfb95, 0x99fa7a, 0x97fadf, 0xcdfc8c, 0xc3fc29,
+    0xd1fdc6, 0xdffd63, 0xf5fe18, 0xfbfebd, 0xe9ff52, 0xe7fff7,
+    0xf4798b, 0xfa792e, 0xe878c1, 0xe67864, 0xcc7b1f, 0xc27bba,
+    0xd07a55, 0xde7af0, 0x847ca3, 0x8a7c06, 0x987de9, 0x967d4c,
+    0xbc7e37, 0xb27e92, 0xa07f7d, 0xae7fd8, 0x1473db, 0x1a737e,
+    0x087291, 0x067234, 0x2c714f, 0x2271ea, 0x307005, 0x3e70a0,
+    0x6476f3, 0x6a7656, 0x7877b9, 0x76771c, 0x5c7467, 0x5274c2,
+    0x40752d, 0x4e7588, 0x93005e, 0x9d00fb, 0x8f0114, 0x8101b1,
+    0xab02ca, 0xa5026f, 0xb70380, 0xb90325, 0xe30576, 0xed05d3,
+    0xff043c, 0xf10499, 0xdb07e2, 0xd50747, 0xc706a8, 0xc9060d,
+    0x730a0e, 0x7d0aab, 0x6f0b44, 0x610be1, 0x4b089a, 0x45083f,
+    0x5709d0, 0x590975, 0x030f26, 0x0d0f83, 0x1f0e6c, 0x110ec9,
+    0x3b0db2, 0x350d17, 0x270cf8, 0x290c5d},
+  {
+    0x000000, 0xc86900, 0x37bf75, 0xffd675, 0x6f7eea, 0xa717ea,
+    0x58c19f, 0x90a89f, 0xdefdd4, 0x1694d4, 0xe942a1, 0x212ba1,
+    0xb1833e, 0x79ea3e, 0x863c4b, 0x4e554b, 0x1a96dd, 0xd2ffdd,
+    0x2d29a8, 0xe540a8, 0x75e837, 0xbd8137, 0x425742, 0x8a3e42,
+    0xc46b09, 0x0c0209, 0xf3d47c, 0x3bbd7c, 0xab15e3, 0x637ce3,
+    0x9caa96, 0x54c396, 0x352dba, 0xfd44ba, 0x0292cf, 0xcafbcf,
+    0x5a5350, 0x923a50, 0x6dec25, 0xa58525, 0xebd06e, 0x23b96e,
+    0xdc6f1b, 0x14061b, 0x84ae84, 0x4cc784, 0xb311f1, 0x7b78f1,
+    0x2fbb67, 0xe7d267, 0x180412, 0xd06d12, 0x40c58d, 0x88ac8d,
+    0x777af8, 0xbf13f8, 0xf146b3, 0x392fb3, 0xc6f9c6, 0x0e90c6,
+    0x9e3859, 0x565159, 0xa9872c, 0x61ee2c, 0x6a5b74, 0xa23274,
+    0x5de401, 0x958d01, 0x05259e, 0xcd4c9e, 0x329aeb, 0xfaf3eb,
+    0xb4a6a0, 0x7ccfa0, 0x8319d5, 0x4b70d5, 0xdbd84a, 0x13b14a,
+    0xec673f, 0x240e3f, 0x70cda9, 0xb8a4a9, 0x4772dc, 0x8f1bdc,
+    0x1fb343, 0xd7da43, 0x280c36, 0xe06536, 0xae307d, 0x66597d,
+    0x998f08, 0x51e608, 0xc14e97, 0x092797, 0xf6f1e2, 0x3e98e2,
+    0x5f76ce, 0x971fce, 0x68c9bb, 0xa0a0bb, 0x300824, 0xf86124,
+    0x07b751, 0xcfde51, 0x818b1a, 0x49e21a, 0xb6346f, 0x7e5d6f,
+    0xeef5f0, 0x269cf0, 0xd94a85, 0x112385, 0x45e013, 0x8d8913,
+    0x725f66, 0xba3666, 0x2a9ef9, 0xe2f7f9, 0x1d218c, 0xd5488c,
+    0x9b1dc7, 0x5374c7, 0xaca2b2, 0x64cbb2, 0xf4632d, 0x3c0a2d,
+    0xc3dc58, 0x0bb558, 0xd4b6e8, 0x1cdfe8, 0xe3099d, 0x2b609d,
+    0xbbc802, 0x73a102, 0x8c7777, 0x441e77, 0x0a4b3c, 0xc2223c,
+    0x3df449, 0xf59d49, 0x6535d6, 0xad5cd6, 0x528aa3, 0x9ae3a3,
+    0xce2035, 0x064935, 0xf99f40, 0x31f640, 0xa15edf, 0x6937df,
+    0x96e1aa, 0x5e88aa, 0x10dde1, 0xd8b4e1, 0x276294, 0xef0b94,
+    0x7fa30b, 0xb7ca0b, 0x481c7e, 0x80757e, 0xe19b52, 0x29f252,
+    0xd62427, 0x1e4d27, 0x8ee5b8, 0x468cb8, 0xb95acd, 0x7133cd,
+    0x3f6686, 0xf70f86, 0x08d9f3, 0xc0b0f3, 0x50186c, 0x98716c,
+    0x67a719, 0xafce19, 0xfb0d8f, 0x33648f, 0xccb2fa, 0x04dbfa,
+    0x947365, 0x5c1a65, 0xa3cc10, 0x6ba510, 0x25f05b, 0xed995b,
+    0x124f2e, 0xda262e, 0x4a8eb1, 0x82e7b1, 0x7d31c4, 0xb558c4,
+    0xbeed9c, 0x76849c, 0x8952e9, 0x413be9, 0xd19376, 0x19fa76,
+    0xe62c03, 0x2e4503, 0x601048, 0xa87948, 0x57af3d, 0x9fc63d,
+    0x0f6ea2, 0xc707a2, 0x38d1d7, 0xf0b8d7, 0xa47b41, 0x6c1241,
+    0x93c434, 0x5bad34, 0xcb05ab, 0x036cab, 0xfcbade, 0x34d3de,
+    0x7a8695, 0xb2ef95, 0x4d39e0, 0x8550e0, 0x15f87f, 0xdd917f,
+    0x22470a, 0xea2e0a, 0x8bc026, 0x43a926, 0xbc7f53, 0x741653,
+    0xe4becc, 0x2cd7cc, 0xd301b9, 0x1b68b9, 0x553df2, 0x9d54f2,
+    0x628287, 0xaaeb87, 0x3a4318, 0xf22a18, 0x0dfc6d, 0xc5956d,
+    0x9156fb, 0x593ffb, 0xa6e98e, 0x6e808e, 0xfe2811, 0x364111,
+    0xc99764, 0x01fe64, 0x4fab2f, 0x87c22f, 0x78145a, 0xb07d5a,
+    0x20d5c5, 0xe8bcc5, 0x176ab0, 0xdf03b0},
+  {
+    0x000000, 0x00c869, 0x0190d2, 0x0158bb, 0x0321a4, 0x03e9cd,
+    0x02b176, 0x02791f, 0x064348, 0x068b21, 0x07d39a, 0x071bf3,
+    0x0562ec, 0x05aa85, 0x04f23e, 0x043a57, 0x0c8690, 0x0c4ef9,
+    0x0d1642, 0x0dde2b, 0x0fa734, 0x0f6f5d, 0x0e37e6, 0x0eff8f,
+    0x0ac5d8, 0x0a0db1, 0x0b550a, 0x0b9d63, 0x09e47c, 0x092c15,
+    0x0874ae, 0x08bcc7, 0x190d20, 0x19c549, 0x189df2, 0x18559b,
+    0x1a2c84, 0x1ae4ed, 0x1bbc56, 0x1b743f, 0x1f4e68, 0x1f8601,
+    0x1edeba, 0x1e16d3, 0x1c6fcc, 0x1ca7a5, 0x1dff1e, 0x1d3777,
+    0x158bb0, 0x1543d9, 0x141b62, 0x14d30b, 0x16aa14, 0x16627d,
+    0x173ac6, 0x17f2af, 0x13c8f8, 0x130091, 0x12582a, 0x129043,
+    0x10e95c, 0x102135, 0x11798e, 0x11b1e7, 0x321a40, 0x32d229,
+    0x338a92, 0x3342fb, 0x313be4, 0x31f38d, 0x30ab36, 0x30635f,
+    0x345908, 0x349161, 0x35c9da, 0x3501b3, 0x3778ac, 0x37b0c5,
+    0x36e87e, 0x362017, 0x3e9cd0, 0x3e54b9, 0x3f0c02, 0x3fc46b,
+    0x3dbd74, 0x3d751d, 0x3c2da6, 0x3ce5cf, 0x38df98, 0x3817f1,
+    0x394f4a, 0x398723, 0x3bfe3c, 0x3b3655, 0x3a6eee, 0x3aa687,
+    0x2b1760, 0x2bdf09, 0x2a87b2, 0x2a4fdb, 0x2836c4, 0x28fead,
+    0x29a616, 0x296e7f, 0x2d5428, 0x2d9c41, 0x2cc4fa, 0x2c0c93,
+    0x2e758c, 0x2ebde5, 0x2fe55e, 0x2f2d37, 0x2791f0, 0x275999,
+    0x260122, 0x26c94b, 0x24b054, 0x24783d, 0x252086, 0x25e8ef,
+    0x21d2b8, 0x211ad1, 0x20426a, 0x208a03, 0x22f31c, 0x223b75,
+    0x2363ce, 0x23aba7, 0x643480, 0x64fce9, 0x65a452, 0x656c3b,
+    0x671524, 0x67dd4d, 0x6685f6, 0x664d9f, 0x6277c8, 0x62bfa1,
+    0x63e71a, 0x632f73, 0x61566c, 0x619e05, 0x60c6be, 0x600ed7,
+    0x68b210, 0x687a79, 0x6922c2, 0x69eaab, 0x6b93b4, 0x6b5bdd,
+    0x6a0366, 0x6acb0f, 0x6ef158, 0x6e3931, 0x6f618a, 0x6fa9e3,
+    0x6dd0fc, 0x6d1895, 0x6c402e, 0x6c8847, 0x7d39a0, 0x7df1c9,
+    0x7ca972, 0x7c611b, 0x7e1804, 0x7ed06d, 0x7f88d6, 0x7f40bf,
+    0x7b7ae8, 0x7bb281, 0x7aea3a, 0x7a2253, 0x785b4c, 0x789325,
+    0x79cb9e, 0x7903f7, 0x71bf30, 0x717759, 0x702fe2, 0x70e78b,
+    0x729e94, 0x7256fd, 0x730e46, 0x73c62f, 0x77fc78, 0x773411,
+    0x766caa, 0x76a4c3, 0x74dddc, 0x7415b5, 0x754d0e, 0x758567,
+    0x562ec0, 0x56e6a9, 0x57be12, 0x57767b, 0x550f64, 0x55c70d,
+    0x549fb6, 0x5457df, 0x506d88, 0x50a5e1, 0x51fd5a, 0x513533,
+    0x534c2c, 0x538445, 0x52dcfe, 0x521497, 0x5aa850, 0x5a6039,
+    0x5b3882, 0x5bf0eb, 0x5989f4, 0x59419d, 0x581926, 0x58d14f,
+    0x5ceb18, 0x5c2371, 0x5d7bca, 0x5db3a3, 0x5fcabc, 0x5f02d5,
+    0x5e5a6e, 0x5e9207, 0x4f23e0, 0x4feb89, 0x4eb332, 0x4e7b5b,
+    0x4c0244, 0x4cca2d, 0x4d9296, 0x4d5aff, 0x4960a8, 0x49a8c1,
+    0x48f07a, 0x483813, 0x4a410c, 0x4a8965, 0x4bd1de, 0x4b19b7,
+    0x43a570, 0x436d19, 0x4235a2, 0x42fdcb, 0x4084d4, 0x404cbd,
+    0x411406, 0x41dc6f, 0x45e638, 0x452e51, 0x4476ea, 0x44be83,
+    0x46c79c, 0x460ff5, 0x47574e, 0x479f27}};
+
+
+// crc32 slicing-by-8 table (polynomial 0x04C11DB7)
+const unsigned int crc32_gentab[8][256] = {
+  {
+    0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f,
+    0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+    0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2,
+    0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+    0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9,
+    0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+    0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c,
+    0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+    0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423,
+    0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+    0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106,
+    0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+    0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d,
+    0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+    0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950,
+    0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+    0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7,
+    0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+    0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa,
+    0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+    0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81,
+    0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a,
+    0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84,
+    0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1,
+    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb,
+    0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+    0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e,
+    0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+    0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55,
+    0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+    0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28,
+    0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+    0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f,
+    0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38,
+    0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242,
+    0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69,
+    0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+    0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc,
+    0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+    0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693,
+    0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+    0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d},
+  {
+    0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445,
+    0x565aa786, 0x4f4196c7, 0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb,
+    0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf, 0x4ac21251, 0x53d92310,
+    0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496,
+    0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c,
+    0xd4413fdf, 0xcd5a0e9e, 0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761,
+    0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265, 0x5d5daeaa, 0x44469feb,
+    0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d,
+    0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6,
+    0x891c9175, 0x9007a034, 0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38,
+    0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c, 0xf0794f05, 0xe9627e44,
+    0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+    0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148,
+    0x6efa628b, 0x77e153ca, 0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97,
+    0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93, 0x7262d75c, 0x6b79e61d,
+    0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b,
+    0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2,
+    0x33a7cc21, 0x2abcfd60, 0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c,
+    0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768, 0x2f3f79f6, 0x362448b7,
+    0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+    0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb,
+    0xb1bc5478, 0xa8a76539, 0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88,
+    0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c, 0xf35a1243, 0xea412302,
+    0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+    0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f,
+    0x271b2d9c, 0x3e001cdd, 0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1,
+    0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5, 0xae07bce9, 0xb71c8da8,
+    0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+    0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4,
+    0x30849167, 0x299fa026, 0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b,
+    0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f, 0x2c1c24b0, 0x350715f1,
+    0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+    0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b,
+    0x9da070c8, 0x84bb4189, 0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85,
+    0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81, 0x8138c51f, 0x9823f45e,
+    0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+    0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52,
+    0x1fbbe891, 0x06a0d9d0, 0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f,
+    0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b, 0x96a779e4, 0x8fbc48a5,
+    0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+    0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8,
+    0x42e6463b, 0x5bfd777a, 0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876,
+    0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72},
+  {
+    0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb,
+    0x048d7cb2, 0x054f1685, 0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1,
+    0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d, 0x1c26a370, 0x1de4c947,
+    0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+    0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023,
+    0x16b88e7a, 0x177ae44d, 0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9,
+    0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065, 0x365e1758, 0x379c7d6f,
+    0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+    0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b,
+    0x20e69922, 0x2124f315, 0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71,
+    0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad, 0x709a8dc0, 0x7158e7f7,
+    0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+    0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93,
+    0x7a04a0ca, 0x7bc6cafd, 0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9,
+    0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835, 0x62af7f08, 0x636d153f,
+    0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+    0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb,
+    0x4c5ab792, 0x4d98dda5, 0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1,
+    0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d, 0x54f16850, 0x55330267,
+    0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+    0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03,
+    0x5e6f455a, 0x5fad2f6d, 0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9,
+    0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05, 0xef264a38, 0xeee4200f,
+    0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+    0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b,
+    0xf99ec442, 0xf85cae75, 0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711,
+    0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd, 0xd9785d60, 0xd8ba3757,
+    0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+    0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33,
+    0xd3e6706a, 0xd2241a5d, 0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049,
+    0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895, 0xcb4dafa8, 0xca8fc59f,
+    0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+    0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab,
+    0x9522eaf2, 0x94e080c5, 0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1,
+    0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d, 0x8d893530, 0x8c4b5f07,
+    0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+    0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663,
+    0x8717183a, 0x86d5720d, 0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9,
+    0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625, 0xa7f18118, 0xa633eb2f,
+    0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+    0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b,
+    0xb1490f62, 0xb08b6555, 0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31,
+    0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed},
+  {
+    0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032,
+    0x256b5fdc, 0x9dd738b9, 0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701,
+    0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056, 0x5019579f, 0xe8a530fa,
+    0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+    0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42,
+    0xb0c620ac, 0x087a47c9, 0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0,
+    0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787, 0x658687d1, 0xdd3ae0b4,
+    0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+    0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893,
+    0xd540a77d, 0x6dfcc018, 0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0,
+    0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7, 0x9b14583d, 0x23a83f58,
+    0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084,
+    0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0,
+    0x7bcb2f0e, 0xc377486b, 0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c,
+    0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b, 0x0eb9274d, 0xb6054028,
+    0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+    0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731,
+    0x1e4da8df, 0xa6f1cfba, 0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002,
+    0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755, 0x6b3fa09c, 0xd383c7f9,
+    0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+    0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841,
+    0x8be0d7af, 0x335cb0ca, 0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5,
+    0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82, 0x28ed9ed4, 0x9051f9b1,
+    0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d,
+    0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196,
+    0x982bbe78, 0x2097d91d, 0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5,
+    0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2, 0x4d6b1905, 0xf5d77e60,
+    0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+    0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8,
+    0xadb46e36, 0x15080953, 0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174,
+    0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623, 0xd8c66675, 0x607a0110,
+    0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+    0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34,
+    0x5326b1da, 0xeb9ad6bf, 0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907,
+    0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50, 0x2654b999, 0x9ee8defc,
+    0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120,
+    0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144,
+    0xc68bceaa, 0x7e37a9cf, 0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6,
+    0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981, 0x13cb69d7, 0xab770eb2,
+    0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+    0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695,
+    0xa30d497b, 0x1bb12e1e, 0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6,
+    0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1},
+  {
+    0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70,
+    0x8f40f5a0, 0xb220dc10, 0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111,
+    0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1, 0x60e09782, 0x5d80be32,
+    0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+    0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333,
+    0xdfd029e3, 0xe2b00053, 0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4,
+    0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314, 0xf1b164c5, 0xccd14d75,
+    0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+    0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6,
+    0x2e614d26, 0x13016496, 0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997,
+    0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57, 0x58f35849, 0x659371f9,
+    0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+    0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8,
+    0xe7c3e628, 0xdaa3cf98, 0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b,
+    0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db, 0x0863840a, 0x3503adba,
+    0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+    0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d,
+    0x167282ed, 0x2b12ab5d, 0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c,
+    0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c, 0xf9d2e0cf, 0xc4b2c97f,
+    0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+    0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e,
+    0x46e25eae, 0x7b82771e, 0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42,
+    0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82, 0x8196fb53, 0xbcf6d2e3,
+    0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743,
+    0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860,
+    0x5e46d2b0, 0x6326fb00, 0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601,
+    0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1, 0x70279f96, 0x4d47b626,
+    0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+    0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27,
+    0xcf1721f7, 0xf2770847, 0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4,
+    0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404, 0x20b743d5, 0x1dd76a65,
+    0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+    0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab,
+    0x66551d7b, 0x5b3534cb, 0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca,
+    0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a, 0x89f57f59, 0xb49556e9,
+    0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349,
+    0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8,
+    0x36c5c138, 0x0ba5e888, 0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f,
+    0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf, 0x18a48c1e, 0x25c4a5ae,
+    0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+    0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d,
+    0xc774a5fd, 0xfa148c4d, 0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c,
+    0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c},
+  {
+    0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3,
+    0xd659e31d, 0x1d0530b8, 0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3,
+    0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5, 0x03d6029b, 0xc88ad13e,
+    0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+    0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145,
+    0x39dc63eb, 0xf280b04e, 0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798,
+    0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e, 0xebff875b, 0x20a354fe,
+    0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+    0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e,
+    0xd223e4b0, 0x197f3715, 0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e,
+    0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578, 0x0f580a6c, 0xc404d9c9,
+    0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+    0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2,
+    0x35526b1c, 0xfe0eb8b9, 0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59,
+    0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f, 0xe0dd8a9a, 0x2b81593f,
+    0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+    0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9,
+    0xdeadec47, 0x15f13fe2, 0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99,
+    0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f, 0x0b220dc1, 0xc07ede64,
+    0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+    0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f,
+    0x31286cb1, 0xfa74bf14, 0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676,
+    0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460, 0xf2e396b5, 0x39bf4510,
+    0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+    0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0,
+    0xcb3ff55e, 0x006326fb, 0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680,
+    0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496, 0x191c11ee, 0xd240c24b,
+    0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156,
+    0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230,
+    0x2316709e, 0xe84aa33b, 0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db,
+    0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd, 0xf6999118, 0x3dc542bd,
+    0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+    0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07,
+    0xc7b1fda9, 0x0ced2e0c, 0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77,
+    0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61, 0x123e1c2f, 0xd962cf8a,
+    0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97,
+    0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1,
+    0x28347d5f, 0xe368aefa, 0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c,
+    0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a, 0xfa1799ef, 0x314b4a4a,
+    0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+    0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa,
+    0xc3cbfa04, 0x089729a1, 0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da,
+    0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc},
+  {
+    0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7,
+    0x63d0353a, 0xc5a73e8e, 0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa,
+    0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9, 0x67de9cce, 0xc1a9977a,
+    0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240,
+    0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e,
+    0x37e1e793, 0x9196ec27, 0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301,
+    0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712, 0xfc5277fb, 0x5a257c4f,
+    0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+    0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5,
+    0xcbb39068, 0x6dc49bdc, 0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8,
+    0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb, 0x440b7579, 0xe27c7ecd,
+    0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+    0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9,
+    0x14340e24, 0xb2430590, 0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a,
+    0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739, 0x103aa7d0, 0xb64dac64,
+    0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+    0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342,
+    0xe86679df, 0x4e11726b, 0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f,
+    0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c, 0xec68d02b, 0x4a1fdb9f,
+    0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+    0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb,
+    0xbc57ab76, 0x1a20a0c2, 0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f,
+    0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c, 0xbbf9a495, 0x1d8eaf21,
+    0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+    0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b,
+    0x8c184306, 0x2a6f48b2, 0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6,
+    0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5, 0x47abd36e, 0xe1dcd8da,
+    0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+    0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae,
+    0x1794a833, 0xb1e3a387, 0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d,
+    0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e, 0x139a01c7, 0xb5ed0a73,
+    0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+    0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c,
+    0xafcdaab1, 0x09baa105, 0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71,
+    0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62, 0xabc30345, 0x0db408f1,
+    0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+    0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285,
+    0xfbfc7818, 0x5d8b73ac, 0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a,
+    0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899, 0x304fe870, 0x9638e3c4,
+    0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+    0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e,
+    0x07ae0fe3, 0xa1d90457, 0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23,
+    0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30},
+  {
+    0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64,
+    0xc66f0987, 0x0ac50919, 0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56,
+    0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac, 0x7cbb312b, 0xb01131b5,
+    0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+    0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa,
+    0x69312319, 0xa59b2387, 0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5,
+    0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f, 0x2a9379e3, 0xe639797d,
+    0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+    0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19,
+    0x43a25afa, 0x8f085a64, 0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b,
+    0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1, 0x299dc2ed, 0xe537c273,
+    0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+    0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c,
+    0x3c17d0df, 0xf0bdd041, 0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425,
+    0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf, 0x86c3e873, 0x4a69e8ed,
+    0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+    0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf,
+    0x1684a93c, 0xda2ea9a2, 0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced,
+    0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217, 0xac509190, 0x60fa910e,
+    0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+    0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441,
+    0xb9da83a2, 0x7570833c, 0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239,
+    0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3, 0x80de9e6f, 0x4c749ef1,
+    0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+    0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95,
+    0xe9efbd76, 0x2545bde8, 0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7,
+    0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d, 0xaa4de78c, 0x66e7e712,
+    0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+    0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d,
+    0xbfc7f5be, 0x736df520, 0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144,
+    0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe, 0x0513cd12, 0xc9b9cd8c,
+    0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b,
+    0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953,
+    0xbcc94eb0, 0x70634e2e, 0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61,
+    0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b, 0x061d761c, 0xcab77682,
+    0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05,
+    0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd,
+    0x1397642e, 0xdf3d64b0, 0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282,
+    0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78, 0x50353ed4, 0x9c9f3e4a,
+    0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+    0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e,
+    0x39041dcd, 0xf5ae1d53, 0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c,
+    0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6}};
+
@@ -31,6 +31,7 @@
 
 #if LIBFEC_ENABLED
 #include "fec.h"
+#endif
 
 fec fec_conv_create(fec_scheme _fs)
 {
@@ -67,6 +68,7 @@ void fec_conv_destroy(fec _q)
     if (_q->vp != NULL)
         _q->delete_viterbi(_q->vp);
 
+    free(_q->enc_bits);
     free(_q);
 }
 
@@ -94,7 +96,7 @@ void fec_conv_encode(fec _q,
 
             // compute parity bits for each polynomial
             for (r=0; r<_q->R; r++) {
-                byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                 _msg_enc[n/8] = byte_out;
                 n++;
             }
@@ -108,7 +110,7 @@ void fec_conv_encode(fec _q,
 
         // compute parity bits for each polynomial
         for (r=0; r<_q->R; r++) {
-            byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+            byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
             _msg_enc[n/8] = byte_out;
             n++;
         }
@@ -233,11 +235,19 @@ void fec_conv_init_v27(fec _q)
     _q->R=2;
     _q->K=7;
     _q->poly = fec_conv27_poly;
+#if LIBFEC_ENABLED
     _q->create_viterbi = create_viterbi27;
     _q->init_viterbi = init_viterbi27;
     _q->update_viterbi_blk = update_viterbi27_blk;
     _q->chainback_viterbi = chainback_viterbi27;
     _q->delete_viterbi = delete_viterbi27;
+#else
+    _q->create_viterbi = viterbi_create27;
+    _q->init_viterbi = viterbi_init;
+    _q->update_viterbi_blk = viterbi_update_blk;
+    _q->chainback_viterbi = viterbi_chainback;
+    _q->delete_viterbi = viterbi_destroy;
+#endif
 }
 
 void fec_conv_init_v29(fec _q)
@@ -245,11 +255,19 @@ void fec_conv_init_v29(fec _q)
     _q->R=2;
     _q->K=9;
     _q->poly = fec_conv29_poly;
+#if LIBFEC_ENABLED
     _q->create_viterbi = create_viterbi29;
     _q->init_viterbi = init_viterbi29;
     _q->update_viterbi_blk = update_viterbi29_blk;
     _q->chainback_viterbi = chainback_viterbi29;
     _q->delete_viterbi = delete_viterbi29;
+#else
+    _q->create_viterbi = viterbi_create29;
+    _q->init_viterbi = viterbi_init;
+    _q->update_viterbi_blk = viterbi_update_blk;
+    _q->chainback_viterbi = viterbi_chainback;
+    _q->delete_viterbi = viterbi_destroy;
+#endif
 }
 
 void fec_conv_init_v39(fec _q)
@@ -257,11 +275,19 @@ void fec_conv_init_v39(fec _q)
     _q->R=3;
     _q->K=9;
     _q->poly = fec_conv39_poly;
+#if LIBFEC_ENABLED
     _q->create_viterbi = create_viterbi39;
     _q->init_viterbi = init_viterbi39;
     _q->update_viterbi_blk = update_viterbi39_blk;
     _q->chainback_viterbi = chainback_viterbi39;
     _q->delete_viterbi = delete_viterbi39;
+#else
+    _q->create_viterbi = viterbi_create39;
+    _q->init_viterbi = viterbi_init;
+    _q->update_viterbi_blk = viterbi_update_blk;
+    _q->chainback_viterbi = viterbi_chainback;
+    _q->delete_viterbi = viterbi_destroy;
+#endif
 }
 
 void fec_conv_init_v615(fec _q)
@@ -269,25 +295,17 @@ void fec_conv_init_v615(fec _q)
     _q->R=6;
     _q->K=15;
     _q->poly = fec_conv615_poly;
+#if LIBFEC_ENABLED
     _q->create_viterbi = create_viterbi615;
     _q->init_viterbi = init_viterbi615;
     _q->update_viterbi_blk = update_viterbi615_blk;
     _q->chainback_viterbi = chainback_viterbi615;
     _q->delete_viterbi = delete_viterbi615;
+#else
+    _q->create_viterbi = viterbi_create615;
+    _q->init_viterbi = viterbi_init;
+    _q->update_viterbi_blk = viterbi_update_blk;
+    _q->chainback_viterbi = viterbi_chainback;
+    _q->delete_viterbi = viterbi_destroy;
+#endif
 }
-
-
-
-#else   // LIBFEC_ENABLED
-
-fec fec_conv_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_conv_destroy(fec _q)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
@@ -31,6 +31,7 @@
 
 #if LIBFEC_ENABLED
 #include "fec.h"
+#endif
 
 fec fec_conv_punctured_create(fec_scheme _fs)
 {
@@ -76,6 +77,7 @@ void fec_conv_punctured_destroy(fec _q)
     if (_q->vp != NULL)
         _q->delete_viterbi(_q->vp);
 
+    free(_q->enc_bits);
     free(_q);
 }
 
@@ -106,7 +108,7 @@ void fec_conv_punctured_encode(fec _q,
             for (r=0; r<_q->R; r++) {
                 // enable output determined by puncturing matrix
                 if (_q->puncturing_matrix[r*(_q->P)+p]) {
-                    byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                    byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                     _msg_enc[n/8] = byte_out;
                     n++;
                 } else {
@@ -128,7 +130,7 @@ void fec_conv_punctured_encode(fec _q,
         // compute parity bits for each polynomial
         for (r=0; r<_q->R; r++) {
             if (_q->puncturing_matrix[r*(_q->P)+p]) {
-                byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                 _msg_enc[n/8] = byte_out;
                 n++;
             }
@@ -168,19 +170,17 @@ void fec_conv_punctured_decode_hard(fec _q,
     unsigned int k=0;   // intput bit index (0<=k<8)
     unsigned int p=0;   // puncturing matrix column index
     unsigned char bit;
-    unsigned char byte_in = _msg_enc[n];
     for (i=0; i<num_enc_bits; i+=_q->R) {
         //
         for (r=0; r<_q->R; r++) {
             if (_q->puncturing_matrix[r*(_q->P)+p]) {
                 // push bit from input
-                bit = (byte_in >> (7-k)) & 0x01;
+                bit = (_msg_enc[n] >> (7-k)) & 0x01;
                 _q->enc_bits[i+r] = bit ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
                 k++;
                 if (k==8) {
                     k = 0;
                     n++;
-                    byte_in = _msg_enc[n];
                 }
             } else {
                 // push erasure
@@ -420,33 +420,3 @@ void fec_conv_init_v29p78(fec _q)
     _q->P = 7;
     _q->puncturing_matrix = fec_conv29p78_matrix;
 }
-
-
-#else   // LIBFEC_ENABLED
-
-fec fec_conv_punctured_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_conv_punctured_destroy(fec _q)
-{
-}
-
-void fec_conv_punctured_encode(fec _q,
-                               unsigned int _dec_msg_len,
-                               unsigned char *_msg_dec,
-                               unsigned char *_msg_enc)
-{
-}
-
-//unsigned int
-void fec_conv_punctured_decode(fec _q,
-                               unsigned int _dec_msg_len,
-                               unsigned char *_msg_enc,
-                               unsigned char *_msg_dec)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
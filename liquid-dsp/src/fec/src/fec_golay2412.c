@@ -95,8 +95,10 @@ unsigned int fec_golay2412_encode_symbol(unsigned int _sym_dec)
         exit(1);
     }
 
-    // compute encoded/transmitted message: v = m*G
-    return golay2412_matrix_mul(_sym_dec, golay2412_Gt, 24);
+    // compute encoded/transmitted message: v = m*G, using the
+    // contributions of the upper and lower six message bits
+    return golay2412_enc_gentab[0][(_sym_dec >> 6) & 0x3f] ^
+           golay2412_enc_gentab[1][(_sym_dec     ) & 0x3f];
 }
 
 // search for p[i] such that w(v+p[i]) <= 2, return -1 on fail
@@ -124,25 +126,12 @@ int golay2412_parity_search(unsigned int _v)
     return -1;
 }
 
-unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
+// estimate 24-bit error vector from 12-bit syndrome (reference
+// algorithm used to generate golay2412_dec_gentab)
+unsigned int golay2412_estimate_ehat(unsigned int _s)
 {
-    // validate input
-    if (_sym_enc >= (1<<24)) {
-        fprintf(stderr,"error, fec_golay2412_decode_symbol(), input symbol too large\n");
-        exit(1);
-    }
-
-    // state variables
-    unsigned int s=0;       // syndrome vector
+    unsigned int s = _s;    // syndrome vector
     unsigned int e_hat=0;   // estimated error vector
-    unsigned int v_hat=0;   // estimated transmitted message
-    unsigned int m_hat=0;   // estimated original message
-    
-    // compute syndrome vector, s = r*H^T = ( H*r^T )^T
-    s = golay2412_matrix_mul(_sym_enc, golay2412_H, 12);
-#if DEBUG_FEC_GOLAY2412
-    printf("s (syndrome vector): "); liquid_print_bitstring(s,12); printf("\n");
-#endif
 
     // compute weight of s (12 bits)
     unsigned int ws = liquid_count_ones_uint16(s);
@@ -217,18 +206,89 @@ unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
         }
     }
 
-    // step 8: compute estimated transmitted message: v_hat = r + e_hat
-    v_hat = _sym_enc ^ e_hat;
+    return e_hat;
+}
+
+unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
+{
+    // validate input
+    if (_sym_enc >= (1<<24)) {
+        fprintf(stderr,"error, fec_golay2412_decode_symbol(), input symbol too large\n");
+        exit(1);
+    }
+
+    // compute syndrome vector, s = r*H^T = ( H*r^T )^T, one byte at a time
+    unsigned int s = golay2412_syndrome_gentab[0][(_sym_enc >> 16) & 0xff] ^
+                     golay2412_syndrome_gentab[1][(_sym_enc >>  8) & 0xff] ^
+                     golay2412_syndrome_gentab[2][(_sym_enc      ) & 0xff];
 #if DEBUG_FEC_GOLAY2412
-    printf("r (recevied vector):            "); liquid_print_bitstring(_sym_enc,24); printf("\n");
-    printf("e-hat (estimated error vector): "); liquid_print_bitstring(e_hat,24);    printf("\n");
-    printf("v-hat (estimated tx vector):    "); liquid_print_bitstring(v_hat,24);    printf("\n");
+    printf("s (syndrome vector): "); liquid_print_bitstring(s,12); printf("\n");
 #endif
-    
-    // compute estimated original message: (last 12 bits of encoded message)
-    m_hat = v_hat & 0x0fff;
 
-    return m_hat;
+    // look up estimated error vector over message bits and compute
+    // estimated original message (last 12 bits of encoded message)
+    return (_sym_enc ^ golay2412_dec_gentab[s]) & 0x0fff;
+}
+
+// encode array of three-byte blocks, each as two 24-bit symbols
+//  _msg_dec    :   decoded message [size: 3*_n x 1]
+//  _n          :   number of three-byte blocks
+//  _msg_enc    :   encoded message [size: 6*_n x 1]
+void fec_golay2412_encode_array(unsigned char * _msg_dec,
+                                unsigned int    _n,
+                                unsigned char * _msg_enc)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned char * m = &_msg_dec[3*i];
+        unsigned char * v = &_msg_enc[6*i];
+
+        // encode two 12-bit symbols from upper/lower six bits of each
+        unsigned int v0 = golay2412_enc_gentab[0][ (m[0] >> 2)                    ] ^
+                          golay2412_enc_gentab[1][((m[0] << 4) & 0x30) | (m[1] >> 4)];
+        unsigned int v1 = golay2412_enc_gentab[0][((m[1] << 2) & 0x3c) | (m[2] >> 6)] ^
+                          golay2412_enc_gentab[1][ (m[2]     ) & 0x3f             ];
+
+        // unpack two 24-bit symbols into six 8-bit bytes
+        v[0] = (v0 >> 16) & 0xff;
+        v[1] = (v0 >>  8) & 0xff;
+        v[2] = (v0      ) & 0xff;
+        v[3] = (v1 >> 16) & 0xff;
+        v[4] = (v1 >>  8) & 0xff;
+        v[5] = (v1      ) & 0xff;
+    }
+}
+
+// decode array of six-byte blocks, each as two 24-bit symbols
+//  _msg_enc    :   encoded message [size: 6*_n x 1]
+//  _n          :   number of six-byte blocks
+//  _msg_dec    :   decoded message [size: 3*_n x 1]
+void fec_golay2412_decode_array(unsigned char * _msg_enc,
+                                unsigned int    _n,
+                                unsigned char * _msg_dec)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned char * r = &_msg_enc[6*i];
+        unsigned char * m = &_msg_dec[3*i];
+
+        // compute syndromes of both symbols, one byte at a time
+        unsigned int s0 = golay2412_syndrome_gentab[0][r[0]] ^
+                          golay2412_syndrome_gentab[1][r[1]] ^
+                          golay2412_syndrome_gentab[2][r[2]];
+        unsigned int s1 = golay2412_syndrome_gentab[0][r[3]] ^
+                          golay2412_syndrome_gentab[1][r[4]] ^
+                          golay2412_syndrome_gentab[2][r[5]];
+
+        // correct message bits (last 12 bits of each symbol)
+        unsigned int m0 = ((r[1] << 8) | r[2]) ^ golay2412_dec_gentab[s0];
+        unsigned int m1 = ((r[4] << 8) | r[5]) ^ golay2412_dec_gentab[s1];
+
+        // unpack two 12-bit symbols into three 8-bit bytes
+        m[0] = ((m0 >> 4) & 0xff);
+        m[1] = ((m0 << 4) & 0xf0) | ((m1 >> 8) & 0x0f);
+        m[2] = ((m1     ) & 0xff);
+    }
 }
 
 // create Golay(24,12) codec object
@@ -267,38 +327,16 @@ void fec_golay2412_encode(fec _q,
 {
     unsigned int i=0;           // decoded byte counter
     unsigned int j=0;           // encoded byte counter
-    unsigned int s0, s1, s2;    // three 8-bit symbols
-    unsigned int m0, m1;        // two 12-bit symbols (uncoded)
-    unsigned int v0, v1;        // two 24-bit symbols (encoded)
+    unsigned int s0;            // 8-bit symbol
+    unsigned int m0;            // 12-bit symbol (uncoded)
+    unsigned int v0;            // 24-bit symbol (encoded)
 
     // determine remainder of input length / 3
     unsigned int r = _dec_msg_len % 3;
 
-    for (i=0; i<_dec_msg_len-r; i+=3) {
-        // strip three input bytes (two uncoded symbols)
-        s0 = _msg_dec[i+0];
-        s1 = _msg_dec[i+1];
-        s2 = _msg_dec[i+2];
-
-        // pack into two 12-bit symbols
-        m0 = ((s0 << 4) & 0x0ff0) | ((s1 >> 4) & 0x000f);
-        m1 = ((s1 << 8) & 0x0f00) | ((s2     ) & 0x00ff);
-
-        // encode each 12-bit symbol into a 24-bit symbol
-        v0 = fec_golay2412_encode_symbol(m0);
-        v1 = fec_golay2412_encode_symbol(m1);
-
-        // unpack two 24-bit symbols into six 8-bit bytes
-        // retaining order of bits in output
-        _msg_enc[j+0] = (v0 >> 16) & 0xff;
-        _msg_enc[j+1] = (v0 >>  8) & 0xff;
-        _msg_enc[j+2] = (v0      ) & 0xff;
-        _msg_enc[j+3] = (v1 >> 16) & 0xff;
-        _msg_enc[j+4] = (v1 >>  8) & 0xff;
-        _msg_enc[j+5] = (v1      ) & 0xff;
-
-        j += 6;
-    }
+    // encode blocks of three bytes (two symbols) directly to output
+    fec_golay2412_encode_array(_msg_dec, _dec_msg_len / 3, _msg_enc);
+    j = 2*(_dec_msg_len - r);
 
     // if input length isn't divisible by 3, encode last 1 or two bytes
     for (i=_dec_msg_len-r; i<_dec_msg_len; i++) {
@@ -339,37 +377,16 @@ void fec_golay2412_decode(fec _q,
 {
     unsigned int i=0;                       // decoded byte counter
     unsigned int j=0;                       // encoded byte counter
-    unsigned int r0, r1, r2, r3, r4, r5;    // six 8-bit bytes
-    unsigned int v0, v1;                    // two 24-bit encoded symbols
-    unsigned int m0_hat, m1_hat;            // two 12-bit decoded symbols
+    unsigned int r0, r1, r2;                // three 8-bit bytes
+    unsigned int v0;                        // 24-bit encoded symbol
+    unsigned int m0_hat;                    // 12-bit decoded symbol
     
     // determine remainder of input length / 3
     unsigned int r = _dec_msg_len % 3;
 
-    for (i=0; i<_dec_msg_len-r; i+=3) {
-        // strip six input bytes (two encoded symbols)
-        r0 = _msg_enc[j+0];
-        r1 = _msg_enc[j+1];
-        r2 = _msg_enc[j+2];
-        r3 = _msg_enc[j+3];
-        r4 = _msg_enc[j+4];
-        r5 = _msg_enc[j+5];
-
-        // pack six 8-bit symbols into two 24-bit symbols
-        v0 = ((r0 << 16) & 0xff0000) | ((r1 <<  8) & 0x00ff00) | ((r2     ) & 0x0000ff);
-        v1 = ((r3 << 16) & 0xff0000) | ((r4 <<  8) & 0x00ff00) | ((r5 << 0) & 0x0000ff);
-
-        // decode each symbol into a 12-bit symbol
-        m0_hat = fec_golay2412_decode_symbol(v0);
-        m1_hat = fec_golay2412_decode_symbol(v1);
-
-        // unpack two 12-bit symbols into three 8-bit bytes
-        _msg_dec[i+0] = ((m0_hat >> 4) & 0xff);
-        _msg_dec[i+1] = ((m0_hat << 4) & 0xf0) | ((m1_hat >> 8) & 0x0f);
-        _msg_dec[i+2] = ((m1_hat     ) & 0xff);
-
-        j += 6;
-    }
+    // decode blocks of six bytes (two symbols) directly to output
+    fec_golay2412_decode_array(_msg_enc, _dec_msg_len / 3, _msg_dec);
+    j = 2*(_dec_msg_len - r);
 
     // if input length isn't divisible by 3, decode last 1 or two bytes
     for (i=_dec_msg_len-r; i<_dec_msg_len; i++) {
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Low-density parity check (LDPC) codes
+//
+// Quasi-cyclic codes of length n=768 bits, built from a 24-column
+// base matrix lifted with 32 x 32 circulant permutations. The parity
+// portion of each base matrix has the dual-diagonal structure used
+// by IEEE 802.11n/802.16e: the first parity column has shifts {1,0,1}
+// in the first, middle and last rows, followed by an identity
+// staircase. This permits linear-time encoding directly from the base
+// matrix. Shifts were selected by a random search to avoid all
+// length-4 cycles while minimizing the number of length-6 cycles.
+//
+// Messages are split into blocks as with the Reed-Solomon codes; each
+// block is shortened to the decoded block length and only the data
+// and parity bytes are transmitted.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+#define VERBOSE_FEC_LDPC    0
+
+// maximum number of layered min-sum iterations
+#define FEC_LDPC_MAX_ITERATIONS     (20)
+
+// log-likelihood of shortened (known zero) bits
+#define FEC_LDPC_LLR_KNOWN          (1e6f)
+
+// r1/2 (768,384), 12 x 24 base matrix
+static const signed char fec_ldpc_base_r12[12*24] = {
+     -1, 21, 26, -1, -1, -1, -1, 13,  6, -1, -1, -1,  1,  0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+      3, -1, -1, 17, -1, -1, -1, 29,  0, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     24, -1, 12, -1,  3, -1, -1, -1, -1,  3, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1, -1,
+     31, -1, -1, 30, -1, 18, -1, -1, -1,  4, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1, -1,
+      7, -1, 28, -1, -1, -1, 26, -1,  6, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1, -1,
+     -1, 10, -1,  3, -1, 14, -1, -1, -1, -1, 24, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1, -1,
+     -1, 14, 31, -1, -1, 16, -1, -1, -1,  8, -1, -1,  0, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1, -1,
+     26, -1, 20, -1, 19, -1, -1, -1, -1, -1,  5, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1, -1,
+     -1,  3, 16, -1, -1, -1,  1, -1, -1, -1, -1,  7, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1, -1,
+     13, -1, -1, 16, 11, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0, -1,
+     -1, 19, -1, 25, -1, -1, 20, -1, -1, -1, -1, 30, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  0,
+     -1, 16, -1,  3, -1, -1, -1, 18, -1, -1, -1, 25,  1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0
+};
+
+// r2/3 (768,512), 8 x 24 base matrix
+static const signed char fec_ldpc_base_r23[8*24] = {
+     -1, 28, 21, -1,  3, -1, -1,  2, -1,  4, -1, 24, -1, 10, -1, -1,  1,  0, -1, -1, -1, -1, -1, -1,
+     -1, 14, 19, -1, 19,  8, -1, -1, -1, -1, 10, 23, -1, -1, -1, 31, -1,  0,  0, -1, -1, -1, -1, -1,
+     -1, 10, 13, 12, -1, -1,  4, -1, -1, -1, 27, -1, 17, -1, 11, -1, -1, -1,  0,  0, -1, -1, -1, -1,
+     31, -1,  8,  1, -1, -1, -1, 13, 12, -1, 17, -1, -1, -1, -1, 30, -1, -1, -1,  0,  0, -1, -1, -1,
+      9,  9, -1,  4, -1, -1, -1,  7, -1, 11, -1, -1, 19, 11, -1, -1,  0, -1, -1, -1,  0,  0, -1, -1,
+      5, -1, 10, -1, 25, -1, 20, -1,  1, -1, -1, -1, 16, -1, 18, -1, -1, -1, -1, -1, -1,  0,  0, -1,
+     25, -1, -1,  7, -1, 17, 18, -1, -1,  7, -1, -1, -1, 30, 28, -1, -1, -1, -1, -1, -1, -1,  0,  0,
+     24,  0, -1, 25, -1, 10, -1, -1, 10, -1, -1, 15, -1, -1, -1, 18,  1, -1, -1, -1, -1, -1, -1,  0
+};
+
+// r3/4 (768,576), 6 x 24 base matrix
+static const signed char fec_ldpc_base_r34[6*24] = {
+     -1,  9, 23, 27, -1, 20, -1, -1, 27, -1, 20,  8, -1, -1,  2, 19, -1, 21,  1,  0, -1, -1, -1, -1,
+     16, 21, -1, 22, 22, -1, -1, -1, 17, 20, -1, 22, -1, -1, 11, 29,  7, -1, -1,  0,  0, -1, -1, -1,
+     -1, 26,  1,  9, -1, -1, 14, 16, -1, 27, -1, 16, -1, 23, 22, -1, -1, -1, -1, -1,  0,  0, -1, -1,
+     10, -1, 26, 24, -1,  7, -1, 10, 12, -1, -1, -1, 10, 28, -1, 25, -1, 17,  0, -1, -1,  0,  0, -1,
+     27, -1,  8, -1, 10, 23, 17, -1, -1, -1, 20, -1,  7, 24, -1, -1, 21, -1, -1, -1, -1, -1,  0,  0,
+     31, 29, -1, -1, 27, -1,  3,  1, -1,  1,  1, -1, 15, -1, -1, -1, 10, 15,  1, -1, -1, -1, -1,  0
+};
+
+fec fec_ldpc_create(fec_scheme _fs)
+{
+    fec q = (fec) malloc(sizeof(struct fec_s));
+
+    q->scheme = _fs;
+    q->rate = fec_get_rate(q->scheme);
+
+    q->encode_func      = &fec_ldpc_encode;
+    q->decode_func      = &fec_ldpc_decode;
+    q->decode_soft_func = &fec_ldpc_decode_soft;
+
+    q->ldpc_nb = 24;
+    q->ldpc_Z  = 32;
+    switch (q->scheme) {
+    case LIQUID_FEC_LDPC_R12: q->ldpc_base = fec_ldpc_base_r12; q->ldpc_mb = 12; break;
+    case LIQUID_FEC_LDPC_R23: q->ldpc_base = fec_ldpc_base_r23; q->ldpc_mb =  8; break;
+    case LIQUID_FEC_LDPC_R34: q->ldpc_base = fec_ldpc_base_r34; q->ldpc_mb =  6; break;
+    default:
+        fprintf(stderr,"error: fec_ldpc_create(), invalid type\n");
+        exit(1);
+    }
+
+    // block lengths (bytes)
+    unsigned int n = q->ldpc_nb * q->ldpc_Z;
+    unsigned int k = (q->ldpc_nb - q->ldpc_mb) * q->ldpc_Z;
+    q->nn     = n / 8;
+    q->kk     = k / 8;
+    q->nroots = q->nn - q->kk;
+    q->num_dec_bytes = 0;
+
+    // create decoder from expanded parity check matrix
+    smatrixb H = fec_ldpc_expand(q->ldpc_base, q->ldpc_mb, q->ldpc_nb, q->ldpc_Z);
+    q->ldpc = ldpc_create(H);
+    smatrixb_destroy(H);
+
+    // allocate memory for arrays
+    q->ldpc_bits = (unsigned char*) malloc(n*sizeof(unsigned char));
+    q->ldpc_LLR  = (float*)         malloc(n*sizeof(float));
+
+    return q;
+}
+
+void fec_ldpc_destroy(fec _q)
+{
+    ldpc_destroy(_q->ldpc);
+    free(_q->ldpc_bits);
+    free(_q->ldpc_LLR);
+    free(_q);
+}
+
+// expand quasi-cyclic base matrix into sparse parity check matrix;
+// a shift h places a one at column (z+h) mod Z of row z within the
+// block
+//  _base   :   base matrix shifts, -1 for zero block [size: _mb x _nb]
+//  _mb     :   base matrix rows
+//  _nb     :   base matrix columns
+//  _Z      :   circulant size
+smatrixb fec_ldpc_expand(const signed char * _base,
+                         unsigned int        _mb,
+                         unsigned int        _nb,
+                         unsigned int        _Z)
+{
+    smatrixb H = smatrixb_create(_mb*_Z, _nb*_Z);
+    unsigned int i, j, z;
+    for (i=0; i<_mb; i++) {
+        for (j=0; j<_nb; j++) {
+            int h = _base[i*_nb + j];
+            if (h < 0)
+                continue;
+            for (z=0; z<_Z; z++)
+                smatrixb_set(H, i*_Z + z, j*_Z + (z+h)%_Z, 1);
+        }
+    }
+    return H;
+}
+
+// compute parity bits of codeword in place from information bits
+// using the dual-diagonal structure of the base matrix
+//  _q      :   fec object
+//  _c      :   codeword bits; information bits in [0,k) on input,
+//              parity bits in [k,n) on output
+static void fec_ldpc_encode_block(fec             _q,
+                                  unsigned char * _c)
+{
+    unsigned int mb = _q->ldpc_mb;
+    unsigned int nb = _q->ldpc_nb;
+    unsigned int Z  = _q->ldpc_Z;
+    unsigned int kb = nb - mb;
+    const signed char * B = _q->ldpc_base;
+    unsigned char * p = &_c[kb*Z];
+
+    // per-row syndromes of the information bits
+    unsigned char lambda[mb*Z];
+    memset(lambda, 0x00, sizeof(lambda));
+    unsigned int i, j, z;
+    for (i=0; i<mb; i++) {
+        for (j=0; j<kb; j++) {
+            int h = B[i*nb + j];
+            if (h < 0)
+                continue;
+            // cyclic shift, split to avoid modulo in inner loop
+            unsigned char * l = &lambda[i*Z];
+            unsigned char * x = &_c[j*Z];
+            for (z=0; z<Z-h; z++) l[z] ^= x[z+h];
+            for (   ; z<Z;   z++) l[z] ^= x[z+h-Z];
+        }
+    }
+
+    // first parity block: staircase columns and the outer {1,1}
+    // shifts cancel when summing all rows
+    memset(p, 0x00, Z*sizeof(unsigned char));
+    for (i=0; i<mb; i++) {
+        for (z=0; z<Z; z++)
+            p[z] ^= lambda[i*Z+z];
+    }
+
+    // remaining parity blocks: back-substitution along the staircase
+    unsigned char acc[Z];
+    memset(acc, 0x00, sizeof(acc));
+    for (i=0; i<mb-1; i++) {
+        int h = B[i*nb + kb];
+        for (z=0; z<Z; z++) {
+            acc[z] ^= lambda[i*Z+z];
+            if (h >= 0)
+                acc[z] ^= p[(z+h)%Z];
+            p[(i+1)*Z+z] = acc[z];
+        }
+    }
+}
+
+void fec_ldpc_encode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char *_msg_dec,
+                     unsigned char *_msg_enc)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_encode(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int i, j;
+    unsigned int n0=0;  // input index
+    unsigned int n1=0;  // output index
+    unsigned int block_size = _q->dec_block_len;
+    unsigned int n = 8*_q->nn;
+    unsigned int k = 8*_q->kk;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // unpack information bits, padding with zeros
+        memset(_q->ldpc_bits, 0x00, n*sizeof(unsigned char));
+        for (j=0; j<8*block_size; j++)
+            _q->ldpc_bits[j] = (_msg_dec[n0 + j/8] >> (7-(j%8))) & 1;
+
+        // compute parity bits
+        fec_ldpc_encode_block(_q, _q->ldpc_bits);
+
+        // output data bytes (zero-padded) followed by parity bytes
+        memset(&_msg_enc[n1], 0x00, _q->enc_block_len*sizeof(unsigned char));
+        memmove(&_msg_enc[n1], &_msg_dec[n0], block_size*sizeof(unsigned char));
+        for (j=0; j<n-k; j++)
+            _msg_enc[n1 + _q->dec_block_len + j/8] |= _q->ldpc_bits[k+j] << (7-(j%8));
+
+        // increment counters
+        n0 += block_size;
+        n1 += _q->enc_block_len;
+    }
+
+    // sanity check
+    assert( n0 == _q->num_dec_bytes );
+    assert( n1 == _q->num_enc_bytes );
+}
+
+// decode block from codeword log-likelihoods
+//  _q          :   fec object
+//  _msg_dec    :   decoded bytes [size: _block_size x 1]
+//  _block_size :   number of decoded bytes to write
+static void fec_ldpc_decode_block(fec             _q,
+                                  unsigned char * _msg_dec,
+                                  unsigned int    _block_size)
+{
+    unsigned int j;
+    unsigned int k = 8*_q->kk;
+
+    // shortened bits are known to be zero
+    for (j=8*_q->dec_block_len; j<k; j++)
+        _q->ldpc_LLR[j] = FEC_LDPC_LLR_KNOWN;
+
+    // run decoder (output is hard decision even if parity fails)
+    ldpc_decode(_q->ldpc, _q->ldpc_LLR, _q->ldpc_bits, FEC_LDPC_MAX_ITERATIONS);
+#if VERBOSE_FEC_LDPC
+    printf("fec_ldpc_decode_block(), %u iterations\n", _q->ldpc->num_iterations);
+#endif
+
+    // pack information bits
+    memset(_msg_dec, 0x00, _block_size*sizeof(unsigned char));
+    for (j=0; j<8*_block_size; j++)
+        _msg_dec[j/8] |= _q->ldpc_bits[j] << (7-(j%8));
+}
+
+void fec_ldpc_decode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char *_msg_enc,
+                     unsigned char *_msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_decode(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int i, j;
+    unsigned int n0=0;
+    unsigned int n1=0;
+    unsigned int block_size = _q->dec_block_len;
+    unsigned int k = 8*_q->kk;
+    unsigned int num_data_bits = 8*_q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // map hard bits to log-likelihoods: data, then parity
+        unsigned char * r = &_msg_enc[n0];
+        for (j=0; j<8*_q->enc_block_len; j++) {
+            unsigned int bit = (r[j/8] >> (7-(j%8))) & 1;
+            unsigned int m   = j < num_data_bits ? j : j - num_data_bits + k;
+            _q->ldpc_LLR[m] = bit ? -1.0f : 1.0f;
+        }
+
+        fec_ldpc_decode_block(_q, &_msg_dec[n1], block_size);
+
+        // increment counters
+        n0 += _q->enc_block_len;
+        n1 += block_size;
+    }
+
+    // sanity check
+    assert( n0 == _q->num_enc_bytes );
+    assert( n1 == _q->num_dec_bytes );
+}
+
+void fec_ldpc_decode_soft(fec _q,
+                          unsigned int _dec_msg_len,
+                          unsigned char *_msg_enc,
+                          unsigned char *_msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_decode_soft(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int i, j;
+    unsigned int n0=0;
+    unsigned int n1=0;
+    unsigned int block_size = _q->dec_block_len;
+    unsigned int k = 8*_q->kk;
+    unsigned int num_data_bits = 8*_q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // map soft bits (255: strong '1') to log-likelihoods
+        unsigned char * r = &_msg_enc[8*n0];
+        for (j=0; j<8*_q->enc_block_len; j++) {
+            unsigned int m = j < num_data_bits ? j : j - num_data_bits + k;
+            _q->ldpc_LLR[m] = 127.5f - (float)r[j];
+        }
+
+        fec_ldpc_decode_block(_q, &_msg_dec[n1], block_size);
+
+        // increment counters
+        n0 += _q->enc_block_len;
+        n1 += block_size;
+    }
+
+    // sanity check
+    assert( n0 == _q->num_enc_bytes );
+    assert( n1 == _q->num_dec_bytes );
+}
+
+// Set dec_msg_len, splitting the message into blocks exactly as with
+// the Reed-Solomon codes (see fec_rs_setlength()); the encoded length
+// matches fec_rs_get_enc_msg_len(_dec_msg_len, nroots, nn, kk) where
+// all lengths are in bytes.
+void fec_ldpc_setlength(fec _q,
+                        unsigned int _dec_msg_len)
+{
+    // return if length has not changed
+    if (_dec_msg_len == _q->num_dec_bytes)
+        return;
+
+    _q->num_dec_bytes = _dec_msg_len;
+
+    div_t d;
+
+    // compute the total number of blocks necessary: ceil(num_dec_bytes / kk)
+    d = div(_q->num_dec_bytes, _q->kk);
+    _q->num_blocks = d.quot + (d.rem==0 ? 0 : 1);
+
+    // compute the decoded block length: ceil(num_dec_bytes / num_blocks)
+    d = div(_dec_msg_len, _q->num_blocks);
+    _q->dec_block_len = d.quot + (d.rem == 0 ? 0 : 1);
+
+    // compute the encoded block length: dec_block_len + nroots
+    _q->enc_block_len = _q->dec_block_len + _q->nroots;
+
+    // compute the residual padding symbols in the last block
+    _q->res_block_len = _q->num_blocks*_q->dec_block_len - _q->num_dec_bytes;
+
+    // compute the final encoded block length: enc_block_len * num_blocks
+    _q->num_enc_bytes = _q->enc_block_len * _q->num_blocks;
+
+#if VERBOSE_FEC_LDPC
+    printf("dec_msg_len     :   %u\n", _q->num_dec_bytes);
+    printf("num_blocks      :   %u\n", _q->num_blocks);
+    printf("dec_block_len   :   %u\n", _q->dec_block_len);
+    printf("enc_block_len   :   %u\n", _q->enc_block_len);
+    printf("res_block_len   :   %u\n", _q->res_block_len);
+    printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
+#endif
+}
+
@@ -32,6 +32,7 @@
 
 #if LIBFEC_ENABLED
 #include "fec.h"
+#endif
 
 fec fec_rs_create(fec_scheme _fs)
 {
@@ -70,7 +71,13 @@ fec fec_rs_create(fec_scheme _fs)
 void fec_rs_destroy(fec _q)
 {
     // delete internal Reed-Solomon decoder object
-    free_rs_char(_q->rs);
+    if (_q->rs != NULL) {
+#if LIBFEC_ENABLED
+        free_rs_char(_q->rs);
+#else
+        reedsolomon_destroy(_q->rs);
+#endif
+    }
 
     // delete internal memory arrays
     free(_q->tblock);
@@ -112,7 +119,11 @@ void fec_rs_encode(fec _q,
         // necessary as these bits are going to be thrown away anyway
 
         // encode data, appending parity bits to end of sequence
+#if LIBFEC_ENABLED
         encode_rs_char(_q->rs, _q->tblock, &_q->tblock[_q->dec_block_len]);
+#else
+        reedsolomon_encode(_q->rs, _q->tblock, &_q->tblock[_q->dec_block_len]);
+#endif
 
         // copy result to output
         memmove(&_msg_enc[n1], _q->tblock, _q->enc_block_len*sizeof(unsigned char));
@@ -143,8 +154,8 @@ void fec_rs_decode(fec _q,
     fec_rs_setlength(_q, _dec_msg_len);
 
     // set erasures, error locations to zero
-    memset(_q->errlocs,  0x00, _q->nn*sizeof(unsigned char));
-    memset(_q->derrlocs, 0x00, _q->nn*sizeof(unsigned char));
+    memset(_q->errlocs,  0x00, _q->nn*sizeof(int));
+    memset(_q->derrlocs, 0x00, _q->nn*sizeof(int));
     _q->erasures = 0;
 
     unsigned int i;
@@ -163,10 +174,17 @@ void fec_rs_decode(fec _q,
 
         // decode block
         //derrors = 
+#if LIBFEC_ENABLED
         decode_rs_char(_q->rs,
                        _q->tblock,
                        _q->derrlocs,
                        _q->erasures);
+#else
+        reedsolomon_decode(_q->rs,
+                           _q->tblock,
+                           _q->derrlocs,
+                           _q->erasures);
+#endif
 
         // copy result
         memmove(&_msg_dec[n1], _q->tblock, block_size*sizeof(unsigned char));
@@ -256,16 +274,30 @@ void fec_rs_setlength(fec _q,
 #endif
 
     // delete old decoder if necessary
-    if (_q->rs != NULL)
+    if (_q->rs != NULL) {
+#if LIBFEC_ENABLED
         free_rs_char(_q->rs);
+#else
+        reedsolomon_destroy(_q->rs);
+#endif
+    }
 
     // Reed-Solomon specific decoding
+#if LIBFEC_ENABLED
     _q->rs = init_rs_char(_q->symsize,
                           _q->genpoly,
                           _q->fcs,
                           _q->prim,
                           _q->nroots,
                           _q->pad);
+#else
+    _q->rs = reedsolomon_create(_q->symsize,
+                                _q->genpoly,
+                                _q->fcs,
+                                _q->prim,
+                                _q->nroots,
+                                _q->pad);
+#endif
 }
 
 // 
@@ -281,31 +313,3 @@ void fec_rs_init_p8(fec _q)
     _q->nroots = 32;
 }
 
-#else   // LIBFEC_ENABLED
-
-fec fec_rs_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_rs_destroy(fec _q)
-{
-}
-
-void fec_rs_encode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_dec,
-                   unsigned char *_msg_enc)
-{
-}
-
-//unsigned int
-void fec_rs_decode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_enc,
-                   unsigned char *_msg_dec)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
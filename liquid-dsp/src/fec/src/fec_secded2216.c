@@ -61,41 +61,16 @@ unsigned char secded2216_syndrome_w1[22] = {
 // compute parity on 16-bit input
 unsigned char fec_secded2216_compute_parity(unsigned char * _m)
 {
-    // compute encoded/transmitted message: v = m*G
-    unsigned char parity = 0x00;
-
-    // TODO : unwrap this loop
-    unsigned int i;
-    for (i=0; i<6; i++) {
-        parity <<= 1;
-
-        unsigned int p = liquid_c_ones[ secded2216_P[2*i+0] & _m[0] ] +
-                         liquid_c_ones[ secded2216_P[2*i+1] & _m[1] ];
-
-        parity |= p & 0x01;
-    }
-
-    return parity;
+    // exclusive-or of parity contributions of each message byte
+    return secded2216_syndrome_gentab[0][_m[0]] ^
+           secded2216_syndrome_gentab[1][_m[1]];
 }
 
 // compute syndrome on 22-bit input
 unsigned char fec_secded2216_compute_syndrome(unsigned char * _v)
 {
-    // TODO : unwrap this loop
-    unsigned int i;
-    unsigned char syndrome = 0x00;
-    for (i=0; i<6; i++) {
-        syndrome <<= 1;
-
-        unsigned int p =
-            ( (_v[0] & (1<<(6-i-1))) ? 1 : 0 )+
-            liquid_c_ones[ secded2216_P[2*i+0] & _v[1] ] +
-            liquid_c_ones[ secded2216_P[2*i+1] & _v[2] ];
-
-        syndrome |= p & 0x01;
-    }
-
-    return syndrome;
+    // received parity bits plus parity of received message bytes
+    return (_v[0] & 0x3f) ^ fec_secded2216_compute_parity(&_v[1]);
 }
 
 // encode symbol
@@ -163,32 +138,55 @@ int fec_secded2216_estimate_ehat(unsigned char * _sym_enc,
     // compute syndrome vector, s = r*H^T = ( H*r^T )^T
     unsigned char s = fec_secded2216_compute_syndrome(_sym_enc);
 
-    // compute weight of s
-    unsigned int ws = liquid_c_ones[s];
-    
-    if (ws == 0) {
+    if (s == 0) {
         // no errors detected
         return 0;
-    } else {
-        // estimate error location; search for syndrome with error
-        // vector of weight one
-
-        unsigned int n;
-        // estimate error location
-        for (n=0; n<22; n++) {
-            if (s == secded2216_syndrome_w1[n]) {
-                // single error detected at location 'n'
-                div_t d = div(n,8);
-                _e_hat[3-d.quot-1] = 1 << d.rem;
-
-                return 1;
-            }
-        }
+    }
 
+    // look up location of error vector of weight one with matching
+    // syndrome
+    unsigned int n = secded2216_ehat_gentab[s];
+    if (n == 0xff) {
+        // no syndrome match; multiple errors detected
+        return 2;
     }
 
-    // no syndrome match; multiple errors detected
-    return 2;
+    // single error detected at location 'n'
+    _e_hat[3-(n>>3)-1] = 1 << (n & 7);
+    return 1;
+}
+
+// decode array of encoded symbols, returning the number of symbols
+// for which multiple errors were detected
+//  _msg_enc    :   encoded message [size: 3*_n x 1]
+//  _n          :   number of symbols
+//  _msg_dec    :   decoded message [size: 2*_n x 1]
+unsigned int fec_secded2216_decode_array(unsigned char * _msg_enc,
+                                         unsigned int    _n,
+                                         unsigned char * _msg_dec)
+{
+    unsigned int num_errors = 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned char * v = &_msg_enc[3*i];
+        unsigned char * m = &_msg_dec[2*i];
+
+        // copy message bytes and compute syndrome
+        memmove(m, &v[1], 2*sizeof(unsigned char));
+        unsigned char s = fec_secded2216_compute_syndrome(v);
+        if (s == 0)
+            continue;
+
+        // correct single error in message bytes (errors in parity
+        // bits require no correction)
+        unsigned int n = secded2216_ehat_gentab[s];
+        if (n == 0xff)
+            num_errors++;
+        else if (n < 16)
+            m[2-(n>>3)-1] ^= 1 << (n & 7);
+    }
+
+    return num_errors;
 }
 
 // create SEC-DED (22,16) codec object
@@ -291,12 +289,10 @@ void fec_secded2216_decode(fec _q,
     // determine remainder of input length / 8
     unsigned int r = _dec_msg_len % 2;
 
-    for (i=0; i<_dec_msg_len-r; i+=2) {
-        // decode straight to output
-        fec_secded2216_decode_symbol(&_msg_enc[j], &_msg_dec[i]);
-
-        j += 3;
-    }
+    // decode full symbols directly to output
+    fec_secded2216_decode_array(_msg_enc, _dec_msg_len / 2, _msg_dec);
+    i = _dec_msg_len - r;
+    j = 3*(i / 2);
 
     // if input length isn't divisible by 2, decode last several bytes
     if (r) {
@@ -68,45 +68,18 @@ unsigned char secded3932_syndrome_w1[39] = {
 // compute parity on 32-bit input
 unsigned char fec_secded3932_compute_parity(unsigned char * _m)
 {
-    // compute encoded/transmitted message: v = m*G
-    unsigned char parity = 0x00;
-
-    // TODO : unwrap this loop
-    unsigned int i;
-    for (i=0; i<7; i++) {
-        parity <<= 1;
-
-        unsigned int p = liquid_c_ones[ secded3932_P[4*i+0] & _m[0] ] +
-                         liquid_c_ones[ secded3932_P[4*i+1] & _m[1] ] +
-                         liquid_c_ones[ secded3932_P[4*i+2] & _m[2] ] +
-                         liquid_c_ones[ secded3932_P[4*i+3] & _m[3] ];
-
-        parity |= p & 0x01;
-    }
-
-    return parity;
+    // exclusive-or of parity contributions of each message byte
+    return secded3932_syndrome_gentab[0][_m[0]] ^
+           secded3932_syndrome_gentab[1][_m[1]] ^
+           secded3932_syndrome_gentab[2][_m[2]] ^
+           secded3932_syndrome_gentab[3][_m[3]];
 }
 
 // compute syndrome on 39-bit input
 unsigned char fec_secded3932_compute_syndrome(unsigned char * _v)
 {
-    // TODO : unwrap this loop
-    unsigned int i;
-    unsigned char syndrome = 0x00;
-    for (i=0; i<7; i++) {
-        syndrome <<= 1;
-
-        unsigned int p =
-            ( (_v[0] & (1<<(7-i-1))) ? 1 : 0 )+
-            liquid_c_ones[ secded3932_P[4*i+0] & _v[1] ] +
-            liquid_c_ones[ secded3932_P[4*i+1] & _v[2] ] +
-            liquid_c_ones[ secded3932_P[4*i+2] & _v[3] ] +
-            liquid_c_ones[ secded3932_P[4*i+3] & _v[4] ];
-
-        syndrome |= p & 0x01;
-    }
-
-    return syndrome;
+    // received parity bits plus parity of received message bytes
+    return (_v[0] & 0x7f) ^ fec_secded3932_compute_parity(&_v[1]);
 }
 
 // encode symbol
@@ -179,32 +152,55 @@ int fec_secded3932_estimate_ehat(unsigned char * _sym_enc,
     // compute syndrome vector, s = r*H^T = ( H*r^T )^T
     unsigned char s = fec_secded3932_compute_syndrome(_sym_enc);
 
-    // compute weight of s
-    unsigned int ws = liquid_c_ones[s];
-    
-    if (ws == 0) {
+    if (s == 0) {
         // no errors detected
         return 0;
-    } else {
-        // estimate error location; search for syndrome with error
-        // vector of weight one
+    }
 
-        unsigned int n;
-        // estimate error location
-        for (n=0; n<39; n++) {
-            if (s == secded3932_syndrome_w1[n]) {
-                // single error detected at location 'n'
-                div_t d = div(n,8);
-                _e_hat[5-d.quot-1] = 1 << d.rem;
+    // look up location of error vector of weight one with matching
+    // syndrome
+    unsigned int n = secded3932_ehat_gentab[s];
+    if (n == 0xff) {
+        // no syndrome match; multiple errors detected
+        return 2;
+    }
 
-                return 1;
-            }
-        }
+    // single error detected at location 'n'
+    _e_hat[5-(n>>3)-1] = 1 << (n & 7);
+    return 1;
+}
 
+// decode array of encoded symbols, returning the number of symbols
+// for which multiple errors were detected
+//  _msg_enc    :   encoded message [size: 5*_n x 1]
+//  _n          :   number of symbols
+//  _msg_dec    :   decoded message [size: 4*_n x 1]
+unsigned int fec_secded3932_decode_array(unsigned char * _msg_enc,
+                                         unsigned int    _n,
+                                         unsigned char * _msg_dec)
+{
+    unsigned int num_errors = 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned char * v = &_msg_enc[5*i];
+        unsigned char * m = &_msg_dec[4*i];
+
+        // copy message bytes and compute syndrome
+        memmove(m, &v[1], 4*sizeof(unsigned char));
+        unsigned char s = fec_secded3932_compute_syndrome(v);
+        if (s == 0)
+            continue;
+
+        // correct single error in message bytes (errors in parity
+        // bits require no correction)
+        unsigned int n = secded3932_ehat_gentab[s];
+        if (n == 0xff)
+            num_errors++;
+        else if (n < 32)
+            m[4-(n>>3)-1] ^= 1 << (n & 7);
     }
 
-    // no syndrome match; multiple errors detected
-    return 2;
+    return num_errors;
 }
 
 // create SEC-DED (39,32) codec object
@@ -313,12 +309,10 @@ void fec_secded3932_decode(fec _q,
     // determine remainder of input length / 4
     unsigned int r = _dec_msg_len % 4;
 
-    for (i=0; i<_dec_msg_len-r; i+=4) {
-        // decode straight to output
-        fec_secded3932_decode_symbol(&_msg_enc[j], &_msg_dec[i]);
-
-        j += 5;
-    }
+    // decode full symbols directly to output
+    fec_secded3932_decode_array(_msg_enc, _dec_msg_len / 4, _msg_dec);
+    i = _dec_msg_len - r;
+    j = 5*(i / 4);
 
     // if input length isn't divisible by 4, decode last several bytes
     if (r) {
@@ -69,53 +69,22 @@ unsigned char secded7264_syndrome_w1[72] = {
 // compute parity byte on 64-byte input
 unsigned char fec_secded7264_compute_parity(unsigned char * _v)
 {
-    // compute parity byte on message
-    unsigned int i;
-    unsigned char parity = 0x00;
-    for (i=0; i<8; i++) {
-        parity <<= 1;
-
-        unsigned int p = liquid_c_ones[ secded7264_P[8*i+0] & _v[0] ] +
-                         liquid_c_ones[ secded7264_P[8*i+1] & _v[1] ] +
-                         liquid_c_ones[ secded7264_P[8*i+2] & _v[2] ] +
-                         liquid_c_ones[ secded7264_P[8*i+3] & _v[3] ] +
-                         liquid_c_ones[ secded7264_P[8*i+4] & _v[4] ] +
-                         liquid_c_ones[ secded7264_P[8*i+5] & _v[5] ] +
-                         liquid_c_ones[ secded7264_P[8*i+6] & _v[6] ] +
-                         liquid_c_ones[ secded7264_P[8*i+7] & _v[7] ];
-
-        parity |= p & 0x01;
-    }
-
-    // return parity byte
-    return parity;
+    // exclusive-or of parity contributions of each message byte
+    return secded7264_syndrome_gentab[0][_v[0]] ^
+           secded7264_syndrome_gentab[1][_v[1]] ^
+           secded7264_syndrome_gentab[2][_v[2]] ^
+           secded7264_syndrome_gentab[3][_v[3]] ^
+           secded7264_syndrome_gentab[4][_v[4]] ^
+           secded7264_syndrome_gentab[5][_v[5]] ^
+           secded7264_syndrome_gentab[6][_v[6]] ^
+           secded7264_syndrome_gentab[7][_v[7]];
 }
 
 // compute syndrome on 72-bit input
 unsigned char fec_secded7264_compute_syndrome(unsigned char * _v)
 {
-    // TODO : unwrap this loop
-    unsigned int i;
-    unsigned char syndrome = 0x00;
-    for (i=0; i<8; i++) {
-        syndrome <<= 1;
-
-        // compute parity bit
-        unsigned int p =
-            ( (_v[0] & (1<<(8-i-1))) ? 1 : 0 ) +
-            liquid_c_ones[ secded7264_P[8*i+0] & _v[1] ] +
-            liquid_c_ones[ secded7264_P[8*i+1] & _v[2] ] +
-            liquid_c_ones[ secded7264_P[8*i+2] & _v[3] ] +
-            liquid_c_ones[ secded7264_P[8*i+3] & _v[4] ] +
-            liquid_c_ones[ secded7264_P[8*i+4] & _v[5] ] +
-            liquid_c_ones[ secded7264_P[8*i+5] & _v[6] ] +
-            liquid_c_ones[ secded7264_P[8*i+6] & _v[7] ] +
-            liquid_c_ones[ secded7264_P[8*i+7] & _v[8] ];
-
-        syndrome |= p & 0x01;
-    }
-
-    return syndrome;
+    // received parity bits plus parity of received message bytes
+    return _v[0] ^ fec_secded7264_compute_parity(&_v[1]);
 }
 
 void fec_secded7264_encode_symbol(unsigned char * _sym_dec,
@@ -182,32 +151,55 @@ int fec_secded7264_estimate_ehat(unsigned char * _sym_enc,
     // compute syndrome vector, s = r*H^T = ( H*r^T )^T
     unsigned char s = fec_secded7264_compute_syndrome(_sym_enc);
 
-    // compute weight of s
-    unsigned int ws = liquid_c_ones[s];
-    
-    if (ws == 0) {
+    if (s == 0) {
         // no errors detected
         return 0;
-    } else {
-        // estimate error location; search for syndrome with error
-        // vector of weight one
+    }
 
-        unsigned int n;
-        // estimate error location
-        for (n=0; n<72; n++) {
-            if (s == secded7264_syndrome_w1[n]) {
-                // single error detected at location 'n'
-                div_t d = div(n,8);
-                _e_hat[9-d.quot-1] = 1 << d.rem;
+    // look up location of error vector of weight one with matching
+    // syndrome
+    unsigned int n = secded7264_ehat_gentab[s];
+    if (n == 0xff) {
+        // no syndrome match; multiple errors detected
+        return 2;
+    }
 
-                return 1;
-            }
-        }
+    // single error detected at location 'n'
+    _e_hat[9-(n>>3)-1] = 1 << (n & 7);
+    return 1;
+}
 
+// decode array of encoded symbols, returning the number of symbols
+// for which multiple errors were detected
+//  _msg_enc    :   encoded message [size: 9*_n x 1]
+//  _n          :   number of symbols
+//  _msg_dec    :   decoded message [size: 8*_n x 1]
+unsigned int fec_secded7264_decode_array(unsigned char * _msg_enc,
+                                         unsigned int    _n,
+                                         unsigned char * _msg_dec)
+{
+    unsigned int num_errors = 0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned char * v = &_msg_enc[9*i];
+        unsigned char * m = &_msg_dec[8*i];
+
+        // copy message bytes and compute syndrome
+        memmove(m, &v[1], 8*sizeof(unsigned char));
+        unsigned char s = fec_secded7264_compute_syndrome(v);
+        if (s == 0)
+            continue;
+
+        // correct single error in message bytes (errors in parity
+        // bits require no correction)
+        unsigned int n = secded7264_ehat_gentab[s];
+        if (n == 0xff)
+            num_errors++;
+        else if (n < 64)
+            m[8-(n>>3)-1] ^= 1 << (n & 7);
     }
 
-    // no syndrome match; multiple errors detected
-    return 2;
+    return num_errors;
 }
 
 // create SEC-DED (72,64) codec object
@@ -303,12 +295,10 @@ void fec_secded7264_decode(fec _q,
     // determine remainder of input length / 8
     unsigned int r = _dec_msg_len % 8;
 
-    for (i=0; i<_dec_msg_len-r; i+=8) {
-        // decode nine input bytes
-        fec_secded7264_decode_symbol(&_msg_enc[j], &_msg_dec[i]);
-
-        j += 9;
-    }
+    // decode full symbols directly to output
+    fec_secded7264_decode_array(_msg_enc, _dec_msg_len / 8, _msg_dec);
+    i = _dec_msg_len - r;
+    j = 9*(i / 8);
 
 
     // if input length isn't divisible by 8, decode last several bytes
@@ -30,37 +30,6 @@
 
 #include "liquid.internal.h"
 
-// 
-// internal methods
-//
-
-// permute one iteration
-void interleaver_permute(unsigned char * _x,
-                         unsigned int    _n,
-                         unsigned int    _M,
-                         unsigned int    _N);
-
-// permute one iteration (soft bit input)
-void interleaver_permute_soft(unsigned char * _x,
-                              unsigned int    _n,
-                              unsigned int    _M,
-                              unsigned int    _N);
-
-// permute one iteration with mask
-void interleaver_permute_mask(unsigned char * _x,
-                              unsigned int    _n,
-                              unsigned int    _M,
-                              unsigned int    _N,
-                              unsigned char   _mask);
-
-// permute one iteration (soft bit input) with mask
-void interleaver_permute_mask_soft(unsigned char * _x,
-                                   unsigned int    _n,
-                                   unsigned int    _M,
-                                   unsigned int    _N,
-                                   unsigned char   _mask);
-
-
 // structured interleaver object
 struct interleaver_s {
     unsigned int n;     // number of bytes
@@ -70,6 +39,11 @@ struct interleaver_s {
 
     // interleaving depth (number of permutations)
     unsigned int depth;
+
+    // composite permutation: source byte index of each bit position
+    // (all passes preserve the position of a bit within its byte)
+    unsigned int * enc_index;   // output bit from input [size: 8n x 1]
+    unsigned int * dec_index;   // inverse permutation [size: 8n x 1]
 };
 
 // create interleaver of length _n input/output bytes
@@ -87,12 +61,21 @@ interleaver interleaver_create(unsigned int _n)
     q->N = q->n / q->M;
     while (q->n >= (q->M*q->N)) q->N++;  // ensures M*N >= n
 
+    // compute composite permutation tables
+    q->enc_index = (unsigned int*) malloc(8*q->n*sizeof(unsigned int));
+    q->dec_index = (unsigned int*) malloc(8*q->n*sizeof(unsigned int));
+    interleaver_compute_index(q);
+
     return q;
 }
 
 // destroy interleaver object
 void interleaver_destroy(interleaver _q)
 {
+    // free permutation tables
+    free(_q->enc_index);
+    free(_q->dec_index);
+
     // free main object memory
     free(_q);
 }
@@ -110,7 +93,72 @@ void interleaver_print(interleaver _q)
 void interleaver_set_depth(interleaver  _q,
                            unsigned int _depth)
 {
+    if (_depth == _q->depth)
+        return;
+
     _q->depth = _depth;
+    interleaver_compute_index(_q);
+}
+
+// compute composite permutation tables by replaying the swaps of each
+// permutation pass on bit-position indices
+void interleaver_compute_index(interleaver _q)
+{
+    unsigned int i;
+    unsigned int k;
+    for (i=0; i<_q->n; i++) {
+        for (k=0; k<8; k++)
+            _q->enc_index[8*i+k] = i;
+    }
+
+    if (_q->depth > 0) interleaver_permute_index(_q->enc_index, _q->n, _q->M, _q->N,   0xff);
+    if (_q->depth > 1) interleaver_permute_index(_q->enc_index, _q->n, _q->M, _q->N+2, 0x0f);
+    if (_q->depth > 2) interleaver_permute_index(_q->enc_index, _q->n, _q->M, _q->N+4, 0x55);
+    if (_q->depth > 3) interleaver_permute_index(_q->enc_index, _q->n, _q->M, _q->N+8, 0x33);
+
+    // invert
+    for (i=0; i<_q->n; i++) {
+        for (k=0; k<8; k++)
+            _q->dec_index[8*_q->enc_index[8*i+k]+k] = i;
+    }
+}
+
+// permute bytes using composite table (single gather pass)
+//  _index  :   source byte of each bit position [size: 8*_n x 1]
+//  _x      :   input bytes [size: _n x 1]
+//  _y      :   output bytes [size: _n x 1]
+//  _n      :   number of bytes
+static void interleaver_gather(unsigned int *  _index,
+                               unsigned char * _x,
+                               unsigned char * _y,
+                               unsigned int    _n)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        unsigned int * s = &_index[8*i];
+        _y[i] = (_x[s[0]] & 0x80) | (_x[s[1]] & 0x40) |
+                (_x[s[2]] & 0x20) | (_x[s[3]] & 0x10) |
+                (_x[s[4]] & 0x08) | (_x[s[5]] & 0x04) |
+                (_x[s[6]] & 0x02) | (_x[s[7]] & 0x01);
+    }
+}
+
+// permute soft bits using composite table (single gather pass)
+//  _index  :   source byte of each bit position [size: 8*_n x 1]
+//  _x      :   input soft bits [size: 8*_n x 1]
+//  _y      :   output soft bits [size: 8*_n x 1]
+//  _n      :   number of bytes
+static void interleaver_gather_soft(unsigned int *  _index,
+                                    unsigned char * _x,
+                                    unsigned char * _y,
+                                    unsigned int    _n)
+{
+    unsigned int i;
+    unsigned int k;
+    for (i=0; i<8*_n; i+=8) {
+        for (k=0; k<8; k++)
+            _y[i+k] = _x[8*_index[i+k] + k];
+    }
 }
 
 // execute forward interleaver (encoder)
@@ -121,7 +169,13 @@ void interleaver_encode(interleaver _q,
                         unsigned char * _msg_dec,
                         unsigned char * _msg_enc)
 {
-    // copy data to output
+    // single pass using composite permutation table
+    if (_msg_dec != _msg_enc) {
+        interleaver_gather(_q->enc_index, _msg_dec, _msg_enc, _q->n);
+        return;
+    }
+
+    // in-place: run each permutation pass
     memmove(_msg_enc, _msg_dec, _q->n);
 
     if (_q->depth > 0) interleaver_permute(_msg_enc, _q->n, _q->M, _q->N);
@@ -138,7 +192,13 @@ void interleaver_encode_soft(interleaver _q,
                              unsigned char * _msg_dec,
                              unsigned char * _msg_enc)
 {
-    // copy data to output
+    // single pass using composite permutation table
+    if (_msg_dec != _msg_enc) {
+        interleaver_gather_soft(_q->enc_index, _msg_dec, _msg_enc, _q->n);
+        return;
+    }
+
+    // in-place: run each permutation pass
     memmove(_msg_enc, _msg_dec, 8*_q->n);
 
     if (_q->depth > 0) interleaver_permute_soft(_msg_enc, _q->n, _q->M, _q->N);
@@ -155,7 +215,13 @@ void interleaver_decode(interleaver _q,
                         unsigned char * _msg_enc,
                         unsigned char * _msg_dec)
 {
-    // copy data to output
+    // single pass using composite permutation table
+    if (_msg_enc != _msg_dec) {
+        interleaver_gather(_q->dec_index, _msg_enc, _msg_dec, _q->n);
+        return;
+    }
+
+    // in-place: run each permutation pass
     memmove(_msg_dec, _msg_enc, _q->n);
 
     if (_q->depth > 3) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
@@ -172,7 +238,13 @@ void interleaver_decode_soft(interleaver _q,
                              unsigned char * _msg_enc,
                              unsigned char * _msg_dec)
 {
-    // copy data to output
+    // single pass using composite permutation table
+    if (_msg_enc != _msg_dec) {
+        interleaver_gather_soft(_q->dec_index, _msg_enc, _msg_dec, _q->n);
+        return;
+    }
+
+    // in-place: run each permutation pass
     memmove(_msg_dec, _msg_enc, 8*_q->n);
 
     if (_q->depth > 3) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
@@ -317,3 +389,39 @@ void interleaver_permute_mask_soft(unsigned char * _x,
     //printf("\n");
 }
 
+// permute one iteration on bit-position indices with mask (used to
+// build composite permutation tables; see interleaver_permute_mask)
+void interleaver_permute_index(unsigned int * _x,
+                               unsigned int   _n,
+                               unsigned int   _M,
+                               unsigned int   _N,
+                               unsigned char  _mask)
+{
+    unsigned int i;
+    unsigned int j;
+    unsigned int k;
+    unsigned int m=0;
+    unsigned int n=_n/3;
+    unsigned int n2=_n/2;
+    unsigned int tmp;
+    for (i=0; i<n2; i++) {
+        do {
+            j = m*_N + n; // output
+            m++;
+            if (m == _M) {
+                n = (n+1) % (_N);
+                m=0;
+            }
+        } while (j>=n2);
+
+        // swap indices matching the mask
+        for (k=0; k<8; k++) {
+            if ( (_mask >> (8-k-1)) & 0x01 ) {
+                tmp = _x[8*(2*j+1)+k];
+                _x[8*(2*j+1)+k] = _x[8*(2*i+0)+k];
+                _x[8*(2*i+0)+k] = tmp;
+            }
+        }
+    }
+}
+
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// ldpc.c
+//
+// Layered normalized min-sum decoder for low-density parity check
+// codes. The row lists of the sparse parity check matrix are copied
+// into a single compressed-row edge array so that each check node
+// update walks contiguous memory. Check nodes are processed one row
+// at a time, updating the posterior log-likelihood ratios in place
+// (layered schedule), which roughly halves the number of iterations
+// needed relative to the flooding schedule of fec_sumproduct().
+//
+// Log-likelihood ratios follow the same convention as
+// fec_sumproduct(): positive values favor a '0' bit.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+#define DEBUG_LDPC 0
+
+// default normalization factor for min-sum check node messages
+#define LDPC_MINSUM_SCALE   (0.75f)
+
+// create LDPC decoder from sparse parity check matrix
+//  _H      :   sparse binary parity check matrix [size: M x N]
+ldpc ldpc_create(smatrixb _H)
+{
+    ldpc q = (ldpc) malloc(sizeof(struct ldpc_s));
+    smatrixb_size(_H, &q->M, &q->N);
+
+    // validate input
+    if (q->M == 0 || q->N == 0) {
+        fprintf(stderr,"error: ldpc_create(), matrix dimensions cannot be zero\n");
+        exit(1);
+    }
+
+    // count edges and find maximum row weight
+    unsigned int idx[q->N];
+    unsigned int i;
+    q->num_edges      = 0;
+    q->max_row_weight = 0;
+    for (i=0; i<q->M; i++) {
+        unsigned int w = smatrixb_get_row_indices(_H, i, idx);
+        q->num_edges += w;
+        if (w > q->max_row_weight)
+            q->max_row_weight = w;
+    }
+
+    // copy row lists into compressed-row arrays
+    q->row_ptr = (unsigned int*) malloc((q->M+1)*sizeof(unsigned int));
+    q->col_idx = (unsigned int*) malloc(q->num_edges*sizeof(unsigned int));
+    q->row_ptr[0] = 0;
+    for (i=0; i<q->M; i++) {
+        unsigned int w = smatrixb_get_row_indices(_H, i, &q->col_idx[q->row_ptr[i]]);
+        q->row_ptr[i+1] = q->row_ptr[i] + w;
+    }
+
+    // allocate message arrays
+    q->R = (float*) malloc(q->num_edges*sizeof(float));
+    q->L = (float*) malloc(q->N*sizeof(float));
+    q->t = (float*) malloc((q->max_row_weight > 0 ? q->max_row_weight : 1)*sizeof(float));
+
+    q->scale          = LDPC_MINSUM_SCALE;
+    q->num_iterations = 0;
+    return q;
+}
+
+// destroy LDPC decoder object
+void ldpc_destroy(ldpc _q)
+{
+    free(_q->row_ptr);
+    free(_q->col_idx);
+    free(_q->R);
+    free(_q->L);
+    free(_q->t);
+    free(_q);
+}
+
+// run parity check on hard-decision codeword, returning 1 if all
+// checks pass, 0 otherwise
+//  _q      :   LDPC decoder object
+//  _c      :   codeword bits [size: N x 1]
+int ldpc_check(ldpc            _q,
+               unsigned char * _c)
+{
+    unsigned int i;
+    unsigned int e;
+    for (i=0; i<_q->M; i++) {
+        unsigned char p = 0;
+        for (e=_q->row_ptr[i]; e<_q->row_ptr[i+1]; e++)
+            p ^= _c[_q->col_idx[e]];
+        if (p & 1)
+            return 0;
+    }
+    return 1;
+}
+
+// decode received codeword, returning 1 if parity checks, 0 otherwise
+//  _q              :   LDPC decoder object
+//  _LLR            :   channel log-likelihood ratios [size: N x 1]
+//  _c_hat          :   estimated transmitted codeword [size: N x 1]
+//  _max_iterations :   maximum number of iterations before bailing
+int ldpc_decode(ldpc            _q,
+                float *         _LLR,
+                unsigned char * _c_hat,
+                unsigned int    _max_iterations)
+{
+    unsigned int i;
+    unsigned int e;
+    unsigned int n;
+
+    // initialize posteriors with channel values, clear messages
+    memmove(_q->L, _LLR, _q->N*sizeof(float));
+    memset(_q->R, 0x00, _q->num_edges*sizeof(float));
+
+    // early exit: received hard decisions already satisfy all checks
+    for (n=0; n<_q->N; n++)
+        _c_hat[n] = _q->L[n] < 0.0f ? 1 : 0;
+    _q->num_iterations = 0;
+    int parity_pass = ldpc_check(_q, _c_hat);
+
+    while (!parity_pass && _q->num_iterations < _max_iterations) {
+        // layered update: one check node (row) at a time
+        for (i=0; i<_q->M; i++) {
+            unsigned int e0 = _q->row_ptr[i];
+            unsigned int w  = _q->row_ptr[i+1] - e0;
+            if (w < 2)
+                continue;   // no extrinsic information
+            unsigned int * col = &_q->col_idx[e0];
+            float * R = &_q->R[e0];
+
+            // variable-to-check messages: remove this row's previous
+            // contribution; track two smallest magnitudes and sign
+            float min1 = INFINITY;
+            float min2 = INFINITY;
+            unsigned int imin = 0;
+            unsigned int sign = 0;
+            for (e=0; e<w; e++) {
+                float t = _q->L[col[e]] - R[e];
+                _q->t[e] = t;
+                sign ^= t < 0.0f;
+
+                float a = fabsf(t);
+                if (a < min1) {
+                    min2 = min1;
+                    min1 = a;
+                    imin = e;
+                } else if (a < min2) {
+                    min2 = a;
+                }
+            }
+            min1 *= _q->scale;
+            min2 *= _q->scale;
+
+            // check-to-variable messages and posterior update
+            for (e=0; e<w; e++) {
+                float r = (e == imin) ? min2 : min1;
+                r = ((_q->t[e] < 0.0f) ^ sign) ? -r : r;
+                R[e] = r;
+                _q->L[col[e]] = _q->t[e] + r;
+            }
+        }
+        _q->num_iterations++;
+
+        // hard decision and parity check
+        for (n=0; n<_q->N; n++)
+            _c_hat[n] = _q->L[n] < 0.0f ? 1 : 0;
+        parity_pass = ldpc_check(_q, _c_hat);
+
+#if DEBUG_LDPC
+        printf("  ldpc iteration %3u : %s\n", _q->num_iterations, parity_pass ? "pass" : "fail");
+#endif
+    }
+
+    return parity_pass;
+}
+
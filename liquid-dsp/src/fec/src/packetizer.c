@@ -27,9 +27,18 @@
 
 #include "liquid.internal.h"
 
+// block size for combined copy/crc (bytes)
+#define PACKETIZER_COPY_BLOCK_LEN (1024)
+
 // reallocate memory for buffers
 void packetizer_realloc_buffers(packetizer _p, unsigned int _len);
 
+// copy message and compute its error-detection key
+unsigned int packetizer_copy_key(crc_scheme      _check,
+                                 unsigned char * _dst,
+                                 unsigned char * _src,
+                                 unsigned int    _n);
+
 // computes the number of encoded bytes after packetizing
 //
 //  _n      :   number of uncoded input bytes
@@ -232,11 +241,10 @@ void packetizer_encode(packetizer _p,
 {
     unsigned int i;
 
-    // copy input message to internal buffer[0]
-    memmove(_p->buffer_0, _msg, _p->msg_len);
+    // copy input message to internal buffer[0], computing crc
+    unsigned int key = packetizer_copy_key(_p->check, _p->buffer_0, _msg, _p->msg_len);
 
-    // compute crc, append to buffer
-    unsigned int key = crc_generate_key(_p->check, _p->buffer_0, _p->msg_len);
+    // append crc to buffer
     for (i=0; i<_p->crc_length; i++) {
         // append byte to buffer
         _p->buffer_0[_p->msg_len+_p->crc_length-i-1] = key & 0xff;
@@ -299,14 +307,11 @@ int packetizer_decode(packetizer _p,
         key |= _p->buffer_0[_p->msg_len+i];
     }
 
-    // copy result to output
-    memmove(_msg, _p->buffer_0, _p->msg_len);
+    // copy result to output, computing crc
+    unsigned int key_rx = packetizer_copy_key(_p->check, _msg, _p->buffer_0, _p->msg_len);
 
     // return crc validity
-    return crc_validate_message(_p->check,
-                                _p->buffer_0,
-                                _p->msg_len,
-                                key);
+    return _p->check == LIQUID_CRC_NONE || key_rx == key;
 }
 
 // Execute the packetizer to decode an input message, return validity
@@ -361,14 +366,11 @@ int packetizer_decode_soft(packetizer _p,
         key |= _p->buffer_0[_p->msg_len+i];
     }
 
-    // copy result to output
-    memmove(_msg, _p->buffer_0, _p->msg_len);
+    // copy result to output, computing crc
+    unsigned int key_rx = packetizer_copy_key(_p->check, _msg, _p->buffer_0, _p->msg_len);
 
     // return crc validity
-    return crc_validate_message(_p->check,
-                                _p->buffer_0,
-                                _p->msg_len,
-                                key);
+    return _p->check == LIQUID_CRC_NONE || key_rx == key;
 }
 
 void packetizer_set_scheme(packetizer _p, int _fec0, int _fec1)
@@ -380,6 +382,33 @@ void packetizer_set_scheme(packetizer _p, int _fec0, int _fec1)
 // internal methods
 //
 
+// copy message and compute its error-detection key in a single pass,
+// working in blocks small enough that the crc reads each block from
+// cache immediately after it has been copied
+//  _check  :   error-detection scheme
+//  _dst    :   destination buffer [size: _n x 1]
+//  _src    :   source buffer [size: _n x 1]
+//  _n      :   message length
+unsigned int packetizer_copy_key(crc_scheme      _check,
+                                 unsigned char * _dst,
+                                 unsigned char * _src,
+                                 unsigned int    _n)
+{
+    if (_check == LIQUID_CRC_NONE) {
+        memmove(_dst, _src, _n);
+        return 0;
+    }
+
+    unsigned int state = crc_init(_check);
+    unsigned int i;
+    for (i=0; i<_n; i+=PACKETIZER_COPY_BLOCK_LEN) {
+        unsigned int len = _n - i < PACKETIZER_COPY_BLOCK_LEN ? _n - i : PACKETIZER_COPY_BLOCK_LEN;
+        memmove(&_dst[i], &_src[i], len);
+        state = crc_update(_check, state, &_dst[i], len);
+    }
+    return crc_finalize(_check, state);
+}
+
 void packetizer_realloc_buffers(packetizer _p, unsigned int _len)
 {
     _p->buffer_len = _len;
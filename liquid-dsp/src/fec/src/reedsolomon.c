@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Reed-Solomon codec over GF(2^m), m <= 8
+//
+// Used for Reed-Solomon codes when libfec is not available; the
+// interface matches libfec's init_rs_char(), encode_rs_char(),
+// decode_rs_char() and free_rs_char() so that codewords (including
+// shortened blocks with implicit leading zeros) are interchangeable.
+//
+// The systematic encoder divides by the generator polynomial with a
+// table of feedback products: each input symbol XORs one row of the
+// table into a sliding parity window, eight symbols at a time. The
+// decoder re-encodes the received message and compares the parity;
+// only if they differ are the syndromes computed (from the remainder,
+// not the full codeword) and errors located with Berlekamp-Massey,
+// Chien search and Forney's algorithm.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// multiply field elements
+static unsigned char reedsolomon_mul(reedsolomon   _q,
+                                     unsigned char _a,
+                                     unsigned char _b)
+{
+    if (_a == 0 || _b == 0)
+        return 0;
+    return _q->alpha_to[_q->index_of[_a] + _q->index_of[_b]];
+}
+
+// create codec
+//  _symsize    :   bits per symbol, 2 <= _symsize <= 8
+//  _gfpoly     :   primitive polynomial of field
+//  _fcr        :   first consecutive root of generator, index form
+//  _prim       :   primitive element used to generate roots, index form
+//  _nroots     :   number of parity symbols
+//  _pad        :   number of implicit leading zeros (shortened code)
+void * reedsolomon_create(int _symsize,
+                          int _gfpoly,
+                          int _fcr,
+                          int _prim,
+                          int _nroots,
+                          int _pad)
+{
+    // validate input
+    if (_symsize < 2 || _symsize > 8) {
+        fprintf(stderr,"error: reedsolomon_create(), symbol size must be in [2,8]\n");
+        exit(1);
+    }
+    int nn = (1 << _symsize) - 1;
+    if (_fcr < 0 || _fcr >= nn+1) {
+        fprintf(stderr,"error: reedsolomon_create(), first root must be in [0,%d]\n", nn);
+        exit(1);
+    } else if (_prim <= 0 || _prim >= nn+1) {
+        fprintf(stderr,"error: reedsolomon_create(), primitive element must be in [1,%d]\n", nn);
+        exit(1);
+    } else if (_nroots < 1 || _nroots >= nn) {
+        fprintf(stderr,"error: reedsolomon_create(), number of roots must be in [1,%d]\n", nn-1);
+        exit(1);
+    } else if (_pad < 0 || _pad >= nn - _nroots) {
+        fprintf(stderr,"error: reedsolomon_create(), padding must be in [0,%d]\n", nn-_nroots-1);
+        exit(1);
+    }
+
+    reedsolomon q = (reedsolomon) malloc(sizeof(struct reedsolomon_s));
+    q->mm     = _symsize;
+    q->nn     = nn;
+    q->fcr    = _fcr;
+    q->prim   = _prim;
+    q->nroots = _nroots;
+    q->pad    = _pad;
+
+    // generate field tables; alpha_to is extended to twice the field
+    // size so that products need no reduction modulo nn
+    q->alpha_to = (unsigned char*) malloc(2*nn*sizeof(unsigned char));
+    q->index_of = (unsigned int*)  malloc((nn+1)*sizeof(unsigned int));
+    memset(q->index_of, 0x00, (nn+1)*sizeof(unsigned int));
+    unsigned int i, j;
+    unsigned int sr = 1;
+    for (i=0; i<(unsigned int)nn; i++) {
+        if (i > 0 && sr == 1) {
+            fprintf(stderr,"error: reedsolomon_create(), polynomial 0x%x is not primitive\n", _gfpoly);
+            exit(1);
+        }
+        q->alpha_to[i]    = sr;
+        q->alpha_to[i+nn] = sr;
+        q->index_of[sr]   = i;
+        sr <<= 1;
+        if (sr & (1 << _symsize))
+            sr ^= _gfpoly;
+        sr &= nn;
+    }
+    if (sr != 1) {
+        fprintf(stderr,"error: reedsolomon_create(), polynomial 0x%x is not primitive\n", _gfpoly);
+        exit(1);
+    }
+
+    // generator polynomial, g(x) = prod_i (x - alpha^{(fcr+i)*prim}),
+    // with coefficients genpoly[k] of x^k
+    q->genpoly = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    memset(q->genpoly, 0x00, (_nroots+1)*sizeof(unsigned char));
+    q->genpoly[0] = 1;
+    for (i=0; i<(unsigned int)_nroots; i++) {
+        unsigned char root = q->alpha_to[((_fcr+i)*_prim) % nn];
+        for (j=i+1; j>0; j--)
+            q->genpoly[j] = q->genpoly[j-1] ^ reedsolomon_mul(q, q->genpoly[j], root);
+        q->genpoly[0] = reedsolomon_mul(q, q->genpoly[0], root);
+    }
+
+    // encoder table: row f holds f*g_{nroots-1-j} for j in [0,nroots),
+    // padded with zeros to a multiple of eight symbols
+    q->enc_stride = 8*((_nroots + 7) / 8);
+    q->enc_tab = (unsigned char*) malloc((nn+1)*q->enc_stride*sizeof(unsigned char));
+    memset(q->enc_tab, 0x00, (nn+1)*q->enc_stride*sizeof(unsigned char));
+    for (i=0; i<=(unsigned int)nn; i++) {
+        for (j=0; j<(unsigned int)_nroots; j++)
+            q->enc_tab[i*q->enc_stride + j] = reedsolomon_mul(q, i, q->genpoly[_nroots-1-j]);
+    }
+
+    // encoder window, decoder parity and working arrays
+    q->enc_buf  = (unsigned char*) malloc((nn + q->enc_stride + 1)*sizeof(unsigned char));
+    q->parity   = (unsigned char*) malloc(_nroots*sizeof(unsigned char));
+    q->syndrome = (unsigned char*) malloc(_nroots*sizeof(unsigned char));
+    q->lambda   = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->b        = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->t        = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    q->omega    = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+
+    return q;
+}
+
+// destroy codec, freeing all internal memory
+void reedsolomon_destroy(void * _q)
+{
+    reedsolomon q = (reedsolomon) _q;
+    free(q->alpha_to);
+    free(q->index_of);
+    free(q->genpoly);
+    free(q->enc_tab);
+    free(q->enc_buf);
+    free(q->parity);
+    free(q->syndrome);
+    free(q->lambda);
+    free(q->b);
+    free(q->t);
+    free(q->omega);
+    free(q);
+}
+
+// compute parity symbols of message
+//  _q      :   codec object
+//  _data   :   message [size: nn-nroots-pad x 1]
+//  _parity :   parity symbols [size: nroots x 1]
+void reedsolomon_encode(void *          _q,
+                        unsigned char * _data,
+                        unsigned char * _parity)
+{
+    reedsolomon q = (reedsolomon) _q;
+    unsigned int n = q->nn - q->nroots - q->pad;
+    unsigned int stride = q->enc_stride;
+
+    // The parity register for symbol i occupies enc_buf[i+1:i+nroots];
+    // rather than shifting the register, the window slides along the
+    // buffer and each step XORs a table row into it.
+    unsigned char * buf = q->enc_buf;
+    memset(buf, 0x00, (n + stride + 1)*sizeof(unsigned char));
+    unsigned int i, j;
+    for (i=0; i<n; i++) {
+        unsigned char * row = &q->enc_tab[(_data[i] ^ buf[i])*stride];
+        unsigned char * reg = &buf[i+1];
+        for (j=0; j<stride; j+=8) {
+            unsigned long long int r, t;
+            memcpy(&r, &reg[j], 8);
+            memcpy(&t, &row[j], 8);
+            r ^= t;
+            memcpy(&reg[j], &r, 8);
+        }
+    }
+
+    memmove(_parity, &buf[n], q->nroots*sizeof(unsigned char));
+}
+
+// decode block in place, returning the number of corrected symbols,
+// or -1 if the block could not be corrected
+//  _q          :   codec object
+//  _data       :   received block (message followed by parity)
+//                  [size: nn-pad x 1]
+//  _eras_pos   :   input: erasure positions; output: positions of
+//                  corrected symbols [size: nroots x 1]
+//  _no_eras    :   number of erasures
+int reedsolomon_decode(void *          _q,
+                       unsigned char * _data,
+                       int *           _eras_pos,
+                       int             _no_eras)
+{
+    reedsolomon q = (reedsolomon) _q;
+    unsigned int nroots = q->nroots;
+    unsigned int n      = q->nn - q->pad;   // received block length
+    unsigned int i, j;
+
+    // re-encode message and compare parity; the difference is the
+    // remainder of the received polynomial divided by g(x)
+    reedsolomon_encode(q, _data, q->parity);
+    int nonzero = 0;
+    for (i=0; i<nroots; i++) {
+        q->parity[i] ^= _data[n - nroots + i];
+        nonzero |= q->parity[i];
+    }
+    if (!nonzero)
+        return 0;
+
+    // syndromes: remainder evaluated at roots of g(x)
+    for (i=0; i<nroots; i++) {
+        unsigned int root = ((q->fcr + i)*q->prim) % q->nn;
+        unsigned char s = 0;
+        for (j=0; j<nroots; j++) {
+            // s = s*alpha^root + parity[j]
+            s = (s == 0 ? 0 : q->alpha_to[q->index_of[s] + root]) ^ q->parity[j];
+        }
+        q->syndrome[i] = s;
+    }
+
+    // initialize error locator with erasures, lambda(x) = prod(1 - X x),
+    // where X = alpha^{prim*e} for a symbol of degree e
+    memset(q->lambda, 0x00, (nroots+1)*sizeof(unsigned char));
+    q->lambda[0] = 1;
+    if (_no_eras > 0 && (unsigned int)_no_eras > nroots)
+        return -1;
+    for (i=0; i<(unsigned int)_no_eras; i++) {
+        if (_eras_pos[i] < 0 || (unsigned int)_eras_pos[i] >= n)
+            return -1;
+        unsigned int e = n - 1 - _eras_pos[i];
+        unsigned char X = q->alpha_to[(q->prim*e) % q->nn];
+        for (j=i+1; j>0; j--)
+            q->lambda[j] ^= reedsolomon_mul(q, X, q->lambda[j-1]);
+    }
+
+    // Berlekamp-Massey
+    unsigned int L = _no_eras;
+    memmove(q->b, q->lambda, (nroots+1)*sizeof(unsigned char));
+    unsigned int k;
+    for (k=_no_eras; k<nroots; k++) {
+        // discrepancy
+        unsigned char delta = 0;
+        for (i=0; i<=L && i<=k; i++)
+            delta ^= reedsolomon_mul(q, q->lambda[i], q->syndrome[k-i]);
+
+        if (delta == 0) {
+            // b(x) = x*b(x)
+            memmove(&q->b[1], q->b, nroots*sizeof(unsigned char));
+            q->b[0] = 0;
+            continue;
+        }
+
+        // t(x) = lambda(x) - delta*x*b(x)
+        q->t[0] = q->lambda[0];
+        for (i=1; i<=nroots; i++)
+            q->t[i] = q->lambda[i] ^ reedsolomon_mul(q, delta, q->b[i-1]);
+
+        if (2*L <= k + _no_eras) {
+            // b(x) = lambda(x)/delta
+            L = k + 1 + _no_eras - L;
+            unsigned int delta_inv = q->nn - q->index_of[delta];
+            for (i=0; i<=nroots; i++)
+                q->b[i] = q->lambda[i] == 0 ? 0 : q->alpha_to[q->index_of[q->lambda[i]] + delta_inv];
+        } else {
+            memmove(&q->b[1], q->b, nroots*sizeof(unsigned char));
+            q->b[0] = 0;
+        }
+        memmove(q->lambda, q->t, (nroots+1)*sizeof(unsigned char));
+    }
+
+    // degree of error locator
+    unsigned int deg_lambda = 0;
+    for (i=0; i<=nroots; i++) {
+        if (q->lambda[i] != 0)
+            deg_lambda = i;
+    }
+    if (deg_lambda == 0 || deg_lambda > nroots)
+        return -1;
+
+    // error evaluator, omega(x) = syndrome(x)*lambda(x) mod x^nroots
+    for (i=0; i<nroots; i++) {
+        unsigned char w = 0;
+        for (j=0; j<=i && j<=deg_lambda; j++)
+            w ^= reedsolomon_mul(q, q->lambda[j], q->syndrome[i-j]);
+        q->omega[i] = w;
+    }
+
+    // Chien search over received positions (roots falling in the
+    // padded region indicate a decoding failure), followed by Forney's
+    // algorithm for the error values:
+    //  Y = X^{1-fcr} omega(X^{-1}) / lambda'(X^{-1})
+    // Corrections are applied only once all roots have been found.
+    unsigned char * err = q->t;
+    int count = 0;
+    for (j=0; j<n && count < (int)deg_lambda; j++) {
+        unsigned int e      = n - 1 - j;                    // degree of symbol
+        unsigned int log_X  = (q->prim*e) % q->nn;          // log(X)
+        unsigned int log_Xi = (q->nn - log_X) % q->nn;      // log(X^{-1})
+
+        // evaluate lambda(X^{-1}) and its formal derivative
+        unsigned char sum = 0, der = 0;
+        unsigned int pwr = 0;   // log(X^{-i})
+        for (i=0; i<=deg_lambda; i++) {
+            if (q->lambda[i] != 0) {
+                unsigned char v = q->alpha_to[q->index_of[q->lambda[i]] + pwr];
+                sum ^= v;
+                // derivative picks odd terms, lambda_i x^{i-1}
+                if (i & 1)
+                    der ^= q->alpha_to[q->index_of[v] + log_X];
+            }
+            pwr = (pwr + log_Xi) % q->nn;
+        }
+        if (sum != 0)
+            continue;
+
+        // evaluate omega(X^{-1})
+        unsigned char num = 0;
+        pwr = 0;
+        for (i=0; i<nroots; i++) {
+            if (q->omega[i] != 0)
+                num ^= q->alpha_to[q->index_of[q->omega[i]] + pwr];
+            pwr = (pwr + log_Xi) % q->nn;
+        }
+        if (der == 0)
+            return -1;
+
+        // Y = X^{1-fcr} num / der
+        err[count] = 0;
+        if (num != 0) {
+            unsigned int log_Y = (log_X*(q->nn + 1 - q->fcr % q->nn)) % q->nn
+                               + q->index_of[num] + q->nn - q->index_of[der];
+            err[count] = q->alpha_to[log_Y % q->nn];
+        }
+        _eras_pos[count++] = j;
+    }
+
+    // number of roots must equal degree of locator
+    if (count != (int)deg_lambda)
+        return -1;
+
+    for (i=0; i<(unsigned int)count; i++)
+        _data[_eras_pos[i]] ^= err[i];
+
+    return count;
+}
+
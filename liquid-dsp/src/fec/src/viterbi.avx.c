@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Viterbi decoder add-compare-select kernel (AVX2)
+//
+
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// AVX2 add-compare-select kernel, 16 butterflies per iteration
+// (see viterbi_acs_port for decision packing)
+void viterbi_acs_avx2(short int *     _m0,
+                      short int *     _m1,
+                      short int *     _mask,
+                      unsigned char * _sym,
+                      unsigned int    _R,
+                      unsigned int    _n,
+                      unsigned int *  _dec)
+{
+    unsigned int n2 = _n / 2;
+    unsigned int j, r;
+
+    __m256i ref    = _mm256_set1_epi16(_m0[0]);
+    __m256i bm_max = _mm256_set1_epi16(255*_R);
+    __m256i sym[8];
+    for (r=0; r<_R; r++)
+        sym[r] = _mm256_set1_epi16(_sym[r]);
+
+    for (j=0; j<n2; j+=16) {
+        // branch metrics
+        __m256i a = _mm256_xor_si256(sym[0], _mm256_loadu_si256((__m256i*)&_mask[j]));
+        for (r=1; r<_R; r++)
+            a = _mm256_add_epi16(a, _mm256_xor_si256(sym[r], _mm256_loadu_si256((__m256i*)&_mask[r*n2+j])));
+        __m256i b = _mm256_sub_epi16(bm_max, a);
+
+        // predecessor metrics
+        __m256i m0 = _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)&_m0[j]),    ref);
+        __m256i m1 = _mm256_sub_epi16(_mm256_loadu_si256((__m256i*)&_m0[j+n2]), ref);
+
+        // add, compare, select
+        __m256i e0 = _mm256_add_epi16(m0, a);
+        __m256i e1 = _mm256_add_epi16(m1, b);
+        __m256i o0 = _mm256_add_epi16(m0, b);
+        __m256i o1 = _mm256_add_epi16(m1, a);
+        __m256i ve = _mm256_min_epi16(e0, e1);
+        __m256i vo = _mm256_min_epi16(o0, o1);
+        __m256i de = _mm256_cmpgt_epi16(e0, e1);
+        __m256i dn = _mm256_cmpgt_epi16(o0, o1);
+
+        // interleave even/odd states (unpack operates within 128-bit
+        // lanes) and store
+        __m256i lo = _mm256_unpacklo_epi16(ve, vo);
+        __m256i hi = _mm256_unpackhi_epi16(ve, vo);
+        _mm256_storeu_si256((__m256i*)&_m1[2*j   ], _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i*)&_m1[2*j+16], _mm256_permute2x128_si256(lo, hi, 0x31));
+
+        // pack decisions: per-lane packing yields the same bit order
+        // as two SSE2 iterations
+        _dec[j >> 4] = (unsigned int)_mm256_movemask_epi8(_mm256_packs_epi16(de, dn));
+    }
+}
+
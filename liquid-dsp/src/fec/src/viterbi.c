@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Viterbi decoder for rate 1/R convolutional codes
+//
+// Soft-decision decoder operating on 8-bit symbols (0: strong zero,
+// 255: strong one, 127: erasure) with 16-bit path metrics. The
+// add-compare-select step is vectorized across states (see
+// viterbi.mmx.c, viterbi.avx.c) and decisions are kept only for a
+// sliding window of trellis steps: once the window is full the
+// survivor path is traced back from the best state and the oldest
+// bits are written out, keeping memory independent of the message
+// length.
+//
+// The decoder relies on every generator polynomial having its first
+// and last taps set (true for all codes in liquid) so that the four
+// branch metrics of each butterfly reduce to a single value and its
+// complement.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+// decisions kept beyond the traceback depth before output (steps)
+#define VITERBI_OUTPUT_LEN      (256)
+
+// initial path metric of states other than the starting state
+#define VITERBI_METRIC_INIT     (4096)
+
+// create decoder
+//  _K      :   constraint length, 7 <= _K <= 15
+//  _R      :   primitive rate, inverted, 0 < _R <= 8
+//  _poly   :   generator polynomials [size: _R x 1]
+//  _len    :   decoded message length (bits)
+void * viterbi_create(unsigned int _K,
+                      unsigned int _R,
+                      int *        _poly,
+                      int          _len)
+{
+    // validate input
+    if (_K < 7 || _K > 15) {
+        fprintf(stderr,"error: viterbi_create(), constraint length must be in [7,15]\n");
+        exit(1);
+    } else if (_R == 0 || _R > 8) {
+        fprintf(stderr,"error: viterbi_create(), rate must be in [1,8]\n");
+        exit(1);
+    }
+    unsigned int r;
+    for (r=0; r<_R; r++) {
+        if ( !(_poly[r] & 1) || !((_poly[r] >> (_K-1)) & 1) ) {
+            fprintf(stderr,"error: viterbi_create(), polynomial 0x%x must have first and last taps set\n", _poly[r]);
+            exit(1);
+        }
+    }
+
+    viterbi q = (viterbi) malloc(sizeof(struct viterbi_s));
+    q->K          = _K;
+    q->R          = _R;
+    q->num_states = 1 << (_K-1);
+    q->num_words  = q->num_states / 32;
+    q->len        = _len;
+
+    // expected output of each polynomial for even states
+    unsigned int n2 = q->num_states / 2;
+    unsigned int j;
+    q->mask = (short int*) malloc(_R*n2*sizeof(short int));
+    for (r=0; r<_R; r++) {
+        for (j=0; j<n2; j++)
+            q->mask[r*n2 + j] = liquid_count_ones_mod2((2*j) & _poly[r]) ? 0xff : 0;
+    }
+
+    // traceback depth: roughly six constraint lengths
+    q->tb_len     = 6*_K < 64 ? 64 : 6*_K;
+    q->window_len = q->tb_len + VITERBI_OUTPUT_LEN;
+
+    // allocate memory for metrics, decisions, and output
+    q->metric[0] = (short int*)    malloc(q->num_states*sizeof(short int));
+    q->metric[1] = (short int*)    malloc(q->num_states*sizeof(short int));
+    q->dec       = (unsigned int*) malloc(q->window_len*q->num_words*sizeof(unsigned int));
+    q->out       = (unsigned char*)malloc((q->len/8 + 1)*sizeof(unsigned char));
+
+    // select add-compare-select kernel based on host CPU
+#if LIQUID_VITERBI_SIMD
+    switch (liquid_simd_level()) {
+#if LIQUID_VITERBI_AVX2
+    case LIQUID_SIMD_AVX512:
+    case LIQUID_SIMD_AVX2:   q->acs = viterbi_acs_avx2; break;
+#endif
+    default:                 q->acs = viterbi_acs_sse2;
+    }
+#else
+    q->acs = viterbi_acs_port;
+#endif
+
+    viterbi_init(q, 0);
+    return q;
+}
+
+// create decoders for codes with libfec-compatible polynomials
+//  _len    :   decoded message length (bits)
+void * viterbi_create27(int _len)  { return viterbi_create( 7,2,fec_conv27_poly, _len); }
+void * viterbi_create29(int _len)  { return viterbi_create( 9,2,fec_conv29_poly, _len); }
+void * viterbi_create39(int _len)  { return viterbi_create( 9,3,fec_conv39_poly, _len); }
+void * viterbi_create615(int _len) { return viterbi_create(15,6,fec_conv615_poly,_len); }
+
+// destroy decoder, freeing all internal memory
+void viterbi_destroy(void * _q)
+{
+    viterbi q = (viterbi) _q;
+    free(q->mask);
+    free(q->metric[0]);
+    free(q->metric[1]);
+    free(q->dec);
+    free(q->out);
+    free(q);
+}
+
+// reset decoder state
+//  _q              :   decoder object
+//  _starting_state :   encoder state at start of message
+int viterbi_init(void * _q,
+                 int    _starting_state)
+{
+    viterbi q = (viterbi) _q;
+    unsigned int i;
+    for (i=0; i<q->num_states; i++)
+        q->metric[0][i] = VITERBI_METRIC_INIT;
+    q->metric[0][_starting_state & (q->num_states-1)] = 0;
+
+    memset(q->out, 0x00, q->len/8 + 1);
+    q->num_steps  = 0;
+    q->num_stored = 0;
+    q->dec_index  = 0;
+    return 0;
+}
+
+// trace back survivor path through history, writing decoded bits
+//  _q      :   decoder object
+//  _state  :   state at most recent step
+//  _skip   :   number of steps to trace through before output
+//  _n      :   number of steps to output
+void viterbi_traceback(viterbi      _q,
+                       unsigned int _state,
+                       unsigned int _skip,
+                       unsigned int _n)
+{
+    unsigned int n2 = _q->num_states / 2;
+    unsigned int t  = _q->num_steps;    // absolute index of step after most recent
+    unsigned int k  = _q->dec_index;    // history index of step after most recent
+    unsigned int i;
+    for (i=0; i<_skip+_n; i++) {
+        t--;
+        k = (k == 0 ? _q->window_len : k) - 1;
+        unsigned int * dec = &_q->dec[k*_q->num_words];
+
+        // decoded bit is least-significant bit of state
+        if (i >= _skip && t < _q->len)
+            _q->out[t/8] |= (_state & 1) << (7 - (t%8));
+
+        // locate decision bit (see packing in viterbi_acs_port)
+        unsigned int j  = _state >> 1;
+        unsigned int jj = j & 15;
+        unsigned int b  = ((jj >> 3) << 4) | ((_state & 1) << 3) | (jj & 7);
+        unsigned int d  = (dec[j >> 4] >> b) & 1;
+
+        // move to predecessor state
+        _state = j | (d ? n2 : 0);
+    }
+}
+
+// run decoder on block of soft symbols
+//  _q      :   decoder object
+//  _sym    :   soft symbols [size: _R*_nbits x 1]
+//  _nbits  :   number of trellis steps
+int viterbi_update_blk(void *          _q,
+                       unsigned char * _sym,
+                       int             _nbits)
+{
+    viterbi q = (viterbi) _q;
+    int i;
+    for (i=0; i<_nbits; i++) {
+        // run add-compare-select, storing decisions in history
+        unsigned int * dec = &q->dec[q->dec_index*q->num_words];
+        q->acs(q->metric[0], q->metric[1], q->mask, _sym, q->R, q->num_states, dec);
+        _sym += q->R;
+        q->dec_index = (q->dec_index == q->window_len-1) ? 0 : q->dec_index+1;
+
+        // swap metrics
+        short int * m = q->metric[0];
+        q->metric[0] = q->metric[1];
+        q->metric[1] = m;
+
+        q->num_steps++;
+        q->num_stored++;
+
+        // write out oldest bits once history is full
+        if (q->num_stored == q->window_len) {
+            unsigned int s, s_best = 0;
+            for (s=1; s<q->num_states; s++) {
+                if (q->metric[0][s] < q->metric[0][s_best])
+                    s_best = s;
+            }
+            viterbi_traceback(q, s_best, q->tb_len, VITERBI_OUTPUT_LEN);
+            q->num_stored -= VITERBI_OUTPUT_LEN;
+        }
+    }
+    return 0;
+}
+
+// trace back from final state and write decoded message
+//  _q          :   decoder object
+//  _data       :   decoded message [size: _nbits/8 x 1]
+//  _nbits      :   number of decoded bits
+//  _endstate   :   encoder state at end of message
+int viterbi_chainback(void *          _q,
+                      unsigned char * _data,
+                      unsigned int    _nbits,
+                      unsigned int    _endstate)
+{
+    viterbi q = (viterbi) _q;
+    viterbi_traceback(q, _endstate & (q->num_states-1), 0, q->num_stored);
+    q->num_stored = 0;
+
+    memmove(_data, q->out, _nbits/8);
+    return 0;
+}
+
+// portable add-compare-select kernel
+//
+// New states 2j and 2j+1 share predecessors j and j+n/2. Decisions
+// for 16 consecutive values of j are packed into one word: bits 0-7
+// hold even states of the first eight, bits 8-15 odd states of the
+// first eight, bits 16-31 the same for the next eight (this matches
+// the byte packing of the SIMD kernels).
+void viterbi_acs_port(short int *     _m0,
+                      short int *     _m1,
+                      short int *     _mask,
+                      unsigned char * _sym,
+                      unsigned int    _R,
+                      unsigned int    _n,
+                      unsigned int *  _dec)
+{
+    unsigned int n2 = _n / 2;
+    short int    bm_max = 255*_R;
+    short int    ref    = _m0[0];   // normalize metrics to state 0
+    unsigned int j, r;
+    for (j=0; j<n2; j++) {
+        // branch metric for transition j -> 2j
+        short int a = 0;
+        for (r=0; r<_R; r++)
+            a += _sym[r] ^ _mask[r*n2 + j];
+        short int b = bm_max - a;
+
+        short int m0 = _m0[j]    - ref;
+        short int m1 = _m0[j+n2] - ref;
+
+        // even state 2j: a from j, b from j+n/2
+        short int e0 = m0 + a, e1 = m1 + b;
+        // odd state 2j+1: b from j, a from j+n/2
+        short int o0 = m0 + b, o1 = m1 + a;
+
+        _m1[2*j  ] = e0 > e1 ? e1 : e0;
+        _m1[2*j+1] = o0 > o1 ? o1 : o0;
+
+        unsigned int jj = j & 15;
+        if ( jj == 0 )
+            _dec[j >> 4] = 0;
+        unsigned int b_even = ((jj >> 3) << 4) | (jj & 7);
+        _dec[j >> 4] |= (e0 > e1) << b_even;
+        _dec[j >> 4] |= (o0 > o1) << (b_even | 8);
+    }
+}
+
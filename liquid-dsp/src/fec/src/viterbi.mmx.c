@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Viterbi decoder add-compare-select kernel (SSE2)
+//
+
+#include <emmintrin.h>
+
+#include "liquid.internal.h"
+
+// SSE2 add-compare-select kernel, 16 butterflies per iteration
+// (see viterbi_acs_port for decision packing)
+void viterbi_acs_sse2(short int *     _m0,
+                      short int *     _m1,
+                      short int *     _mask,
+                      unsigned char * _sym,
+                      unsigned int    _R,
+                      unsigned int    _n,
+                      unsigned int *  _dec)
+{
+    unsigned int n2 = _n / 2;
+    unsigned int j, r, h;
+
+    __m128i ref    = _mm_set1_epi16(_m0[0]);
+    __m128i bm_max = _mm_set1_epi16(255*_R);
+    __m128i sym[8];
+    for (r=0; r<_R; r++)
+        sym[r] = _mm_set1_epi16(_sym[r]);
+
+    for (j=0; j<n2; j+=16) {
+        unsigned int dec = 0;
+        for (h=0; h<16; h+=8) {
+            // branch metrics
+            __m128i a = _mm_xor_si128(sym[0], _mm_loadu_si128((__m128i*)&_mask[j+h]));
+            for (r=1; r<_R; r++)
+                a = _mm_add_epi16(a, _mm_xor_si128(sym[r], _mm_loadu_si128((__m128i*)&_mask[r*n2+j+h])));
+            __m128i b = _mm_sub_epi16(bm_max, a);
+
+            // predecessor metrics
+            __m128i m0 = _mm_sub_epi16(_mm_loadu_si128((__m128i*)&_m0[j+h]),    ref);
+            __m128i m1 = _mm_sub_epi16(_mm_loadu_si128((__m128i*)&_m0[j+h+n2]), ref);
+
+            // add, compare, select
+            __m128i e0 = _mm_add_epi16(m0, a);
+            __m128i e1 = _mm_add_epi16(m1, b);
+            __m128i o0 = _mm_add_epi16(m0, b);
+            __m128i o1 = _mm_add_epi16(m1, a);
+            __m128i ve = _mm_min_epi16(e0, e1);
+            __m128i vo = _mm_min_epi16(o0, o1);
+            __m128i de = _mm_cmpgt_epi16(e0, e1);
+            __m128i dn = _mm_cmpgt_epi16(o0, o1);
+
+            // interleave even/odd states and store
+            _mm_storeu_si128((__m128i*)&_m1[2*(j+h)  ], _mm_unpacklo_epi16(ve, vo));
+            _mm_storeu_si128((__m128i*)&_m1[2*(j+h)+8], _mm_unpackhi_epi16(ve, vo));
+
+            // pack decisions
+            dec |= (unsigned int)_mm_movemask_epi8(_mm_packs_epi16(de, dn)) << (2*h);
+        }
+        _dec[j >> 4] = dec;
+    }
+}
+
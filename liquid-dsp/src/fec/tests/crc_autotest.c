@@ -17,6 +17,7 @@
  * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "autotest/autotest.h"
@@ -117,3 +118,69 @@ void autotest_crc24()    { validate_crc(LIQUID_CRC_24,          64); }
 void autotest_crc32()    { validate_crc(LIQUID_CRC_32,          64); }
 
 
+// reference key: bit-by-bit method with 32-bit register
+// (algorithm from: http://www.hackersdelight.org/crc.pdf)
+unsigned int crc_reference_key(unsigned int    _poly,
+                               unsigned int    _mask,
+                               unsigned char * _msg,
+                               unsigned int    _n)
+{
+    unsigned int i, j, key=~0;
+    for (i=0; i<_n; i++) {
+        key ^= _msg[i];
+        for (j=0; j<8; j++)
+            key = (key>>1) ^ (_poly & -(key & 1));
+    }
+    return (~key) & _mask;
+}
+
+// 
+// autotest helper function: compare table-driven and streaming keys
+// against bit-by-bit reference for many message lengths
+//
+void crc_testbench_streaming(crc_scheme   _check,
+                             unsigned int _poly,
+                             unsigned int _mask)
+{
+    unsigned int i, n;
+    unsigned char data[75];
+    for (i=0; i<75; i++)
+        data[i] = rand() & 0xff;
+
+    for (n=0; n<75; n++) {
+        unsigned int key_ref = crc_reference_key(_poly, _mask, data, n);
+
+        // one-shot key
+        CONTEND_EQUALITY(crc_generate_key(_check, data, n), key_ref);
+
+        // streaming key, message split into three pieces
+        unsigned int n0 = n / 3;
+        unsigned int n1 = (2*n) / 3;
+        unsigned int state = crc_init(_check);
+        state = crc_update(_check, state, data,    n0);
+        state = crc_update(_check, state, data+n0, n1-n0);
+        state = crc_update(_check, state, data+n1, n-n1);
+        CONTEND_EQUALITY(crc_finalize(_check, state), key_ref);
+    }
+}
+
+void autotest_crc8_streaming()  { crc_testbench_streaming(LIQUID_CRC_8,  0xe0,       0xff);       }
+void autotest_crc16_streaming() { crc_testbench_streaming(LIQUID_CRC_16, 0xa001,     0xffff);     }
+void autotest_crc24_streaming() { crc_testbench_streaming(LIQUID_CRC_24, 0xd3b6ba,   0xffffff);   }
+void autotest_crc32_streaming() { crc_testbench_streaming(LIQUID_CRC_32, 0xedb88320, 0xffffffff); }
+
+// streaming checksum
+void autotest_checksum_streaming()
+{
+    unsigned int i;
+    unsigned char data[37];
+    for (i=0; i<37; i++)
+        data[i] = rand() & 0xff;
+
+    unsigned int state = crc_init(LIQUID_CRC_CHECKSUM);
+    state = crc_update(LIQUID_CRC_CHECKSUM, state, data,    20);
+    state = crc_update(LIQUID_CRC_CHECKSUM, state, data+20, 17);
+    CONTEND_EQUALITY(crc_finalize(LIQUID_CRC_CHECKSUM, state),
+                     crc_generate_key(LIQUID_CRC_CHECKSUM, data, 37));
+}
+
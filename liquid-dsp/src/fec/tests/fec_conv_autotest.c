@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// Helper function: decode long message (spanning many traceback
+// windows) with noisy soft bits and periodic hard errors
+//  _fs             :   convolutional scheme
+//  _n              :   message length (bytes)
+//  _error_spacing  :   number of encoded bits between hard errors
+//  _noise          :   peak uniform noise added to soft bits
+void fec_conv_test_noise(fec_scheme   _fs,
+                         unsigned int _n,
+                         unsigned int _error_spacing,
+                         int          _noise)
+{
+    fec q = fec_create(_fs,NULL);
+
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg[_n];              // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_soft[8*n_enc];    // encoded message (soft bits)
+    unsigned char msg_dec[_n];          // decoded message
+
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        msg[i] = rand() & 0xff;
+        msg_dec[i] = 0;
+    }
+
+    // encode message
+    fec_encode(q, _n, msg, msg_enc);
+
+    // convert to soft bits with uniform noise, flipping bits periodically
+    for (i=0; i<8*n_enc; i++) {
+        int bit = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        if ( (i % _error_spacing) == _error_spacing/2 )
+            bit = 1 - bit;
+        int v = (bit ? 192 : 63) + (rand() % (2*_noise+1)) - _noise;
+        msg_soft[i] = (unsigned char) v;
+    }
+
+    // decode message
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+
+    // validate output
+    CONTEND_SAME_DATA(msg,msg_dec,_n);
+
+    fec_destroy(q);
+}
+
+void autotest_fec_conv_v27_noise()    { fec_conv_test_noise(LIQUID_FEC_CONV_V27,    1024, 24, 48); }
+void autotest_fec_conv_v29_noise()    { fec_conv_test_noise(LIQUID_FEC_CONV_V29,    1024, 24, 48); }
+void autotest_fec_conv_v39_noise()    { fec_conv_test_noise(LIQUID_FEC_CONV_V39,     512, 24, 48); }
+void autotest_fec_conv_v27p34_noise() { fec_conv_test_noise(LIQUID_FEC_CONV_V27P34,  512, 64,  0); }
+void autotest_fec_conv_v29p78_noise() { fec_conv_test_noise(LIQUID_FEC_CONV_V29P78,  512, 96,  0); }
+
+// Helper function: compare SIMD add-compare-select kernel to
+// portable version
+void viterbi_test_acs(viterbi_acs_kernel _acs,
+                      unsigned int       _K,
+                      unsigned int       _R)
+{
+    unsigned int n  = 1 << (_K-1);
+    unsigned int n2 = n / 2;
+    short int     m0[n], m1_test[n], m1[n], mask[_R*n2];
+    unsigned int  dec_test[n/32], dec[n/32];
+    unsigned char sym[_R];
+
+    unsigned int i, t;
+    for (t=0; t<20; t++) {
+        for (i=0; i<n; i++)
+            m0[i] = (rand() % 4096) - 2048;
+        for (i=0; i<_R*n2; i++)
+            mask[i] = (rand() & 1) ? 0xff : 0;
+        for (i=0; i<_R; i++)
+            sym[i] = rand() & 0xff;
+
+        viterbi_acs_port(m0, m1_test, mask, sym, _R, n, dec_test);
+        _acs(m0, m1, mask, sym, _R, n, dec);
+
+        CONTEND_SAME_DATA(m1,  m1_test,  n*sizeof(short int));
+        CONTEND_SAME_DATA(dec, dec_test, (n/32)*sizeof(unsigned int));
+    }
+}
+
+void autotest_viterbi_acs_sse2()
+{
+#if LIQUID_VITERBI_SIMD
+    viterbi_test_acs(viterbi_acs_sse2, 7, 2);
+    viterbi_test_acs(viterbi_acs_sse2, 9, 3);
+#else
+    AUTOTEST_WARN("SSE2 Viterbi kernel unavailable\n");
+#endif
+}
+
+void autotest_viterbi_acs_avx2()
+{
+#if LIQUID_VITERBI_AVX2
+    if (liquid_simd_level() < LIQUID_SIMD_AVX2) {
+        AUTOTEST_WARN("AVX2 unavailable on host\n");
+        return;
+    }
+    viterbi_test_acs(viterbi_acs_avx2, 7, 2);
+    viterbi_test_acs(viterbi_acs_avx2, 9, 3);
+#else
+    AUTOTEST_WARN("AVX2 Viterbi kernel unavailable\n");
+#endif
+}
+
@@ -102,3 +102,66 @@ void autotest_golay2412_codec()
     }
 }
 
+
+//
+// AUTOTEST: Golay(24,12) generated tables match reference algorithm
+//
+void autotest_golay2412_gentab()
+{
+    unsigned int i;
+
+    // encoder and syndrome tables
+    for (i=0; i<(1<<12); i++) {
+        unsigned int v = golay2412_matrix_mul(i, golay2412_Gt, 24);
+        CONTEND_EQUALITY( fec_golay2412_encode_symbol(i), v );
+
+        // syndrome of random received vector
+        unsigned int r = (rand() & 0xfff) | ((rand() & 0xfff) << 12);
+        unsigned int s = golay2412_syndrome_gentab[0][(r >> 16) & 0xff] ^
+                         golay2412_syndrome_gentab[1][(r >>  8) & 0xff] ^
+                         golay2412_syndrome_gentab[2][(r      ) & 0xff];
+        CONTEND_EQUALITY( s, golay2412_matrix_mul(r, golay2412_H, 12) );
+    }
+
+    // error pattern (over message bits) for every syndrome
+    for (i=0; i<(1<<12); i++)
+        CONTEND_EQUALITY( golay2412_dec_gentab[i], golay2412_estimate_ehat(i) & 0x0fff );
+}
+
+//
+// AUTOTEST: Golay(24,12) array encoder/decoder
+//
+void autotest_golay2412_array()
+{
+    unsigned int n = 60;        // number of three-byte blocks
+    unsigned char msg_org[3*n]; // original message
+    unsigned char msg_enc[6*n]; // encoded message
+    unsigned char msg_dec[3*n]; // decoded message
+    unsigned int i;
+
+    for (i=0; i<3*n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    // encode and validate against symbol encoder
+    fec_golay2412_encode_array(msg_org, n, msg_enc);
+    for (i=0; i<n; i++) {
+        unsigned int m0 = (msg_org[3*i+0] << 4) | (msg_org[3*i+1] >> 4);
+        unsigned int m1 = ((msg_org[3*i+1] & 0x0f) << 8) | msg_org[3*i+2];
+        unsigned int v0 = (msg_enc[6*i+0] << 16) | (msg_enc[6*i+1] << 8) | msg_enc[6*i+2];
+        unsigned int v1 = (msg_enc[6*i+3] << 16) | (msg_enc[6*i+4] << 8) | msg_enc[6*i+5];
+        CONTEND_EQUALITY( v0, fec_golay2412_encode_symbol(m0) );
+        CONTEND_EQUALITY( v1, fec_golay2412_encode_symbol(m1) );
+    }
+
+    // add up to three errors to each symbol
+    for (i=0; i<2*n; i++) {
+        unsigned int e = golay2412_generate_error_vector(i % 4);
+        msg_enc[3*i+0] ^= (e >> 16) & 0xff;
+        msg_enc[3*i+1] ^= (e >>  8) & 0xff;
+        msg_enc[3*i+2] ^= (e      ) & 0xff;
+    }
+
+    // decode and validate
+    fec_golay2412_decode_array(msg_enc, n, msg_dec);
+    CONTEND_SAME_DATA( msg_org, msg_dec, 3*n );
+}
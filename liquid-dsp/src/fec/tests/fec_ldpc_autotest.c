@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// encode full (unshortened) block and verify H*c = 0
+void fec_ldpc_test_parity(fec_scheme _fs)
+{
+    fec q = fec_create(_fs, NULL);
+    unsigned int n = 8*q->nn;
+    unsigned int k = q->kk;
+
+    // encode random message of exactly one block
+    unsigned char msg[k];
+    unsigned char msg_enc[q->nn];
+    unsigned int i;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+    CONTEND_EQUALITY( fec_get_enc_msg_length(_fs,k), q->nn );
+    fec_encode(q, k, msg, msg_enc);
+
+    // systematic: data bytes are passed through
+    CONTEND_SAME_DATA( msg, msg_enc, k );
+
+    // unpack codeword and run parity check
+    unsigned char c[n];
+    unsigned char p[n - 8*k];
+    for (i=0; i<n; i++)
+        c[i] = (msg_enc[i/8] >> (7-(i%8))) & 1;
+    smatrixb H = fec_ldpc_expand(q->ldpc_base, q->ldpc_mb, q->ldpc_nb, q->ldpc_Z);
+    smatrixb_vmul(H, c, p);
+    for (i=0; i<n-8*k; i++)
+        CONTEND_EQUALITY( p[i], 0 );
+
+    // decoder's compressed-row copy agrees
+    CONTEND_EQUALITY( ldpc_check(q->ldpc, c), 1 );
+    c[17] ^= 1;
+    CONTEND_EQUALITY( ldpc_check(q->ldpc, c), 0 );
+
+    smatrixb_destroy(H);
+    fec_destroy(q);
+}
+
+void autotest_fec_ldpc12_parity() { fec_ldpc_test_parity(LIQUID_FEC_LDPC_R12); }
+void autotest_fec_ldpc23_parity() { fec_ldpc_test_parity(LIQUID_FEC_LDPC_R23); }
+void autotest_fec_ldpc34_parity() { fec_ldpc_test_parity(LIQUID_FEC_LDPC_R34); }
+
+// decode message spanning several (shortened) blocks with random
+// hard-decision bit errors
+//  _fs         :   LDPC scheme
+//  _n          :   decoded message length (bytes)
+//  _num_errors :   number of bit errors per encoded block
+void fec_ldpc_test_errors(fec_scheme   _fs,
+                          unsigned int _n,
+                          unsigned int _num_errors)
+{
+    fec q = fec_create(_fs, NULL);
+
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg[_n];
+    unsigned char msg_enc[n_enc];
+    unsigned char msg_dec[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+
+    // flip distinct bits within each encoded block
+    unsigned int num_blocks = q->num_blocks;
+    unsigned int enc_block_len = n_enc / num_blocks;
+    unsigned int b;
+    for (b=0; b<num_blocks; b++) {
+        unsigned char * r = &msg_enc[b*enc_block_len];
+        for (i=0; i<_num_errors; i++)
+            r[(7*i + 3*b) % enc_block_len] ^= 1 << ((5*i + b) % 8);
+    }
+
+    fec_decode(q, _n, msg_enc, msg_dec);
+    CONTEND_SAME_DATA( msg, msg_dec, _n );
+
+    fec_destroy(q);
+}
+
+void autotest_fec_ldpc12_errors() { fec_ldpc_test_errors(LIQUID_FEC_LDPC_R12, 100, 12); }
+void autotest_fec_ldpc23_errors() { fec_ldpc_test_errors(LIQUID_FEC_LDPC_R23, 100,  6); }
+void autotest_fec_ldpc34_errors() { fec_ldpc_test_errors(LIQUID_FEC_LDPC_R34, 100,  3); }
+
+// soft decoding with erased (127) bits
+void autotest_fec_ldpc12_erasures()
+{
+    unsigned int n = 48;
+    fec q = fec_create(LIQUID_FEC_LDPC_R12, NULL);
+
+    unsigned int n_enc = fec_get_enc_msg_length(LIQUID_FEC_LDPC_R12,n);
+    unsigned char msg[n];
+    unsigned char msg_enc[n_enc];
+    unsigned char msg_soft[8*n_enc];
+    unsigned char msg_dec[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, n, msg, msg_enc);
+    for (i=0; i<8*n_enc; i++)
+        msg_soft[i] = ((msg_enc[i/8] >> (7-(i%8))) & 1) ? 255 : 0;
+
+    // erase every fifth bit (20 percent)
+    for (i=0; i<8*n_enc; i+=5)
+        msg_soft[i] = 127;
+
+    fec_decode_soft(q, n, msg_soft, msg_dec);
+    CONTEND_SAME_DATA( msg, msg_dec, n );
+
+    fec_destroy(q);
+}
+
+// decoder terminates early once parity checks are satisfied
+void autotest_ldpc_early_termination()
+{
+    fec q = fec_create(LIQUID_FEC_LDPC_R12, NULL);
+    unsigned int n = 8*q->nn;
+    unsigned int k = q->kk;
+
+    unsigned char msg[k];
+    unsigned char msg_enc[q->nn];
+    unsigned int i;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+    fec_encode(q, k, msg, msg_enc);
+
+    float LLR[n];
+    unsigned char c[n];
+    unsigned char c_hat[n];
+    for (i=0; i<n; i++) {
+        c[i]   = (msg_enc[i/8] >> (7-(i%8))) & 1;
+        LLR[i] = c[i] ? -1.0f : 1.0f;
+    }
+
+    // no errors: parity passes before any iterations
+    CONTEND_EQUALITY( ldpc_decode(q->ldpc, LLR, c_hat, 20), 1 );
+    CONTEND_EQUALITY( q->ldpc->num_iterations, 0 );
+    CONTEND_SAME_DATA( c, c_hat, n );
+
+    // a few weak errors: converges quickly
+    LLR[  3] = -LLR[  3] * 0.5f;
+    LLR[100] = -LLR[100] * 0.5f;
+    LLR[500] = -LLR[500] * 0.5f;
+    CONTEND_EQUALITY( ldpc_decode(q->ldpc, LLR, c_hat, 20), 1 );
+    CONTEND_GREATER_THAN( q->ldpc->num_iterations, 0 );
+    CONTEND_LESS_THAN( q->ldpc->num_iterations, 5 );
+    CONTEND_SAME_DATA( c, c_hat, n );
+
+    fec_destroy(q);
+}
+
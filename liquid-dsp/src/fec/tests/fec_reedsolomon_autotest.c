@@ -28,11 +28,6 @@
 //
 void autotest_reedsolomon_223_255()
 {
-#if !LIBFEC_ENABLED
-    printf("warning: Reed-Solomon codes unavailable\n");
-    return;
-#endif
-
     unsigned int dec_msg_len = 223;
 
     // compute and test encoded message length
@@ -80,3 +75,109 @@ void autotest_reedsolomon_223_255()
     fec_destroy(q);
 }
 
+//
+// AUTOTEST: Reed-Solomon codec, multiple shortened blocks with the
+// maximum number of correctable errors in each
+//
+void fec_reedsolomon_runtest(unsigned int _dec_msg_len)
+{
+    unsigned int enc_msg_len = fec_get_enc_msg_length(LIQUID_FEC_RS_M8,_dec_msg_len);
+
+    unsigned char msg_org[_dec_msg_len];
+    unsigned char msg_enc[enc_msg_len];
+    unsigned char msg_dec[_dec_msg_len];
+
+    unsigned int i;
+    for (i=0; i<_dec_msg_len; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_RS_M8,NULL);
+    fec_encode(q, _dec_msg_len, msg_org, msg_enc);
+
+    // decode clean message
+    fec_decode(q, _dec_msg_len, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, _dec_msg_len);
+
+    // corrupt 16 symbols in each encoded block (spaced to avoid
+    // hitting the same symbol twice)
+    unsigned int num_blocks    = (_dec_msg_len + 222) / 223;
+    unsigned int enc_block_len = enc_msg_len / num_blocks;
+    unsigned int b;
+    for (b=0; b<num_blocks; b++) {
+        unsigned int offset = rand() % enc_block_len;
+        for (i=0; i<16; i++)
+            msg_enc[b*enc_block_len + (offset + i*(enc_block_len/16)) % enc_block_len] ^= 1 + (rand() % 255);
+    }
+
+    fec_decode(q, _dec_msg_len, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, _dec_msg_len);
+
+    fec_destroy(q);
+}
+
+void autotest_reedsolomon_n1()    { fec_reedsolomon_runtest(   1); }
+void autotest_reedsolomon_n64()   { fec_reedsolomon_runtest(  64); }
+void autotest_reedsolomon_n1024() { fec_reedsolomon_runtest(1024); }
+
+//
+// AUTOTEST: native Reed-Solomon codec, errors and erasures
+//
+void autotest_reedsolomon_codec()
+{
+    unsigned int pad = 100;
+    unsigned int k   = 255 - 32 - pad;     // message length
+    unsigned int n   = k + 32;             // block length
+    void * q = reedsolomon_create(8, 0x11d, 1, 1, 32, pad);
+
+    unsigned char msg[n], rec[n];
+    int pos[32];
+    unsigned int i;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+    reedsolomon_encode(q, msg, &msg[k]);
+
+    // codeword must evaluate to zero at the roots alpha^1 ... alpha^32
+    reedsolomon r = (reedsolomon) q;
+    unsigned int j;
+    for (j=0; j<32; j++) {
+        unsigned char s = 0;
+        for (i=0; i<n; i++)
+            s = (s == 0 ? 0 : r->alpha_to[r->index_of[s] + 1 + j]) ^ msg[i];
+        CONTEND_EQUALITY( s, 0 );
+    }
+
+    // clean block
+    memmove(rec, msg, n);
+    CONTEND_EQUALITY( reedsolomon_decode(q, rec, pos, 0), 0 );
+    CONTEND_SAME_DATA( rec, msg, n );
+
+    // 16 errors, including first and last symbols
+    memmove(rec, msg, n);
+    for (i=0; i<16; i++)
+        rec[(i*(n-1))/15] ^= 0x5a + i;
+    CONTEND_EQUALITY( reedsolomon_decode(q, rec, pos, 0), 16 );
+    CONTEND_SAME_DATA( rec, msg, n );
+
+    // 32 erasures
+    memmove(rec, msg, n);
+    for (i=0; i<32; i++) {
+        pos[i] = 3*i + 1;
+        rec[pos[i]] = 0;
+    }
+    CONTEND_EQUALITY( reedsolomon_decode(q, rec, pos, 32) >= 0, 1 );
+    CONTEND_SAME_DATA( rec, msg, n );
+
+    // 8 errors and 16 erasures
+    memmove(rec, msg, n);
+    for (i=0; i<16; i++) {
+        pos[i] = 5*i;
+        rec[pos[i]] ^= 0xff;
+    }
+    for (i=0; i<8; i++)
+        rec[100 + 7*i] ^= 0x33;
+    CONTEND_EQUALITY( reedsolomon_decode(q, rec, pos, 16) >= 0, 1 );
+    CONTEND_SAME_DATA( rec, msg, n );
+
+    reedsolomon_destroy(q);
+}
+
@@ -143,3 +143,40 @@ void autotest_secded2216_codec_e2()
     }
 }
 
+//
+// AUTOTEST: SEC-DED (22,16) array decoder
+//
+void autotest_secded2216_array()
+{
+    unsigned int n = 3*22;         // number of symbols
+    unsigned char msg_org[2*n];    // original message
+    unsigned char msg_enc[3*n];    // encoded message
+    unsigned char msg_dec[2*n];    // decoded message (array)
+    unsigned char sym_dec[2];      // decoded symbol
+    unsigned int i;
+    unsigned int k;
+
+    // encode, adding zero, one, and two errors to each symbol in turn
+    for (i=0; i<n; i++) {
+        for (k=0; k<2; k++)
+            msg_org[2*i+k] = rand() & 0xff;
+        fec_secded2216_encode_symbol(&msg_org[2*i], &msg_enc[3*i]);
+
+        unsigned int b0 = (i/3) % 22;        // first error location
+        unsigned int b1 = (b0 + 5) % 22;     // second error location
+        if ((i % 3) > 0) msg_enc[3*i + 3-(b0>>3)-1] ^= 1 << (b0 & 7);
+        if ((i % 3) > 1) msg_enc[3*i + 3-(b1>>3)-1] ^= 1 << (b1 & 7);
+    }
+
+    // decode array and validate against symbol decoder
+    unsigned int num_errors = fec_secded2216_decode_array(msg_enc, n, msg_dec);
+    CONTEND_EQUALITY( num_errors, n/3 );
+    for (i=0; i<n; i++) {
+        int flag = fec_secded2216_decode_symbol(&msg_enc[3*i], sym_dec);
+        CONTEND_EQUALITY( flag, i % 3 );
+        CONTEND_SAME_DATA( &msg_dec[2*i], sym_dec, 2 );
+        if (flag < 2) {
+            CONTEND_SAME_DATA( &msg_dec[2*i], &msg_org[2*i], 2 );
+        }
+    }
+}
@@ -159,3 +159,40 @@ void autotest_secded3932_codec_e2()
     }
 }
 
+//
+// AUTOTEST: SEC-DED (39,32) array decoder
+//
+void autotest_secded3932_array()
+{
+    unsigned int n = 3*39;         // number of symbols
+    unsigned char msg_org[4*n];    // original message
+    unsigned char msg_enc[5*n];    // encoded message
+    unsigned char msg_dec[4*n];    // decoded message (array)
+    unsigned char sym_dec[4];      // decoded symbol
+    unsigned int i;
+    unsigned int k;
+
+    // encode, adding zero, one, and two errors to each symbol in turn
+    for (i=0; i<n; i++) {
+        for (k=0; k<4; k++)
+            msg_org[4*i+k] = rand() & 0xff;
+        fec_secded3932_encode_symbol(&msg_org[4*i], &msg_enc[5*i]);
+
+        unsigned int b0 = (i/3) % 39;        // first error location
+        unsigned int b1 = (b0 + 5) % 39;     // second error location
+        if ((i % 3) > 0) msg_enc[5*i + 5-(b0>>3)-1] ^= 1 << (b0 & 7);
+        if ((i % 3) > 1) msg_enc[5*i + 5-(b1>>3)-1] ^= 1 << (b1 & 7);
+    }
+
+    // decode array and validate against symbol decoder
+    unsigned int num_errors = fec_secded3932_decode_array(msg_enc, n, msg_dec);
+    CONTEND_EQUALITY( num_errors, n/3 );
+    for (i=0; i<n; i++) {
+        int flag = fec_secded3932_decode_symbol(&msg_enc[5*i], sym_dec);
+        CONTEND_EQUALITY( flag, i % 3 );
+        CONTEND_SAME_DATA( &msg_dec[4*i], sym_dec, 4 );
+        if (flag < 2) {
+            CONTEND_SAME_DATA( &msg_dec[4*i], &msg_org[4*i], 4 );
+        }
+    }
+}
@@ -174,3 +174,40 @@ void autotest_secded7264_codec_e2()
     }
 }
 
+//
+// AUTOTEST: SEC-DED (72,64) array decoder
+//
+void autotest_secded7264_array()
+{
+    unsigned int n = 3*72;         // number of symbols
+    unsigned char msg_org[8*n];    // original message
+    unsigned char msg_enc[9*n];    // encoded message
+    unsigned char msg_dec[8*n];    // decoded message (array)
+    unsigned char sym_dec[8];      // decoded symbol
+    unsigned int i;
+    unsigned int k;
+
+    // encode, adding zero, one, and two errors to each symbol in turn
+    for (i=0; i<n; i++) {
+        for (k=0; k<8; k++)
+            msg_org[8*i+k] = rand() & 0xff;
+        fec_secded7264_encode_symbol(&msg_org[8*i], &msg_enc[9*i]);
+
+        unsigned int b0 = (i/3) % 72;        // first error location
+        unsigned int b1 = (b0 + 5) % 72;     // second error location
+        if ((i % 3) > 0) msg_enc[9*i + 9-(b0>>3)-1] ^= 1 << (b0 & 7);
+        if ((i % 3) > 1) msg_enc[9*i + 9-(b1>>3)-1] ^= 1 << (b1 & 7);
+    }
+
+    // decode array and validate against symbol decoder
+    unsigned int num_errors = fec_secded7264_decode_array(msg_enc, n, msg_dec);
+    CONTEND_EQUALITY( num_errors, n/3 );
+    for (i=0; i<n; i++) {
+        int flag = fec_secded7264_decode_symbol(&msg_enc[9*i], sym_dec);
+        CONTEND_EQUALITY( flag, i % 3 );
+        CONTEND_SAME_DATA( &msg_dec[8*i], sym_dec, 8 );
+        if (flag < 2) {
+            CONTEND_SAME_DATA( &msg_dec[8*i], &msg_org[8*i], 8 );
+        }
+    }
+}
@@ -62,3 +62,5 @@ void autotest_packetizer_n16_0_0()  { packetizer_test_codec(16, LIQUID_CRC_32, L
 void autotest_packetizer_n16_0_1()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_REP3);       }
 void autotest_packetizer_n16_0_2()  { packetizer_test_codec(16, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_HAMMING74);  }
 
+void autotest_packetizer_n64_0_ldpc12() { packetizer_test_codec(64, LIQUID_CRC_32, LIQUID_FEC_NONE, LIQUID_FEC_LDPC_R12); }
+void autotest_packetizer_n64_h74_ldpc34() { packetizer_test_codec(64, LIQUID_CRC_32, LIQUID_FEC_HAMMING74, LIQUID_FEC_LDPC_R34); }
@@ -23,6 +23,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+#include <time.h>
 #include "liquid.internal.h"
 
 struct FFT(plan_s)
@@ -51,11 +53,14 @@ struct FFT(plan_s)
             DOTPROD() * dotprod;        // inner dot products
         } dft;
 
-        // radix-2 transform data
+        // radix-2 transform data (self-sorting radix-4 stages)
         struct {
             unsigned int m;             // log2(nfft)
-            unsigned int * index_rev;   // reversed indices
-            TC * twiddle;               // twiddle factors
+            unsigned int num_stages;    // number of radix-4/radix-2 stages
+            TC * twiddle;               // twiddle factors, contiguous by stage
+            TC * buf0;                  // intermediate buffer
+            TC * buf1;                  // intermediate buffer (in-place only)
+            FFT(_stage_t) * stage;      // stage kernel
         } radix2;
 
         // recursive mixed-radix transform data:
@@ -97,30 +102,69 @@ struct FFT(plan_s)
     } data;
 };
 
+// minimum execution time per planner trial [seconds]
+#define FFT_PLANNER_MIN_TIME    (1e-3)
+
+// number of trials per candidate (minimum time is retained)
+#define FFT_PLANNER_NUM_TRIALS  (3)
+
+// largest transform for which the regular DFT is a planner candidate
+#define FFT_PLANNER_MAX_DFT     (64)
+
 // create FFT plan, regular complex one-dimensional transform
 //  _nfft   :   FFT size
 //  _x      :   input array [size: _nfft x 1]
 //  _y      :   output array [size: _nfft x 1]
 //  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
-//  _flags  :   fft method
+//  _flags  :   planner flags, e.g. LIQUID_FFT_MEASURE
 FFT(plan) FFT(_create_plan)(unsigned int _nfft,
                             TC *         _x,
                             TC *         _y,
                             int          _dir,
                             int          _flags)
 {
-    // determine best method for execution
-    // TODO : check flags and allow user override
-    liquid_fft_method method = liquid_fft_estimate_method(_nfft);
+    // determine best method for execution: use existing wisdom if
+    // available, otherwise measure or estimate
+    liquid_fft_method method;
+    unsigned int      radix = 0;
+    if (liquid_fft_wisdom_lookup(_nfft, _dir, &method, &radix)) {
+        // method already known
+    } else if ( (_flags & LIQUID_FFT_MEASURE) && _nfft > 8 ) {
+        // benchmark candidate methods (small transforms always use
+        // DFT codelets)
+        FFT(_plan_measure)(_nfft, _dir, _flags, &method, &radix);
+    } else {
+        method = liquid_fft_estimate_method(_nfft);
+    }
+
+    return FFT(_create_plan_method)(_nfft, _x, _y, _dir, _flags, method, radix);
+}
 
-    // initialize fft based on method
-    switch (method) {
+// create FFT plan using specific method
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags  :   planner flags
+//  _method :   fft method
+//  _radix  :   mixed-radix split (0 to estimate)
+FFT(plan) FFT(_create_plan_method)(unsigned int      _nfft,
+                                   TC *              _x,
+                                   TC *              _y,
+                                   int               _dir,
+                                   int               _flags,
+                                   liquid_fft_method _method,
+                                   unsigned int      _radix)
+{
+    switch (_method) {
     case LIQUID_FFT_METHOD_RADIX2:
         // use radix-2 decimation-in-time method
         return FFT(_create_plan_radix2)(_nfft, _x, _y, _dir, _flags);
 
     case LIQUID_FFT_METHOD_MIXED_RADIX:
         // use Cooley-Tukey mixed-radix algorithm
+        if (_radix > 0)
+            return FFT(_create_plan_mixed_radix_split)(_nfft, _x, _y, _dir, _flags, _radix);
         return FFT(_create_plan_mixed_radix)(_nfft, _x, _y, _dir, _flags);
 
     case LIQUID_FFT_METHOD_RADER:
@@ -144,6 +188,106 @@ FFT(plan) FFT(_create_plan)(unsigned int _nfft,
     return NULL;
 }
 
+// measure execution time of plan [seconds per transform], retaining
+// the fastest of several trials
+static double FFT(_plan_time)(FFT(plan) _q)
+{
+    double t_min = 0.0;
+    unsigned int k;
+    for (k=0; k<FFT_PLANNER_NUM_TRIALS; k++) {
+        // double the number of executions until the minimum time is reached
+        unsigned long int num_executions = 1;
+        double t;
+        while (1) {
+            unsigned long int i;
+            clock_t t0 = clock();
+            for (i=0; i<num_executions; i++)
+                FFT(_execute)(_q);
+            t = (double)(clock() - t0) / (double)CLOCKS_PER_SEC;
+            if (t >= FFT_PLANNER_MIN_TIME)
+                break;
+            num_executions <<= 1;
+        }
+        t /= (double)num_executions;
+        t_min = (k==0 || t < t_min) ? t : t_min;
+    }
+    return t_min;
+}
+
+// benchmark candidate methods for transform, saving the fastest as
+// wisdom; sub-transforms are measured (and saved) recursively as the
+// candidate plans are created
+//  _nfft   :   transform size
+//  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)
+//  _flags  :   planner flags
+//  _method :   resulting method
+//  _radix  :   resulting mixed-radix split (0 otherwise)
+void FFT(_plan_measure)(unsigned int        _nfft,
+                        int                 _dir,
+                        int                 _flags,
+                        liquid_fft_method * _method,
+                        unsigned int *      _radix)
+{
+    // allocate buffers and initialize input
+    TC * x = (TC*) malloc(_nfft*sizeof(TC));
+    TC * y = (TC*) malloc(_nfft*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<_nfft; i++)
+        x[i] = cosf(0.1f*i) + _Complex_I*sinf(0.3f*i);
+
+    // enumerate candidates: radix-2, Rader (types I and II), DFT
+    // (small sizes only), and mixed-radix with every non-trivial split
+    unsigned int Q;
+    unsigned int num_splits = 0;
+    for (Q=2; Q<_nfft; Q++)
+        num_splits += (_nfft % Q) == 0 ? 1 : 0;
+    liquid_fft_method method[num_splits + 4];
+    unsigned int      radix [num_splits + 4];
+    unsigned int num_candidates = 0;
+    if (fft_is_radix2(_nfft)) {
+        method[num_candidates] = LIQUID_FFT_METHOD_RADIX2;
+        radix [num_candidates++] = 0;
+    }
+    if (liquid_is_prime(_nfft)) {
+        method[num_candidates] = LIQUID_FFT_METHOD_RADER;
+        radix [num_candidates++] = 0;
+        method[num_candidates] = LIQUID_FFT_METHOD_RADER2;
+        radix [num_candidates++] = 0;
+    }
+    if (_nfft <= FFT_PLANNER_MAX_DFT) {
+        method[num_candidates] = LIQUID_FFT_METHOD_DFT;
+        radix [num_candidates++] = 0;
+    }
+    for (Q=2; Q<_nfft; Q++) {
+        if ( (_nfft % Q) == 0 ) {
+            method[num_candidates] = LIQUID_FFT_METHOD_MIXED_RADIX;
+            radix [num_candidates++] = Q;
+        }
+    }
+
+    // time each candidate, retaining the fastest
+    unsigned int i_opt = 0;
+    double       t_opt = 0.0;
+    for (i=0; i<num_candidates; i++) {
+        FFT(plan) q = FFT(_create_plan_method)(_nfft, x, y, _dir, _flags, method[i], radix[i]);
+        double t = FFT(_plan_time)(q);
+        FFT(_destroy_plan)(q);
+
+        if (i == 0 || t < t_opt) {
+            i_opt = i;
+            t_opt = t;
+        }
+    }
+
+    free(x);
+    free(y);
+
+    // save result
+    liquid_fft_wisdom_add(_nfft, _dir, method[i_opt], radix[i_opt]);
+    *_method = method[i_opt];
+    *_radix  = radix[i_opt];
+}
+
 // destroy FFT plan
 void FFT(_destroy_plan)(FFT(plan) _q)
 {
@@ -41,6 +41,26 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
                                         TC *         _y,
                                         int          _dir,
                                         int          _flags)
+{
+    // find first 'prime' factor of _nfft
+    unsigned int Q = FFT(_estimate_mixed_radix)(_nfft);
+
+    return FFT(_create_plan_mixed_radix_split)(_nfft, _x, _y, _dir, _flags, Q);
+}
+
+// create mixed-radix FFT plan with specific split, nfft = P*Q
+//  _nfft   :   FFT size
+//  _x      :   input array [size: _nfft x 1]
+//  _y      :   output array [size: _nfft x 1]
+//  _dir    :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags  :   fft flags
+//  _Q      :   second FFT size, must divide _nfft
+FFT(plan) FFT(_create_plan_mixed_radix_split)(unsigned int _nfft,
+                                              TC *         _x,
+                                              TC *         _y,
+                                              int          _dir,
+                                              int          _flags,
+                                              unsigned int _Q)
 {
     // allocate plan and initialize all internal arrays to NULL
     FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
@@ -55,12 +75,14 @@ FFT(plan) FFT(_create_plan_mixed_radix)(unsigned int _nfft,
 
     q->execute   = FFT(_execute_mixed_radix);
 
-    // find first 'prime' factor of _nfft
     unsigned int i;
-    unsigned int Q = FFT(_estimate_mixed_radix)(_nfft);
+    unsigned int Q = _Q;
     if (Q==0) {
         fprintf(stderr,"error: fft_create_plan_mixed_radix(), _nfft=%u is prime\n", _nfft);
         exit(1);
+    } else if (Q == 1 || Q >= _nfft) {
+        fprintf(stderr,"error: fft_create_plan_mixed_radix(), invalid split Q=%u for _nfft=%u\n", Q, _nfft);
+        exit(1);
     } else if ( (_nfft % Q) != 0 ) {
         fprintf(stderr,"error: fft_create_plan_mixed_radix(), _nfft=%u is not divisible by Q=%u\n", _nfft, Q);
         exit(1);
@@ -26,7 +26,15 @@
 #include <math.h>
 #include "liquid.internal.h"
 
-// create FFT plan for regular DFT
+// create FFT plan for transforms of the form 2^m
+//
+// The transform is computed with self-sorting (Stockham) radix-4
+// stages, followed by a single radix-2 stage when m is odd. Each stage
+// reads from one buffer and writes to another in natural order so no
+// bit-reversal permutation is needed; the last stage writes directly
+// to the output array. Twiddle factors for each stage are stored
+// contiguously, {w^p, w^2p, w^3p} for p in [0,n1) where n1 is a quarter
+// of the stage length.
 //  _nfft   :   FFT size
 //  _x      :   input array [size: _nfft x 1]
 //  _y      :   output array [size: _nfft x 1]
@@ -51,20 +59,55 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
 
     q->execute   = FFT(_execute_radix2);
 
-    // initialize twiddle factors, indices for radix-2 transforms
-    q->data.radix2.m = liquid_msb_index(q->nfft) - 1;  // m = log2(nfft)
-    
-    q->data.radix2.index_rev = (unsigned int *) malloc((q->nfft)*sizeof(unsigned int));
-    unsigned int i;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.index_rev[i] = fft_reverse_index(i,q->data.radix2.m);
-
-    // initialize twiddle factors
-    q->data.radix2.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
-    
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+    // validate input
+    if (!fft_is_radix2(_nfft) || _nfft < 2) {
+        fprintf(stderr,"error: fft_create_plan_radix2(), _nfft=%u is not of the form 2^m\n", _nfft);
+        exit(1);
+    }
+
+    // m = log2(nfft), number of stages: floor(m/2) radix-4 plus one
+    // radix-2 stage if m is odd
+    q->data.radix2.m = liquid_msb_index(q->nfft) - 1;
+    q->data.radix2.num_stages = q->data.radix2.m/2 + (q->data.radix2.m % 2);
+
+    // initialize twiddle factors for each radix-4 stage
+    unsigned int s, p, n0, n1;
+    unsigned int twiddle_len = 0;
+    for (s=1; _nfft/s >= 4; s*=4)
+        twiddle_len += 3*(_nfft/s)/4;
+    q->data.radix2.twiddle = (TC *) malloc((twiddle_len > 0 ? twiddle_len : 1)*sizeof(TC));
+
+    double d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    TC * w = q->data.radix2.twiddle;
+    for (s=1; _nfft/s >= 4; s*=4) {
+        n0 = _nfft / s;
+        n1 = n0 / 4;
+        for (p=0; p<n1; p++) {
+            w[     p] = cexp(_Complex_I*d*2*M_PI*(double)(  p) / (double)n0);
+            w[  n1+p] = cexp(_Complex_I*d*2*M_PI*(double)(2*p) / (double)n0);
+            w[2*n1+p] = cexp(_Complex_I*d*2*M_PI*(double)(3*p) / (double)n0);
+        }
+        w += 3*n1;
+    }
+
+    // allocate intermediate buffers; the output array can only be
+    // used as an intermediate buffer if the transform is not in place
+    q->data.radix2.buf0 = (TC *) malloc(q->nfft * sizeof(TC));
+    q->data.radix2.buf1 = (_x == _y) ? (TC *) malloc(q->nfft * sizeof(TC)) : NULL;
+
+    // select stage kernel based on host CPU
+    q->data.radix2.stage = FFT(_radix4_stage);
+#if LIQUID_FFT_SIMD
+    if (_nfft >= 16) {
+        switch (liquid_simd_level()) {
+#if LIQUID_FFT_AVX2
+        case LIQUID_SIMD_AVX512:
+        case LIQUID_SIMD_AVX2:   q->data.radix2.stage = fft_radix4_stage_avx; break;
+#endif
+        default:                 q->data.radix2.stage = fft_radix4_stage_sse;
+        }
+    }
+#endif
 
     return q;
 }
@@ -73,8 +116,9 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
 void FFT(_destroy_plan_radix2)(FFT(plan) _q)
 {
     // free data specific to radix-2 transforms
-    free(_q->data.radix2.index_rev);
     free(_q->data.radix2.twiddle);
+    free(_q->data.radix2.buf0);
+    free(_q->data.radix2.buf1);
 
     // free main object memory
     free(_q);
@@ -83,51 +127,82 @@ void FFT(_destroy_plan_radix2)(FFT(plan) _q)
 // execute radix-2 FFT
 void FFT(_execute_radix2)(FFT(plan) _q)
 {
-    // swap values
-    unsigned int i,j,k;
-
-    // unroll loop
-    unsigned int nfft4 = (_q->nfft>>2)<<2;  // floor(_nfft/4)
-    for (i=0; i<nfft4; i+=4) {
-        _q->y[i  ] = _q->x[ _q->data.radix2.index_rev[i  ] ];
-        _q->y[i+1] = _q->x[ _q->data.radix2.index_rev[i+1] ];
-        _q->y[i+2] = _q->x[ _q->data.radix2.index_rev[i+2] ];
-        _q->y[i+3] = _q->x[ _q->data.radix2.index_rev[i+3] ];
+    unsigned int num_stages = _q->data.radix2.num_stages;
+
+    // intermediate buffers, alternating such that the last stage
+    // writes to the output array
+    TC * buf[2];
+    buf[0] = _q->data.radix2.buf0;
+    buf[1] = _q->data.radix2.buf1 == NULL ? _q->y : _q->data.radix2.buf1;
+
+    TC * x = _q->x;
+    TC * w = _q->data.radix2.twiddle;
+    unsigned int k, s = 1;
+    for (k=0; k<num_stages; k++) {
+        TC * y = (k == num_stages-1) ? _q->y : buf[(num_stages - k) % 2];
+
+        _q->data.radix2.stage(x, y, _q->nfft, s, w, _q->direction);
+
+        // advance to next stage
+        w += 3*(_q->nfft/s)/4;
+        s *= 4;
+        x  = y;
     }
+}
 
-#if 0
-    // clean up remaining
-    // NOTE : this only happens when _nfft=2 because we know (_nfft%4)==0 otherwise
-    for ( ; i<_q->nfft; i++)
-        _q->y[i] = _q->x[ _q->data.radix2.index_rev[i] ];
-#endif
+// execute single self-sorting radix-4 stage (radix-2 if the stage
+// length is 2); portable C version
+//  _x      :   input array [size: _n x 1]
+//  _y      :   output array [size: _n x 1]
+//  _n      :   transform size
+//  _s      :   stage stride (product of previous radices)
+//  _w      :   stage twiddle factors [size: 3*_n/(4*_s) x 1]
+//  _dir    :   fft direction
+void FFT(_radix4_stage)(TC *         _x,
+                        TC *         _y,
+                        unsigned int _n,
+                        unsigned int _s,
+                        TC *         _w,
+                        int          _dir)
+{
+    unsigned int n0 = _n / _s;  // stage length
+    unsigned int p, q;
+
+    // final radix-2 stage (no twiddle factors)
+    if (n0 == 2) {
+        for (q=0; q<_s; q++) {
+            TC a = _x[q];
+            TC b = _x[q + _s];
+            _y[q]      = a + b;
+            _y[q + _s] = a - b;
+        }
+        return;
+    }
 
-    TC yp;
-    TC *y=_q->y;
-    unsigned int n1 = 0;
-    unsigned int n2 = 1;
-
-    TC t;   // twiddle value
-    unsigned int stride = _q->nfft;
-    unsigned int twiddle_index;
-
-    for (i=0; i<_q->data.radix2.m; i++) {
-        n1 = n2;
-        n2 *= 2;
-        stride >>= 1;
-
-        twiddle_index = 0;
-    
-        for (j=0; j<n1; j++) {
-            t = _q->data.radix2.twiddle[twiddle_index];
-            twiddle_index = (twiddle_index + stride) % _q->nfft;
-
-            for (k=j; k<_q->nfft; k+=n2) {
-                // NOTE: most computation is with the multiplication in next line
-                yp      =  y[k+n1]*t;
-                y[k+n1] =  y[k] - yp;
-                y[k]    += yp;
-            }
+    // radix-4 stage: multiplying by -j (forward) or +j (reverse) is
+    // a swap of real/imaginary components and a sign change
+    unsigned int n1 = n0 / 4;
+    T g = (_dir == LIQUID_FFT_FORWARD) ? 1 : -1;
+    for (p=0; p<n1; p++) {
+        TC w1 = _w[     p];
+        TC w2 = _w[  n1+p];
+        TC w3 = _w[2*n1+p];
+        for (q=0; q<_s; q++) {
+            TC a = _x[q + _s*(p       )];
+            TC b = _x[q + _s*(p +   n1)];
+            TC c = _x[q + _s*(p + 2*n1)];
+            TC d = _x[q + _s*(p + 3*n1)];
+
+            TC apc  = a + c;
+            TC amc  = a - c;
+            TC bpd  = b + d;
+            TC bmd  = b - d;
+            TC jbmd = g*cimagf(bmd) - _Complex_I*g*crealf(bmd);
+
+            _y[q + _s*(4*p  )] =      apc + bpd;
+            _y[q + _s*(4*p+1)] = w1*(amc + jbmd);
+            _y[q + _s*(4*p+2)] = w2*(apc - bpd);
+            _y[q + _s*(4*p+3)] = w3*(amc - jbmd);
         }
     }
 }
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Self-sorting radix-4 FFT stage kernel (AVX2/FMA)
+//
+// Same structure as fft_radix4.mmx.c with four complex values per
+// register; the first stage transposes 4x4 blocks of outputs.
+//
+
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// complex multiply of packed values, {a0*b0, ..., a3*b3}
+static inline __m256 fft_radix4_cmul_avx(__m256 _a,
+                                         __m256 _b)
+{
+    __m256 br = _mm256_moveldup_ps(_b);
+    __m256 bi = _mm256_movehdup_ps(_b);
+    __m256 as = _mm256_permute_ps(_a, _MM_SHUFFLE(2,3,0,1));
+
+    // {ar*br - ai*bi, ai*br + ar*bi}
+    return _mm256_fmaddsub_ps(_a, br, _mm256_mul_ps(as, bi));
+}
+
+// radix-4 butterfly on packed values
+#define FFT_RADIX4_BUTTERFLY_AVX(A,B,C,D,Y0,Y1,Y2,Y3)           \
+{                                                               \
+    __m256 apc  = _mm256_add_ps(A, C);                          \
+    __m256 amc  = _mm256_sub_ps(A, C);                          \
+    __m256 bpd  = _mm256_add_ps(B, D);                          \
+    __m256 bmd  = _mm256_sub_ps(B, D);                          \
+    __m256 jbmd = _mm256_xor_ps(_mm256_permute_ps(bmd, _MM_SHUFFLE(2,3,0,1)), sign_j); \
+    Y0 = _mm256_add_ps(apc, bpd);                               \
+    Y1 = _mm256_add_ps(amc, jbmd);                              \
+    Y2 = _mm256_sub_ps(apc, bpd);                               \
+    Y3 = _mm256_sub_ps(amc, jbmd);                              \
+}
+
+void fft_radix4_stage_avx(float complex * _x,
+                          float complex * _y,
+                          unsigned int    _n,
+                          unsigned int    _s,
+                          float complex * _w,
+                          int             _dir)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    float * w = (float*) _w;
+
+    unsigned int n0 = _n / _s;  // stage length
+    unsigned int p, q;
+
+    // final radix-2 stage (no twiddle factors)
+    if (n0 == 2) {
+        for (q=0; q<_s; q+=4) {
+            __m256 a = _mm256_loadu_ps(&x[2*q]);
+            __m256 b = _mm256_loadu_ps(&x[2*(q+_s)]);
+            _mm256_storeu_ps(&y[2*q],      _mm256_add_ps(a,b));
+            _mm256_storeu_ps(&y[2*(q+_s)], _mm256_sub_ps(a,b));
+        }
+        return;
+    }
+
+    // sign mask to multiply by -j (forward) or +j (reverse) after
+    // swapping real/imaginary components
+    __m256 sign_j = (_dir == LIQUID_FFT_FORWARD) ?
+        _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f) :
+        _mm256_set_ps( 0.0f,-0.0f,  0.0f,-0.0f,  0.0f,-0.0f,  0.0f,-0.0f);
+
+    unsigned int n1 = n0 / 4;
+    __m256 a, b, c, d, y0, y1, y2, y3;
+    if (_s == 1) {
+        // first stage: four butterflies at a time, transpose outputs
+        for (p=0; p<n1; p+=4) {
+            a = _mm256_loadu_ps(&x[2*(p       )]);
+            b = _mm256_loadu_ps(&x[2*(p +   n1)]);
+            c = _mm256_loadu_ps(&x[2*(p + 2*n1)]);
+            d = _mm256_loadu_ps(&x[2*(p + 3*n1)]);
+            FFT_RADIX4_BUTTERFLY_AVX(a,b,c,d,y0,y1,y2,y3);
+
+            y1 = fft_radix4_cmul_avx(y1, _mm256_loadu_ps(&w[2*(     p)]));
+            y2 = fft_radix4_cmul_avx(y2, _mm256_loadu_ps(&w[2*(  n1+p)]));
+            y3 = fft_radix4_cmul_avx(y3, _mm256_loadu_ps(&w[2*(2*n1+p)]));
+
+            // transpose complex values (64-bit elements)
+            __m256d t0 = _mm256_unpacklo_pd(_mm256_castps_pd(y0), _mm256_castps_pd(y1));
+            __m256d t1 = _mm256_unpackhi_pd(_mm256_castps_pd(y0), _mm256_castps_pd(y1));
+            __m256d t2 = _mm256_unpacklo_pd(_mm256_castps_pd(y2), _mm256_castps_pd(y3));
+            __m256d t3 = _mm256_unpackhi_pd(_mm256_castps_pd(y2), _mm256_castps_pd(y3));
+            _mm256_storeu_pd((double*)&y[8*p     ], _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd((double*)&y[8*p +  8], _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd((double*)&y[8*p + 16], _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd((double*)&y[8*p + 24], _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+    } else if (n1 == 1) {
+        // last radix-4 stage: all twiddle factors are unity
+        for (q=0; q<_s; q+=4) {
+            a = _mm256_loadu_ps(&x[2*(q     )]);
+            b = _mm256_loadu_ps(&x[2*(q+  _s)]);
+            c = _mm256_loadu_ps(&x[2*(q+2*_s)]);
+            d = _mm256_loadu_ps(&x[2*(q+3*_s)]);
+            FFT_RADIX4_BUTTERFLY_AVX(a,b,c,d,y0,y1,y2,y3);
+            _mm256_storeu_ps(&y[2*(q     )], y0);
+            _mm256_storeu_ps(&y[2*(q+  _s)], y1);
+            _mm256_storeu_ps(&y[2*(q+2*_s)], y2);
+            _mm256_storeu_ps(&y[2*(q+3*_s)], y3);
+        }
+    } else {
+        // remaining stages: columns share twiddle factors
+        for (p=0; p<n1; p++) {
+            __m256 w1 = _mm256_castpd_ps(_mm256_broadcast_sd((double*)&w[2*(     p)]));
+            __m256 w2 = _mm256_castpd_ps(_mm256_broadcast_sd((double*)&w[2*(  n1+p)]));
+            __m256 w3 = _mm256_castpd_ps(_mm256_broadcast_sd((double*)&w[2*(2*n1+p)]));
+
+            float * xp = &x[2*_s*p];
+            float * yp = &y[2*_s*4*p];
+            for (q=0; q<_s; q+=4) {
+                a = _mm256_loadu_ps(&xp[2*(q       )]);
+                b = _mm256_loadu_ps(&xp[2*(q+  _s*n1)]);
+                c = _mm256_loadu_ps(&xp[2*(q+2*_s*n1)]);
+                d = _mm256_loadu_ps(&xp[2*(q+3*_s*n1)]);
+                FFT_RADIX4_BUTTERFLY_AVX(a,b,c,d,y0,y1,y2,y3);
+                _mm256_storeu_ps(&yp[2*(q     )], y0);
+                _mm256_storeu_ps(&yp[2*(q+  _s)], fft_radix4_cmul_avx(y1, w1));
+                _mm256_storeu_ps(&yp[2*(q+2*_s)], fft_radix4_cmul_avx(y2, w2));
+                _mm256_storeu_ps(&yp[2*(q+3*_s)], fft_radix4_cmul_avx(y3, w3));
+            }
+        }
+    }
+}
+
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Self-sorting radix-4 FFT stage kernel (SSE)
+//
+// Each register holds two complex values {re,im,re,im}. The first
+// stage (stride 1) operates on two consecutive butterflies at a time
+// and interleaves the results; all other stages have a stride which
+// is a multiple of four and operate on consecutive columns sharing the
+// same twiddle factors. See FFT(_radix4_stage) in fft_radix2.c.
+//
+
+#include <xmmintrin.h>
+
+#include "liquid.internal.h"
+
+// complex multiply of two packed pairs, {a0*b0, a1*b1}
+static inline __m128 fft_radix4_cmul_sse(__m128 _a,
+                                         __m128 _b,
+                                         __m128 _sign_re)
+{
+    __m128 br = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(2,2,0,0));
+    __m128 bi = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(3,3,1,1));
+    __m128 as = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(2,3,0,1));
+
+    // {ar*br - ai*bi, ai*br + ar*bi}
+    return _mm_add_ps(_mm_mul_ps(_a, br), _mm_xor_ps(_mm_mul_ps(as, bi), _sign_re));
+}
+
+// radix-4 butterfly on packed values
+#define FFT_RADIX4_BUTTERFLY_SSE(A,B,C,D,Y0,Y1,Y2,Y3)           \
+{                                                               \
+    __m128 apc  = _mm_add_ps(A, C);                             \
+    __m128 amc  = _mm_sub_ps(A, C);                             \
+    __m128 bpd  = _mm_add_ps(B, D);                             \
+    __m128 bmd  = _mm_sub_ps(B, D);                             \
+    __m128 jbmd = _mm_xor_ps(_mm_shuffle_ps(bmd, bmd, _MM_SHUFFLE(2,3,0,1)), sign_j); \
+    Y0 = _mm_add_ps(apc, bpd);                                  \
+    Y1 = _mm_add_ps(amc, jbmd);                                 \
+    Y2 = _mm_sub_ps(apc, bpd);                                  \
+    Y3 = _mm_sub_ps(amc, jbmd);                                 \
+}
+
+void fft_radix4_stage_sse(float complex * _x,
+                          float complex * _y,
+                          unsigned int    _n,
+                          unsigned int    _s,
+                          float complex * _w,
+                          int             _dir)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+    float * w = (float*) _w;
+
+    unsigned int n0 = _n / _s;  // stage length
+    unsigned int p, q;
+
+    // final radix-2 stage (no twiddle factors)
+    if (n0 == 2) {
+        for (q=0; q<_s; q+=2) {
+            __m128 a = _mm_loadu_ps(&x[2*q]);
+            __m128 b = _mm_loadu_ps(&x[2*(q+_s)]);
+            _mm_storeu_ps(&y[2*q],      _mm_add_ps(a,b));
+            _mm_storeu_ps(&y[2*(q+_s)], _mm_sub_ps(a,b));
+        }
+        return;
+    }
+
+    // sign masks: real components only, and those applied after
+    // swapping real/imaginary components to multiply by -j (forward)
+    // or +j (reverse)
+    __m128 sign_re = _mm_set_ps( 0.0f, -0.0f,  0.0f, -0.0f);
+    __m128 sign_im = _mm_set_ps(-0.0f,  0.0f, -0.0f,  0.0f);
+    __m128 sign_j  = (_dir == LIQUID_FFT_FORWARD) ? sign_im : sign_re;
+
+    unsigned int n1 = n0 / 4;
+    __m128 a, b, c, d, y0, y1, y2, y3;
+    if (_s == 1) {
+        // first stage: two butterflies at a time, interleave outputs
+        for (p=0; p<n1; p+=2) {
+            a = _mm_loadu_ps(&x[2*(p       )]);
+            b = _mm_loadu_ps(&x[2*(p +   n1)]);
+            c = _mm_loadu_ps(&x[2*(p + 2*n1)]);
+            d = _mm_loadu_ps(&x[2*(p + 3*n1)]);
+            FFT_RADIX4_BUTTERFLY_SSE(a,b,c,d,y0,y1,y2,y3);
+
+            y1 = fft_radix4_cmul_sse(y1, _mm_loadu_ps(&w[2*(     p)]), sign_re);
+            y2 = fft_radix4_cmul_sse(y2, _mm_loadu_ps(&w[2*(  n1+p)]), sign_re);
+            y3 = fft_radix4_cmul_sse(y3, _mm_loadu_ps(&w[2*(2*n1+p)]), sign_re);
+
+            _mm_storeu_ps(&y[8*p     ], _mm_movelh_ps(y0, y1));
+            _mm_storeu_ps(&y[8*p +  4], _mm_movelh_ps(y2, y3));
+            _mm_storeu_ps(&y[8*p +  8], _mm_movehl_ps(y1, y0));
+            _mm_storeu_ps(&y[8*p + 12], _mm_movehl_ps(y3, y2));
+        }
+    } else if (n1 == 1) {
+        // last radix-4 stage: all twiddle factors are unity
+        for (q=0; q<_s; q+=2) {
+            a = _mm_loadu_ps(&x[2*(q     )]);
+            b = _mm_loadu_ps(&x[2*(q+  _s)]);
+            c = _mm_loadu_ps(&x[2*(q+2*_s)]);
+            d = _mm_loadu_ps(&x[2*(q+3*_s)]);
+            FFT_RADIX4_BUTTERFLY_SSE(a,b,c,d,y0,y1,y2,y3);
+            _mm_storeu_ps(&y[2*(q     )], y0);
+            _mm_storeu_ps(&y[2*(q+  _s)], y1);
+            _mm_storeu_ps(&y[2*(q+2*_s)], y2);
+            _mm_storeu_ps(&y[2*(q+3*_s)], y3);
+        }
+    } else {
+        // remaining stages: columns share twiddle factors
+        __m128 zero = _mm_setzero_ps();
+        for (p=0; p<n1; p++) {
+            __m128 w1 = _mm_loadl_pi(zero, (__m64*)&w[2*(     p)]);
+            __m128 w2 = _mm_loadl_pi(zero, (__m64*)&w[2*(  n1+p)]);
+            __m128 w3 = _mm_loadl_pi(zero, (__m64*)&w[2*(2*n1+p)]);
+            w1 = _mm_movelh_ps(w1, w1);
+            w2 = _mm_movelh_ps(w2, w2);
+            w3 = _mm_movelh_ps(w3, w3);
+
+            float * xp = &x[2*_s*p];
+            float * yp = &y[2*_s*4*p];
+            for (q=0; q<_s; q+=2) {
+                a = _mm_loadu_ps(&xp[2*(q       )]);
+                b = _mm_loadu_ps(&xp[2*(q+  _s*n1)]);
+                c = _mm_loadu_ps(&xp[2*(q+2*_s*n1)]);
+                d = _mm_loadu_ps(&xp[2*(q+3*_s*n1)]);
+                FFT_RADIX4_BUTTERFLY_SSE(a,b,c,d,y0,y1,y2,y3);
+                _mm_storeu_ps(&yp[2*(q     )], y0);
+                _mm_storeu_ps(&yp[2*(q+  _s)], fft_radix4_cmul_sse(y1, w1, sign_re));
+                _mm_storeu_ps(&yp[2*(q+2*_s)], fft_radix4_cmul_sse(y2, w2, sign_re));
+                _mm_storeu_ps(&yp[2*(q+3*_s)], fft_radix4_cmul_sse(y3, w3, sign_re));
+            }
+        }
+    }
+}
+
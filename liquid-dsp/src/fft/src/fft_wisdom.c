@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// fft_wisdom.c : process-wide cache of measured fft methods
+//
+// Each entry records the method (and mixed-radix split) found to be
+// fastest by the planner for a given transform size and direction.
+// The table is global and is not protected against concurrent access.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+struct liquid_fft_wisdom_s {
+    unsigned int      nfft;     // transform size
+    int               dir;      // direction (forward/backward)
+    liquid_fft_method method;   // fastest method
+    unsigned int      radix;    // mixed-radix split 'Q' (0 otherwise)
+};
+
+// wisdom table
+static struct liquid_fft_wisdom_s * liquid_fft_wisdom = NULL;
+static unsigned int liquid_fft_wisdom_len = 0;     // number of entries
+static unsigned int liquid_fft_wisdom_cap = 0;     // allocated entries
+
+// method names, indexed by liquid_fft_method
+static const char * liquid_fft_method_str[] = {
+    "unknown",
+    "radix2",
+    "mixed-radix",
+    "rader",
+    "rader2",
+    "dft",
+};
+
+// find index of wisdom entry, returning -1 if not found
+static int liquid_fft_wisdom_find(unsigned int _nfft,
+                                  int          _dir)
+{
+    int dir = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    unsigned int i;
+    for (i=0; i<liquid_fft_wisdom_len; i++) {
+        if (liquid_fft_wisdom[i].nfft == _nfft && liquid_fft_wisdom[i].dir == dir)
+            return (int)i;
+    }
+    return -1;
+}
+
+// look up wisdom for transform, returning 1 if found
+//  _nfft   :   transform size
+//  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)
+//  _method :   resulting method
+//  _radix  :   resulting mixed-radix split (0 otherwise)
+int liquid_fft_wisdom_lookup(unsigned int        _nfft,
+                             int                 _dir,
+                             liquid_fft_method * _method,
+                             unsigned int *      _radix)
+{
+    int i = liquid_fft_wisdom_find(_nfft, _dir);
+    if (i < 0)
+        return 0;
+
+    *_method = liquid_fft_wisdom[i].method;
+    *_radix  = liquid_fft_wisdom[i].radix;
+    return 1;
+}
+
+// add/replace wisdom for transform
+void liquid_fft_wisdom_add(unsigned int      _nfft,
+                           int               _dir,
+                           liquid_fft_method _method,
+                           unsigned int      _radix)
+{
+    // validate input
+    if (_nfft == 0) {
+        fprintf(stderr,"error: liquid_fft_wisdom_add(), fft size must be > 0\n");
+        exit(1);
+    } else if (_method == LIQUID_FFT_METHOD_MIXED_RADIX &&
+               (_radix < 2 || _radix >= _nfft || (_nfft % _radix) != 0))
+    {
+        fprintf(stderr,"error: liquid_fft_wisdom_add(), invalid split %u for fft size %u\n", _radix, _nfft);
+        exit(1);
+    }
+
+    int i = liquid_fft_wisdom_find(_nfft, _dir);
+    if (i < 0) {
+        // grow table as necessary
+        if (liquid_fft_wisdom_len == liquid_fft_wisdom_cap) {
+            liquid_fft_wisdom_cap = liquid_fft_wisdom_cap ? 2*liquid_fft_wisdom_cap : 16;
+            liquid_fft_wisdom = (struct liquid_fft_wisdom_s *)
+                realloc(liquid_fft_wisdom, liquid_fft_wisdom_cap*sizeof(struct liquid_fft_wisdom_s));
+        }
+        i = liquid_fft_wisdom_len++;
+    }
+
+    liquid_fft_wisdom[i].nfft   = _nfft;
+    liquid_fft_wisdom[i].dir    = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    liquid_fft_wisdom[i].method = _method;
+    liquid_fft_wisdom[i].radix  = (_method == LIQUID_FFT_METHOD_MIXED_RADIX) ? _radix : 0;
+}
+
+// clear all accumulated wisdom
+void liquid_fft_wisdom_forget()
+{
+    free(liquid_fft_wisdom);
+    liquid_fft_wisdom     = NULL;
+    liquid_fft_wisdom_len = 0;
+    liquid_fft_wisdom_cap = 0;
+}
+
+// get number of wisdom entries
+unsigned int liquid_fft_wisdom_get_num_entries()
+{
+    return liquid_fft_wisdom_len;
+}
+
+// print accumulated wisdom to stdout
+void liquid_fft_wisdom_print()
+{
+    printf("fft wisdom [%u entries]:\n", liquid_fft_wisdom_len);
+    unsigned int i;
+    for (i=0; i<liquid_fft_wisdom_len; i++) {
+        printf("  %6u %-8s : %s",
+                liquid_fft_wisdom[i].nfft,
+                liquid_fft_wisdom[i].dir == LIQUID_FFT_FORWARD ? "forward" : "reverse",
+                liquid_fft_method_str[liquid_fft_wisdom[i].method]);
+        if (liquid_fft_wisdom[i].method == LIQUID_FFT_METHOD_MIXED_RADIX)
+            printf(", Q=%u", liquid_fft_wisdom[i].radix);
+        printf("\n");
+    }
+}
+
+// save accumulated wisdom to file, returning 0 on success
+int liquid_fft_wisdom_export(const char * _filename)
+{
+    FILE * fid = fopen(_filename,"w");
+    if (!fid) {
+        fprintf(stderr,"error: liquid_fft_wisdom_export(), could not open '%s' for writing\n", _filename);
+        return -1;
+    }
+
+    fprintf(fid,"# liquid fft wisdom\n");
+    fprintf(fid,"# nfft direction method radix\n");
+    unsigned int i;
+    for (i=0; i<liquid_fft_wisdom_len; i++) {
+        fprintf(fid,"%u %d %s %u\n",
+                liquid_fft_wisdom[i].nfft,
+                liquid_fft_wisdom[i].dir,
+                liquid_fft_method_str[liquid_fft_wisdom[i].method],
+                liquid_fft_wisdom[i].radix);
+    }
+
+    fclose(fid);
+    return 0;
+}
+
+// load wisdom from file, merging with existing entries and
+// returning 0 on success
+int liquid_fft_wisdom_import(const char * _filename)
+{
+    FILE * fid = fopen(_filename,"r");
+    if (!fid) {
+        fprintf(stderr,"error: liquid_fft_wisdom_import(), could not open '%s' for reading\n", _filename);
+        return -1;
+    }
+
+    char line[256];
+    unsigned int line_num = 0;
+    int rc = 0;
+    while (fgets(line, sizeof(line), fid) != NULL) {
+        line_num++;
+
+        // skip comments and blank lines
+        char * p = line;
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '#' || *p == '\n' || *p == '\r' || *p == '\0')
+            continue;
+
+        // parse entry
+        unsigned int nfft, radix;
+        int dir;
+        char method_str[32];
+        if (sscanf(p, "%u %d %31s %u", &nfft, &dir, method_str, &radix) != 4) {
+            fprintf(stderr,"error: liquid_fft_wisdom_import(), '%s' line %u: could not parse entry\n", _filename, line_num);
+            rc = -1;
+            break;
+        }
+
+        // look up method by name
+        liquid_fft_method method = LIQUID_FFT_METHOD_UNKNOWN;
+        unsigned int i;
+        for (i=1; i<sizeof(liquid_fft_method_str)/sizeof(char*); i++) {
+            if (strcmp(method_str, liquid_fft_method_str[i]) == 0)
+                method = (liquid_fft_method)i;
+        }
+
+        // validate entry before adding
+        if ( nfft == 0 ||
+             (dir != LIQUID_FFT_FORWARD && dir != LIQUID_FFT_BACKWARD) ||
+             method == LIQUID_FFT_METHOD_UNKNOWN ||
+             (method == LIQUID_FFT_METHOD_RADIX2 && !fft_is_radix2(nfft)) ||
+             (method == LIQUID_FFT_METHOD_MIXED_RADIX &&
+                (radix < 2 || radix >= nfft || (nfft % radix) != 0)) ||
+             ((method == LIQUID_FFT_METHOD_RADER || method == LIQUID_FFT_METHOD_RADER2) &&
+                !liquid_is_prime(nfft)) )
+        {
+            fprintf(stderr,"error: liquid_fft_wisdom_import(), '%s' line %u: invalid entry\n", _filename, line_num);
+            rc = -1;
+            break;
+        }
+
+        liquid_fft_wisdom_add(nfft, dir, method, radix);
+    }
+
+    fclose(fid);
+    return rc;
+}
+
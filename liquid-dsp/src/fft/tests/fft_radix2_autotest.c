@@ -21,8 +21,9 @@
 // fft_radix2_autotest.c : test power-of-two transforms
 //
 
+#include <math.h>
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 // autotest data definitions
 #include "src/fft/tests/fft_runtest.h"
@@ -37,3 +38,54 @@ void autotest_fft_16()      { fft_test( fft_test_x16,  fft_test_y16,     16);
 void autotest_fft_32()      { fft_test( fft_test_x32,  fft_test_y32,     32);    }
 void autotest_fft_64()      { fft_test( fft_test_x64,  fft_test_y64,     64);    }
 
+
+// compare radix-2 plan (internal) against double-precision DFT, both
+// directions, in place and out of place
+void fft_radix2_runtest_dft(unsigned int _nfft)
+{
+    float tol = 2e-5f * sqrtf((float)_nfft);
+
+    float complex x[_nfft], y[_nfft], y_test[_nfft];
+    unsigned int i, k;
+    int d;
+    for (d=0; d<2; d++) {
+        int dir = d ? LIQUID_FFT_BACKWARD : LIQUID_FFT_FORWARD;
+
+        for (i=0; i<_nfft; i++)
+            x[i] = randnf() + _Complex_I*randnf();
+
+        // reference
+        for (k=0; k<_nfft; k++) {
+            double complex v = 0;
+            for (i=0; i<_nfft; i++)
+                v += x[i] * cexp(-_Complex_I*2*M_PI*dir*(double)((i*k) % _nfft) / (double)_nfft);
+            y_test[k] = v;
+        }
+
+        // out of place
+        fftplan q0 = fft_create_plan_radix2(_nfft, x, y, dir, 0);
+        fft_execute(q0);
+        fft_destroy_plan(q0);
+        for (i=0; i<_nfft; i++)
+            CONTEND_DELTA( cabsf(y[i] - y_test[i]), 0.0f, tol );
+
+        // in place
+        fftplan q1 = fft_create_plan_radix2(_nfft, x, x, dir, 0);
+        fft_execute(q1);
+        fft_destroy_plan(q1);
+        for (i=0; i<_nfft; i++)
+            CONTEND_DELTA( cabsf(x[i] - y_test[i]), 0.0f, tol );
+    }
+}
+
+void autotest_fft_radix2_dft_2()    { fft_radix2_runtest_dft(   2); }
+void autotest_fft_radix2_dft_4()    { fft_radix2_runtest_dft(   4); }
+void autotest_fft_radix2_dft_8()    { fft_radix2_runtest_dft(   8); }
+void autotest_fft_radix2_dft_16()   { fft_radix2_runtest_dft(  16); }
+void autotest_fft_radix2_dft_32()   { fft_radix2_runtest_dft(  32); }
+void autotest_fft_radix2_dft_64()   { fft_radix2_runtest_dft(  64); }
+void autotest_fft_radix2_dft_128()  { fft_radix2_runtest_dft( 128); }
+void autotest_fft_radix2_dft_256()  { fft_radix2_runtest_dft( 256); }
+void autotest_fft_radix2_dft_512()  { fft_radix2_runtest_dft( 512); }
+void autotest_fft_radix2_dft_1024() { fft_radix2_runtest_dft(1024); }
+void autotest_fft_radix2_dft_2048() { fft_radix2_runtest_dft(2048); }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// fft_wisdom_autotest.c : test measured fft planner and wisdom
+//
+
+#include <stdio.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// autotest data definitions
+#include "src/fft/tests/fft_runtest.h"
+
+// helper function: run forward/reverse transforms with measured plans
+//  _x      :   fft input array
+//  _test   :   expected fft output
+//  _n      :   fft size
+void fft_wisdom_runtest(float complex * _x,
+                        float complex * _test,
+                        unsigned int    _n)
+{
+    float tol = 2e-4f;
+    unsigned int i;
+    float complex y[_n], z[_n];
+
+    // start without wisdom
+    liquid_fft_wisdom_forget();
+
+    // compute FFT, IFFT using measured plans
+    fftplan pf = fft_create_plan(_n, _x, y, LIQUID_FFT_FORWARD,  LIQUID_FFT_MEASURE);
+    fftplan pr = fft_create_plan(_n, y,  z, LIQUID_FFT_BACKWARD, LIQUID_FFT_MEASURE);
+    fft_execute(pf);
+    fft_execute(pr);
+
+    // validate results
+    for (i=0; i<_n; i++) {
+        CONTEND_DELTA( cabsf(y[i] - _test[i]),         0, tol );
+        CONTEND_DELTA( cabsf(_x[i] - z[i]/(float)_n), 0, tol );
+    }
+
+    // wisdom should exist for both directions
+    liquid_fft_method method;
+    unsigned int radix;
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(_n, LIQUID_FFT_FORWARD,  &method, &radix), 1 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(_n, LIQUID_FFT_BACKWARD, &method, &radix), 1 );
+
+    fft_destroy_plan(pf);
+    fft_destroy_plan(pr);
+    liquid_fft_wisdom_forget();
+}
+
+void autotest_fft_measure_20()  { fft_wisdom_runtest( fft_test_x20,  fft_test_y20,   20); }
+void autotest_fft_measure_43()  { fft_wisdom_runtest( fft_test_x43,  fft_test_y43,   43); }
+void autotest_fft_measure_64()  { fft_wisdom_runtest( fft_test_x64,  fft_test_y64,   64); }
+void autotest_fft_measure_120() { fft_wisdom_runtest( fft_test_x120, fft_test_y120, 120); }
+void autotest_fft_measure_157() { fft_wisdom_runtest( fft_test_x157, fft_test_y157, 157); }
+
+// export wisdom, re-import and verify entries are identical
+void autotest_fft_wisdom_file()
+{
+    const char filename[] = "fft_wisdom_autotest.txt";
+
+    // accumulate wisdom
+    liquid_fft_wisdom_forget();
+    float complex x[96], y[96];
+    fftplan q = fft_create_plan(96, x, y, LIQUID_FFT_FORWARD, LIQUID_FFT_MEASURE);
+    fft_destroy_plan(q);
+    unsigned int num_entries = liquid_fft_wisdom_get_num_entries();
+    CONTEND_GREATER_THAN( num_entries, 1 );
+
+    liquid_fft_method method0;
+    unsigned int radix0;
+    liquid_fft_wisdom_lookup(96, LIQUID_FFT_FORWARD, &method0, &radix0);
+
+    // save, clear, and restore
+    CONTEND_EQUALITY( liquid_fft_wisdom_export(filename), 0 );
+    liquid_fft_wisdom_forget();
+    CONTEND_EQUALITY( liquid_fft_wisdom_get_num_entries(), 0 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_import(filename), 0 );
+    CONTEND_EQUALITY( liquid_fft_wisdom_get_num_entries(), num_entries );
+
+    liquid_fft_method method1;
+    unsigned int radix1;
+    CONTEND_EQUALITY( liquid_fft_wisdom_lookup(96, LIQUID_FFT_FORWARD, &method1, &radix1), 1 );
+    CONTEND_EQUALITY( method0, method1 );
+    CONTEND_EQUALITY( radix0,  radix1  );
+
+    remove(filename);
+    liquid_fft_wisdom_forget();
+}
+
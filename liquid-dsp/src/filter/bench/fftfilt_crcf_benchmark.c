@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; compare to the
+// firfilt_crcf_block benchmark to find the crossover filter length
+// (about 32-64 taps)
+void fftfilt_crcf_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _n)
+{
+    // block size: smallest power of two not less than filter length
+    unsigned int num_samples = 1 << liquid_nextpow2(_n);
+
+    // adjust number of iterations:
+    // cycles/trial ~ 60 + 4*log2(_n) (per sample)
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(60+4*liquid_nextpow2(_n));
+    *_num_iterations /= num_samples;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float h[_n];
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf();
+
+    // create filter object
+    fftfilt_crcf f = fftfilt_crcf_create(h,_n,num_samples);
+
+    // generate input vector
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // output vector
+    float complex y[num_samples];
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        fftfilt_crcf_execute(f, x, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_samples;
+
+    fftfilt_crcf_destroy(f);
+}
+
+#define FFTFILT_CRCF_BENCHMARK_API(N)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ fftfilt_crcf_bench(_start, _finish, _num_iterations, N); }
+
+void benchmark_fftfilt_crcf_4       FFTFILT_CRCF_BENCHMARK_API(4)
+void benchmark_fftfilt_crcf_8       FFTFILT_CRCF_BENCHMARK_API(8)
+void benchmark_fftfilt_crcf_16      FFTFILT_CRCF_BENCHMARK_API(16)
+void benchmark_fftfilt_crcf_32      FFTFILT_CRCF_BENCHMARK_API(32)
+void benchmark_fftfilt_crcf_64      FFTFILT_CRCF_BENCHMARK_API(64)
+void benchmark_fftfilt_crcf_128     FFTFILT_CRCF_BENCHMARK_API(128)
+void benchmark_fftfilt_crcf_256     FFTFILT_CRCF_BENCHMARK_API(256)
+void benchmark_fftfilt_crcf_512     FFTFILT_CRCF_BENCHMARK_API(512)
+void benchmark_fftfilt_crcf_1024    FFTFILT_CRCF_BENCHMARK_API(1024)
+
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void firfilt_crcf_block_bench(struct rusage *     _start,
+                              struct rusage *     _finish,
+                              unsigned long int * _num_iterations,
+                              unsigned int        _n)
+{
+    // number of samples per block
+    unsigned int num_samples = 256;
+
+    // adjust number of iterations:
+    // cycles/trial ~ 107 + 4.3*_n (per sample)
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(107+4.3*_n);
+    *_num_iterations /= num_samples;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // generate coefficients
+    float h[_n];
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf();
+
+    // create filter object
+    firfilt_crcf f = firfilt_crcf_create(h,_n);
+
+    // generate input vector
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // output vector
+    float complex y[num_samples];
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firfilt_crcf_execute_block(f, x, num_samples, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_samples;
+
+    firfilt_crcf_destroy(f);
+}
+
+#define FIRFILT_CRCF_BLOCK_BENCHMARK_API(N) \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ firfilt_crcf_block_bench(_start, _finish, _num_iterations, N); }
+
+void benchmark_firfilt_crcf_block_4    FIRFILT_CRCF_BLOCK_BENCHMARK_API(4)
+void benchmark_firfilt_crcf_block_8    FIRFILT_CRCF_BLOCK_BENCHMARK_API(8)
+void benchmark_firfilt_crcf_block_16   FIRFILT_CRCF_BLOCK_BENCHMARK_API(16)
+void benchmark_firfilt_crcf_block_32   FIRFILT_CRCF_BLOCK_BENCHMARK_API(32)
+void benchmark_firfilt_crcf_block_64   FIRFILT_CRCF_BLOCK_BENCHMARK_API(64)
+void benchmark_firfilt_crcf_block_128  FIRFILT_CRCF_BLOCK_BENCHMARK_API(128)
+void benchmark_firfilt_crcf_block_256  FIRFILT_CRCF_BLOCK_BENCHMARK_API(256)
+void benchmark_firfilt_crcf_block_512  FIRFILT_CRCF_BLOCK_BENCHMARK_API(512)
+void benchmark_firfilt_crcf_block_1024 FIRFILT_CRCF_BLOCK_BENCHMARK_API(1024)
+
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// fftfilt : finite impulse response (FIR) filter using fast convolution
+//
+// Input samples are processed in blocks of length n using the
+// overlap-save method with a transform of size 2n: each block is
+// appended to the previous one, transformed, multiplied by the
+// frequency response of the zero-padded filter, and transformed
+// back; the last n samples of the result are the filter output.
+// The coefficients follow the same convention as firfilt, i.e.
+//
+//      y[k] = sum_{i=0}^{h_len-1} h[i] x[k-i]
+//
+// and the output is identical (within numerical precision) to
+// running firfilt on the same input.
+//
+// The cost per sample grows only with log(n), whereas firfilt grows
+// linearly with the filter length; with the SIMD radix-4 FFT stages
+// the two break even at about 32-64 taps (see the fftfilt_crcf and
+// firfilt_crcf_block benchmarks), above which fftfilt is faster.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FFTFILT()       name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro
+
+// fftfilt object structure
+struct FFTFILT(_s) {
+    TC * h;                 // filter coefficients array [size: h_len x 1]
+    unsigned int h_len;     // filter length
+    unsigned int n;         // block size, h_len <= n+1
+
+    float complex * time_buf;   // time-domain buffer [size: 2n x 1]
+    float complex * freq_buf;   // freq-domain buffer [size: 2n x 1]
+    float complex * H;          // filter frequency response [size: 2n x 1]
+    FFT_PLAN fft;               // forward transform (time_buf -> freq_buf)
+    FFT_PLAN ifft;              // reverse transform (freq_buf -> time_buf)
+
+    TI * w;                 // previous input block [size: n x 1]
+    TC scale;               // output scaling factor
+};
+
+// create fftfilt object
+//  _h      :   coefficients (filter taps) [size: _h_len x 1]
+//  _h_len  :   filter length, _h_len > 0
+//  _n      :   block size, _h_len <= _n+1
+FFTFILT() FFTFILT(_create)(TC *         _h,
+                           unsigned int _h_len,
+                           unsigned int _n)
+{
+    // validate input
+    if (_h_len == 0) {
+        fprintf(stderr,"error: fftfilt_%s_create(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_n == 0) {
+        fprintf(stderr,"error: fftfilt_%s_create(), block size must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_h_len > _n+1) {
+        fprintf(stderr,"error: fftfilt_%s_create(), filter length cannot exceed block size plus one\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create filter object and initialize
+    FFTFILT() q = (FFTFILT()) malloc(sizeof(struct FFTFILT(_s)));
+    q->h_len = _h_len;
+    q->n     = _n;
+
+    // copy filter coefficients
+    q->h = (TC *) malloc((q->h_len)*sizeof(TC));
+    memmove(q->h, _h, (q->h_len)*sizeof(TC));
+
+    // allocate internal buffers and create transforms
+    unsigned int nfft = 2*q->n;
+    q->time_buf = (float complex*) malloc(nfft*sizeof(float complex));
+    q->freq_buf = (float complex*) malloc(nfft*sizeof(float complex));
+    q->H        = (float complex*) malloc(nfft*sizeof(float complex));
+    q->w        = (TI *)           malloc((q->n)*sizeof(TI));
+    q->fft  = FFT_CREATE_PLAN(nfft, q->time_buf, q->freq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
+    q->ifft = FFT_CREATE_PLAN(nfft, q->freq_buf, q->time_buf, FFT_DIR_BACKWARD, FFT_METHOD);
+
+    // compute frequency response of zero-padded filter, folding in
+    // the normalization of the reverse transform
+    unsigned int i;
+    for (i=0; i<nfft; i++)
+        q->time_buf[i] = i < q->h_len ? q->h[i] : 0.0f;
+    FFT_EXECUTE(q->fft);
+    for (i=0; i<nfft; i++)
+        q->H[i] = q->freq_buf[i] / (float)nfft;
+
+    // set default scaling
+    q->scale = 1;
+
+    // reset filter state (clear buffer)
+    FFTFILT(_reset)(q);
+
+    return q;
+}
+
+// destroy fftfilt object
+void FFTFILT(_destroy)(FFTFILT() _q)
+{
+    FFT_DESTROY_PLAN(_q->fft);
+    FFT_DESTROY_PLAN(_q->ifft);
+    free(_q->time_buf);
+    free(_q->freq_buf);
+    free(_q->H);
+    free(_q->w);
+    free(_q->h);
+    free(_q);
+}
+
+// reset internal state of filter object
+void FFTFILT(_reset)(FFTFILT() _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->n; i++)
+        _q->w[i] = 0.0;
+}
+
+// print filter object internals (taps, block size)
+void FFTFILT(_print)(FFTFILT() _q)
+{
+    printf("fftfilt_%s: [%u taps, block size %u]\n", EXTENSION_FULL, _q->h_len, _q->n);
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++) {
+        printf("  h(%3u) = ", i+1);
+        PRINTVAL_TC(_q->h[i],%12.8f);
+        printf("\n");
+    }
+
+    // print scaling
+    printf("  scale = ");
+    PRINTVAL_TC(_q->scale,%12.8f);
+    printf("\n");
+}
+
+// set output scaling for filter
+void FFTFILT(_set_scale)(FFTFILT() _q,
+                         TC        _scale)
+{
+    _q->scale = _scale;
+}
+
+// execute the filter on one block of input samples; in-place
+// operation is permitted
+//  _q      :   filter object
+//  _x      :   input array [size: n x 1]
+//  _y      :   output array [size: n x 1]
+void FFTFILT(_execute)(FFTFILT() _q,
+                       TI *      _x,
+                       TO *      _y)
+{
+    unsigned int i;
+    unsigned int n = _q->n;
+
+    // load previous and current input blocks
+    for (i=0; i<n; i++) {
+        _q->time_buf[i]   = _q->w[i];
+        _q->time_buf[n+i] = _x[i];
+    }
+
+    // save current block for next call (before output overwrites
+    // the input in case of in-place operation)
+    memmove(_q->w, _x, n*sizeof(TI));
+
+    // run forward transform
+    FFT_EXECUTE(_q->fft);
+
+    // apply filter frequency response
+    for (i=0; i<2*n; i++)
+        _q->freq_buf[i] *= _q->H[i];
+
+    // run reverse transform
+    FFT_EXECUTE(_q->ifft);
+
+    // keep last n samples (first n are corrupted by circular wrap)
+    for (i=0; i<n; i++) {
+#if TO_COMPLEX
+        _y[i] = _q->time_buf[n+i] * _q->scale;
+#else
+        _y[i] = crealf(_q->time_buf[n+i]) * _q->scale;
+#endif
+    }
+}
+
+// get filter length
+unsigned int FFTFILT(_get_length)(FFTFILT() _q)
+{
+    return _q->h_len;
+}
+
+// get block size
+unsigned int FFTFILT(_get_block_size)(FFTFILT() _q)
+{
+    return _q->n;
+}
+
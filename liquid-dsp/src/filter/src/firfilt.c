@@ -34,6 +34,10 @@
 
 #define LIQUID_FIRFILT_USE_WINDOW   (0)
 
+// maximum filter length for which _execute_block() computes
+// outputs in register-blocked groups rather than with dotprod
+#define LIQUID_FIRFILT_BLOCK_MAX_LEN (8)
+
 // firfilt object structure
 struct FIRFILT(_s) {
     TC * h;             // filter coefficients array [size; h_len x 1]
@@ -310,6 +314,92 @@ void FIRFILT(_execute)(FIRFILT() _q,
     *_y *= _q->scale;
 }
 
+// execute the filter on a block of input samples; equivalent
+// to calling _push() followed by _execute() for each sample
+//  _q      :   filter object
+//  _x      :   input array [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y      :   output array [size: _n x 1]
+void FIRFILT(_execute_block)(FIRFILT()    _q,
+                             TI *         _x,
+                             unsigned int _n,
+                             TO *         _y)
+{
+    if (_n == 0)
+        return;
+
+#if LIQUID_FIRFILT_USE_WINDOW
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        FIRFILT(_push)(_q, _x[i]);
+        FIRFILT(_execute)(_q, &_y[i]);
+    }
+#else
+    // Only the first h_len-1 outputs depend on samples already in
+    // the buffer; move these to the start of the internal array and
+    // append enough of the input to compute them from one linear
+    // buffer. All remaining outputs are computed directly from the
+    // input array.
+    unsigned int m  = _q->h_len - 1;        // history length
+    unsigned int nh = _n < m ? _n : m;      // outputs using history
+    memmove(_q->w,     _q->w + _q->w_index + 1, m *sizeof(TI));
+    memmove(_q->w + m, _x,                      nh*sizeof(TI));
+
+    FIRFILT(_execute_linear)(_q, _q->w, nh, _y);
+    if (_n > m)
+        FIRFILT(_execute_linear)(_q, _x, _n - m, _y + m);
+
+    // retain last h_len input samples as the filter state
+    if (_n < _q->h_len) {
+        _q->w_index = _n - 1;
+    } else {
+        memmove(_q->w, _x + _n - _q->h_len, (_q->h_len)*sizeof(TI));
+        _q->w_index = 0;
+    }
+#endif
+}
+
+// compute filter outputs from a linear buffer (internal)
+//  _q      :   filter object
+//  _x      :   input buffer [size: _n + h_len - 1 x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+void FIRFILT(_execute_linear)(FIRFILT()    _q,
+                              TI *         _x,
+                              unsigned int _n,
+                              TO *         _y)
+{
+    unsigned int i;
+    unsigned int k = 0;
+
+    // Short filters: compute outputs in groups of four, each
+    // coefficient loaded once per group. Long filters are better
+    // served by the vectorized dot product.
+    if (_q->h_len <= LIQUID_FIRFILT_BLOCK_MAX_LEN) {
+        TC * h = _q->h;
+        for (k=0; k+4<=_n; k+=4) {
+            TI * r = _x + k;
+            TO y0=0, y1=0, y2=0, y3=0;
+            for (i=0; i<_q->h_len; i++) {
+                y0 += h[i] * r[i  ];
+                y1 += h[i] * r[i+1];
+                y2 += h[i] * r[i+2];
+                y3 += h[i] * r[i+3];
+            }
+            _y[k  ] = y0 * _q->scale;
+            _y[k+1] = y1 * _q->scale;
+            _y[k+2] = y2 * _q->scale;
+            _y[k+3] = y3 * _q->scale;
+        }
+    }
+
+    // remaining outputs
+    for ( ; k<_n; k++) {
+        DOTPROD(_execute)(_q->dp, _x + k, &_y[k]);
+        _y[k] *= _q->scale;
+    }
+}
+
 // get filter length
 unsigned int FIRFILT(_get_length)(FIRFILT() _q)
 {
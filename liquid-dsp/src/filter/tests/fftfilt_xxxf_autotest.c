@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// fftfilt_xxxf_autotest.c : test FFT-based filters against firfilt
+//
+
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare fftfilt_rrrf output to firfilt_rrrf
+void fftfilt_rrrf_test(unsigned int _h_len,
+                       unsigned int _n)
+{
+    float tol = 1e-4f;
+    unsigned int num_blocks = 4;
+    unsigned int num_samples = num_blocks*_n;
+
+    // generate random coefficients and input
+    float h[_h_len];
+    float x[num_samples];
+    unsigned int i;
+    for (i=0; i<_h_len; i++)      h[i] = randnf();
+    for (i=0; i<num_samples; i++) x[i] = randnf();
+
+    // run reference filter
+    float y_test[num_samples];
+    firfilt_rrrf q0 = firfilt_rrrf_create(h, _h_len);
+    firfilt_rrrf_execute_block(q0, x, num_samples, y_test);
+    firfilt_rrrf_destroy(q0);
+
+    // run FFT-based filter
+    float y[num_samples];
+    fftfilt_rrrf q1 = fftfilt_rrrf_create(h, _h_len, _n);
+    for (i=0; i<num_blocks; i++)
+        fftfilt_rrrf_execute(q1, &x[i*_n], &y[i*_n]);
+    fftfilt_rrrf_destroy(q1);
+
+    for (i=0; i<num_samples; i++)
+        CONTEND_DELTA( y[i], y_test[i], tol*sqrtf(_h_len) );
+}
+
+// compare fftfilt_crcf output to firfilt_crcf
+void fftfilt_crcf_test(unsigned int _h_len,
+                       unsigned int _n)
+{
+    float tol = 1e-4f;
+    unsigned int num_blocks = 4;
+    unsigned int num_samples = num_blocks*_n;
+
+    // generate random coefficients and input
+    float h[_h_len];
+    float complex x[num_samples];
+    unsigned int i;
+    for (i=0; i<_h_len; i++)      h[i] = randnf();
+    for (i=0; i<num_samples; i++) x[i] = randnf() + _Complex_I*randnf();
+
+    // run reference filter
+    float complex y_test[num_samples];
+    firfilt_crcf q0 = firfilt_crcf_create(h, _h_len);
+    firfilt_crcf_execute_block(q0, x, num_samples, y_test);
+    firfilt_crcf_destroy(q0);
+
+    // run FFT-based filter (in place)
+    float complex y[num_samples];
+    memmove(y, x, num_samples*sizeof(float complex));
+    fftfilt_crcf q1 = fftfilt_crcf_create(h, _h_len, _n);
+    for (i=0; i<num_blocks; i++)
+        fftfilt_crcf_execute(q1, &y[i*_n], &y[i*_n]);
+    fftfilt_crcf_destroy(q1);
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y[i]), crealf(y_test[i]), tol*sqrtf(_h_len) );
+        CONTEND_DELTA( cimagf(y[i]), cimagf(y_test[i]), tol*sqrtf(_h_len) );
+    }
+}
+
+// compare fftfilt_cccf output to firfilt_cccf
+void fftfilt_cccf_test(unsigned int _h_len,
+                       unsigned int _n)
+{
+    float tol = 1e-4f;
+    unsigned int num_blocks = 4;
+    unsigned int num_samples = num_blocks*_n;
+
+    // generate random coefficients and input
+    float complex h[_h_len];
+    float complex x[num_samples];
+    unsigned int i;
+    for (i=0; i<_h_len; i++)      h[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<num_samples; i++) x[i] = randnf() + _Complex_I*randnf();
+
+    // run reference filter
+    float complex y_test[num_samples];
+    firfilt_cccf q0 = firfilt_cccf_create(h, _h_len);
+    firfilt_cccf_set_scale(q0, 2.0f - 0.5f*_Complex_I);
+    firfilt_cccf_execute_block(q0, x, num_samples, y_test);
+    firfilt_cccf_destroy(q0);
+
+    // run FFT-based filter
+    float complex y[num_samples];
+    fftfilt_cccf q1 = fftfilt_cccf_create(h, _h_len, _n);
+    fftfilt_cccf_set_scale(q1, 2.0f - 0.5f*_Complex_I);
+    for (i=0; i<num_blocks; i++)
+        fftfilt_cccf_execute(q1, &x[i*_n], &y[i*_n]);
+    fftfilt_cccf_destroy(q1);
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y[i]), crealf(y_test[i]), 4*tol*sqrtf(_h_len) );
+        CONTEND_DELTA( cimagf(y[i]), cimagf(y_test[i]), 4*tol*sqrtf(_h_len) );
+    }
+}
+
+void autotest_fftfilt_rrrf_h1n8()    { fftfilt_rrrf_test(  1,   8); }
+void autotest_fftfilt_rrrf_h9n8()    { fftfilt_rrrf_test(  9,   8); }
+void autotest_fftfilt_rrrf_h57n64()  { fftfilt_rrrf_test( 57,  64); }
+void autotest_fftfilt_crcf_h7n12()   { fftfilt_crcf_test(  7,  12); }
+void autotest_fftfilt_crcf_h65n64()  { fftfilt_crcf_test( 65,  64); }
+void autotest_fftfilt_crcf_h200n256(){ fftfilt_crcf_test(200, 256); }
+void autotest_fftfilt_cccf_h13n16()  { fftfilt_cccf_test( 13,  16); }
+void autotest_fftfilt_cccf_h100n100(){ fftfilt_cccf_test(100, 100); }
+
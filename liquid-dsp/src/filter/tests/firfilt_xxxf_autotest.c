@@ -114,3 +114,68 @@ void autotest_firfilt_cccf_data_h23x64()
 }
 
 
+// 
+// AUTOTEST: firfilt block execution
+//
+
+// compare block execution against push/execute for a given filter
+// length, feeding the input in uneven block sizes
+void firfilt_cccf_block_test(unsigned int _h_len)
+{
+    float tol = 1e-4f;
+    unsigned int num_samples = 200;
+
+    // generate random coefficients and input
+    float complex h[_h_len];
+    float complex x[num_samples];
+    unsigned int i;
+    for (i=0; i<_h_len; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // create two identical filters
+    firfilt_cccf q0 = firfilt_cccf_create(h, _h_len);
+    firfilt_cccf q1 = firfilt_cccf_create(h, _h_len);
+    firfilt_cccf_set_scale(q0, 0.5f);
+    firfilt_cccf_set_scale(q1, 0.5f);
+
+    // run filters
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    for (i=0; i<num_samples; i++) {
+        firfilt_cccf_push(q0, x[i]);
+        firfilt_cccf_execute(q0, &y0[i]);
+    }
+    unsigned int block_sizes[7] = {1, 3, 7, 50, 2, 33, 0};
+    unsigned int n = 0;
+    for (i=0; n<num_samples; i++) {
+        unsigned int b = block_sizes[i % 7];
+        if (n + b > num_samples)
+            b = num_samples - n;
+        firfilt_cccf_execute_block(q1, &x[n], b, &y1[n]);
+        n += b;
+    }
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    // ensure internal state is retained for sample-wise execution
+    float complex v0, v1;
+    firfilt_cccf_push(q0, 1.0f); firfilt_cccf_execute(q0, &v0);
+    firfilt_cccf_push(q1, 1.0f); firfilt_cccf_execute(q1, &v1);
+    CONTEND_DELTA( crealf(v0), crealf(v1), tol );
+    CONTEND_DELTA( cimagf(v0), cimagf(v1), tol );
+
+    firfilt_cccf_destroy(q0);
+    firfilt_cccf_destroy(q1);
+}
+
+void autotest_firfilt_cccf_block_h1()  { firfilt_cccf_block_test( 1); }
+void autotest_firfilt_cccf_block_h5()  { firfilt_cccf_block_test( 5); }
+void autotest_firfilt_cccf_block_h8()  { firfilt_cccf_block_test( 8); }
+void autotest_firfilt_cccf_block_h9()  { firfilt_cccf_block_test( 9); }
+void autotest_firfilt_cccf_block_h64() { firfilt_cccf_block_test(64); }
+
@@ -78,6 +78,54 @@ void detector_cccf_bench(struct rusage *     _start,
     detector_cccf_destroy(q);
 }
 
+// Helper function for block mode
+void detector_cccf_block_bench(struct rusage *     _start,
+                               struct rusage *     _finish,
+                               unsigned long int * _num_iterations,
+                               unsigned int        _n)
+{
+    // adjust number of iterations
+    *_num_iterations *= 4;
+    *_num_iterations /= _n;
+
+    // generate sequence (random)
+    float complex h[_n];
+    unsigned long int i;
+    for (i=0; i<_n; i++) {
+        h[i] = (rand() % 2 ? 1.0f : -1.0f) +
+               (rand() % 2 ? 1.0f : -1.0f)*_Complex_I;
+    }
+
+    // generate synchronizer
+    float threshold = 0.5f;
+    float dphi_max  = 0.07f;
+    detector_cccf q = detector_cccf_create(h, _n, threshold, dphi_max);
+
+    // input sequence (random)
+    unsigned int num_samples = 1024;
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++) {
+        x[i] = (rand() % 2 ? 1.0f : -1.0f) +
+               (rand() % 2 ? 1.0f : -1.0f)*_Complex_I;
+    }
+
+    float tau_hat;
+    float dphi_hat;
+    float gamma_hat;
+    unsigned int num_read;
+
+    // start trials
+    unsigned long int num_blocks = *_num_iterations / num_samples + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_blocks; i++)
+        detector_cccf_correlate_block(q, x, num_samples, &num_read, &tau_hat, &dphi_hat, &gamma_hat);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * num_samples;
+
+    // clean up allocated objects
+    detector_cccf_destroy(q);
+}
+
 #define DETECTOR_CCCF_BENCHMARK_API(N)      \
 (   struct rusage *     _start,             \
     struct rusage *     _finish,            \
@@ -90,3 +138,14 @@ void benchmark_detector_cccf_64   DETECTOR_CCCF_BENCHMARK_API(64);
 void benchmark_detector_cccf_128  DETECTOR_CCCF_BENCHMARK_API(128);
 void benchmark_detector_cccf_256  DETECTOR_CCCF_BENCHMARK_API(256);
 
+#define DETECTOR_CCCF_BLOCK_BENCHMARK_API(N)    \
+(   struct rusage *     _start,                 \
+    struct rusage *     _finish,                \
+    unsigned long int * _num_iterations)        \
+{ detector_cccf_block_bench(_start, _finish, _num_iterations, N); }
+
+void benchmark_detector_cccf_block_16   DETECTOR_CCCF_BLOCK_BENCHMARK_API(16);
+void benchmark_detector_cccf_block_32   DETECTOR_CCCF_BLOCK_BENCHMARK_API(32);
+void benchmark_detector_cccf_block_64   DETECTOR_CCCF_BLOCK_BENCHMARK_API(64);
+void benchmark_detector_cccf_block_128  DETECTOR_CCCF_BLOCK_BENCHMARK_API(128);
+void benchmark_detector_cccf_block_256  DETECTOR_CCCF_BLOCK_BENCHMARK_API(256);
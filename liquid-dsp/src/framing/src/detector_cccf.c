@@ -36,6 +36,11 @@
 #define DEBUG_DETECTOR_BUFFER_LEN   (1600)
 #define DEBUG_DETECTOR_FILENAME     "detector_cccf_debug.m"
 
+// In block mode, time-domain correlators only run on samples where the
+// coarse (FFT-domain) correlation exceeds this fraction of the
+// detection threshold
+#define DETECTOR_COARSE_GATE        (0.8f)
+
 // 
 // internal method declarations
 //
@@ -47,6 +52,18 @@ void detector_cccf_update_sumsq(detector_cccf _q,
 // compute all dot product outputs
 void detector_cccf_compute_dotprods(detector_cccf _q);
 
+// update correlators with newest buffer and run detection state machine;
+// returns '1' if signal was detected, '0' otherwise
+int detector_cccf_update(detector_cccf _q,
+                         float *       _tau_hat,
+                         float *       _dphi_hat,
+                         float *       _gamma_hat);
+
+// compute coarse correlation of next block of input samples
+void detector_cccf_compute_coarse(detector_cccf   _q,
+                                  float complex * _x,
+                                  unsigned int    _n);
+
 // estimate carrier and timing offsets
 void detector_cccf_estimate_offsets(detector_cccf _q,
                                     float *       _tau_hat,
@@ -78,6 +95,20 @@ struct detector_cccf_s {
     unsigned int imax;      // index of maximum
     unsigned int idetect;   // index of detection
 
+    // coarse (FFT-domain) correlators for block mode; carrier
+    // hypotheses are circular shifts of the sequence spectrum
+    unsigned int nfft;      // transform size
+    unsigned int num_coarse;// number of input samples per transform
+    int          bmax;      // hypotheses: bins -bmax*bstep ... bmax*bstep
+    unsigned int bstep;     // hypothesis spacing [bins]
+    float complex * S;      // conjugate sequence spectrum (scaled) [size: nfft x 1]
+    float complex * X;      // input block spectrum [size: nfft x 1]
+    float complex * buf_time;   // transform buffer (time) [size: nfft x 1]
+    float complex * buf_freq;   // transform buffer (freq) [size: nfft x 1]
+    FFT_PLAN fft;           // forward transform (buf_time -> buf_freq)
+    FFT_PLAN ifft;          // reverse transform (buf_freq -> buf_time)
+    float * coarse;         // coarse max |rxy|^2, unscaled [size: num_coarse x 1]
+
     // estimation of E{|x|^2}
     wdelayf x2;             // buffer of |x|^2 values
     float x2_sum;           // sum{ |x|^2 }
@@ -163,6 +194,30 @@ detector_cccf detector_cccf_create(float complex * _s,
         q->dp[k] = dotprod_cccf_create(sconj, q->n);
     }
 
+    // coarse correlators: transform at least twice the sequence length
+    // with hypotheses spaced about dphi_step apart (the bin spacing
+    // 2*pi/nfft is at most 1.25*dphi_step)
+    q->nfft       = 1 << liquid_nextpow2(2*q->n);
+    q->num_coarse = q->nfft - q->n + 1;
+    q->bstep      = (unsigned int) roundf(q->dphi_step * q->nfft / (2*M_PI));
+    q->bstep      = q->bstep < 1 ? 1 : q->bstep;
+    q->bmax       = (int) ceilf(0.5f * q->m * q->dphi_step * q->nfft / (2*M_PI) / q->bstep);
+    q->S        = (float complex*) malloc(q->nfft*sizeof(float complex));
+    q->X        = (float complex*) malloc(q->nfft*sizeof(float complex));
+    q->buf_time = (float complex*) malloc(q->nfft*sizeof(float complex));
+    q->buf_freq = (float complex*) malloc(q->nfft*sizeof(float complex));
+    q->coarse   = (float*)         malloc(q->num_coarse*sizeof(float));
+    q->fft  = FFT_CREATE_PLAN(q->nfft, q->buf_time, q->buf_freq, FFT_DIR_FORWARD,  FFT_METHOD);
+    q->ifft = FFT_CREATE_PLAN(q->nfft, q->buf_freq, q->buf_time, FFT_DIR_BACKWARD, FFT_METHOD);
+
+    // compute conjugate spectrum of zero-padded sequence, folding in
+    // the normalization of the reverse transform
+    for (i=0; i<q->nfft; i++)
+        q->buf_time[i] = i < q->n ? q->s[i] : 0.0f;
+    FFT_EXECUTE(q->fft);
+    for (i=0; i<q->nfft; i++)
+        q->S[i] = conjf(q->buf_freq[i]) / (float)(q->nfft);
+
     // reset state
     detector_cccf_reset(q);
 
@@ -196,6 +251,15 @@ void detector_cccf_destroy(detector_cccf _q)
     free(_q->rxy0);
     free(_q->rxy1);
 
+    // destroy coarse correlators
+    FFT_DESTROY_PLAN(_q->fft);
+    FFT_DESTROY_PLAN(_q->ifft);
+    free(_q->S);
+    free(_q->X);
+    free(_q->buf_time);
+    free(_q->buf_freq);
+    free(_q->coarse);
+
     // destroy |x|^2 buffer
     wdelayf_destroy(_q->x2);
 
@@ -213,6 +277,7 @@ void detector_cccf_print(detector_cccf _q)
     printf("    threshold           :   %8.4f\n", _q->threshold);
     printf("    maximum carrier     :   %8.4f rad/sample\n", _q->dphi_max);
     printf("    num. correlators    :   %u\n", _q->m);
+    printf("    coarse transform    :   %u (%u hypotheses)\n", _q->nfft, 2*_q->bmax+1);
 }
 
 void detector_cccf_reset(detector_cccf _q)
@@ -268,6 +333,132 @@ int detector_cccf_correlate(detector_cccf _q,
         return 0;
     }
 
+    // update correlators and run detection
+    return detector_cccf_update(_q, _tau_hat, _dphi_hat, _gamma_hat);
+}
+
+// Run block of samples through pre-demod detector, stopping at the
+// first detection. A bank of FFT-based correlators first searches all
+// carrier offset hypotheses at once and the time-domain correlators
+// are only run on samples whose coarse correlation exceeds
+// DETECTOR_COARSE_GATE times the threshold. This is equivalent in
+// practice to running each sample through detector_cccf_correlate(),
+// but not sample-exact: a peak below the coarse gate is missed, and
+// skipped samples leave the time-domain correlator history (rxy0,
+// rxy1) stale, which can shift when a detection is declared.
+// Returns '1' if signal was detected, '0' otherwise
+//  _q          :   pre-demod detector
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _num_read   :   number of samples consumed (up to and including
+//                  the detection, otherwise _n)
+//  _tau_hat    :   fractional sample offset estimate (set when detected)
+//  _dphi_hat   :   carrier frequency offset estimate (set when detected)
+//  _gamma_hat  :   channel gain estimate (set when detected)
+int detector_cccf_correlate_block(detector_cccf   _q,
+                                  float complex * _x,
+                                  unsigned int    _n,
+                                  unsigned int *  _num_read,
+                                  float *         _tau_hat,
+                                  float *         _dphi_hat,
+                                  float *         _gamma_hat)
+{
+    // detection threshold on unscaled |rxy|^2, relative to x2_hat
+    float gate = DETECTOR_COARSE_GATE * _q->threshold * _q->n;
+    gate = gate * gate;
+
+    unsigned int i = 0;
+    while (i < _n) {
+        // number of samples in this block: run out timer first,
+        // otherwise fill coarse correlator block
+        unsigned int num_block = _n - i;
+        if (_q->timer > 0 && _q->timer < num_block)
+            num_block = _q->timer;
+        else if (num_block > _q->num_coarse)
+            num_block = _q->num_coarse;
+
+        // run coarse correlators only if seeking after timeout, and the
+        // block is long enough to be worth the transforms
+        int seek = _q->state == DETECTOR_STATE_SEEK && _q->timer == 0 &&
+                   2*num_block >= _q->num_coarse;
+        if (seek)
+            detector_cccf_compute_coarse(_q, &_x[i], num_block);
+
+        unsigned int j;
+        for (j=0; j<num_block; j++) {
+            // push sample into buffer and update sum{|x|^2}
+            windowcf_push(_q->buffer, _x[i+j]);
+            detector_cccf_update_sumsq(_q, _x[i+j]);
+
+#if DEBUG_DETECTOR
+            windowcf_push(_q->debug_x, _x[i+j]);
+            windowf_push(_q->debug_x2, _q->x2_hat);
+#endif
+            if (_q->timer) {
+                _q->timer--;
+#if DEBUG_DETECTOR
+                windowf_push(_q->debug_rxy, 0.0f);
+#endif
+                continue;
+            }
+
+            // skip time-domain correlators while seeking unless a peak
+            // is possible here or on the next sample (the next sample
+            // needs this output for timing interpolation); always run
+            // on the last sample as the next block is not yet known
+            if (seek && _q->state == DETECTOR_STATE_SEEK && j+1 < num_block &&
+                _q->coarse[j]   < gate * _q->x2_hat &&
+                _q->coarse[j+1] < gate * _q->x2_hat)
+            {
+#if DEBUG_DETECTOR
+                windowf_push(_q->debug_rxy, 0.0f);
+#endif
+                continue;
+            }
+
+            if (detector_cccf_update(_q, _tau_hat, _dphi_hat, _gamma_hat)) {
+                *_num_read = i + j + 1;
+                return 1;
+            }
+        }
+        i += num_block;
+    }
+
+    *_num_read = _n;
+    return 0;
+}
+
+// 
+// internal methods
+//
+
+// compute sum{ |x|^2 }
+void detector_cccf_update_sumsq(detector_cccf _q,
+                                float complex _x)
+{
+    // update estimate of signal magnitude
+    float x2_n = crealf(_x * conjf(_x));    // |x[n-1]|^2 (input sample)
+    float x2_0;                             // |x[0]  |^2 (oldest sample)
+    wdelayf_read(_q->x2, &x2_0);            // read oldest sample
+    wdelayf_push(_q->x2, x2_n);             // push newest sample
+    _q->x2_sum = _q->x2_sum + x2_n - x2_0;  // update sum( |x|^2 ) of last 'n' input samples
+#if 0
+    // filtered estimate of E{ |x|^2 }
+    _q->x2_hat = 0.8f*_q->x2_hat + 0.2f*_q->x2_sum*_q->n_inv;
+#else
+    // unfiltered estimate of E{ |x|^2 }
+    _q->x2_hat = _q->x2_sum * _q->n_inv;
+#endif
+
+}
+
+// update correlators with newest buffer and run detection state machine;
+// returns '1' if signal was detected, '0' otherwise
+int detector_cccf_update(detector_cccf _q,
+                         float *       _tau_hat,
+                         float *       _dphi_hat,
+                         float *       _gamma_hat)
+{
     // save previous correlator outputs
     memmove(_q->rxy0, _q->rxy1, _q->m*sizeof(float));
     memmove(_q->rxy1, _q->rxy,  _q->m*sizeof(float));
@@ -319,37 +510,13 @@ int detector_cccf_correlate(detector_cccf _q,
             return 1;
         }
     } else {
-        fprintf(stderr,"error: detector_cccf_correlate(), unknown/unsupported internal state\n");
+        fprintf(stderr,"error: detector_cccf_update(), unknown/unsupported internal state\n");
         exit(1);
     }
 
     return 0;
 }
 
-// 
-// internal methods
-//
-
-// compute sum{ |x|^2 }
-void detector_cccf_update_sumsq(detector_cccf _q,
-                                float complex _x)
-{
-    // update estimate of signal magnitude
-    float x2_n = crealf(_x * conjf(_x));    // |x[n-1]|^2 (input sample)
-    float x2_0;                             // |x[0]  |^2 (oldest sample)
-    wdelayf_read(_q->x2, &x2_0);            // read oldest sample
-    wdelayf_push(_q->x2, x2_n);             // push newest sample
-    _q->x2_sum = _q->x2_sum + x2_n - x2_0;  // update sum( |x|^2 ) of last 'n' input samples
-#if 0
-    // filtered estimate of E{ |x|^2 }
-    _q->x2_hat = 0.8f*_q->x2_hat + 0.2f*_q->x2_sum*_q->n_inv;
-#else
-    // unfiltered estimate of E{ |x|^2 }
-    _q->x2_hat = _q->x2_sum * _q->n_inv;
-#endif
-
-}
-
 // compute all dot product outputs
 void detector_cccf_compute_dotprods(detector_cccf _q)
 {
@@ -389,6 +556,55 @@ void detector_cccf_compute_dotprods(detector_cccf _q)
 #endif
 }
 
+// compute coarse correlation of next block of input samples; for
+// each sample the maximum unscaled |rxy|^2 over all carrier offset
+// hypotheses is stored in _q->coarse
+//  _q      :   detector object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of input samples, _n <= num_coarse
+void detector_cccf_compute_coarse(detector_cccf   _q,
+                                  float complex * _x,
+                                  unsigned int    _n)
+{
+    unsigned int i;
+    unsigned int n    = _q->n;
+    unsigned int nfft = _q->nfft;
+
+    // load last n-1 buffered samples, new block, and zero-pad
+    float complex * r;
+    windowcf_read(_q->buffer, &r);
+    memmove(_q->buf_time,       &r[1], (n-1)*sizeof(float complex));
+    memmove(&_q->buf_time[n-1], _x,    _n*sizeof(float complex));
+    for (i=n-1+_n; i<nfft; i++)
+        _q->buf_time[i] = 0.0f;
+
+    // compute input spectrum
+    FFT_EXECUTE(_q->fft);
+    memmove(_q->X, _q->buf_freq, nfft*sizeof(float complex));
+
+    for (i=0; i<_n; i++)
+        _q->coarse[i] = 0.0f;
+
+    int b;
+    for (b=-_q->bmax; b<=_q->bmax; b++) {
+        // spin sequence by b*bstep bins: S[k] -> S[k-b*bstep]
+        unsigned int shift = (unsigned int)(b*(int)_q->bstep + (int)nfft) % nfft;
+        for (i=0; i<shift; i++)
+            _q->buf_freq[i] = _q->X[i] * _q->S[nfft-shift+i];
+        for (i=shift; i<nfft; i++)
+            _q->buf_freq[i] = _q->X[i] * _q->S[i-shift];
+
+        // cross-correlation; output i corresponds to window ending at _x[i]
+        FFT_EXECUTE(_q->ifft);
+        for (i=0; i<_n; i++) {
+            float complex v = _q->buf_time[i];
+            float rxy2 = crealf(v)*crealf(v) + cimagf(v)*cimagf(v);
+            if (rxy2 > _q->coarse[i])
+                _q->coarse[i] = rxy2;
+        }
+    }
+}
+
 // estimate carrier and timing offsets
 void detector_cccf_estimate_offsets(detector_cccf _q,
                                     float *       _tau_hat,
@@ -37,9 +37,11 @@
 #define DEBUG_FILENAME              "framesync64_internal_debug.m"
 #define DEBUG_BUFFER_LEN            (1600)
 
-// push samples through detection stage
-void framesync64_execute_seekpn(framesync64   _q,
-                                float complex _x);
+// push samples through detection stage; returns number of samples
+// consumed (up to and including a detection)
+unsigned int framesync64_execute_seekpn(framesync64     _q,
+                                        float complex * _x,
+                                        unsigned int    _n);
 
 // update symbol synchronizer internal state (filtered error, index, etc.)
 //  _q      :   frame synchronizer
@@ -289,17 +291,18 @@ void framesync64_execute(framesync64     _q,
                          float complex * _x,
                          unsigned int    _n)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
+    unsigned int i = 0;
+    while (i < _n) {
+        if (_q->state == STATE_DETECTFRAME) {
+            // detect frame (look for p/n sequence) over block of samples
+            i += framesync64_execute_seekpn(_q, &_x[i], _n-i);
+            continue;
+        }
 #if DEBUG_FRAMESYNC64
         if (_q->debug_enabled)
             windowcf_push(_q->debug_x, _x[i]);
 #endif
         switch (_q->state) {
-        case STATE_DETECTFRAME:
-            // detect frame (look for p/n sequence)
-            framesync64_execute_seekpn(_q, _x[i]);
-            break;
         case STATE_RXPREAMBLE:
             // receive p/n sequence symbols
             framesync64_execute_rxpreamble(_q, _x[i]);
@@ -312,6 +315,7 @@ void framesync64_execute(framesync64     _q,
             fprintf(stderr,"error: framesync64_exeucte(), unknown/unsupported state\n");
             exit(1);
         }
+        i++;
     }
 }
 
@@ -320,21 +324,29 @@ void framesync64_execute(framesync64     _q,
 //
 
 // execute synchronizer, seeking p/n sequence
-//  _q     :   frame synchronizer object
-//  _x      :   input sample
-//  _sym    :   demodulated symbol
-void framesync64_execute_seekpn(framesync64   _q,
-                                float complex _x)
+//  _q      :   frame synchronizer object
+//  _x      :   input sample array [size: _n x 1]
+//  _n      :   number of input samples
+unsigned int framesync64_execute_seekpn(framesync64     _q,
+                                        float complex * _x,
+                                        unsigned int    _n)
 {
-    // push sample into pre-demod p/n sequence buffer
-    windowcf_push(_q->buffer, _x);
-
-    // push through pre-demod synchronizer
-    int detected = detector_cccf_correlate(_q->frame_detector,
-                                           _x,
-                                           &_q->tau_hat,
-                                           &_q->dphi_hat,
-                                           &_q->gamma_hat);
+    // push block through pre-demod synchronizer
+    unsigned int num_read = 0;
+    int detected = detector_cccf_correlate_block(_q->frame_detector,
+                                                 _x,
+                                                 _n,
+                                                 &num_read,
+                                                 &_q->tau_hat,
+                                                 &_q->dphi_hat,
+                                                 &_q->gamma_hat);
+
+    // push samples into pre-demod p/n sequence buffer
+    windowcf_write(_q->buffer, _x, num_read);
+#if DEBUG_FRAMESYNC64
+    if (_q->debug_enabled)
+        windowcf_write(_q->debug_x, _x, num_read);
+#endif
 
     // check if frame has been detected
     if (detected) {
@@ -346,6 +358,8 @@ void framesync64_execute_seekpn(framesync64   _q,
         //       to STATE_SEEKPN
         framesync64_pushpn(_q);
     }
+
+    return num_read;
 }
 
 // update symbol synchronizer internal state (filtered error, index, etc.)
@@ -552,73 +552,74 @@ void ofdmflexframesync_decode_header(ofdmflexframesync _q)
 void ofdmflexframesync_rxpayload(ofdmflexframesync _q,
                                  float complex * _X)
 {
-    // demodulate paylod symbols
+    // gather data subcarriers, up to end of payload
     unsigned int i;
-    int sctype;
-    for (i=0; i<_q->M; i++) {
-        // subcarrier type (PILOT/NULL/DATA)
-        sctype = _q->p[i];
-
+    unsigned int n = 0;
+    unsigned int num_remaining = _q->payload_mod_len - _q->payload_symbol_index;
+    float complex x[_q->M_data];
+    for (i=0; i<_q->M && n < num_remaining; i++) {
         // ignore pilot and null subcarriers
-        if (sctype == OFDMFRAME_SCTYPE_DATA) {
-            // unload payload symbols
-            unsigned int sym;
-            modem_demodulate(_q->mod_payload, _X[i], &sym);
+        if (_q->p[i] == OFDMFRAME_SCTYPE_DATA)
+            x[n++] = _X[i];
+    }
 
-            // pack decoded symbol into array
-            liquid_pack_array(_q->payload_enc,
-                              _q->payload_enc_len,
-                              _q->payload_buffer_index,
-                              _q->bps_payload,
-                              sym);
+    // demodulate payload symbols
+    unsigned int sym[_q->M_data];
+    modem_demodulate_block(_q->mod_payload, x, n, sym);
 
-            // increment...
-            _q->payload_buffer_index += _q->bps_payload;
+    for (i=0; i<n; i++) {
+        // pack decoded symbol into array
+        liquid_pack_array(_q->payload_enc,
+                          _q->payload_enc_len,
+                          _q->payload_buffer_index,
+                          _q->bps_payload,
+                          sym[i]);
 
-            // increment symbol counter
-            _q->payload_symbol_index++;
+        // increment...
+        _q->payload_buffer_index += _q->bps_payload;
+    }
+
+    // increment symbol counter
+    _q->payload_symbol_index += n;
 
-            if (_q->payload_symbol_index == _q->payload_mod_len) {
-                // payload extracted
+    if (_q->payload_symbol_index == _q->payload_mod_len) {
+        // payload extracted
 
-                // decode payload
-                _q->payload_valid = packetizer_decode(_q->p_payload, _q->payload_enc, _q->payload_dec);
+        // decode payload
+        _q->payload_valid = packetizer_decode(_q->p_payload, _q->payload_enc, _q->payload_dec);
 #if DEBUG_OFDMFLEXFRAMESYNC
-                printf("****** payload extracted [%s]\n", _q->payload_valid ? "valid" : "INVALID!");
+        printf("****** payload extracted [%s]\n", _q->payload_valid ? "valid" : "INVALID!");
 #endif
 
-                // ignore callback if set to NULL
-                if (_q->callback == NULL) {
-                    ofdmflexframesync_reset(_q);
-                    break;
-                }
-
-                // set framestats internals
-                _q->framestats.rssi             = ofdmframesync_get_rssi(_q->fs);
-                _q->framestats.cfo              = ofdmframesync_get_cfo(_q->fs);
-                _q->framestats.framesyms        = NULL;
-                _q->framestats.num_framesyms    = 0;
-                _q->framestats.mod_scheme       = _q->ms_payload;
-                _q->framestats.mod_bps          = _q->bps_payload;
-                _q->framestats.check            = _q->check;
-                _q->framestats.fec0             = _q->fec0;
-                _q->framestats.fec1             = _q->fec1;
-
-                // invoke callback method
-                _q->callback(_q->header,
-                             _q->header_valid,
-                             _q->payload_dec,
-                             _q->payload_len,
-                             _q->payload_valid,
-                             _q->framestats,
-                             _q->userdata);
-
-
-                // reset object
-                ofdmflexframesync_reset(_q);
-                break;
-            }
+        // ignore callback if set to NULL
+        if (_q->callback == NULL) {
+            ofdmflexframesync_reset(_q);
+            return;
         }
+
+        // set framestats internals
+        _q->framestats.rssi             = ofdmframesync_get_rssi(_q->fs);
+        _q->framestats.cfo              = ofdmframesync_get_cfo(_q->fs);
+        _q->framestats.framesyms        = NULL;
+        _q->framestats.num_framesyms    = 0;
+        _q->framestats.mod_scheme       = _q->ms_payload;
+        _q->framestats.mod_bps          = _q->bps_payload;
+        _q->framestats.check            = _q->check;
+        _q->framestats.fec0             = _q->fec0;
+        _q->framestats.fec1             = _q->fec1;
+
+        // invoke callback method
+        _q->callback(_q->header,
+                     _q->header_valid,
+                     _q->payload_dec,
+                     _q->payload_len,
+                     _q->payload_valid,
+                     _q->framestats,
+                     _q->userdata);
+
+
+        // reset object
+        ofdmflexframesync_reset(_q);
     }
 }
 
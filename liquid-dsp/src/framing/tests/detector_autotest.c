@@ -17,6 +17,8 @@
  * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
+
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -48,6 +50,16 @@ void autotest_detector_cccf_n671()  { detector_cccf_runtest( 671, 0.2f, 0.01f);
 void autotest_detector_cccf_n1024() { detector_cccf_runtest(1024, 0.2f, 0.01f); }
 void autotest_detector_cccf_n1341() { detector_cccf_runtest(1341, 0.2f, 0.01f); }
 
+// block mode must produce the same detection as running the detector
+// one sample at a time
+void detector_cccf_runtest_block(unsigned int _n,
+                                 float        _dphi);
+
+void autotest_detector_cccf_block_n64()   { detector_cccf_runtest_block(  64,  0.01f); }
+void autotest_detector_cccf_block_n128()  { detector_cccf_runtest_block( 128, -0.02f); }
+void autotest_detector_cccf_block_n335()  { detector_cccf_runtest_block( 335,  0.03f); }
+void autotest_detector_cccf_block_n1024() { detector_cccf_runtest_block(1024, -0.01f); }
+
 // autotest helper function
 //  _n      :   sequence length
 //  _dt     :   fractional sample offset
@@ -169,3 +181,79 @@ void detector_cccf_runtest(unsigned int _n,
 }
 
 
+// autotest helper function: compare block and sample-by-sample modes
+//  _n      :   sequence length
+//  _dphi   :   carrier frequency offset
+void detector_cccf_runtest_block(unsigned int _n,
+                                 float        _dphi)
+{
+    unsigned int i;
+
+    // fixed values
+    float SNRdB       = 20.0f;      // signal-to-noise ratio [dB]
+    float threshold   = 0.5f;       // detection threshold
+    unsigned int num_noise = 3*_n + 17;     // leading noise samples
+    unsigned int num_samples = num_noise + 2*_n;
+
+    // generate random QPSK sequence
+    float complex s[_n];
+    for (i=0; i<_n; i++)
+        s[i] = (rand() % 2 ? 1.0f : -1.0f) + (rand() % 2 ? 1.0f : -1.0f)*_Complex_I;
+
+    // generate received signal: noise, sequence, noise
+    float nstd = powf(10.0f, -SNRdB/20.0f);
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++) {
+        x[i] = nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        if (i >= num_noise && i < num_noise + _n)
+            x[i] += s[i-num_noise] * cexpf(_Complex_I*_dphi*i);
+    }
+
+    // run sample by sample
+    detector_cccf q0 = detector_cccf_create(s, _n, threshold, 2*fabsf(_dphi));
+    float tau0=0, dphi0=0, gamma0=0;
+    unsigned int index0 = 0, num_detect0 = 0;
+    for (i=0; i<num_samples; i++) {
+        if (detector_cccf_correlate(q0, x[i], &tau0, &dphi0, &gamma0)) {
+            index0 = i;
+            num_detect0++;
+        }
+    }
+    detector_cccf_destroy(q0);
+
+    // run in blocks of irregular size
+    detector_cccf q1 = detector_cccf_create(s, _n, threshold, 2*fabsf(_dphi));
+    float tau1=0, dphi1=0, gamma1=0;
+    unsigned int index1 = 0, num_detect1 = 0;
+    unsigned int block_len[4] = {1, 37, _n, 5*_n};
+    unsigned int num_read;
+    i = 0;
+    unsigned int k = 0;
+    while (i < num_samples) {
+        unsigned int n = block_len[k++ % 4];
+        if (n > num_samples - i)
+            n = num_samples - i;
+        if (detector_cccf_correlate_block(q1, &x[i], n, &num_read, &tau1, &dphi1, &gamma1)) {
+            index1 = i + num_read - 1;
+            num_detect1++;
+        }
+        i += num_read;
+    }
+    detector_cccf_destroy(q1);
+
+    if (liquid_autotest_verbose) {
+        printf("detector block autotest [%4u]: %u/%u detections, index %u/%u\n",
+                _n, num_detect0, num_detect1, index0, index1);
+        printf("    tau   : %12.8f %12.8f\n", tau0,   tau1);
+        printf("    dphi  : %12.8f %12.8f\n", dphi0,  dphi1);
+        printf("    gamma : %12.8f %12.8f\n", gamma0, gamma1);
+    }
+
+    CONTEND_GREATER_THAN( num_detect0, 0 );
+    CONTEND_EQUALITY( num_detect0, num_detect1 );
+    CONTEND_EQUALITY( index0, index1 );
+    CONTEND_DELTA( tau0,   tau1,   1e-3f );
+    CONTEND_DELTA( dphi0,  dphi1,  1e-4f );
+    CONTEND_DELTA( gamma0, gamma1, 1e-4f );
+}
+
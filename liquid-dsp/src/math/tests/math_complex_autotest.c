@@ -18,7 +18,7 @@
  */
 
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 // 
 // AUTOTEST: cexpf
@@ -342,3 +342,42 @@ void autotest_catanf()
         CONTEND_DELTA(cimagf(t), cimagf(test[i]), tol);
     }
 }
+
+// 
+// AUTOTEST: complex arithmetic helpers (liquid_cmulf, liquid_cdivf,
+// liquid_cabsf2), checked against the C99 operators
+//
+void autotest_liquid_cmulf()
+{
+    float tol = 1e-5f;
+
+    unsigned int n = 8;
+    float complex a[8] = {
+        1.0000e+00+_Complex_I*  0.0000e+00,  -2.5000e+00+_Complex_I*  1.2500e+00,
+        3.1416e+00+_Complex_I* -2.7183e+00,   0.0000e+00+_Complex_I*  1.0000e+00,
+       -7.0711e-01+_Complex_I* -7.0711e-01,   1.0000e+03+_Complex_I*  2.0000e-03,
+        4.5000e-01+_Complex_I*  9.1000e-01,  -1.2000e+00+_Complex_I* -3.4000e+00 };
+    float complex b[8] = {
+        2.0000e+00+_Complex_I* -3.0000e+00,   7.0711e-01+_Complex_I*  7.0711e-01,
+       -1.0000e+00+_Complex_I*  5.0000e-01,   0.0000e+00+_Complex_I*  1.0000e+00,
+        1.5000e+00+_Complex_I* -2.5000e-01,   1.0000e-03+_Complex_I*  5.0000e+02,
+       -8.0000e-01+_Complex_I*  6.0000e-01,   3.3000e+00+_Complex_I* -1.1000e+00 };
+
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        float complex y_mul = a[i] * b[i];
+        float complex y_div = a[i] / b[i];
+        float complex t_mul = liquid_cmulf(a[i], b[i]);
+        float complex t_div = liquid_cdivf(a[i], b[i]);
+        float tol_mul = tol * (1.0f + cabsf(y_mul));
+        float tol_div = tol * (1.0f + cabsf(y_div));
+
+        CONTEND_DELTA(crealf(t_mul), crealf(y_mul), tol_mul);
+        CONTEND_DELTA(cimagf(t_mul), cimagf(y_mul), tol_mul);
+        CONTEND_DELTA(crealf(t_div), crealf(y_div), tol_div);
+        CONTEND_DELTA(cimagf(t_div), cimagf(y_div), tol_div);
+
+        float v = cabsf(a[i]);
+        CONTEND_DELTA(liquid_cabsf2(a[i]), v*v, tol*(1.0f + v*v));
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <complex.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// number of matrices in each batch
+#define MATRIXCF_BATCH_NUM (256)
+
+// Helper function to keep code base small
+//  _n      :   matrix size
+//  _op     :   operation (0:linsolve, 1:inv, 2:chol)
+void matrixcf_batch_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _n,
+                          int                 _op)
+{
+    // normalize number of iterations
+    // time ~ _num * _n ^ 3
+    *_num_iterations /= MATRIXCF_BATCH_NUM * _n * _n * _n / 8;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned int num = MATRIXCF_BATCH_NUM;
+    float complex * A = (float complex*) malloc(_n*_n*num*sizeof(float complex));
+    float complex * X = (float complex*) malloc(_n*_n*num*sizeof(float complex));
+    float complex * b = (float complex*) malloc(_n*num*sizeof(float complex));
+    float complex * x = (float complex*) malloc(_n*num*sizeof(float complex));
+    unsigned long int i;
+
+    // Hermitian positive-definite matrices, A = H^H H + I
+    unsigned int k;
+    for (k=0; k<num; k++) {
+        float complex H[_n*_n];
+        float complex Ak[_n*_n];
+        for (i=0; i<_n*_n; i++)
+            H[i] = randnf() + _Complex_I*randnf();
+        matrixcf_transpose_mul(H, _n, _n, Ak);
+        for (i=0; i<_n*_n; i++)
+            A[i*num+k] = Ak[i] + (i % (_n+1) == 0 ? 1.0f : 0.0f);
+    }
+    for (i=0; i<_n*num; i++)
+        b[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        switch (_op) {
+        case 0:
+            matrixcf_linsolve_batch(A, _n, b, x, num);
+            break;
+        case 1:
+            memmove(X, A, _n*_n*num*sizeof(float complex));
+            matrixcf_inv_batch(X, _n, num);
+            break;
+        default:
+            matrixcf_chol_batch(A, _n, X, num);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    free(A);
+    free(X);
+    free(b);
+    free(x);
+}
+
+#define MATRIXCF_BATCH_BENCHMARK_API(N,OP)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ matrixcf_batch_bench(_start, _finish, _num_iterations, N, OP); }
+
+void benchmark_matrixcf_linsolve_batch_n2   MATRIXCF_BATCH_BENCHMARK_API(2, 0)
+void benchmark_matrixcf_linsolve_batch_n4   MATRIXCF_BATCH_BENCHMARK_API(4, 0)
+void benchmark_matrixcf_linsolve_batch_n8   MATRIXCF_BATCH_BENCHMARK_API(8, 0)
+void benchmark_matrixcf_inv_batch_n2        MATRIXCF_BATCH_BENCHMARK_API(2, 1)
+void benchmark_matrixcf_inv_batch_n4        MATRIXCF_BATCH_BENCHMARK_API(4, 1)
+void benchmark_matrixcf_inv_batch_n8        MATRIXCF_BATCH_BENCHMARK_API(8, 1)
+void benchmark_matrixcf_chol_batch_n2       MATRIXCF_BATCH_BENCHMARK_API(2, 2)
+void benchmark_matrixcf_chol_batch_n4       MATRIXCF_BATCH_BENCHMARK_API(4, 2)
+void benchmark_matrixcf_chol_batch_n8       MATRIXCF_BATCH_BENCHMARK_API(8, 2)
+
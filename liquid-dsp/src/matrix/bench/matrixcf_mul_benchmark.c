@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <complex.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void matrixcf_mul_bench(struct rusage *_start,
+                        struct rusage *_finish,
+                        unsigned long int *_num_iterations,
+                        unsigned int _n)
+{
+    // normalize number of iterations
+    // time ~ _n ^ 2
+    *_num_iterations /= _n * _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float complex * a = (float complex*) malloc(_n*_n*sizeof(float complex));
+    float complex * b = (float complex*) malloc(_n*_n*sizeof(float complex));
+    float complex * c = (float complex*) malloc(_n*_n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_n*_n; i++) {
+        a[i] = randnf() + _Complex_I*randnf();
+        b[i] = randnf() + _Complex_I*randnf();
+    }
+    
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        matrixcf_mul(a,_n,_n,  b,_n,_n,  c,_n,_n);
+        matrixcf_mul(a,_n,_n,  b,_n,_n,  c,_n,_n);
+        matrixcf_mul(a,_n,_n,  b,_n,_n,  c,_n,_n);
+        matrixcf_mul(a,_n,_n,  b,_n,_n,  c,_n,_n);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    free(a);
+    free(b);
+    free(c);
+}
+
+#define MATRIXCF_MUL_BENCHMARK_API(N)    \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ matrixcf_mul_bench(_start, _finish, _num_iterations, N); }
+
+void benchmark_matrixcf_mul_n2      MATRIXCF_MUL_BENCHMARK_API(2)
+void benchmark_matrixcf_mul_n4      MATRIXCF_MUL_BENCHMARK_API(4)
+void benchmark_matrixcf_mul_n8      MATRIXCF_MUL_BENCHMARK_API(8)
+void benchmark_matrixcf_mul_n16     MATRIXCF_MUL_BENCHMARK_API(16)
+void benchmark_matrixcf_mul_n32     MATRIXCF_MUL_BENCHMARK_API(32)
+void benchmark_matrixcf_mul_n64     MATRIXCF_MUL_BENCHMARK_API(64)
+void benchmark_matrixcf_mul_n128    MATRIXCF_MUL_BENCHMARK_API(128)
+void benchmark_matrixcf_mul_n256    MATRIXCF_MUL_BENCHMARK_API(256)
+void benchmark_matrixcf_mul_n512    MATRIXCF_MUL_BENCHMARK_API(512)
+
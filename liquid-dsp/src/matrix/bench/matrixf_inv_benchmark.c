@@ -17,6 +17,7 @@
  * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -31,7 +32,7 @@ void matrixf_inv_bench(struct rusage *_start,
     *_num_iterations /= _n * _n;
     if (*_num_iterations < 1) *_num_iterations = 1;
 
-    float x[_n*_n];
+    float * x = (float*) malloc(_n*_n*sizeof(float));
     unsigned int i;
     for (i=0; i<_n*_n; i++)
         x[i] = randnf();
@@ -46,6 +47,8 @@ void matrixf_inv_bench(struct rusage *_start,
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4;
+
+    free(x);
 }
 
 #define MATRIXF_INV_BENCHMARK_API(N)    \
@@ -60,4 +63,7 @@ void benchmark_matrixf_inv_n8      MATRIXF_INV_BENCHMARK_API(8)
 void benchmark_matrixf_inv_n16     MATRIXF_INV_BENCHMARK_API(16)
 void benchmark_matrixf_inv_n32     MATRIXF_INV_BENCHMARK_API(32)
 void benchmark_matrixf_inv_n64     MATRIXF_INV_BENCHMARK_API(64)
+void benchmark_matrixf_inv_n128    MATRIXF_INV_BENCHMARK_API(128)
+void benchmark_matrixf_inv_n256    MATRIXF_INV_BENCHMARK_API(256)
+void benchmark_matrixf_inv_n512    MATRIXF_INV_BENCHMARK_API(512)
 
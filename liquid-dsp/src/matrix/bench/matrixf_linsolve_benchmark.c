@@ -34,7 +34,7 @@ void matrixf_linsolve_bench(struct rusage *     _start,
 
     unsigned long int i;
 
-    float A[_n*_n];
+    float * A = (float*) malloc(_n*_n*sizeof(float));
     float b[_n];
     float x[_n];
     for (i=0; i<_n*_n; i++)
@@ -52,6 +52,8 @@ void matrixf_linsolve_bench(struct rusage *     _start,
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4;
+
+    free(A);
 }
 
 #define MATRIXF_LINSOLVE_BENCHMARK_API(N)   \
@@ -66,4 +68,7 @@ void benchmark_matrixf_linsolve_n8      MATRIXF_LINSOLVE_BENCHMARK_API(8)
 void benchmark_matrixf_linsolve_n16     MATRIXF_LINSOLVE_BENCHMARK_API(16)
 void benchmark_matrixf_linsolve_n32     MATRIXF_LINSOLVE_BENCHMARK_API(32)
 void benchmark_matrixf_linsolve_n64     MATRIXF_LINSOLVE_BENCHMARK_API(64)
+void benchmark_matrixf_linsolve_n128    MATRIXF_LINSOLVE_BENCHMARK_API(128)
+void benchmark_matrixf_linsolve_n256    MATRIXF_LINSOLVE_BENCHMARK_API(256)
+void benchmark_matrixf_linsolve_n512    MATRIXF_LINSOLVE_BENCHMARK_API(512)
 
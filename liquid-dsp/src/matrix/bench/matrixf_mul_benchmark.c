@@ -17,6 +17,7 @@
  * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -31,9 +32,9 @@ void matrixf_mul_bench(struct rusage *_start,
     *_num_iterations /= _n * _n;
     if (*_num_iterations < 1) *_num_iterations = 1;
 
-    float a[_n*_n];
-    float b[_n*_n];
-    float c[_n*_n];
+    float * a = (float*) malloc(_n*_n*sizeof(float));
+    float * b = (float*) malloc(_n*_n*sizeof(float));
+    float * c = (float*) malloc(_n*_n*sizeof(float));
     unsigned int i;
     for (i=0; i<_n*_n; i++) {
         a[i] = randnf();
@@ -50,6 +51,10 @@ void matrixf_mul_bench(struct rusage *_start,
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4;
+
+    free(a);
+    free(b);
+    free(c);
 }
 
 #define MATRIXF_MUL_BENCHMARK_API(N)    \
@@ -64,4 +69,7 @@ void benchmark_matrixf_mul_n8      MATRIXF_MUL_BENCHMARK_API(8)
 void benchmark_matrixf_mul_n16     MATRIXF_MUL_BENCHMARK_API(16)
 void benchmark_matrixf_mul_n32     MATRIXF_MUL_BENCHMARK_API(32)
 void benchmark_matrixf_mul_n64     MATRIXF_MUL_BENCHMARK_API(64)
+void benchmark_matrixf_mul_n128    MATRIXF_MUL_BENCHMARK_API(128)
+void benchmark_matrixf_mul_n256    MATRIXF_MUL_BENCHMARK_API(256)
+void benchmark_matrixf_mul_n512    MATRIXF_MUL_BENCHMARK_API(512)
 
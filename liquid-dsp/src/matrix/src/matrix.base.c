@@ -25,6 +25,226 @@
 #include <stdio.h>
 #include <string.h>
 
+// accumulate scaled vector: _y[i] += _a*_x[i], i in [0,_n); complex
+// values are operated on as (real,imag) pairs, avoiding the C99
+// complex multiply so that the loop can be vectorized
+static void MATRIX(_axpy)(T            _a,
+                          T *          _x,
+                          T *          _y,
+                          unsigned int _n)
+{
+    unsigned int i;
+#if T_COMPLEX
+    TP   ar = ((TP*)&_a)[0];
+    TP   ai = ((TP*)&_a)[1];
+    TP * x  = (TP*)_x;
+    TP * y  = (TP*)_y;
+    for (i=0; i<2*_n; i+=2) {
+        y[i  ] += ar*x[i  ] - ai*x[i+1];
+        y[i+1] += ar*x[i+1] + ai*x[i  ];
+    }
+#else
+    for (i=0; i<_n; i++)
+        _y[i] += _a*_x[i];
+#endif
+}
+
+// squared magnitude of matrix element
+static TP MATRIX(_abs2)(T _x)
+{
+#if T_COMPLEX
+    TP xr = ((TP*)&_x)[0];
+    TP xi = ((TP*)&_x)[1];
+    return xr*xr + xi*xi;
+#else
+    return _x*_x;
+#endif
+}
+
+// complex conjugate of matrix element (no-op for real types)
+static T MATRIX(_conj)(T _x)
+{
+#if T_COMPLEX
+    ((TP*)&_x)[1] = -((TP*)&_x)[1];
+#endif
+    return _x;
+}
+
+// matrix multiplication blocking: the output is computed in tiles of
+// MATRIX_MR rows by MATRIX_NR primitive values (real or imaginary
+// parts) held in registers, from blocks of the right operand packed
+// into MATRIX_KC x MATRIX_NC panels that stay in cache
+#define MATRIX_MR   (4)
+#define MATRIX_NR   (4)
+#define MATRIX_KC   (128)
+#define MATRIX_NC   (256)
+
+// micro-kernel: accumulate [MATRIX_MR x MATRIX_NR] output tile over
+// _kc elements of the inner dimension
+//  _x      :   first row of tile in left operand
+//  _xr     :   row stride of left operand (primitive values)
+//  _xi     :   inner stride of left operand (primitive values)
+//  _s      :   sign of imaginary part of left operand (conjugate)
+//  _rows   :   number of valid rows in tile
+//  _bp     :   packed panel of right operand [size: _kc x MATRIX_NR]
+//  _bs     :   packed panel with (re,im) pairs as (-im,re)
+//  _z      :   output tile
+//  _zr     :   row stride of output (primitive values)
+//  _cols   :   number of valid primitive values per row of tile
+//  _alpha  :   scaling of result when accumulated into output (+/-1)
+static void MATRIX(_gemm_kernel)(unsigned int _kc,
+                                 TP *         _x,
+                                 unsigned int _xr,
+                                 unsigned int _xi,
+                                 TP           _s,
+                                 unsigned int _rows,
+                                 TP *         _bp,
+                                 TP *         _bs,
+                                 TP *         _z,
+                                 unsigned int _zr,
+                                 unsigned int _cols,
+                                 TP           _alpha)
+{
+    // rows past the end of the operand repeat the first row and
+    // are discarded
+    TP * a0 = _x;
+    TP * a1 = _x + (_rows > 1 ? _xr : 0);
+    TP * a2 = _x + (_rows > 2 ? _xr*2 : 0);
+    TP * a3 = _x + (_rows > 3 ? _xr*3 : 0);
+
+    // one accumulator row per row of the tile
+    TP c0[MATRIX_NR] = {0};
+    TP c1[MATRIX_NR] = {0};
+    TP c2[MATRIX_NR] = {0};
+    TP c3[MATRIX_NR] = {0};
+
+    unsigned int j, k;
+    for (k=0; k<_kc; k++) {
+        TP * bp = &_bp[k*MATRIX_NR];
+        TP x0 = a0[k*_xi];
+        TP x1 = a1[k*_xi];
+        TP x2 = a2[k*_xi];
+        TP x3 = a3[k*_xi];
+#if T_COMPLEX
+        TP * bs = &_bs[k*MATRIX_NR];
+        TP y0 = _s*a0[k*_xi + 1];
+        TP y1 = _s*a1[k*_xi + 1];
+        TP y2 = _s*a2[k*_xi + 1];
+        TP y3 = _s*a3[k*_xi + 1];
+        for (j=0; j<MATRIX_NR; j++) {
+            c0[j] += x0*bp[j] + y0*bs[j];
+            c1[j] += x1*bp[j] + y1*bs[j];
+            c2[j] += x2*bp[j] + y2*bs[j];
+            c3[j] += x3*bp[j] + y3*bs[j];
+        }
+#else
+        for (j=0; j<MATRIX_NR; j++) {
+            c0[j] += x0*bp[j];
+            c1[j] += x1*bp[j];
+            c2[j] += x2*bp[j];
+            c3[j] += x3*bp[j];
+        }
+#endif
+    }
+
+    // accumulate into output
+    TP * c[MATRIX_MR] = {c0, c1, c2, c3};
+    unsigned int r;
+    for (r=0; r<_rows; r++) {
+        for (j=0; j<_cols; j++)
+            _z[r*_zr + j] += _alpha*c[r][j];
+    }
+}
+
+// accumulate matrix product _Z += op(_X)*_Y (or _Z -= op(_X)*_Y if
+// _sub is set), where op(_X) is [_M x _K] with element (r,i) read from
+// _X[r*_xr + i*_xi] (conjugated if _xconj is set), _Y is [_K x _N]
+// with row stride _yr and _Z is [_M x _N] with row stride _zr. If
+// _upper is set (requires _M == _N) tiles below the diagonal are
+// skipped; the lower triangle of _Z is then incomplete.
+static void MATRIX(_gemm)(unsigned int _M,
+                          unsigned int _K,
+                          unsigned int _N,
+                          T *          _X,
+                          unsigned int _xr,
+                          unsigned int _xi,
+                          int          _xconj,
+                          T *          _Y,
+                          unsigned int _yr,
+                          T *          _Z,
+                          unsigned int _zr,
+                          int          _upper,
+                          int          _sub)
+{
+    if (_M == 0 || _K == 0 || _N == 0)
+        return;
+
+    unsigned int w  = T_COMPLEX ? 2 : 1;    // primitive values per element
+    unsigned int n  = _N*w;                 // row length
+    TP * x = (TP*)_X;
+    TP * y = (TP*)_Y;
+    TP * z = (TP*)_Z;
+    TP   s = _xconj ? -1 : 1;
+    TP   g = _sub   ? -1 : 1;
+
+    // packed block of _Y, panels of MATRIX_NR values, zero-padded
+    unsigned int kc_max = _K < MATRIX_KC ? _K : MATRIX_KC;
+    unsigned int nc_max = n  < MATRIX_NC ? n  : MATRIX_NC;
+    nc_max = ((nc_max + MATRIX_NR - 1) / MATRIX_NR) * MATRIX_NR;
+    TP bp[kc_max*nc_max];
+#if T_COMPLEX
+    TP bs[kc_max*nc_max];
+#else
+    TP * bs = bp;       // unused
+#endif
+
+    unsigned int j0, nc;    // block of columns (primitive values)
+    unsigned int k0, kc;    // block of inner dimension
+    unsigned int c, r, k, j;
+    for (j0=0; j0<n; j0+=nc) {
+        nc = n-j0 < MATRIX_NC ? n-j0 : MATRIX_NC;
+        for (k0=0; k0<_K; k0+=kc) {
+            kc = _K-k0 < MATRIX_KC ? _K-k0 : MATRIX_KC;
+
+            // pack block: panel starting at column c holds element
+            // (k,j) at k*MATRIX_NR + j
+            for (c=0; c<nc; c+=MATRIX_NR) {
+                TP * p = &bp[c*kc];
+                for (k=0; k<kc; k++) {
+                    TP * yk = &y[(k0+k)*_yr*w + j0 + c];
+                    for (j=0; j<MATRIX_NR; j++)
+                        p[k*MATRIX_NR + j] = c + j < nc ? yk[j] : 0;
+                }
+#if T_COMPLEX
+                TP * q = &bs[c*kc];
+                for (j=0; j<kc*MATRIX_NR; j+=2) {
+                    q[j  ] = -p[j+1];
+                    q[j+1] =  p[j  ];
+                }
+#endif
+            }
+
+            // run micro-kernel over tiles
+            for (c=0; c<nc; c+=MATRIX_NR) {
+                // columns (elements) covered by this panel
+                unsigned int cols = nc-c < MATRIX_NR ? nc-c : MATRIX_NR;
+                unsigned int e1   = (j0 + c + cols + w - 1) / w;
+                for (r=0; r<_M; r+=MATRIX_MR) {
+                    // remaining tiles are below the diagonal
+                    if (_upper && r >= e1)
+                        break;
+                    MATRIX(_gemm_kernel)(kc,
+                                         &x[(r*_xr + k0*_xi)*w], _xr*w, _xi*w, s,
+                                         _M-r < MATRIX_MR ? _M-r : MATRIX_MR,
+                                         &bp[c*kc],
+                                         &bs[c*kc],
+                                         &z[(r*_zr)*w + j0 + c], _zr*w, cols, g);
+                }
+            }
+        }
+    }
+}
+
 void MATRIX(_print)(T * _X,
                     unsigned int _R,
                     unsigned int _C)
@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Batched small-matrix method definitions
+//
+// A batch of _num [_n x _n] matrices is stored as a structure of
+// arrays: element (r,c) of matrix k is _A[(r*_n+c)*_num + k], and
+// element r of vector k is _b[r*_num + k]. Matrices are processed
+// MATRIX_BATCH_W at a time, with matching elements held in adjacent
+// lanes of a local block (real and imaginary parts separated), so
+// that every arithmetic step is a fixed-length loop across lanes.
+//
+
+#include <math.h>
+#include <string.h>
+#include "liquid.internal.h"
+
+// number of matrices processed together
+#define MATRIX_BATCH_W (8)
+
+// load lanes [_k0,_k0+_w) of a batch element into block element;
+// unused lanes are filled with _pad
+//  _x      :   batch element [size: _num x 1]
+//  _k0     :   index of first matrix in block
+//  _w      :   number of valid lanes
+//  _pad    :   value for unused lanes
+//  _a      :   block element, real and imaginary parts
+static void MATRIX(_batch_get)(T *          _x,
+                               unsigned int _k0,
+                               unsigned int _w,
+                               TP           _pad,
+                               TP           _a[2][MATRIX_BATCH_W])
+{
+    TP * x = (TP*)&_x[_k0];
+    unsigned int l;
+    for (l=0; l<_w; l++) {
+#if T_COMPLEX
+        _a[0][l] = x[2*l  ];
+        _a[1][l] = x[2*l+1];
+#else
+        _a[0][l] = x[l];
+#endif
+    }
+    for ( ; l<MATRIX_BATCH_W; l++) {
+        _a[0][l] = _pad;
+        _a[1][l] = 0;
+    }
+}
+
+// store lanes [_k0,_k0+_w) of block element to batch element
+static void MATRIX(_batch_put)(T *          _x,
+                               unsigned int _k0,
+                               unsigned int _w,
+                               TP           _a[2][MATRIX_BATCH_W])
+{
+    TP * x = (TP*)&_x[_k0];
+    unsigned int l;
+    for (l=0; l<_w; l++) {
+#if T_COMPLEX
+        x[2*l  ] = _a[0][l];
+        x[2*l+1] = _a[1][l];
+#else
+        x[l] = _a[0][l];
+#endif
+    }
+}
+
+// Gauss-Jordan elimination with partial pivoting on each lane of an
+// augmented block [A | B], leaving the solution X = A^-1 B in place
+// of B; returns non-zero if any system is singular
+//  _n      :   matrix dimension
+//  _nrhs   :   number of right-hand side columns
+//  _a      :   block [size: _n*(_n+_nrhs) x 2 x MATRIX_BATCH_W]
+static int MATRIX(_batch_gjsolve)(unsigned int _n,
+                                  unsigned int _nrhs,
+                                  TP (*_a)[2][MATRIX_BATCH_W])
+{
+    unsigned int m = _n + _nrhs;    // row length
+    unsigned int i, k, c, l;
+    int singular = 0;
+    TP r[m][2][MATRIX_BATCH_W];     // normalized pivot row
+    for (k=0; k<_n; k++) {
+        // choose pivot row for each lane based on maximum element
+        // along column
+        unsigned int p[MATRIX_BATCH_W];
+        TP v_max[MATRIX_BATCH_W];
+        for (l=0; l<MATRIX_BATCH_W; l++) {
+            p[l] = k;
+            v_max[l] = _a[k*m+k][0][l]*_a[k*m+k][0][l];
+#if T_COMPLEX
+            v_max[l] += _a[k*m+k][1][l]*_a[k*m+k][1][l];
+#endif
+        }
+        for (i=k+1; i<_n; i++) {
+            for (l=0; l<MATRIX_BATCH_W; l++) {
+                TP v = _a[i*m+k][0][l]*_a[i*m+k][0][l];
+#if T_COMPLEX
+                v += _a[i*m+k][1][l]*_a[i*m+k][1][l];
+#endif
+                p[l]     = v > v_max[l] ? i : p[l];
+                v_max[l] = v > v_max[l] ? v : v_max[l];
+            }
+        }
+
+        // swap rows in lanes where pivot is off the diagonal
+        for (l=0; l<MATRIX_BATCH_W; l++) {
+            if (p[l] == k)
+                continue;
+            for (c=k; c<m; c++) {
+                TP v_tmp = _a[k*m+c][0][l];
+                _a[k*m+c][0][l]    = _a[p[l]*m+c][0][l];
+                _a[p[l]*m+c][0][l] = v_tmp;
+#if T_COMPLEX
+                v_tmp = _a[k*m+c][1][l];
+                _a[k*m+c][1][l]    = _a[p[l]*m+c][1][l];
+                _a[p[l]*m+c][1][l] = v_tmp;
+#endif
+            }
+        }
+
+        // inverse of pivot, g = conj(a_kk) / |a_kk|^2
+        TP g[2][MATRIX_BATCH_W];
+        for (l=0; l<MATRIX_BATCH_W; l++) {
+            singular |= v_max[l] == 0;
+            g[0][l] =  _a[k*m+k][0][l] / v_max[l];
+            g[1][l] = -_a[k*m+k][1][l] / v_max[l];
+        }
+
+        // normalize pivot row, keeping a copy of it
+        for (c=k+1; c<m; c++) {
+            for (l=0; l<MATRIX_BATCH_W; l++) {
+#if T_COMPLEX
+                r[c][0][l] = _a[k*m+c][0][l]*g[0][l] - _a[k*m+c][1][l]*g[1][l];
+                r[c][1][l] = _a[k*m+c][0][l]*g[1][l] + _a[k*m+c][1][l]*g[0][l];
+                _a[k*m+c][1][l] = r[c][1][l];
+#else
+                r[c][0][l] = _a[k*m+c][0][l]*g[0][l];
+#endif
+                _a[k*m+c][0][l] = r[c][0][l];
+            }
+        }
+
+        // eliminate column from all other rows
+        for (i=0; i<_n; i++) {
+            if (i == k)
+                continue;
+            TP f[2][MATRIX_BATCH_W];
+            memmove(f, _a[i*m+k], sizeof(f));
+            for (c=k+1; c<m; c++) {
+                for (l=0; l<MATRIX_BATCH_W; l++) {
+#if T_COMPLEX
+                    _a[i*m+c][0][l] -= f[0][l]*r[c][0][l] - f[1][l]*r[c][1][l];
+                    _a[i*m+c][1][l] -= f[0][l]*r[c][1][l] + f[1][l]*r[c][0][l];
+#else
+                    _a[i*m+c][0][l] -= f[0][l]*r[c][0][l];
+#endif
+                }
+            }
+        }
+    }
+    return singular;
+}
+
+// Cholesky decomposition A = L L^H on each lane of a block, computed
+// in place on the lower triangle; returns non-zero if any matrix is
+// not positive definite
+//  _n      :   matrix dimension
+//  _a      :   block [size: _n*_n x 2 x MATRIX_BATCH_W]
+static int MATRIX(_batch_chol)(unsigned int _n,
+                               TP (*_a)[2][MATRIX_BATCH_W])
+{
+    unsigned int i, j, k, l;
+    int singular = 0;
+    for (j=0; j<_n; j++) {
+        // diagonal: L_jj = sqrt( A_jj - sum_k |L_jk|^2 )
+        TP d[MATRIX_BATCH_W];
+        memmove(d, _a[j*_n+j][0], sizeof(d));
+        for (k=0; k<j; k++) {
+            for (l=0; l<MATRIX_BATCH_W; l++) {
+                d[l] -= _a[j*_n+k][0][l]*_a[j*_n+k][0][l];
+#if T_COMPLEX
+                d[l] -= _a[j*_n+k][1][l]*_a[j*_n+k][1][l];
+#endif
+            }
+        }
+        for (l=0; l<MATRIX_BATCH_W; l++) {
+            singular |= !(d[l] > 0);
+            d[l] = sqrt(d[l]);
+            _a[j*_n+j][0][l] = d[l];
+            _a[j*_n+j][1][l] = 0;
+            d[l] = 1 / d[l];
+        }
+
+        // column below diagonal:
+        //  L_ij = ( A_ij - sum_k L_ik conj(L_jk) ) / L_jj
+        for (i=j+1; i<_n; i++) {
+            TP t[2][MATRIX_BATCH_W];
+            memmove(t, _a[i*_n+j], sizeof(t));
+            for (k=0; k<j; k++) {
+                for (l=0; l<MATRIX_BATCH_W; l++) {
+                    t[0][l] -= _a[i*_n+k][0][l]*_a[j*_n+k][0][l];
+#if T_COMPLEX
+                    t[0][l] -= _a[i*_n+k][1][l]*_a[j*_n+k][1][l];
+                    t[1][l] -= _a[i*_n+k][1][l]*_a[j*_n+k][0][l] - _a[i*_n+k][0][l]*_a[j*_n+k][1][l];
+#endif
+                }
+            }
+            for (l=0; l<MATRIX_BATCH_W; l++) {
+                _a[i*_n+j][0][l] = t[0][l]*d[l];
+                _a[i*_n+j][1][l] = t[1][l]*d[l];
+            }
+        }
+    }
+    return singular;
+}
+
+// solve batch of linear systems A_k x_k = b_k
+//  _A      :   input matrices [size: _n x _n x _num]
+//  _n      :   system size
+//  _b      :   equality vectors [size: _n x _num]
+//  _x      :   solution vectors [size: _n x _num]
+//  _num    :   number of systems in batch
+void MATRIX(_linsolve_batch)(T *          _A,
+                             unsigned int _n,
+                             T *          _b,
+                             T *          _x,
+                             unsigned int _num)
+{
+    unsigned int m = _n + 1;
+    TP a[_n*m][2][MATRIX_BATCH_W];
+    unsigned int r, c, k0;
+    int singular = 0;
+    for (k0=0; k0<_num; k0+=MATRIX_BATCH_W) {
+        unsigned int w = _num-k0 < MATRIX_BATCH_W ? _num-k0 : MATRIX_BATCH_W;
+
+        // load augmented block [A | b], padding unused lanes with
+        // identity systems
+        for (r=0; r<_n; r++) {
+            for (c=0; c<_n; c++)
+                MATRIX(_batch_get)(&_A[(r*_n+c)*_num], k0, w, r==c, a[r*m+c]);
+            MATRIX(_batch_get)(&_b[r*_num], k0, w, 0, a[r*m+_n]);
+        }
+
+        // run elimination
+        singular |= MATRIX(_batch_gjsolve)(_n, 1, a);
+
+        for (r=0; r<_n; r++)
+            MATRIX(_batch_put)(&_x[r*_num], k0, w, a[r*m+_n]);
+    }
+
+    if (singular)
+        fprintf(stderr,"warning: matrix_linsolve_batch(), matrix singular to machine precision\n");
+}
+
+// invert batch of square matrices in place
+//  _X      :   input/output matrices [size: _n x _n x _num]
+//  _n      :   matrix size
+//  _num    :   number of matrices in batch
+void MATRIX(_inv_batch)(T *          _X,
+                        unsigned int _n,
+                        unsigned int _num)
+{
+    unsigned int m = 2*_n;
+    TP a[_n*m][2][MATRIX_BATCH_W];
+    unsigned int r, c, l, k0;
+    int singular = 0;
+    for (k0=0; k0<_num; k0+=MATRIX_BATCH_W) {
+        unsigned int w = _num-k0 < MATRIX_BATCH_W ? _num-k0 : MATRIX_BATCH_W;
+
+        // load augmented block [X | I], padding unused lanes with
+        // identity matrices
+        for (r=0; r<_n; r++) {
+            for (c=0; c<_n; c++) {
+                MATRIX(_batch_get)(&_X[(r*_n+c)*_num], k0, w, r==c, a[r*m+c]);
+                for (l=0; l<MATRIX_BATCH_W; l++) {
+                    a[r*m+_n+c][0][l] = r==c;
+                    a[r*m+_n+c][1][l] = 0;
+                }
+            }
+        }
+
+        // run elimination
+        singular |= MATRIX(_batch_gjsolve)(_n, _n, a);
+
+        for (r=0; r<_n; r++) {
+            for (c=0; c<_n; c++)
+                MATRIX(_batch_put)(&_X[(r*_n+c)*_num], k0, w, a[r*m+_n+c]);
+        }
+    }
+
+    if (singular)
+        fprintf(stderr,"warning: matrix_inv_batch(), matrix singular to machine precision\n");
+}
+
+// Cholesky decomposition of batch of symmetric/Hermitian positive-
+// definite matrices as A_k = L_k * L_k^T
+//  _A      :   input square matrices [size: _n x _n x _num]
+//  _n      :   matrix dimension
+//  _L      :   output lower-triangular matrices
+//  _num    :   number of matrices in batch
+void MATRIX(_chol_batch)(T *          _A,
+                         unsigned int _n,
+                         T *          _L,
+                         unsigned int _num)
+{
+    TP a[_n*_n][2][MATRIX_BATCH_W];
+    unsigned int r, c, k0;
+    int singular = 0;
+    for (k0=0; k0<_num; k0+=MATRIX_BATCH_W) {
+        unsigned int w = _num-k0 < MATRIX_BATCH_W ? _num-k0 : MATRIX_BATCH_W;
+
+        // load lower triangle, padding unused lanes with identity
+        for (r=0; r<_n; r++) {
+            for (c=0; c<=r; c++)
+                MATRIX(_batch_get)(&_A[(r*_n+c)*_num], k0, w, r==c, a[r*_n+c]);
+        }
+
+        // run decomposition
+        singular |= MATRIX(_batch_chol)(_n, a);
+
+        // store lower triangle and clear upper
+        for (r=0; r<_n; r++) {
+            for (c=0; c<=r; c++)
+                MATRIX(_batch_put)(&_L[(r*_n+c)*_num], k0, w, a[r*_n+c]);
+            for (c=r+1; c<_n; c++)
+                memset(&_L[(r*_n+c)*_num + k0], 0x00, w*sizeof(T));
+        }
+    }
+
+    if (singular)
+        fprintf(stderr,"warning: matrix_chol_batch(), matrix is not positive definite\n");
+}
+
@@ -34,6 +34,7 @@
     printf("%12.8f", matrix_access(X,R,C,r,c));
 
 #include "matrix.base.c"
+#include "matrix.batch.c"
 #include "matrix.cgsolve.c"
 #include "matrix.chol.c"
 #include "matrix.gramschmidt.c"
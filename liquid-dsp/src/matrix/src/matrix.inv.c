@@ -21,6 +21,8 @@
 // Matrix inverse method definitions
 //
 
+#include <string.h>
+
 #include "liquid.internal.h"
 
 void MATRIX(_inv)(T * _X, unsigned int _XR, unsigned int _XC)
@@ -31,46 +33,16 @@ void MATRIX(_inv)(T * _X, unsigned int _XR, unsigned int _XC)
         exit(1);
     }
 
-    // X:
-    //  x11 x12 ... x1n
-    //  x21 x22 ... x2n
-    //  ...
-    //  xn1 xn2 ... xnn
-
-    // allocate temporary memory
-    T x[2*_XR*_XC];
-    unsigned int xr = _XR;
-    unsigned int xc = _XC*2;
-
-    // x:
-    //  x11 x12 ... x1n 1   0   ... 0
-    //  x21 x22 ... x2n 0   1   ... 0
-    //  ...
-    //  xn1 xn2 ... xnn 0   0   ... 1
-    unsigned int r,c;
-    for (r=0; r<_XR; r++) {
-        // copy matrix elements
-        for (c=0; c<_XC; c++)
-            matrix_access(x,xr,xc,r,c) = matrix_access(_X,_XR,_XC,r,c);
+    // compute L/U factors of X
+    unsigned int n = _XR;
+    T x[n*n];
+    unsigned int piv[n];
+    memmove(x, _X, n*n*sizeof(T));
+    MATRIX(_lufactor)(x, n, piv);
 
-        // append identity matrix
-        for (c=0; c<_XC; c++)
-            matrix_access(x,xr,xc,r,_XC+c) = (r==c) ? 1 : 0;
-    }
-
-    // perform Gauss-Jordan elimination on x
-    // x:
-    //  1   0   ... 0   y11 y12 ... y1n
-    //  0   1   ... 0   y21 y22 ... y2n
-    //  ...
-    //  0   0   ... 1   yn1 yn2 ... ynn
-    MATRIX(_gjelim)(x,xr,xc);
-
-    // copy result from right half of x
-    for (r=0; r<_XR; r++) {
-        for (c=0; c<_XC; c++)
-            matrix_access(_X,_XR,_XC,r,c) = matrix_access(x,xr,xc,r,_XC+c);
-    }
+    // solve X*Y = I for all columns of Y at once
+    MATRIX(_eye)(_X, n);
+    MATRIX(_lusolve)(x, n, piv, _X, n);
 }
 
 // Gauss-Jordan elmination
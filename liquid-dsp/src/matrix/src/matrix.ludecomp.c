@@ -21,8 +21,13 @@
 // Matrix L/U decomposition method definitions
 //
 
+#include <string.h>
 #include "liquid.internal.h"
 
+// number of columns factored per panel in _lufactor(), and rows
+// per block in _lusolve()
+#define MATRIX_LU_NB (32)
+
 // L/U/P decomposition, Crout's method
 void MATRIX(_ludecomp_crout)(T * _x,
                              unsigned int _rx,
@@ -137,3 +142,139 @@ void MATRIX(_ludecomp_doolittle)(T * _x,
     MATRIX(_eye)(_P,n);
 }
 
+
+// L/U decomposition with partial pivoting, in place (right-looking:
+// after each pivot the trailing rows are updated with unit-stride
+// row operations)
+//  _x      :   input/output matrix [size: _n x _n]
+//  _n      :   matrix size
+//  _piv    :   row interchanges [size: _n x 1]
+void MATRIX(_lufactor)(T *            _x,
+                       unsigned int   _n,
+                       unsigned int * _piv)
+{
+    unsigned int i, k, k0;
+    for (k0=0; k0<_n; k0+=MATRIX_LU_NB) {
+        // factor panel of columns [k0,k1); row interchanges are
+        // applied to the full rows
+        unsigned int k1 = k0+MATRIX_LU_NB < _n ? k0+MATRIX_LU_NB : _n;
+        for (k=k0; k<k1; k++) {
+            // choose pivot row based on maximum element along column
+            unsigned int p = k;
+            TP v_max = MATRIX(_abs2)(matrix_access(_x,_n,_n,k,k));
+            for (i=k+1; i<_n; i++) {
+                TP v = MATRIX(_abs2)(matrix_access(_x,_n,_n,i,k));
+                if (v > v_max) {
+                    p = i;
+                    v_max = v;
+                }
+            }
+            _piv[k] = p;
+
+            // swap rows
+            if (p != k) {
+                T row_tmp[_n];
+                memmove(row_tmp,   &_x[k*_n], _n*sizeof(T));
+                memmove(&_x[k*_n], &_x[p*_n], _n*sizeof(T));
+                memmove(&_x[p*_n], row_tmp,   _n*sizeof(T));
+            }
+
+            // if the maximum is zero, matrix is singular
+            if (v_max == 0) {
+                fprintf(stderr,"warning: matrix_lufactor(), matrix singular to machine precision\n");
+                continue;
+            }
+
+            // eliminate column below the diagonal within the panel,
+            // storing multipliers
+            T g = 1 / matrix_access(_x,_n,_n,k,k);
+            for (i=k+1; i<_n; i++) {
+                T l = matrix_access(_x,_n,_n,i,k) * g;
+                matrix_access(_x,_n,_n,i,k) = l;
+                MATRIX(_axpy)(-l, &matrix_access(_x,_n,_n,k,k+1),
+                                  &matrix_access(_x,_n,_n,i,k+1), k1-k-1);
+            }
+        }
+
+        if (k1 == _n)
+            break;
+
+        // compute block row of U to the right of panel
+        for (i=k0+1; i<k1; i++) {
+            for (k=k0; k<i; k++) {
+                MATRIX(_axpy)(-matrix_access(_x,_n,_n,i,k),
+                              &matrix_access(_x,_n,_n,k,k1),
+                              &matrix_access(_x,_n,_n,i,k1), _n-k1);
+            }
+        }
+
+        // update trailing sub-matrix
+        MATRIX(_gemm)(_n-k1, k1-k0, _n-k1,
+                      &matrix_access(_x,_n,_n,k1,k0), _n, 1, 0,
+                      &matrix_access(_x,_n,_n,k0,k1), _n,
+                      &matrix_access(_x,_n,_n,k1,k1), _n, 0, 1);
+    }
+}
+
+// solve linear system(s) using L/U factors from _lufactor()
+//  _x      :   factored matrix [size: _n x _n]
+//  _n      :   matrix size
+//  _piv    :   row interchanges [size: _n x 1]
+//  _b      :   right-hand sides, overwritten with solution [size: _n x _nrhs]
+//  _nrhs   :   number of right-hand sides
+void MATRIX(_lusolve)(T *            _x,
+                      unsigned int   _n,
+                      unsigned int * _piv,
+                      T *            _b,
+                      unsigned int   _nrhs)
+{
+    if (_n == 0)
+        return;
+
+    unsigned int i, k, c, i0;
+
+    // apply row interchanges
+    for (k=0; k<_n; k++) {
+        if (_piv[k] == k)
+            continue;
+        for (c=0; c<_nrhs; c++) {
+            T v_tmp = matrix_access(_b,_n,_nrhs,k,c);
+            matrix_access(_b,_n,_nrhs,k,c) = matrix_access(_b,_n,_nrhs,_piv[k],c);
+            matrix_access(_b,_n,_nrhs,_piv[k],c) = v_tmp;
+        }
+    }
+
+    // forward substitution (L has unit diagonal), subtracting the
+    // contribution of previously solved blocks in one product
+    for (i0=0; i0<_n; i0+=MATRIX_LU_NB) {
+        unsigned int i1 = i0+MATRIX_LU_NB < _n ? i0+MATRIX_LU_NB : _n;
+        MATRIX(_gemm)(i1-i0, i0, _nrhs,
+                      &matrix_access(_x,_n,_n,i0,0), _n, 1, 0,
+                      _b, _nrhs, &_b[i0*_nrhs], _nrhs, 0, 1);
+        for (i=i0+1; i<i1; i++) {
+            for (k=i0; k<i; k++) {
+                MATRIX(_axpy)(-matrix_access(_x,_n,_n,i,k),
+                              &_b[k*_nrhs], &_b[i*_nrhs], _nrhs);
+            }
+        }
+    }
+
+    // back substitution
+    for (i0=((_n-1)/MATRIX_LU_NB)*MATRIX_LU_NB; ; i0-=MATRIX_LU_NB) {
+        unsigned int i1 = i0+MATRIX_LU_NB < _n ? i0+MATRIX_LU_NB : _n;
+        MATRIX(_gemm)(i1-i0, _n-i1, _nrhs,
+                      &matrix_access(_x,_n,_n,i0,i1), _n, 1, 0,
+                      &_b[i1*_nrhs], _nrhs, &_b[i0*_nrhs], _nrhs, 0, 1);
+        for (i=i1; i>i0; i--) {
+            for (k=i; k<i1; k++) {
+                MATRIX(_axpy)(-matrix_access(_x,_n,_n,i-1,k),
+                              &_b[k*_nrhs], &_b[(i-1)*_nrhs], _nrhs);
+            }
+            T g = 1 / matrix_access(_x,_n,_n,i-1,i-1);
+            for (c=0; c<_nrhs; c++)
+                _b[(i-1)*_nrhs + c] *= g;
+        }
+        if (i0 == 0)
+            break;
+    }
+}
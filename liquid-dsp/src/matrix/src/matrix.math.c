@@ -94,6 +94,21 @@ void MATRIX(_pdiv)(T * _X,
 }
 
 
+// fill lower triangle of square matrix from upper triangle, with
+// conjugation if _conj is set
+static void MATRIX(_mirror)(T *          _X,
+                            unsigned int _n,
+                            int          _conj)
+{
+    unsigned int r, c;
+    for (r=0; r<_n; r++) {
+        for (c=r+1; c<_n; c++) {
+            T v = matrix_access(_X,_n,_n,r,c);
+            matrix_access(_X,_n,_n,c,r) = _conj ? MATRIX(_conj)(v) : v;
+        }
+    }
+}
+
 // multiply two matrices together
 void MATRIX(_mul)(T * _X, unsigned int _XR, unsigned int _XC,
                   T * _Y, unsigned int _YR, unsigned int _YC,
@@ -105,23 +120,9 @@ void MATRIX(_mul)(T * _X, unsigned int _XR, unsigned int _XC,
         exit(1);
     }
 
-    unsigned int r, c, i;
-    for (r=0; r<_ZR; r++) {
-        for (c=0; c<_ZC; c++) {
-            // z(i,j) = dotprod( x(i,:), y(:,j) )
-            T sum=0.0f;
-            for (i=0; i<_XC; i++) {
-                sum += matrix_access(_X,_XR,_XC,r,i) *
-                       matrix_access(_Y,_YR,_YC,i,c);
-            }
-            matrix_access(_Z,_ZR,_ZC,r,c) = sum;
-#ifdef DEBUG
-            printf("z(%u,%u) = ", r, c);
-            MATRIX_PRINT_ELEMENT(_Z,_ZR,_ZC,r,c);
-            printf("\n");
-#endif
-        }
-    }
+    // z(r,:) = sum_i x(r,i) y(i,:)
+    MATRIX(_zeros)(_Z, _ZR, _ZC);
+    MATRIX(_gemm)(_ZR, _XC, _ZC, _X, _XC, 1, 0, _Y, _ZC, _Z, _ZC, 0, 0);
 }
 
 // augment matrices x and y:
@@ -190,17 +191,21 @@ T MATRIX(_det)(T * _X,
     unsigned int n = _r;
     if (n==2) return MATRIX(_det2x2)(_X,2,2);
 
-    // compute L/U decomposition (Doolittle's method)
-    T L[n*n]; // lower
-    T U[n*n]; // upper
-    T P[n*n]; // permutation
-    MATRIX(_ludecomp_doolittle)(_X,n,n,L,U,P);
+    // compute L/U decomposition with partial pivoting
+    T x[n*n];
+    unsigned int piv[n];
+    memmove(x, _X, n*n*sizeof(T));
+    MATRIX(_lufactor)(x, n, piv);
 
-    // evaluate along the diagonal of U
+    // evaluate along the diagonal of U, negating for each row
+    // interchange
     T det = 1.0;
     unsigned int i;
-    for (i=0; i<n; i++)
-        det *= matrix_access(U,n,n,i,i);
+    for (i=0; i<n; i++) {
+        det *= matrix_access(x,n,n,i,i);
+        if (piv[i] != i)
+            det = -det;
+    }
 
     return det;
 }
@@ -241,30 +246,18 @@ void MATRIX(_mul_transpose)(T * _x,
                             unsigned int _n,
                             T * _xxT)
 {
-    unsigned int r;
-    unsigned int c;
-    unsigned int i;
-
-    // clear _xxT
-    for (i=0; i<_m*_m; i++)
-        _xxT[i] = 0.0f;
-
-    // 
-    T sum = 0;
+    // conjugate transpose of x, so that its rows can be accumulated
+    T xH[_n*_m];
+    unsigned int r, c;
     for (r=0; r<_m; r++) {
-
-        for (c=0; c<_m; c++) {
-            sum = 0.0f;
-
-            for (i=0; i<_n; i++) {
-                T prod =        matrix_access(_x,_m,_n,r,i) *
-                         conjf( matrix_access(_x,_m,_n,c,i) );
-                sum += prod;
-            }
-
-            matrix_access(_xxT,_m,_m,r,c) = sum;
-        }
+        for (c=0; c<_n; c++)
+            matrix_access(xH,_n,_m,c,r) = MATRIX(_conj)(matrix_access(_x,_m,_n,r,c));
     }
+
+    // result is Hermitian: compute upper triangle only
+    MATRIX(_zeros)(_xxT, _m, _m);
+    MATRIX(_gemm)(_m, _n, _m, _x, _n, 1, 0, xH, _m, _xxT, _m, 1, 0);
+    MATRIX(_mirror)(_xxT, _m, 1);
 }
 
 
@@ -274,30 +267,11 @@ void MATRIX(_transpose_mul)(T * _x,
                             unsigned int _n,
                             T * _xTx)
 {
-    unsigned int r;
-    unsigned int c;
-    unsigned int i;
-
-    // clear _xTx
-    for (i=0; i<_n*_n; i++)
-        _xTx[i] = 0.0f;
-
-    // 
-    T sum = 0;
-    for (r=0; r<_n; r++) {
-
-        for (c=0; c<_n; c++) {
-            sum = 0.0f;
-
-            for (i=0; i<_m; i++) {
-                T prod = conjf( matrix_access(_x,_m,_n,i,r) ) *
-                                matrix_access(_x,_m,_n,i,c);
-                sum += prod;
-            }
-
-            matrix_access(_xTx,_n,_n,r,c) = sum;
-        }
-    }
+    // result is Hermitian: compute upper triangle only, reading
+    // conjugated elements of x transposed
+    MATRIX(_zeros)(_xTx, _n, _n);
+    MATRIX(_gemm)(_n, _m, _n, _x, 1, _n, 1, _x, _n, _xTx, _n, 1, 0);
+    MATRIX(_mirror)(_xTx, _n, 1);
 }
 
 
@@ -307,29 +281,18 @@ void MATRIX(_mul_hermitian)(T * _x,
                             unsigned int _n,
                             T * _xxH)
 {
-    unsigned int r;
-    unsigned int c;
-    unsigned int i;
-
-    // clear _xxH
-    for (i=0; i<_m*_m; i++)
-        _xxH[i] = 0.0f;
-
-    // 
-    T sum = 0;
+    // transpose of x, so that its rows can be accumulated
+    T xT[_n*_m];
+    unsigned int r, c;
     for (r=0; r<_m; r++) {
-
-        for (c=0; c<_m; c++) {
-            sum = 0.0f;
-
-            for (i=0; i<_n; i++) {
-                sum += matrix_access(_x,_m,_n,r,i) *
-                       matrix_access(_x,_m,_n,c,i);
-            }
-
-            matrix_access(_xxH,_m,_m,r,c) = sum;
-        }
+        for (c=0; c<_n; c++)
+            matrix_access(xT,_n,_m,c,r) = matrix_access(_x,_m,_n,r,c);
     }
+
+    // result is symmetric: compute upper triangle only
+    MATRIX(_zeros)(_xxH, _m, _m);
+    MATRIX(_gemm)(_m, _n, _m, _x, _n, 1, 0, xT, _m, _xxH, _m, 1, 0);
+    MATRIX(_mirror)(_xxH, _m, 0);
 }
 
 
@@ -339,28 +302,9 @@ void MATRIX(_hermitian_mul)(T * _x,
                             unsigned int _n,
                             T * _xHx)
 {
-    unsigned int r;
-    unsigned int c;
-    unsigned int i;
-
-    // clear _xHx
-    for (i=0; i<_n*_n; i++)
-        _xHx[i] = 0.0f;
-
-    // 
-    T sum = 0;
-    for (r=0; r<_n; r++) {
-
-        for (c=0; c<_n; c++) {
-            sum = 0.0f;
-
-            for (i=0; i<_m; i++) {
-                sum += matrix_access(_x,_m,_n,i,r) *
-                       matrix_access(_x,_m,_n,i,c);
-            }
-
-            matrix_access(_xHx,_n,_n,r,c) = sum;
-        }
-    }
+    // result is symmetric: compute upper triangle only, reading
+    // elements of x transposed
+    MATRIX(_zeros)(_xHx, _n, _n);
+    MATRIX(_gemm)(_n, _m, _n, _x, 1, _n, 0, _x, _n, _xHx, _n, 1, 0);
+    MATRIX(_mirror)(_xHx, _n, 0);
 }
-
@@ -36,6 +36,7 @@
         cimagf(matrix_access(X,R,C,r,c)));
 
 #include "matrix.base.c"
+#include "matrix.batch.c"
 #include "matrix.cgsolve.c"
 #include "matrix.chol.c"
 #include "matrix.gramschmidt.c"
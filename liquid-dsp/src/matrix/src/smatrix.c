@@ -293,6 +293,28 @@ int SMATRIX(_isset)(SMATRIX()    _q,
     return 0;
 }
 
+// get column indices of non-zero elements in row, returning the
+// number of elements (row weight)
+//  _q      :   sparse matrix
+//  _m      :   row index
+//  _idx    :   output indices, sorted ascending [size: _N x 1]
+unsigned int SMATRIX(_get_row_indices)(SMATRIX()      _q,
+                                       unsigned int   _m,
+                                       unsigned int * _idx)
+{
+    // validate input
+    if (_m >= _q->M) {
+        fprintf(stderr,"error: SMATRIX(_get_row_indices)(%u), index exceeds matrix dimension (%u,%u)\n",
+                _m, _q->M, _q->N);
+        exit(1);
+    }
+
+    unsigned int j;
+    for (j=0; j<_q->num_mlist[_m]; j++)
+        _idx[j] = _q->mlist[_m][j];
+    return _q->num_mlist[_m];
+}
+
 // insert element at index
 void SMATRIX(_insert)(SMATRIX()    _q,
                       unsigned int _m,
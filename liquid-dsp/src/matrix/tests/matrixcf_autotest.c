@@ -402,3 +402,257 @@ void autotest_matrixcf_transmul()
 
 
 
+// multiplication of matrices larger than the internal blocking,
+// compared against direct evaluation
+void autotest_matrixcf_mul_large()
+{
+    float tol = 1e-4f;  // error tolerance
+
+    // x [size: 37 x 150]
+    // y [size: 150 x 133]
+    // z [size: 37 x 133]
+    unsigned int m = 37, n = 150, p = 133;
+    float complex x[m*n];
+    float complex y[n*p];
+    float complex z[m*p];
+    unsigned int i, j, k;
+    for (i=0; i<m*n; i++) x[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n*p; i++) y[i] = randnf() + _Complex_I*randnf();
+
+    matrixcf_mul(x, m, n, y, n, p, z, m, p);
+
+    for (i=0; i<m; i++) {
+        for (j=0; j<p; j++) {
+            float complex v = 0.0f;
+            for (k=0; k<n; k++)
+                v += x[i*n+k] * y[k*p+j];
+            CONTEND_DELTA( crealf(z[i*p+j]), crealf(v), tol );
+            CONTEND_DELTA( cimagf(z[i*p+j]), cimagf(v), tol );
+        }
+    }
+}
+
+// L/U factorization and solution with multiple right-hand sides
+void autotest_matrixcf_lusolve()
+{
+    float tol = 1e-3f;  // error tolerance
+
+    // A [size: 70 x 70]
+    // B [size: 70 x 3]
+    unsigned int n = 70, nrhs = 3;
+    float complex A[n*n];
+    float complex LU[n*n];
+    float complex B[n*nrhs];
+    float complex X[n*nrhs];
+    float complex AX[n*nrhs];
+    unsigned int piv[n];
+    unsigned int i;
+    for (i=0; i<n*n; i++)    A[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n*nrhs; i++) B[i] = randnf() + _Complex_I*randnf();
+
+    // factor once, solve for all right-hand sides
+    memmove(LU, A, n*n*sizeof(float complex));
+    memmove(X,  B, n*nrhs*sizeof(float complex));
+    matrixcf_lufactor(LU, n, piv);
+    matrixcf_lusolve(LU, n, piv, X, nrhs);
+
+    // check residual
+    matrixcf_mul(A, n, n, X, n, nrhs, AX, n, nrhs);
+    for (i=0; i<n*nrhs; i++) {
+        CONTEND_DELTA( crealf(AX[i]), crealf(B[i]), tol );
+        CONTEND_DELTA( cimagf(AX[i]), cimagf(B[i]), tol );
+    }
+}
+
+// products of a matrix with its own (conjugate) transpose, for sizes
+// larger than the internal blocking
+void autotest_matrixcf_transmul_large()
+{
+    float tol = 1e-4f;  // error tolerance
+
+    // x [size: 45 x 140]
+    unsigned int m = 45, n = 140;
+    float complex x[m*n];
+    float complex xxT[m*m];
+    float complex xxH[m*m];
+    float complex xTx[n*n];
+    float complex xHx[n*n];
+    unsigned int i, j, k;
+    for (i=0; i<m*n; i++) x[i] = randnf() + _Complex_I*randnf();
+
+    matrixcf_mul_transpose(x, m, n, xxT);
+    matrixcf_mul_hermitian(x, m, n, xxH);
+    matrixcf_transpose_mul(x, m, n, xTx);
+    matrixcf_hermitian_mul(x, m, n, xHx);
+
+    for (i=0; i<m; i++) {
+        for (j=0; j<m; j++) {
+            float complex v0 = 0.0f;
+            float complex v1 = 0.0f;
+            for (k=0; k<n; k++) {
+                v0 += x[i*n+k] * conjf(x[j*n+k]);
+                v1 += x[i*n+k] * x[j*n+k];
+            }
+            CONTEND_DELTA( crealf(xxT[i*m+j]), crealf(v0), tol );
+            CONTEND_DELTA( cimagf(xxT[i*m+j]), cimagf(v0), tol );
+            CONTEND_DELTA( crealf(xxH[i*m+j]), crealf(v1), tol );
+            CONTEND_DELTA( cimagf(xxH[i*m+j]), cimagf(v1), tol );
+        }
+    }
+
+    for (i=0; i<n; i++) {
+        for (j=0; j<n; j++) {
+            float complex v0 = 0.0f;
+            float complex v1 = 0.0f;
+            for (k=0; k<m; k++) {
+                v0 += conjf(x[k*n+i]) * x[k*n+j];
+                v1 += x[k*n+i] * x[k*n+j];
+            }
+            CONTEND_DELTA( crealf(xTx[i*n+j]), crealf(v0), tol );
+            CONTEND_DELTA( cimagf(xTx[i*n+j]), cimagf(v0), tol );
+            CONTEND_DELTA( crealf(xHx[i*n+j]), crealf(v1), tol );
+            CONTEND_DELTA( cimagf(xHx[i*n+j]), cimagf(v1), tol );
+        }
+    }
+}
+
+// batched linear solver, compared against solving each system alone;
+// column 0 of the system at index _singular (if less than _num) is
+// zeroed, and the remaining systems must be unaffected
+//  _n          :   system size
+//  _num        :   number of systems in batch
+//  _singular   :   index of singular system
+void matrixcf_linsolve_batch_runtest(unsigned int _n,
+                                     unsigned int _num,
+                                     unsigned int _singular)
+{
+    float tol = 1e-4f;  // error tolerance
+
+    unsigned int n = _n, num = _num;
+    float complex A[n*n*num];
+    float complex b[n*num];
+    float complex x[n*num];
+    unsigned int i, k;
+    // weight diagonal by system size to keep systems well conditioned
+    for (i=0; i<n*n*num; i++)
+        A[i] = randnf() + _Complex_I*randnf() + (i/num % (n+1) == 0 ? 3.0f + n : 0.0f);
+    for (i=0; i<n*num;   i++)
+        b[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n && _singular<num; i++)
+        A[(i*n)*num + _singular] = 0.0f;
+
+    matrixcf_linsolve_batch(A, n, b, x, num);
+
+    for (k=0; k<num; k++) {
+        if (k == _singular)
+            continue;
+        float complex Ak[n*n];
+        float complex bk[n];
+        float complex xk[n];
+        for (i=0; i<n*n; i++) Ak[i] = A[i*num+k];
+        for (i=0; i<n;   i++) bk[i] = b[i*num+k];
+        matrixcf_linsolve(Ak, n, bk, xk, NULL);
+        for (i=0; i<n; i++) {
+            CONTEND_DELTA( crealf(x[i*num+k]), crealf(xk[i]), tol*(1+cabsf(xk[i])) );
+            CONTEND_DELTA( cimagf(x[i*num+k]), cimagf(xk[i]), tol*(1+cabsf(xk[i])) );
+        }
+    }
+}
+
+// batched inversion, checking that X^-1 * X = I for each matrix and
+// comparing against inverting each matrix alone; column 0 of the
+// matrix at index _singular (if less than _num) is zeroed, and the
+// remaining matrices must be unaffected
+//  _n          :   matrix size
+//  _num        :   number of matrices in batch
+//  _singular   :   index of singular matrix
+void matrixcf_inv_batch_runtest(unsigned int _n,
+                                unsigned int _num,
+                                unsigned int _singular)
+{
+    float tol = 1e-4f;  // error tolerance
+
+    unsigned int n = _n, num = _num;
+    float complex X[n*n*num];
+    float complex Y[n*n*num];
+    unsigned int i, k;
+    // weight diagonal by matrix size to keep matrices well conditioned
+    for (i=0; i<n*n*num; i++)
+        X[i] = randnf() + _Complex_I*randnf() + (i/num % (n+1) == 0 ? 3.0f + n : 0.0f);
+    for (i=0; i<n && _singular<num; i++)
+        X[(i*n)*num + _singular] = 0.0f;
+    memmove(Y, X, sizeof(X));
+
+    matrixcf_inv_batch(Y, n, num);
+
+    for (k=0; k<num; k++) {
+        if (k == _singular)
+            continue;
+        float complex Xk[n*n];
+        float complex Yk[n*n];
+        float complex Zk[n*n];
+        for (i=0; i<n*n; i++) {
+            Xk[i] = X[i*num+k];
+            Yk[i] = Y[i*num+k];
+        }
+        matrixcf_mul(Yk, n, n, Xk, n, n, Zk, n, n);
+        for (i=0; i<n*n; i++) {
+            CONTEND_DELTA( crealf(Zk[i]), i % (n+1) == 0 ? 1.0f : 0.0f, tol );
+            CONTEND_DELTA( cimagf(Zk[i]), 0.0f, tol );
+        }
+
+        matrixcf_inv(Xk, n, n);
+        for (i=0; i<n*n; i++) {
+            CONTEND_DELTA( crealf(Yk[i]), crealf(Xk[i]), tol*(1+cabsf(Xk[i])) );
+            CONTEND_DELTA( cimagf(Yk[i]), cimagf(Xk[i]), tol*(1+cabsf(Xk[i])) );
+        }
+    }
+}
+
+// batches are not a multiple of the internal block size (8)
+void autotest_matrixcf_linsolve_batch_n2()  { matrixcf_linsolve_batch_runtest(2, 21, -1); }
+void autotest_matrixcf_linsolve_batch_n4()  { matrixcf_linsolve_batch_runtest(4, 21, -1); }
+void autotest_matrixcf_linsolve_batch_n8()  { matrixcf_linsolve_batch_runtest(8, 11, -1); }
+void autotest_matrixcf_inv_batch_n2()       { matrixcf_inv_batch_runtest(     2, 13, -1); }
+void autotest_matrixcf_inv_batch_n3()       { matrixcf_inv_batch_runtest(     3, 13, -1); }
+void autotest_matrixcf_inv_batch_n8()       { matrixcf_inv_batch_runtest(     8, 11, -1); }
+
+// one singular system, sharing an internal block with the others
+void autotest_matrixcf_linsolve_batch_singular() { matrixcf_linsolve_batch_runtest(4, 11, 3); }
+void autotest_matrixcf_inv_batch_singular()      { matrixcf_inv_batch_runtest(     4, 11, 3); }
+
+// batched Cholesky decomposition, compared against decomposing each
+// matrix alone
+void autotest_matrixcf_chol_batch()
+{
+    float tol = 1e-4f;  // error tolerance
+
+    // batch of Hermitian positive-definite matrices, A = H^H H + I
+    unsigned int n = 4, num = 11;
+    float complex A[n*n*num];
+    float complex L[n*n*num];
+    unsigned int i, k;
+    for (k=0; k<num; k++) {
+        float complex H[n*n];
+        float complex Ak[n*n];
+        for (i=0; i<n*n; i++)
+            H[i] = randnf() + _Complex_I*randnf();
+        matrixcf_transpose_mul(H, n, n, Ak);
+        for (i=0; i<n*n; i++)
+            A[i*num+k] = Ak[i] + (i % (n+1) == 0 ? 1.0f : 0.0f);
+    }
+
+    matrixcf_chol_batch(A, n, L, num);
+
+    for (k=0; k<num; k++) {
+        float complex Ak[n*n];
+        float complex Lk[n*n];
+        for (i=0; i<n*n; i++) Ak[i] = A[i*num+k];
+        matrixcf_chol(Ak, n, Lk);
+        for (i=0; i<n*n; i++) {
+            CONTEND_DELTA( crealf(L[i*num+k]), crealf(Lk[i]), tol );
+            CONTEND_DELTA( cimagf(L[i*num+k]), cimagf(Lk[i]), tol );
+        }
+    }
+}
+
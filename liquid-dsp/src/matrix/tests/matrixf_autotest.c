@@ -417,3 +417,106 @@ void autotest_matrixf_transmul()
 
 
 
+// multiplication of matrices larger than the internal blocking,
+// compared against direct evaluation
+void autotest_matrixf_mul_large()
+{
+    float tol = 1e-4f;  // error tolerance
+
+    // x [size: 37 x 150]
+    // y [size: 150 x 300]
+    // z [size: 37 x 300]
+    unsigned int m = 37, n = 150, p = 300;
+    float x[m*n];
+    float y[n*p];
+    float z[m*p];
+    unsigned int i, j, k;
+    for (i=0; i<m*n; i++) x[i] = randnf();
+    for (i=0; i<n*p; i++) y[i] = randnf();
+
+    matrixf_mul(x, m, n, y, n, p, z, m, p);
+
+    for (i=0; i<m; i++) {
+        for (j=0; j<p; j++) {
+            float v = 0.0f;
+            for (k=0; k<n; k++)
+                v += x[i*n+k] * y[k*p+j];
+            CONTEND_DELTA( z[i*p+j], v, tol );
+        }
+    }
+}
+
+// L/U factorization and solution with multiple right-hand sides
+void autotest_matrixf_lusolve()
+{
+    float tol = 1e-3f;  // error tolerance
+
+    // A [size: 70 x 70]
+    // B [size: 70 x 3]
+    unsigned int n = 70, nrhs = 3;
+    float A[n*n];
+    float LU[n*n];
+    float B[n*nrhs];
+    float X[n*nrhs];
+    float AX[n*nrhs];
+    unsigned int piv[n];
+    unsigned int i;
+    for (i=0; i<n*n; i++)    A[i] = randnf();
+    for (i=0; i<n*nrhs; i++) B[i] = randnf();
+
+    // factor once, solve for all right-hand sides
+    memmove(LU, A, n*n*sizeof(float));
+    memmove(X,  B, n*nrhs*sizeof(float));
+    matrixf_lufactor(LU, n, piv);
+    matrixf_lusolve(LU, n, piv, X, nrhs);
+
+    // check residual
+    matrixf_mul(A, n, n, X, n, nrhs, AX, n, nrhs);
+    for (i=0; i<n*nrhs; i++)
+        CONTEND_DELTA( AX[i], B[i], tol );
+}
+
+// batched linear solver, compared against solving each system alone;
+// column 0 of the system at index _singular (if less than _num) is
+// zeroed, and the remaining systems must be unaffected
+//  _n          :   system size
+//  _num        :   number of systems in batch
+//  _singular   :   index of singular system
+void matrixf_linsolve_batch_runtest(unsigned int _n,
+                                    unsigned int _num,
+                                    unsigned int _singular)
+{
+    float tol = 1e-4f;  // error tolerance
+
+    unsigned int n = _n, num = _num;
+    float A[n*n*num];
+    float b[n*num];
+    float x[n*num];
+    unsigned int i, k;
+    // weight diagonal by system size to keep systems well conditioned
+    for (i=0; i<n*n*num; i++) A[i] = randnf() + (i/num % (n+1) == 0 ? 3.0f + n : 0.0f);
+    for (i=0; i<n*num;   i++) b[i] = randnf();
+    for (i=0; i<n && _singular<num; i++)
+        A[(i*n)*num + _singular] = 0.0f;
+
+    matrixf_linsolve_batch(A, n, b, x, num);
+
+    for (k=0; k<num; k++) {
+        if (k == _singular)
+            continue;
+        float Ak[n*n];
+        float bk[n];
+        float xk[n];
+        for (i=0; i<n*n; i++) Ak[i] = A[i*num+k];
+        for (i=0; i<n;   i++) bk[i] = b[i*num+k];
+        matrixf_linsolve(Ak, n, bk, xk, NULL);
+        for (i=0; i<n; i++)
+            CONTEND_DELTA( x[i*num+k], xk[i], tol*(1+fabsf(xk[i])) );
+    }
+}
+
+void autotest_matrixf_linsolve_batch_n2()       { matrixf_linsolve_batch_runtest(2, 21, -1); }
+void autotest_matrixf_linsolve_batch_n5()       { matrixf_linsolve_batch_runtest(5, 10, -1); }
+void autotest_matrixf_linsolve_batch_n8()       { matrixf_linsolve_batch_runtest(8, 11, -1); }
+void autotest_matrixf_linsolve_batch_singular() { matrixf_linsolve_batch_runtest(4, 11,  3); }
+
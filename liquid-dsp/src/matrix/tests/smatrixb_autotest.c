@@ -362,3 +362,26 @@ void autotest_smatrixb_vmulf()
     smatrixb_destroy(A);
 }
 
+
+// test row index lists (sorted regardless of insertion order)
+void autotest_smatrixb_get_row_indices()
+{
+    smatrixb A = smatrixb_create(4,12);
+    smatrixb_set(A,1,9,  1);
+    smatrixb_set(A,1,0,  1);
+    smatrixb_set(A,1,11, 1);
+    smatrixb_set(A,1,4,  1);
+    smatrixb_set(A,3,2,  1);
+
+    unsigned int idx[12];
+    unsigned int test[4] = {0, 4, 9, 11};
+
+    CONTEND_EQUALITY( smatrixb_get_row_indices(A,0,idx), 0 );
+    CONTEND_EQUALITY( smatrixb_get_row_indices(A,1,idx), 4 );
+    CONTEND_SAME_DATA( idx, test, 4*sizeof(unsigned int) );
+    CONTEND_EQUALITY( smatrixb_get_row_indices(A,3,idx), 1 );
+    CONTEND_EQUALITY( idx[0], 2 );
+
+    // destroy matrix object
+    smatrixb_destroy(A);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// helper function to keep code base small
+//  _disc   :   discriminator type
+//  _block  :   use freqdem_demodulate_block() rather than one sample at a time
+void freqdem_bench(struct rusage *     _start,
+                   struct rusage *     _finish,
+                   unsigned long int * _num_iterations,
+                   liquid_freqdem_disc _disc,
+                   int                 _block)
+{
+    // normalize number of iterations
+    *_num_iterations /= 64;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned int n = 256;   // samples per block
+
+    // create demodulator
+    freqdem dem = freqdem_create(0.1f, LIQUID_FREQDEM_DELAYCONJ);
+    freqdem_set_discriminator(dem, _disc);
+
+    float complex r[n];
+    float         m[n];
+    unsigned long int i;
+    unsigned int j;
+    for (j=0; j<n; j++)
+        r[j] = cexpf(_Complex_I*2*M_PI*0.1f*sinf(0.05f*j));
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_block) {
+            freqdem_demodulate_block(dem, r, n, m);
+        } else {
+            for (j=0; j<n; j++)
+                freqdem_demodulate(dem, r[j], &m[j]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    freqdem_destroy(dem);
+}
+
+#define FREQDEM_BENCHMARK_API(DISC,BLOCK)       \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ freqdem_bench(_start, _finish, _num_iterations, DISC, BLOCK); }
+
+void benchmark_freqdem_arg          FREQDEM_BENCHMARK_API(LIQUID_FREQDEM_DISC_ARG,    0)
+void benchmark_freqdem_block_arg    FREQDEM_BENCHMARK_API(LIQUID_FREQDEM_DISC_ARG,    1)
+void benchmark_freqdem_block_atan3  FREQDEM_BENCHMARK_API(LIQUID_FREQDEM_DISC_ATAN3,  1)
+void benchmark_freqdem_block_atan7  FREQDEM_BENCHMARK_API(LIQUID_FREQDEM_DISC_ATAN7,  1)
+void benchmark_freqdem_block_atan11 FREQDEM_BENCHMARK_API(LIQUID_FREQDEM_DISC_ATAN11, 1)
+void benchmark_freqdem_block_quad   FREQDEM_BENCHMARK_API(LIQUID_FREQDEM_DISC_QUAD,   1)
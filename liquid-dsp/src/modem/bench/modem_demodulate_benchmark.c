@@ -157,3 +157,45 @@ void benchmark_demodulate_arb128opt MODEM_DEMODULATE_BENCH_API(LIQUID_MODEM_ARB1
 void benchmark_demodulate_arb256opt MODEM_DEMODULATE_BENCH_API(LIQUID_MODEM_ARB256OPT)
 void benchmark_demodulate_arb64vt   MODEM_DEMODULATE_BENCH_API(LIQUID_MODEM_ARB64VT)
 
+#define MODEM_DEMODULATE_BLOCK_BENCH_API(MS)    \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ modem_demodulate_block_bench(_start, _finish, _num_iterations, MS); }
+
+// Helper function for block demodulation
+void modem_demodulate_block_bench(struct rusage *_start,
+                                  struct rusage *_finish,
+                                  unsigned long int *_num_iterations,
+                                  modulation_scheme _ms)
+{
+    // initialize modulator
+    modem demod = modem_create(_ms);
+
+    unsigned long int i;
+
+    // generate input vector to demodulate (spiral)
+    unsigned int n = 256;
+    float complex x[n];
+    for (i=0; i<n; i++)
+        x[i] = 0.07 * (i % 20) * cexpf(_Complex_I*2*M_PI*0.1*i);
+
+    unsigned int symbol_out[n];
+
+    // start trials
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_blocks; i++)
+        modem_demodulate_block(demod, x, n, symbol_out);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    modem_destroy(demod);
+}
+
+// block demodulation
+void benchmark_demodulate_block_psk8     MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_PSK8)
+void benchmark_demodulate_block_ask16    MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_ASK16)
+void benchmark_demodulate_block_qam16    MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QAM16)
+void benchmark_demodulate_block_qam64    MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QAM64)
+void benchmark_demodulate_block_qam256   MODEM_DEMODULATE_BLOCK_BENCH_API(LIQUID_MODEM_QAM256)
@@ -27,6 +27,17 @@
 
 #include "liquid.internal.h"
 
+// number of samples processed at a time by _demodulate_block()
+#define FREQDEM_BLOCK_LEN   (256)
+
+// minimax coefficients of atan(t)/t as a polynomial in t^2, 0 <= t <= 1
+static const float freqdem_atan3[2]  = { 9.72393990e-01f, -1.91947713e-01f};
+static const float freqdem_atan7[4]  = { 9.99213815e-01f, -3.21174949e-01f,
+                                         1.46264374e-01f, -3.89864556e-02f};
+static const float freqdem_atan11[6] = { 9.99977231e-01f, -3.32622826e-01f,
+                                         1.93540365e-01f, -1.16426446e-01f,
+                                         5.26473112e-02f, -1.17191188e-02f};
+
 // freqdem
 struct FREQDEM(_s) {
     // common
@@ -42,8 +53,28 @@ struct FREQDEM(_s) {
     float complex q;            // phase difference
     firfilt_crcf rxfilter;      // initial receiver filter
     iirfilt_rrrf postfilter;    // post-filter
+
+    // delay/conjugate discriminator
+    liquid_freqdem_disc disc;                   // discriminator type
+    freqdem_disc_kernel_t * disc_kernel;        // SIMD kernel (or NULL)
+    float complex buf[FREQDEM_BLOCK_LEN];       // filtered samples
+    float         p_re[FREQDEM_BLOCK_LEN];      // conjugate products (real)
+    float         p_im[FREQDEM_BLOCK_LEN];      // conjugate products (imag)
 };
 
+// polynomial approximation to atan2(_y,_x)
+static void freqdem_atan2_poly(float *             _y,
+                               float *             _x,
+                               unsigned int        _n,
+                               liquid_freqdem_disc _disc,
+                               float *             _z);
+
+// compute phase difference between consecutive samples
+void FREQDEM(_discriminate)(FREQDEM()       _q,
+                            float complex * _x,
+                            unsigned int    _n,
+                            float *         _y);
+
 // create freqdem object
 //  _kf     :   modulation factor
 //  _type   :   demodulation type (e.g. LIQUID_FREQDEM_DELAYCONJ)
@@ -62,6 +93,8 @@ FREQDEM() FREQDEM(_create)(float               _kf,
     // set basic internal properties
     q->type = _type;    // demod type
     q->kf   = _kf;      // modulation factor
+    q->dphi = 0.0f;     // carrier frequency offset
+    q->disc = LIQUID_FREQDEM_DISC_ARG;
 
     // compute derived values
     q->twopikf_inv = 1.0f / (2*M_PI*q->kf);       // 1 / (2*pi*kf)
@@ -76,6 +109,18 @@ FREQDEM() FREQDEM(_create)(float               _kf,
     // create DC-blocking post-filter
     q->postfilter = iirfilt_rrrf_create_dc_blocker(1e-4f);
 
+    // select discriminator kernel based on host CPU
+    q->disc_kernel = NULL;
+#if LIQUID_FREQDEM_SIMD
+    switch (liquid_simd_level()) {
+#if LIQUID_FREQDEM_AVX2
+    case LIQUID_SIMD_AVX512:
+    case LIQUID_SIMD_AVX2:   q->disc_kernel = freqdem_disc_kernel_avx; break;
+#endif
+    default:                 q->disc_kernel = freqdem_disc_kernel_sse;
+    }
+#endif
+
     // reset modem object
     FREQDEM(_reset)(q);
 
@@ -115,6 +160,19 @@ void FREQDEM(_reset)(FREQDEM() _q)
     _q->q = 0.0f;
 }
 
+// set discriminator used by the delay/conjugate method
+//  _q      :   FM demodulator object
+//  _disc   :   discriminator type (e.g. LIQUID_FREQDEM_DISC_ARG)
+void FREQDEM(_set_discriminator)(FREQDEM()           _q,
+                                 liquid_freqdem_disc _disc)
+{
+    if (_disc > LIQUID_FREQDEM_DISC_QUAD) {
+        fprintf(stderr,"error: freqdem_set_discriminator(), invalid discriminator type\n");
+        exit(1);
+    }
+    _q->disc = _disc;
+}
+
 // demodulate sample
 //  _q      :   FM demodulator object
 //  _r      :   received signal
@@ -145,13 +203,178 @@ void FREQDEM(_demodulate)(FREQDEM()              _q,
         *_m = (nco_crcf_get_frequency(_q->oscillator) -_q->dphi) * _q->twopikf_inv;
     } else {
         // compute phase difference and normalize by modulation index
-        *_m = (cargf(conjf(_q->q)*(_r)) - _q->dphi) * _q->twopikf_inv;
-
-        _q->q = _r;
+        float dphi;
+        FREQDEM(_discriminate)(_q, &_r, 1, &dphi);
+        *_m = (dphi - _q->dphi) * _q->twopikf_inv;
     }
 
     // apply post-filtering
     iirfilt_rrrf_execute(_q->postfilter, *_m, _m);
 }
 
+// demodulate block of samples
+//  _q      :   FM demodulator object
+//  _r      :   received signal [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _m      :   output message signal [size: _n x 1]
+void FREQDEM(_demodulate_block)(FREQDEM()              _q,
+                                liquid_float_complex * _r,
+                                unsigned int           _n,
+                                float *                _m)
+{
+    unsigned int i;
+    unsigned int k;
+
+    if (_q->type == LIQUID_FREQDEM_PLL) {
+        // phase-locked loop is inherently sequential
+        for (i=0; i<_n; i++)
+            FREQDEM(_demodulate)(_q, _r[i], &_m[i]);
+        return;
+    }
+
+    float dphi = _q->dphi;
+    float g    = _q->twopikf_inv;
+    unsigned int n;
+    for (i=0; i<_n; i+=n) {
+        n = _n - i < FREQDEM_BLOCK_LEN ? _n - i : FREQDEM_BLOCK_LEN;
+        float * m = &_m[i];
+
+        // apply rx filter to input
+        firfilt_crcf_execute_block(_q->rxfilter, &_r[i], n, _q->buf);
+
+        // compute phase differences and normalize by modulation index
+        FREQDEM(_discriminate)(_q, _q->buf, n, m);
+        for (k=0; k<n; k++)
+            m[k] = (m[k] - dphi) * g;
+
+        // apply post-filtering
+        for (k=0; k<n; k++)
+            iirfilt_rrrf_execute(_q->postfilter, m[k], &m[k]);
+    }
+}
+
+// polynomial approximation to atan2(_y,_x), computed in three passes
+// (reduction, polynomial, quadrant mapping); portable version of the
+// SIMD kernels in freqdem_disc.*.c, used when those are not built
+//  _y      :   imaginary component [size: _n x 1]
+//  _x      :   real component [size: _n x 1]
+//  _n      :   number of samples
+//  _disc   :   discriminator type (polynomial order)
+//  _z      :   output angle [size: _n x 1]
+static void freqdem_atan2_poly(float *             _y,
+                               float *             _x,
+                               unsigned int        _n,
+                               liquid_freqdem_disc _disc,
+                               float *             _z)
+{
+    unsigned int i;
+
+    // reduce to 0 <= t <= 1, with t = 0 for _x = _y = 0
+    for (i=0; i<_n; i++) {
+        float ax  = fabsf(_x[i]);
+        float ay  = fabsf(_y[i]);
+        int   sw  = ay > ax;
+        float num = sw ? ax : ay;
+        float den = sw ? ay : ax;
+        _z[i] = num / (den + (den == 0.0f));
+    }
+
+    // evaluate atan(t) = t*P(t^2)
+    const float * c;
+    switch (_disc) {
+    case LIQUID_FREQDEM_DISC_ATAN3:
+        c = freqdem_atan3;
+        for (i=0; i<_n; i++) {
+            float t2 = _z[i]*_z[i];
+            _z[i] *= c[0] + t2*c[1];
+        }
+        break;
+    case LIQUID_FREQDEM_DISC_ATAN7:
+        c = freqdem_atan7;
+        for (i=0; i<_n; i++) {
+            float t2 = _z[i]*_z[i];
+            _z[i] *= c[0] + t2*(c[1] + t2*(c[2] + t2*c[3]));
+        }
+        break;
+    default:
+        c = freqdem_atan11;
+        for (i=0; i<_n; i++) {
+            float t2 = _z[i]*_z[i];
+            _z[i] *= c[0] + t2*(c[1] + t2*(c[2] + t2*(c[3] +
+                            t2*(c[4] + t2*c[5]))));
+        }
+    }
+
+    // map back to quadrant, selecting constants rather than results
+    // to keep the loop branch-free; signs are taken from the sign bits
+    // so that signed zeros are treated as atan2f() does
+    for (i=0; i<_n; i++) {
+        float sw = fabsf(_y[i]) > fabsf(_x[i]) ? -1.0f : 1.0f;
+        float sx = copysignf(1.0f, _x[i]);
+        float v  = (sw < 0.0f ? (float)M_PI_2 : 0.0f) + sw*_z[i];
+        v        = (sx < 0.0f ? (float)M_PI   : 0.0f) + sx*v;
+        _z[i] = copysignf(v, _y[i]);
+    }
+}
+
+// compute phase difference between consecutive samples,
+// arg(conj(x[i-1])*x[i]), using the selected discriminator
+//  _q      :   FM demodulator object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples, 0 < _n <= FREQDEM_BLOCK_LEN
+//  _y      :   phase difference [size: _n x 1]
+void FREQDEM(_discriminate)(FREQDEM()       _q,
+                            float complex * _x,
+                            unsigned int    _n,
+                            float *         _y)
+{
+    float * p_re = _q->p_re;
+    float * p_im = _q->p_im;
+    float   ar   = crealf(_q->q);
+    float   ai   = cimagf(_q->q);
+    unsigned int i;
+
+    // polynomial and quadrature discriminators on SIMD kernel
+    if (_q->disc_kernel != NULL && _q->disc != LIQUID_FREQDEM_DISC_ARG) {
+        switch (_q->disc) {
+        case LIQUID_FREQDEM_DISC_ATAN3:  _q->disc_kernel(_q->q, _x, _n, freqdem_atan3,  2, _y); break;
+        case LIQUID_FREQDEM_DISC_ATAN7:  _q->disc_kernel(_q->q, _x, _n, freqdem_atan7,  4, _y); break;
+        case LIQUID_FREQDEM_DISC_ATAN11: _q->disc_kernel(_q->q, _x, _n, freqdem_atan11, 6, _y); break;
+        default:                         _q->disc_kernel(_q->q, _x, _n, NULL,           0, _y);
+        }
+        _q->q = _x[_n-1];
+        return;
+    }
+
+    // imaginary part of conjugate products
+    p_im[0] = ar*cimagf(_x[0]) - ai*crealf(_x[0]);
+    for (i=1; i<_n; i++)
+        p_im[i] = crealf(_x[i-1])*cimagf(_x[i]) - cimagf(_x[i-1])*crealf(_x[i]);
+
+    if (_q->disc == LIQUID_FREQDEM_DISC_QUAD) {
+        // sin(dphi), normalized by the mean energy of the two samples
+        // rather than their geometric mean to avoid a square root
+        p_re[0] = 0.5f*(ar*ar + ai*ai + liquid_cabsf2(_x[0]));
+        for (i=1; i<_n; i++)
+            p_re[i] = 0.5f*(liquid_cabsf2(_x[i-1]) + liquid_cabsf2(_x[i]));
+        for (i=0; i<_n; i++)
+            _y[i] = p_im[i] / (p_re[i] + (p_re[i] == 0.0f));
+    } else {
+        // real part of conjugate products
+        p_re[0] = ar*crealf(_x[0]) + ai*cimagf(_x[0]);
+        for (i=1; i<_n; i++)
+            p_re[i] = crealf(_x[i-1])*crealf(_x[i]) + cimagf(_x[i-1])*cimagf(_x[i]);
+
+        if (_q->disc == LIQUID_FREQDEM_DISC_ARG) {
+            for (i=0; i<_n; i++)
+                _y[i] = atan2f(p_im[i], p_re[i]);
+        } else {
+            freqdem_atan2_poly(p_im, p_re, _n, _q->disc, _y);
+        }
+    }
+
+    // save last sample
+    _q->q = _x[_n-1];
+}
+
 
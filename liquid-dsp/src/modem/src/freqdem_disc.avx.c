@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Delay/conjugate FM discriminator kernel (AVX2/FMA)
+//
+// Same structure as freqdem_disc.mmx.c with eight phase differences
+// per register.
+//
+
+#include <string.h>
+#include <math.h>
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// de-interleave eight complex values into real, imaginary components
+static inline void freqdem_disc_load_avx(const float * _x,
+                                         __m256 *      _re,
+                                         __m256 *      _im)
+{
+    __m256 a = _mm256_loadu_ps(_x);
+    __m256 b = _mm256_loadu_ps(_x+8);
+
+    // shuffles operate within 128-bit lanes; restore sample order
+    __m256 re = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+    __m256 im = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+    *_re = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(re), _MM_SHUFFLE(3,1,2,0)));
+    *_im = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(im), _MM_SHUFFLE(3,1,2,0)));
+}
+
+// phase differences between eight samples and their predecessors
+//  _x      :   samples (interleaved) [size: 16 x 1]
+//  _p      :   preceding samples (interleaved) [size: 16 x 1]
+//  _c      :   broadcast polynomial coefficients [size: _nc x 1]
+//  _nc     :   number of coefficients (0 for quadrature)
+//  _y      :   output [size: 8 x 1]
+static inline void freqdem_disc_avx(const float *  _x,
+                                    const float *  _p,
+                                    const __m256 * _c,
+                                    unsigned int   _nc,
+                                    float *        _y)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one  = _mm256_set1_ps(1.0f);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+
+    __m256 xr, xi, pr, pi;
+    freqdem_disc_load_avx(_x, &xr, &xi);
+    freqdem_disc_load_avx(_p, &pr, &pi);
+
+    // conjugate products, conj(p)*x
+    __m256 im = _mm256_fmsub_ps(pr, xi, _mm256_mul_ps(pi, xr));
+
+    if (_nc == 0) {
+        // quadrature: Im{conj(p)*x} over mean energy of p and x
+        __m256 e = _mm256_fmadd_ps(pr, pr, _mm256_mul_ps(pi, pi));
+        e = _mm256_fmadd_ps(xr, xr, e);
+        e = _mm256_fmadd_ps(xi, xi, e);
+        e = _mm256_mul_ps(_mm256_set1_ps(0.5f), e);
+        e = _mm256_add_ps(e, _mm256_and_ps(_mm256_cmp_ps(e, zero, _CMP_EQ_OQ), one));
+        _mm256_storeu_ps(_y, _mm256_div_ps(im, e));
+        return;
+    }
+    __m256 re = _mm256_fmadd_ps(pr, xr, _mm256_mul_ps(pi, xi));
+
+    // reduce to 0 <= t <= 1, with t = 0 for re = im = 0
+    __m256 ax  = _mm256_andnot_ps(sign, re);
+    __m256 ay  = _mm256_andnot_ps(sign, im);
+    __m256 sw  = _mm256_cmp_ps(ay, ax, _CMP_GT_OQ);
+    __m256 num = _mm256_min_ps(ay, ax);
+    __m256 den = _mm256_max_ps(ay, ax);
+    den = _mm256_add_ps(den, _mm256_and_ps(_mm256_cmp_ps(den, zero, _CMP_EQ_OQ), one));
+    __m256 t = _mm256_div_ps(num, den);
+
+    // atan(t) = t*P(t^2)
+    __m256 t2 = _mm256_mul_ps(t, t);
+    __m256 v  = _c[_nc-1];
+    unsigned int k;
+    for (k=_nc-1; k>0; k--)
+        v = _mm256_fmadd_ps(v, t2, _c[k-1]);
+    v = _mm256_mul_ps(v, t);
+
+    // map back to quadrant: pi/2 - v if swapped, pi - v if re < 0
+    v = _mm256_add_ps(_mm256_and_ps(sw, _mm256_set1_ps((float)M_PI_2)),
+                      _mm256_xor_ps(v, _mm256_and_ps(sw, sign)));
+    __m256 sx = _mm256_and_ps(re, sign);
+    __m256 mx = _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(re), 31));
+    v = _mm256_add_ps(_mm256_and_ps(mx, _mm256_set1_ps((float)M_PI)),
+                      _mm256_xor_ps(v, sx));
+
+    // copy sign of im
+    _mm256_storeu_ps(_y, _mm256_or_ps(_mm256_andnot_ps(sign, v), _mm256_and_ps(sign, im)));
+}
+
+void freqdem_disc_kernel_avx(float complex   _x0,
+                             float complex * _x,
+                             unsigned int    _n,
+                             const float *   _c,
+                             unsigned int    _nc,
+                             float *         _y)
+{
+    float * x = (float*) _x;
+
+    // broadcast polynomial coefficients
+    __m256 c[FREQDEM_DISC_MAX_COEFFS];
+    unsigned int i;
+    for (i=0; i<_nc; i++)
+        c[i] = _mm256_set1_ps(_c[i]);
+
+    // zero-padded buffer for partial groups: preceding sample
+    // followed by up to eight samples
+    float complex b[9];
+    float         z[8];
+
+    // first group, preceded by _x0
+    unsigned int n = _n < 8 ? _n : 8;
+    memset(b, 0, sizeof(b));
+    b[0] = _x0;
+    memmove(&b[1], _x, n*sizeof(float complex));
+    freqdem_disc_avx((float*)&b[1], (float*)&b[0], c, _nc, z);
+    memmove(_y, z, n*sizeof(float));
+
+    // full groups
+    for (i=8; i+8<=_n; i+=8)
+        freqdem_disc_avx(&x[2*i], &x[2*i-2], c, _nc, &_y[i]);
+
+    // last partial group
+    if (i < _n) {
+        n = _n - i;
+        memset(b, 0, sizeof(b));
+        memmove(b, &_x[i-1], (n+1)*sizeof(float complex));
+        freqdem_disc_avx((float*)&b[1], (float*)&b[0], c, _nc, z);
+        memmove(&_y[i], z, n*sizeof(float));
+    }
+}
+
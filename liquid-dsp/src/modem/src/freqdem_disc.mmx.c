@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Delay/conjugate FM discriminator kernel (SSE2)
+//
+// Four phase differences per register. The conjugate products of
+// consecutive samples are formed from the interleaved input and passed
+// through the same branch-free steps as freqdem_atan2_poly() in
+// freqdem.c, with selects done by masking. The first and last partial
+// groups go through a small zero-padded buffer.
+//
+
+#include <string.h>
+#include <math.h>
+#include <emmintrin.h>
+
+#include "liquid.internal.h"
+
+// de-interleave four complex values into real, imaginary components
+static inline void freqdem_disc_load_sse(const float * _x,
+                                         __m128 *      _re,
+                                         __m128 *      _im)
+{
+    __m128 a = _mm_loadu_ps(_x);
+    __m128 b = _mm_loadu_ps(_x+4);
+    *_re = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+    *_im = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+}
+
+// phase differences between four samples and their predecessors
+//  _x      :   samples (interleaved) [size: 8 x 1]
+//  _p      :   preceding samples (interleaved) [size: 8 x 1]
+//  _c      :   broadcast polynomial coefficients [size: _nc x 1]
+//  _nc     :   number of coefficients (0 for quadrature)
+//  _y      :   output [size: 4 x 1]
+static inline void freqdem_disc_sse(const float *  _x,
+                                    const float *  _p,
+                                    const __m128 * _c,
+                                    unsigned int   _nc,
+                                    float *        _y)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one  = _mm_set1_ps(1.0f);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+
+    __m128 xr, xi, pr, pi;
+    freqdem_disc_load_sse(_x, &xr, &xi);
+    freqdem_disc_load_sse(_p, &pr, &pi);
+
+    // conjugate products, conj(p)*x
+    __m128 im = _mm_sub_ps(_mm_mul_ps(pr, xi), _mm_mul_ps(pi, xr));
+
+    if (_nc == 0) {
+        // quadrature: Im{conj(p)*x} over mean energy of p and x
+        __m128 e = _mm_add_ps(_mm_add_ps(_mm_mul_ps(pr, pr), _mm_mul_ps(pi, pi)),
+                              _mm_add_ps(_mm_mul_ps(xr, xr), _mm_mul_ps(xi, xi)));
+        e = _mm_mul_ps(_mm_set1_ps(0.5f), e);
+        e = _mm_add_ps(e, _mm_and_ps(_mm_cmpeq_ps(e, zero), one));
+        _mm_storeu_ps(_y, _mm_div_ps(im, e));
+        return;
+    }
+    __m128 re = _mm_add_ps(_mm_mul_ps(pr, xr), _mm_mul_ps(pi, xi));
+
+    // reduce to 0 <= t <= 1, with t = 0 for re = im = 0
+    __m128 ax  = _mm_andnot_ps(sign, re);
+    __m128 ay  = _mm_andnot_ps(sign, im);
+    __m128 sw  = _mm_cmpgt_ps(ay, ax);
+    __m128 num = _mm_min_ps(ay, ax);
+    __m128 den = _mm_max_ps(ay, ax);
+    den = _mm_add_ps(den, _mm_and_ps(_mm_cmpeq_ps(den, zero), one));
+    __m128 t = _mm_div_ps(num, den);
+
+    // atan(t) = t*P(t^2)
+    __m128 t2 = _mm_mul_ps(t, t);
+    __m128 v  = _c[_nc-1];
+    unsigned int k;
+    for (k=_nc-1; k>0; k--)
+        v = _mm_add_ps(_mm_mul_ps(v, t2), _c[k-1]);
+    v = _mm_mul_ps(v, t);
+
+    // map back to quadrant: pi/2 - v if swapped, pi - v if re < 0
+    v = _mm_add_ps(_mm_and_ps(sw, _mm_set1_ps((float)M_PI_2)),
+                   _mm_xor_ps(v, _mm_and_ps(sw, sign)));
+    __m128 sx = _mm_and_ps(re, sign);
+    __m128 mx = _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(re), 31));
+    v = _mm_add_ps(_mm_and_ps(mx, _mm_set1_ps((float)M_PI)),
+                   _mm_xor_ps(v, sx));
+
+    // copy sign of im
+    _mm_storeu_ps(_y, _mm_or_ps(_mm_andnot_ps(sign, v), _mm_and_ps(sign, im)));
+}
+
+void freqdem_disc_kernel_sse(float complex   _x0,
+                             float complex * _x,
+                             unsigned int    _n,
+                             const float *   _c,
+                             unsigned int    _nc,
+                             float *         _y)
+{
+    float * x = (float*) _x;
+
+    // broadcast polynomial coefficients
+    __m128 c[FREQDEM_DISC_MAX_COEFFS];
+    unsigned int i;
+    for (i=0; i<_nc; i++)
+        c[i] = _mm_set1_ps(_c[i]);
+
+    // zero-padded buffer for partial groups: preceding sample
+    // followed by up to four samples
+    float complex b[5];
+    float         z[4];
+
+    // first group, preceded by _x0
+    unsigned int n = _n < 4 ? _n : 4;
+    memset(b, 0, sizeof(b));
+    b[0] = _x0;
+    memmove(&b[1], _x, n*sizeof(float complex));
+    freqdem_disc_sse((float*)&b[1], (float*)&b[0], c, _nc, z);
+    memmove(_y, z, n*sizeof(float));
+
+    // full groups
+    for (i=4; i+4<=_n; i+=4)
+        freqdem_disc_sse(&x[2*i], &x[2*i-2], c, _nc, &_y[i]);
+
+    // last partial group
+    if (i < _n) {
+        n = _n - i;
+        memset(b, 0, sizeof(b));
+        memmove(b, &_x[i-1], (n+1)*sizeof(float complex));
+        freqdem_disc_sse((float*)&b[1], (float*)&b[0], c, _nc, z);
+        memmove(&_y[i], z, n*sizeof(float));
+    }
+}
+
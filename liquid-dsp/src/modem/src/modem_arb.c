@@ -55,6 +55,13 @@ MODEM() MODEM(_create_arb)(unsigned int _bits_per_symbol)
     q->M = q->M;
     q->symbol_map = (TC*) calloc( q->M, sizeof(TC) );
 
+    // spatial index is built when constellation is initialized
+    q->data.arb.n           = 0;
+    q->data.arb.hard_offset = NULL;
+    q->data.arb.hard_list   = NULL;
+    q->data.arb.soft_offset = NULL;
+    q->data.arb.soft_list   = NULL;
+
     q->modulate_func   = &MODEM(_modulate_arb);
     q->demodulate_func = &MODEM(_demodulate_arb);
 
@@ -75,6 +82,23 @@ void MODEM(_modulate_arb)(MODEM()      _q,
     *_y = _q->symbol_map[_sym_in]; 
 }
 
+// look up grid cell of received sample; returns -1 if the sample
+// lies outside of the grid
+static int MODEM(_arb_cell)(MODEM() _q,
+                            TC      _x)
+{
+    T r = _q->data.arb.r;
+    if (crealf(_x) < -r || crealf(_x) >= r || cimagf(_x) < -r || cimagf(_x) >= r)
+        return -1;
+
+    unsigned int n  = _q->data.arb.n;
+    unsigned int ix = (unsigned int)((crealf(_x) + r) * _q->data.arb.dinv);
+    unsigned int iy = (unsigned int)((cimagf(_x) + r) * _q->data.arb.dinv);
+    if (ix >= n) ix = n-1;
+    if (iy >= n) iy = n-1;
+    return iy*n + ix;
+}
+
 // demodulate arbitrary modem type
 void MODEM(_demodulate_arb)(MODEM()        _q,
                             TC             _x,
@@ -82,20 +106,32 @@ void MODEM(_demodulate_arb)(MODEM()        _q,
 {
     //printf("modem_demodulate_arb() invoked with I=%d, Q=%d\n", x);
     
-    // search for symbol nearest to received sample
+    // search for symbol nearest to received sample, only checking
+    // candidates for grid cell if sample is within the grid
     unsigned int i;
     unsigned int s=0;
-    T d;            // distance
-    T d_min = 0.0f; // minimum distance
+    T d;            // squared distance
+    T d_min = 0.0f; // minimum squared distance
+
+    unsigned int num_candidates = _q->M;
+    unsigned char * candidates = NULL;
+    int cell = _q->data.arb.n ? MODEM(_arb_cell)(_q, _x) : -1;
+    if (cell >= 0) {
+        candidates     = &_q->data.arb.hard_list[ _q->data.arb.hard_offset[cell] ];
+        num_candidates = _q->data.arb.hard_offset[cell+1] - _q->data.arb.hard_offset[cell];
+    }
+
+    for (i=0; i<num_candidates; i++) {
+        unsigned int k = candidates ? candidates[i] : i;
 
-    for (i=0; i<_q->M; i++) {
         // compute distance from received symbol to constellation point
-        d = cabsf(_x - _q->symbol_map[i]);
+        TC e = _x - _q->symbol_map[k];
+        d = crealf(e)*crealf(e) + cimagf(e)*cimagf(e);
 
         // retain symbol with minimum distance
         if ( i==0 || d < d_min ) {
             d_min = d;
-            s = i;
+            s = k;
         }
     }
 
@@ -206,6 +242,8 @@ void MODEM(_arb_init)(MODEM()      _q,
     // scale modem to have unity energy
     MODEM(_arb_scale)(_q);
 
+    // build spatial index for demodulation
+    MODEM(_arb_init_index)(_q);
 }
 
 // initialize an arbitrary modem object on a file
@@ -247,6 +285,9 @@ void MODEM(_arb_init_file)(MODEM() _q,
 
     // scale modem to have unity energy
     MODEM(_arb_scale)(_q);
+
+    // build spatial index for demodulation
+    MODEM(_arb_init_index)(_q);
 }
 
 // scale arbitrary modem constellation points
@@ -286,6 +327,114 @@ void MODEM(_arb_balance_iq)(MODEM() _q)
     }
 }
 
+// build spatial index for arbitrary modem demodulation
+//
+// The plane around the constellation is divided into a grid of about
+// 4*M square cells. Point p can only be nearest to some sample in a
+// cell if its minimum distance to the cell does not exceed the maximum
+// distance of every other point to the cell; these candidates are
+// stored for hard demodulation. For soft demodulation the same test is
+// applied separately to the points with each bit set and cleared; the
+// union of these candidates holds the nearest point of each subset, so
+// the log-likelihood approximation is the same as an exhaustive search.
+void MODEM(_arb_init_index)(MODEM() _q)
+{
+    unsigned int M   = _q->M;
+    unsigned int bps = _q->m;
+    unsigned int i, j, k;
+
+    // free existing index
+    free(_q->data.arb.hard_offset);
+    free(_q->data.arb.hard_list);
+    free(_q->data.arb.soft_offset);
+    free(_q->data.arb.soft_list);
+
+    // grid extends beyond outermost constellation point
+    T r = 0.0f;
+    for (i=0; i<M; i++) {
+        T v = fabsf(crealf(_q->symbol_map[i])) > fabsf(cimagf(_q->symbol_map[i])) ?
+              fabsf(crealf(_q->symbol_map[i])) : fabsf(cimagf(_q->symbol_map[i]));
+        r = v > r ? v : r;
+    }
+    r = 1.25f*r + 1e-3f;
+    unsigned int n = 2*(unsigned int)ceilf(sqrtf((float)M));
+    T w = 2*r / (T)n;   // cell width
+    _q->data.arb.n    = n;
+    _q->data.arb.r    = r;
+    _q->data.arb.dinv = 1.0f / w;
+
+    // allocate offsets and worst-case candidate lists
+    _q->data.arb.hard_offset = (unsigned int*) malloc((n*n+1)*sizeof(unsigned int));
+    _q->data.arb.soft_offset = (unsigned int*) malloc((n*n+1)*sizeof(unsigned int));
+    _q->data.arb.hard_list   = (unsigned char*)malloc(n*n*M*sizeof(unsigned char));
+    _q->data.arb.soft_list   = (unsigned char*)malloc(n*n*M*sizeof(unsigned char));
+
+    T dmin[M];          // minimum squared distance of each point to cell
+    T dmax[M];          // maximum squared distance of each point to cell
+    T tmax_0[bps];      // threshold for points with bit cleared
+    T tmax_1[bps];      // threshold for points with bit set
+    unsigned int num_hard = 0;
+    unsigned int num_soft = 0;
+    unsigned int ix, iy;
+    for (iy=0; iy<n; iy++) {
+        for (ix=0; ix<n; ix++) {
+            unsigned int cell = iy*n + ix;
+            _q->data.arb.hard_offset[cell] = num_hard;
+            _q->data.arb.soft_offset[cell] = num_soft;
+
+            // cell boundaries
+            T x0 = -r + ix*w, x1 = x0 + w;
+            T y0 = -r + iy*w, y1 = y0 + w;
+
+            // distances from cell to each point and thresholds
+            T tmax = 0.0f;
+            for (k=0; k<bps; k++) {
+                tmax_0[k] = 1e9f;
+                tmax_1[k] = 1e9f;
+            }
+            for (i=0; i<M; i++) {
+                T px = crealf(_q->symbol_map[i]);
+                T py = cimagf(_q->symbol_map[i]);
+                T dx = px < x0 ? x0 - px : (px > x1 ? px - x1 : 0.0f);
+                T dy = py < y0 ? y0 - py : (py > y1 ? py - y1 : 0.0f);
+                dmin[i] = dx*dx + dy*dy;
+                dx = fabsf(px - x0) > fabsf(px - x1) ? fabsf(px - x0) : fabsf(px - x1);
+                dy = fabsf(py - y0) > fabsf(py - y1) ? fabsf(py - y0) : fabsf(py - y1);
+                dmax[i] = dx*dx + dy*dy;
+
+                if (i==0 || dmax[i] < tmax) tmax = dmax[i];
+                for (k=0; k<bps; k++) {
+                    if ( (i >> (bps-k-1)) & 0x01 ) {
+                        if (dmax[i] < tmax_1[k]) tmax_1[k] = dmax[i];
+                    } else {
+                        if (dmax[i] < tmax_0[k]) tmax_0[k] = dmax[i];
+                    }
+                }
+            }
+
+            // store candidates (in increasing order so ties are
+            // resolved the same as an exhaustive search)
+            for (i=0; i<M; i++) {
+                if (dmin[i] <= tmax)
+                    _q->data.arb.hard_list[num_hard++] = i;
+
+                for (j=0, k=0; k<bps; k++) {
+                    T t = ((i >> (bps-k-1)) & 0x01) ? tmax_1[k] : tmax_0[k];
+                    j |= dmin[i] <= t;
+                }
+                if (j)
+                    _q->data.arb.soft_list[num_soft++] = i;
+            }
+        }
+    }
+    _q->data.arb.hard_offset[n*n] = num_hard;
+    _q->data.arb.soft_offset[n*n] = num_soft;
+
+    // shrink candidate lists
+    _q->data.arb.hard_list = (unsigned char*)realloc(_q->data.arb.hard_list, num_hard*sizeof(unsigned char));
+    _q->data.arb.soft_list = (unsigned char*)realloc(_q->data.arb.soft_list, num_soft*sizeof(unsigned char));
+}
+
 // demodulate arbitrary modem type (soft)
 void MODEM(_demodulate_soft_arb)(MODEM()         _q,
                                  TC              _r,
@@ -293,7 +442,6 @@ void MODEM(_demodulate_soft_arb)(MODEM()         _q,
                                  unsigned char * _soft_bits)
 {
     unsigned int bps = _q->m;
-    unsigned int M   = _q->M;
 
     // gamma = 1/(2*sigma^2), approximate for constellation size
     T gamma = 1.2f*_q->M;
@@ -302,7 +450,6 @@ void MODEM(_demodulate_soft_arb)(MODEM()         _q,
     unsigned int k;         // bit index
     unsigned int i;         // symbol index
     T d;                // distance for this symbol
-    TC x_hat;    // re-modulated symbol
 
     T dmin_0[bps];
     T dmin_1[bps];
@@ -312,20 +459,31 @@ void MODEM(_demodulate_soft_arb)(MODEM()         _q,
     }
     T dmin = 0.0f;
 
-    for (i=0; i<M; i++) {
-        // compute distance from received symbol
-        x_hat = _q->symbol_map[i];
-        d = crealf( (_r-x_hat)*conjf(_r-x_hat) );
+    // only check candidates for grid cell if sample is within the grid
+    unsigned int num_candidates = _q->M;
+    unsigned char * candidates = NULL;
+    int cell = _q->data.arb.n ? MODEM(_arb_cell)(_q, _r) : -1;
+    if (cell >= 0) {
+        candidates     = &_q->data.arb.soft_list[ _q->data.arb.soft_offset[cell] ];
+        num_candidates = _q->data.arb.soft_offset[cell+1] - _q->data.arb.soft_offset[cell];
+    }
+
+    for (i=0; i<num_candidates; i++) {
+        unsigned int j = candidates ? candidates[i] : i;
+
+        // compute squared distance from received symbol
+        TC e = _r - _q->symbol_map[j];
+        d = crealf(e)*crealf(e) + cimagf(e)*cimagf(e);
 
         // set hard-decision...
         if (d < dmin || i==0) {
-            s = i;
+            s = j;
             dmin = d;
         }
 
         for (k=0; k<bps; k++) {
             // strip bit
-            if ( (s >> (bps-k-1)) & 0x01 ) {
+            if ( (j >> (bps-k-1)) & 0x01 ) {
                 if (d < dmin_1[k]) dmin_1[k] = d;
             } else {
                 if (d < dmin_0[k]) dmin_0[k] = d;
@@ -341,8 +499,6 @@ void MODEM(_demodulate_soft_arb)(MODEM()         _q,
         _soft_bits[k] = (unsigned char)soft_bit;
     }
 
-    // hard decision
-
     // set hard output symbol
     *_s = s;
 
@@ -350,4 +506,3 @@ void MODEM(_demodulate_soft_arb)(MODEM()         _q,
     MODEM(_modulate_arb)(_q, *_s, &_q->x_hat);
     _q->r = _r;
 }
-
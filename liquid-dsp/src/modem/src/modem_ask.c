@@ -93,3 +93,41 @@ void MODEM(_demodulate_ask)(MODEM()        _q,
     _q->r = _x;
 }
 
+// demodulate block of ASK samples
+//  _q      :   modem object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples
+//  _s      :   output symbols [size: _n x 1]
+//  _x_hat  :   re-modulated samples (ignored if NULL) [size: _n x 1]
+void MODEM(_demodulate_block_ask)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _s,
+                                  TC *           _x_hat)
+{
+    T v[MODEM_BLOCK_LEN];               // in-phase values/residuals
+    unsigned int s[MODEM_BLOCK_LEN];    // demodulated symbols
+    unsigned int i, j, n;
+    for (i=0; i<_n; i+=n) {
+        n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+
+        // demodulate on linearly-spaced array
+        for (j=0; j<n; j++)
+            v[j] = crealf(_x[i+j]);
+        MODEM(_demodulate_linear_array_ref_block)(v, n, _q->m, _q->ref, s);
+
+        // 'decode' output symbols (actually gray encoding)
+        for (j=0; j<n; j++)
+            _s[i+j] = s[j] ^ (s[j] >> 1);
+
+        // re-modulate symbols
+        if (_x_hat != NULL) {
+            for (j=0; j<n; j++)
+                MODEM(_modulate_ask)(_q, _s[i+j], &_x_hat[i+j]);
+        }
+    }
+
+    // re-modulate last symbol and store state
+    MODEM(_modulate_ask)(_q, _s[_n-1], &_q->x_hat);
+    _q->r = _x[_n-1];
+}
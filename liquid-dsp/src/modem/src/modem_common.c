@@ -29,6 +29,9 @@
 
 #define DEBUG_DEMODULATE_SOFT 0
 
+// number of samples processed at a time by block demodulators
+#define MODEM_BLOCK_LEN (64)
+
 // modem structure used for both modulation and demodulation 
 //
 // The modem structure implements a variety of common modulation schemes,
@@ -101,6 +104,19 @@ struct MODEM(_s)
             unsigned char * map;        // symbol mapping (allocated)
         } apsk;
 
+        // arbitrary modem: spatial index for demodulation; the grid
+        // covers [-r,r] x [-r,r] and each cell lists the constellation
+        // points which can be nearest to any sample within the cell
+        struct {
+            unsigned int n;             // grid size (n x n cells)
+            T r;                        // grid half-width
+            T dinv;                     // 1/(cell width)
+            unsigned int * hard_offset; // hard candidates offsets [size: n*n+1]
+            unsigned char * hard_list;  // hard candidates (symbol indices)
+            unsigned int * soft_offset; // soft candidates offsets [size: n*n+1]
+            unsigned char * soft_list;  // soft candidates (symbol indices)
+        } arb;
+
         // 'square' 32-QAM
         struct {
             TC * map;           // 8-sample sub-map (first quadrant)
@@ -245,6 +261,11 @@ void MODEM(_destroy)(MODEM() _q)
         free(_q->data.sqam128.map);
     } else if (liquid_modem_is_apsk(_q->scheme)) {
         free(_q->data.apsk.map);
+    } else if (_q->scheme == LIQUID_MODEM_ARB) {
+        free(_q->data.arb.hard_offset);
+        free(_q->data.arb.hard_list);
+        free(_q->data.arb.soft_offset);
+        free(_q->data.arb.soft_list);
     }
 
     // free main object memory
@@ -412,6 +433,111 @@ void MODEM(_demodulate_soft)(MODEM() _q,
     liquid_unpack_soft_bits(symbol_out, _q->m, _soft_bits);
 }
 
+// modulate block of symbols
+//  _q          :   modem object
+//  _s          :   input symbols [size: _n x 1]
+//  _n          :   number of symbols
+//  _y          :   output samples [size: _n x 1]
+void MODEM(_modulate_block)(MODEM()        _q,
+                            unsigned int * _s,
+                            unsigned int   _n,
+                            TC *           _y)
+{
+    unsigned int i;
+
+    // validate input
+    for (i=0; i<_n; i++) {
+        if (_s[i] >= _q->M) {
+            fprintf(stderr,"error: modem_modulate_block(), input symbol exceeds constellation size\n");
+            exit(1);
+        }
+    }
+
+    if (_q->modulate_using_map) {
+        // modulate simply using map (look-up table)
+        for (i=0; i<_n; i++)
+            _y[i] = _q->symbol_map[_s[i]];
+    } else {
+        // invoke method specific to scheme (calculate symbol on the fly)
+        for (i=0; i<_n; i++)
+            _q->modulate_func(_q, _s[i], &_y[i]);
+    }
+}
+
+// hard-decision demodulation of block of samples
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of samples
+//  _s          :   output symbols [size: _n x 1]
+void MODEM(_demodulate_block)(MODEM()        _q,
+                              TC *           _x,
+                              unsigned int   _n,
+                              unsigned int * _s)
+{
+    if (_n == 0)
+        return;
+
+    // use block slicers for linear constellations
+    if (liquid_modem_is_qam(_q->scheme)) {
+        MODEM(_demodulate_block_qam)(_q, _x, _n, _s, NULL);
+    } else if (liquid_modem_is_psk(_q->scheme)) {
+        MODEM(_demodulate_block_psk)(_q, _x, _n, _s, NULL);
+    } else if (liquid_modem_is_ask(_q->scheme)) {
+        MODEM(_demodulate_block_ask)(_q, _x, _n, _s, NULL);
+    } else {
+        unsigned int i;
+        for (i=0; i<_n; i++)
+            _q->demodulate_func(_q, _x[i], &_s[i]);
+    }
+}
+
+// soft-decision demodulation of block of samples
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of samples
+//  _s          :   output hard symbols [size: _n x 1]
+//  _soft_bits  :   output soft bits [size: _n*bps x 1]
+void MODEM(_demodulate_soft_block)(MODEM()         _q,
+                                   TC *            _x,
+                                   unsigned int    _n,
+                                   unsigned int *  _s,
+                                   unsigned char * _soft_bits)
+{
+    unsigned int i;
+    unsigned int bps = _q->m;
+
+    int linear = liquid_modem_is_qam(_q->scheme) ||
+                 liquid_modem_is_psk(_q->scheme) ||
+                 liquid_modem_is_ask(_q->scheme);
+    if (!linear || _n == 0) {
+        for (i=0; i<_n; i++)
+            MODEM(_demodulate_soft)(_q, _x[i], &_s[i], &_soft_bits[i*bps]);
+        return;
+    }
+
+    // run hard demodulation in blocks, keeping re-modulated samples
+    TC x_hat[MODEM_BLOCK_LEN];
+    unsigned int n;
+    for (i=0; i<_n; i+=n) {
+        n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+        if (liquid_modem_is_qam(_q->scheme))
+            MODEM(_demodulate_block_qam)(_q, &_x[i], n, &_s[i], x_hat);
+        else if (liquid_modem_is_psk(_q->scheme))
+            MODEM(_demodulate_block_psk)(_q, &_x[i], n, &_s[i], x_hat);
+        else
+            MODEM(_demodulate_block_ask)(_q, &_x[i], n, &_s[i], x_hat);
+
+        // compute soft bits
+        unsigned int j;
+        for (j=0; j<n; j++) {
+            if (_q->demod_soft_neighbors != NULL && _q->demod_soft_p != 0)
+                MODEM(_demodsoft_table)(_q, _x[i+j], _s[i+j], x_hat[j], &_soft_bits[(i+j)*bps]);
+            else
+                liquid_unpack_soft_bits(_s[i+j], bps, &_soft_bits[(i+j)*bps]);
+        }
+    }
+}
+
 #if DEBUG_DEMODULATE_SOFT
 // print a string of bits to the standard output
 void print_bitstring_demod_soft(unsigned int _x,
@@ -438,6 +564,26 @@ void MODEM(_demodulate_soft_table)(MODEM() _q,
     unsigned int s;
     MODEM(_demodulate)(_q, _r, &s);
 
+    // compute soft bits from nearest neighbors
+    MODEM(_demodsoft_table)(_q, _r, s, _q->x_hat, _soft_bits);
+
+    // set hard output symbol
+    *_s = s;
+}
+
+// compute soft bits from look-up table given hard decision
+//  _q          :   demodulator object
+//  _r          :   received sample
+//  _s          :   hard demodulator output
+//  _x_hat      :   re-modulated hard demodulator output
+//  _soft_bits  :   soft bit ouput (approximate log-likelihood ratio)
+void MODEM(_demodsoft_table)(MODEM()         _q,
+                             TC              _r,
+                             unsigned int    _s,
+                             TC              _x_hat,
+                             unsigned char * _soft_bits)
+{
+    unsigned int s = _s;
     unsigned int bps = MODEM(_get_bps)(_q);
 
     // gamma = 1/(2*sigma^2), approximate for constellation size
@@ -460,7 +606,7 @@ void MODEM(_demodulate_soft_table)(MODEM() _q,
     unsigned int p = _q->demod_soft_p;
 
     // check hard demodulation
-    d = crealf( (_r-_q->x_hat)*conjf(_r-_q->x_hat) );
+    d = liquid_cabsf2(_r - _x_hat);
     for (k=0; k<bps; k++) {
         bit = (s >> (bps-k-1)) & 0x01;
         if (bit) dmin_1[k] = d;
@@ -500,9 +646,6 @@ void MODEM(_demodulate_soft_table)(MODEM() _q,
         if (soft_bit <   0) soft_bit = 0;
         _soft_bits[k] = (unsigned char)soft_bit;
     }
-
-    // set hard output symbol
-    *_s = s;
 }
 
 
@@ -517,7 +660,7 @@ void MODEM(_get_demodulator_sample)(MODEM() _q,
 // get demodulator phase error
 T MODEM(_get_demodulator_phase_error)(MODEM() _q)
 {
-    return cimagf(_q->r*conjf(_q->x_hat));
+    return cimagf(liquid_cmulf(_q->r, conjf(_q->x_hat)));
 }
 
 // get error vector magnitude
@@ -593,6 +736,39 @@ void MODEM(_demodulate_linear_array_ref)(T              _v,
 }
 
 
+// Demodulate block of values on a linear symbol constellation using
+// referenced lookup table; same as _demodulate_linear_array_ref but
+// each step is written without branches and applied across the block
+// so that the compiler can vectorize it
+//  _v      :   input values, replaced by residuals [size: _n x 1]
+//  _n      :   number of values
+//  _m      :   bits per symbol
+//  _ref    :   array of thresholds
+//  _s      :   demodulated symbols [size: _n x 1]
+void MODEM(_demodulate_linear_array_ref_block)(T *            _v,
+                                               unsigned int   _n,
+                                               unsigned int   _m,
+                                               T *            _ref,
+                                               unsigned int * _s)
+{
+    unsigned int i;
+    unsigned int j;
+
+    for (j=0; j<_n; j++)
+        _s[j] = 0;
+
+    for (i=0; i<_m; i++) {
+        T ref = _ref[_m-i-1];
+        for (j=0; j<_n; j++) {
+            // shift bit into symbol, subtract (add) reference if
+            // value is positive (negative)
+            unsigned int bit = _v[j] > 0;
+            _s[j] = (_s[j] << 1) | bit;
+            _v[j] += bit ? -ref : ref;
+        }
+    }
+}
+
 // generate soft demodulation look-up table
 void MODEM(_demodsoft_gentab)(MODEM()      _q,
                               unsigned int _p)
@@ -108,3 +108,46 @@ void MODEM(_demodulate_psk)(MODEM()        _q,
     _q->r = _x;
 }
 
+// demodulate block of PSK samples
+//  _q      :   modem object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples
+//  _s      :   output symbols [size: _n x 1]
+//  _x_hat  :   re-modulated samples (ignored if NULL) [size: _n x 1]
+void MODEM(_demodulate_block_psk)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _s,
+                                  TC *           _x_hat)
+{
+    T theta[MODEM_BLOCK_LEN];           // phase/residual
+    unsigned int s[MODEM_BLOCK_LEN];    // demodulated symbols
+    unsigned int i, j, n;
+    for (i=0; i<_n; i+=n) {
+        n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+
+        // compute angle and subtract phase offset, ensuring phase is in [-pi,pi)
+        for (j=0; j<n; j++) {
+            theta[j] = cargf(_x[i+j]) - _q->data.psk.d_phi;
+            if (theta[j] < -M_PI)
+                theta[j] += 2*M_PI;
+        }
+
+        // demodulate on linearly-spaced array
+        MODEM(_demodulate_linear_array_ref_block)(theta, n, _q->m, _q->ref, s);
+
+        // 'decode' output symbols (actually gray encoding)
+        for (j=0; j<n; j++)
+            _s[i+j] = s[j] ^ (s[j] >> 1);
+
+        // re-modulate symbols
+        if (_x_hat != NULL) {
+            for (j=0; j<n; j++)
+                MODEM(_modulate_psk)(_q, _s[i+j], &_x_hat[i+j]);
+        }
+    }
+
+    // re-modulate last symbol and store state
+    MODEM(_modulate_psk)(_q, _s[_n-1], &_q->x_hat);
+    _q->r = _x[_n-1];
+}
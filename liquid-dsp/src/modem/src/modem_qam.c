@@ -140,3 +140,47 @@ void MODEM(_demodulate_qam)(MODEM()      _q,
     _q->r = _x;
 }
 
+// demodulate block of QAM samples
+//  _q      :   modem object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples
+//  _s      :   output symbols [size: _n x 1]
+//  _x_hat  :   re-modulated samples (ignored if NULL) [size: _n x 1]
+void MODEM(_demodulate_block_qam)(MODEM()        _q,
+                                  TC *           _x,
+                                  unsigned int   _n,
+                                  unsigned int * _s,
+                                  TC *           _x_hat)
+{
+    T v_i[MODEM_BLOCK_LEN];             // in-phase values/residuals
+    T v_q[MODEM_BLOCK_LEN];             // quadrature values/residuals
+    unsigned int s_i[MODEM_BLOCK_LEN];  // in-phase symbols
+    unsigned int s_q[MODEM_BLOCK_LEN];  // quadrature symbols
+    unsigned int i, j, n=0;
+    for (i=0; i<_n; i+=n) {
+        n = _n - i < MODEM_BLOCK_LEN ? _n - i : MODEM_BLOCK_LEN;
+
+        // demodulate in-phase and quadrature components on
+        // linearly-spaced arrays
+        for (j=0; j<n; j++) {
+            v_i[j] = crealf(_x[i+j]);
+            v_q[j] = cimagf(_x[i+j]);
+        }
+        MODEM(_demodulate_linear_array_ref_block)(v_i, n, _q->data.qam.m_i, _q->ref, s_i);
+        MODEM(_demodulate_linear_array_ref_block)(v_q, n, _q->data.qam.m_q, _q->ref, s_q);
+
+        // 'decode' output symbols (actually gray encoding)
+        for (j=0; j<n; j++)
+            _s[i+j] = ((s_i[j] ^ (s_i[j] >> 1)) << _q->data.qam.m_q) + (s_q[j] ^ (s_q[j] >> 1));
+
+        // re-modulate symbols (subtract residuals)
+        if (_x_hat != NULL) {
+            for (j=0; j<n; j++)
+                _x_hat[i+j] = _x[i+j] - (v_i[j] + _Complex_I*v_q[j]);
+        }
+    }
+
+    // store state of last sample
+    _q->x_hat = _x[_n-1] - (v_i[n-1] + _Complex_I*v_q[n-1]);
+    _q->r = _x[_n-1];
+}
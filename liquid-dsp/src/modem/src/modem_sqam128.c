@@ -101,7 +101,7 @@ void MODEM(_demodulate_sqam128)(MODEM()        _q,
     T d = 0.0f;
     unsigned int i;
     for (i=0; i<32; i++) {
-        d = cabsf(x_prime - _q->data.sqam128.map[i]);
+        d = liquid_cabsf2(x_prime - _q->data.sqam128.map[i]);
         if (i==0 || d < dmin) {
             dmin = d;
             *_sym_out = i;
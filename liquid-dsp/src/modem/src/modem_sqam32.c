@@ -100,7 +100,7 @@ void MODEM(_demodulate_sqam32)(MODEM()        _q,
     T d = 0.0f;
     unsigned int i;
     for (i=0; i<8; i++) {
-        d = cabsf(x_prime - _q->data.sqam32.map[i]);
+        d = liquid_cabsf2(x_prime - _q->data.sqam32.map[i]);
         if (i==0 || d < dmin) {
             dmin = d;
             *_sym_out = i;
@@ -83,3 +83,67 @@ void freqmodem_test(float               _kf,
 void autotest_freqmodem_0p02_delayconj() { freqmodem_test(0.02f, LIQUID_FREQDEM_DELAYCONJ); }
 void autotest_freqmodem_0p02_pll()       { freqmodem_test(0.02f, LIQUID_FREQDEM_PLL);       }
 
+
+// Help function to keep code base small; compares block demodulation
+// against one sample at a time and the exact discriminator
+//  _type   :   demodulation type {LIQUID_FREQDEM_DELAYCONJ, LIQUID_FREQDEM_PLL}
+//  _disc   :   discriminator type
+//  _tol    :   tolerance relative to LIQUID_FREQDEM_DISC_ARG
+void freqdem_block_test(liquid_freqdem_type _type,
+                        liquid_freqdem_disc _disc,
+                        float               _tol)
+{
+    // options
+    float kf = 0.1f;                // modulation factor
+    unsigned int num_samples = 600; // spans several internal blocks
+
+    unsigned int i;
+
+    // create mod/demod objects
+    freqmod mod  = freqmod_create(kf);
+    freqdem dem0 = freqdem_create(kf,_type);    // exact, sample
+    freqdem dem1 = freqdem_create(kf,_type);    // _disc, sample
+    freqdem dem2 = freqdem_create(kf,_type);    // _disc, block
+    freqdem_set_discriminator(dem1, _disc);
+    freqdem_set_discriminator(dem2, _disc);
+
+    // generate modulated signal
+    float complex r[num_samples];
+    for (i=0; i<num_samples; i++)
+        freqmod_modulate(mod, 0.7f*cosf(2*M_PI*0.013f*i), &r[i]);
+
+    // demodulate
+    float y0[num_samples];
+    float y1[num_samples];
+    float y2[num_samples];
+    for (i=0; i<num_samples; i++) {
+        freqdem_demodulate(dem0, r[i], &y0[i]);
+        freqdem_demodulate(dem1, r[i], &y1[i]);
+    }
+    freqdem_demodulate_block(dem2, r,       100,             y2);
+    freqdem_demodulate_block(dem2, r + 100, num_samples-100, y2 + 100);
+
+    // block and sample outputs must agree; outputs are compared to the
+    // exact discriminator only after the receive filter transient, as
+    // the quadrature discriminator assumes a constant envelope
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( y2[i], y1[i], 1e-6f );
+        if (i >= 20) {
+            CONTEND_DELTA( y1[i], y0[i], _tol );
+        }
+    }
+
+    // delete modem objects
+    freqmod_destroy(mod);
+    freqdem_destroy(dem0);
+    freqdem_destroy(dem1);
+    freqdem_destroy(dem2);
+}
+
+// AUTOTESTS: block demodulation, discriminators
+void autotest_freqdem_block_pll()    { freqdem_block_test(LIQUID_FREQDEM_PLL,       LIQUID_FREQDEM_DISC_ARG,    0.0f ); }
+void autotest_freqdem_block_arg()    { freqdem_block_test(LIQUID_FREQDEM_DELAYCONJ, LIQUID_FREQDEM_DISC_ARG,    0.0f ); }
+void autotest_freqdem_block_atan3()  { freqdem_block_test(LIQUID_FREQDEM_DELAYCONJ, LIQUID_FREQDEM_DISC_ATAN3,  1e-2f); }
+void autotest_freqdem_block_atan7()  { freqdem_block_test(LIQUID_FREQDEM_DELAYCONJ, LIQUID_FREQDEM_DISC_ATAN7,  2e-4f); }
+void autotest_freqdem_block_atan11() { freqdem_block_test(LIQUID_FREQDEM_DELAYCONJ, LIQUID_FREQDEM_DISC_ATAN11, 1e-5f); }
+void autotest_freqdem_block_quad()   { freqdem_block_test(LIQUID_FREQDEM_DELAYCONJ, LIQUID_FREQDEM_DISC_QUAD,   3e-2f); }
@@ -113,3 +113,71 @@ void autotest_mod_demod_arb128opt() { modem_test_mod_demod(LIQUID_MODEM_ARB128OP
 void autotest_mod_demod_arb256opt() { modem_test_mod_demod(LIQUID_MODEM_ARB256OPT); }
 void autotest_mod_demod_arb64vt()   { modem_test_mod_demod(LIQUID_MODEM_ARB64VT);   }
 
+// Compare block modulation/demodulation against one symbol at a time
+void modem_test_block(modulation_scheme _ms)
+{
+    // create separate modems for block and sample-by-sample operation
+    modem q0 = modem_create(_ms);
+    modem q1 = modem_create(_ms);
+    unsigned int bps = modem_get_bps(q0);
+
+    unsigned int i, k, n = 203;
+    unsigned int  sym[n], s0[n], s1[n];
+    float complex y0[n], y1[n];
+    unsigned char soft0[n*bps], soft1[n*bps];
+    for (i=0; i<n; i++)
+        sym[i] = modem_gen_rand_sym(q0);
+
+    // modulate
+    for (i=0; i<n; i++)
+        modem_modulate(q0, sym[i], &y0[i]);
+    modem_modulate_block(q1, sym, n, y1);
+    for (i=0; i<n; i++)
+        CONTEND_EQUALITY(y0[i], y1[i]);
+
+    // add noise
+    for (i=0; i<n; i++)
+        y0[i] += 0.1f*(randnf() + _Complex_I*randnf());
+
+    // hard demodulation
+    for (i=0; i<n; i++)
+        modem_demodulate(q0, y0[i], &s0[i]);
+    modem_demodulate_block(q1, y0, n, s1);
+    for (i=0; i<n; i++)
+        CONTEND_EQUALITY(s0[i], s1[i]);
+    CONTEND_EQUALITY(modem_get_demodulator_phase_error(q0),
+                     modem_get_demodulator_phase_error(q1));
+
+    // soft demodulation
+    modem_reset(q0);
+    modem_reset(q1);
+    for (i=0; i<n; i++)
+        modem_demodulate_soft(q0, y0[i], &s0[i], &soft0[i*bps]);
+    modem_demodulate_soft_block(q1, y0, n, s1, soft1);
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY(s0[i], s1[i]);
+        for (k=0; k<bps; k++)
+            CONTEND_EQUALITY(soft0[i*bps+k], soft1[i*bps+k]);
+    }
+    CONTEND_EQUALITY(modem_get_demodulator_evm(q0),
+                     modem_get_demodulator_evm(q1));
+
+    modem_destroy(q0);
+    modem_destroy(q1);
+}
+
+// AUTOTESTS: block operation
+void autotest_mod_demod_block_psk2()     { modem_test_block(LIQUID_MODEM_PSK2);     }
+void autotest_mod_demod_block_psk8()     { modem_test_block(LIQUID_MODEM_PSK8);     }
+void autotest_mod_demod_block_psk256()   { modem_test_block(LIQUID_MODEM_PSK256);   }
+void autotest_mod_demod_block_dpsk4()    { modem_test_block(LIQUID_MODEM_DPSK4);    }
+void autotest_mod_demod_block_ask4()     { modem_test_block(LIQUID_MODEM_ASK4);     }
+void autotest_mod_demod_block_ask256()   { modem_test_block(LIQUID_MODEM_ASK256);   }
+void autotest_mod_demod_block_qam4()     { modem_test_block(LIQUID_MODEM_QAM4);     }
+void autotest_mod_demod_block_qam8()     { modem_test_block(LIQUID_MODEM_QAM8);     }
+void autotest_mod_demod_block_qam64()    { modem_test_block(LIQUID_MODEM_QAM64);    }
+void autotest_mod_demod_block_qam256()   { modem_test_block(LIQUID_MODEM_QAM256);   }
+void autotest_mod_demod_block_apsk32()   { modem_test_block(LIQUID_MODEM_APSK32);   }
+void autotest_mod_demod_block_qpsk()     { modem_test_block(LIQUID_MODEM_QPSK);     }
+void autotest_mod_demod_block_arb64opt() { modem_test_block(LIQUID_MODEM_ARB64OPT); }
+
@@ -125,3 +125,71 @@ void autotest_demodsoft_arb128opt() { modem_test_demodsoft(LIQUID_MODEM_ARB128OP
 void autotest_demodsoft_arb256opt() { modem_test_demodsoft(LIQUID_MODEM_ARB256OPT); }
 void autotest_demodsoft_arb64vt()   { modem_test_demodsoft(LIQUID_MODEM_ARB64VT);   }
 
+// Compare arbitrary modem demodulation (which uses a spatial index)
+// against an exhaustive search over the constellation
+void modem_test_demod_arb_search(modulation_scheme _ms)
+{
+    modem q = modem_create(_ms);
+    unsigned int bps = modem_get_bps(q);
+    unsigned int M   = 1 << bps;
+
+    // constellation
+    unsigned int i, j, k;
+    float complex c[M];
+    for (i=0; i<M; i++)
+        modem_modulate(q, i, &c[i]);
+
+    unsigned int num_trials = 2000;
+    unsigned char soft_bits[bps];
+    for (i=0; i<num_trials; i++) {
+        // received sample, some of which lie well outside of constellation
+        float complex x = (randnf() + _Complex_I*randnf()) * (i < num_trials/2 ? 0.7f : 2.0f);
+
+        // exhaustive search, minimum squared distance for each bit
+        unsigned int s_ref = 0;
+        float d_min = 0.0f;
+        float dmin_0[bps], dmin_1[bps];
+        for (k=0; k<bps; k++) {
+            dmin_0[k] = 4.0f;
+            dmin_1[k] = 4.0f;
+        }
+        for (j=0; j<M; j++) {
+            float complex e = x - c[j];
+            float d = crealf(e)*crealf(e) + cimagf(e)*cimagf(e);
+            if (j==0 || d < d_min) {
+                d_min = d;
+                s_ref = j;
+            }
+            for (k=0; k<bps; k++) {
+                if ( (j >> (bps-k-1)) & 1 ) { if (d < dmin_1[k]) dmin_1[k] = d; }
+                else                        { if (d < dmin_0[k]) dmin_0[k] = d; }
+            }
+        }
+
+        // hard demodulation
+        unsigned int s;
+        modem_demodulate(q, x, &s);
+        CONTEND_EQUALITY(s, s_ref);
+
+        // soft demodulation
+        modem_demodulate_soft(q, x, &s, soft_bits);
+        CONTEND_EQUALITY(s, s_ref);
+        for (k=0; k<bps; k++) {
+            int soft_bit = ((dmin_0[k] - dmin_1[k])*1.2f*M)*16 + 127;
+            if (soft_bit > 255) soft_bit = 255;
+            if (soft_bit <   0) soft_bit = 0;
+            CONTEND_EQUALITY(soft_bits[k], soft_bit);
+        }
+    }
+
+    modem_destroy(q);
+}
+
+void autotest_demod_arb_search_V29()       { modem_test_demod_arb_search(LIQUID_MODEM_V29);       }
+void autotest_demod_arb_search_arb16opt()  { modem_test_demod_arb_search(LIQUID_MODEM_ARB16OPT);  }
+void autotest_demod_arb_search_arb32opt()  { modem_test_demod_arb_search(LIQUID_MODEM_ARB32OPT);  }
+void autotest_demod_arb_search_arb64opt()  { modem_test_demod_arb_search(LIQUID_MODEM_ARB64OPT);  }
+void autotest_demod_arb_search_arb128opt() { modem_test_demod_arb_search(LIQUID_MODEM_ARB128OPT); }
+void autotest_demod_arb_search_arb256opt() { modem_test_demod_arb_search(LIQUID_MODEM_ARB256OPT); }
+void autotest_demod_arb_search_arb64vt()   { modem_test_demod_arb_search(LIQUID_MODEM_ARB64VT);   }
+
@@ -17,6 +17,7 @@
  * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -80,3 +81,67 @@ void benchmark_firpfbch2_crcf_s512  FIRPFBCH2_EXECUTE_BENCH_API(512,  2,  LIQUID
 void benchmark_firpfbch2_crcf_s1024 FIRPFBCH2_EXECUTE_BENCH_API(1024, 2,  LIQUID_SYNTHESIZER)
 
 
+
+#define FIRPFBCH2_BLOCK_BENCH_API(NUM_CHANNELS,M,TYPE,NUM_ACTIVE)   \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ firpfbch2_crcf_block_bench(_start, _finish, _num_iterations, NUM_CHANNELS, M, TYPE, NUM_ACTIVE); }
+
+// block execution, 16 frames per call; iterations count frames
+void firpfbch2_crcf_block_bench(struct rusage *     _start,
+                                struct rusage *     _finish,
+                                unsigned long int * _num_iterations,
+                                unsigned int        _num_channels,
+                                unsigned int        _m,
+                                int                 _type,
+                                unsigned int        _num_active)
+{
+    // initialize channelizer
+    float As         = 60.0f;
+    firpfbch2_crcf q = firpfbch2_crcf_create_kaiser(_type,_num_channels,_m,As);
+
+    unsigned long int i;
+
+    // set active channel mask, spreading channels across the band
+    if (_num_active < _num_channels) {
+        unsigned char mask[_num_channels];
+        for (i=0; i<_num_channels; i++)
+            mask[i] = (i*_num_active) % _num_channels < _num_active;
+        firpfbch2_crcf_set_channel_mask(q, mask);
+    }
+    unsigned int num_frames = 16;
+
+    float complex * x = (float complex*) malloc(num_frames*_num_channels*sizeof(float complex));
+    float complex * y = (float complex*) malloc(num_frames*_num_channels*sizeof(float complex));
+    for (i=0; i<num_frames*_num_channels; i++)
+        x[i] = 1.0f + _Complex_I*1.0f;
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= _num_channels * num_frames;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firpfbch2_crcf_execute_block(q, x, num_frames, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_frames;
+
+    free(x);
+    free(y);
+    firpfbch2_crcf_destroy(q);
+}
+
+// analysis (block)
+void benchmark_firpfbch2_crcf_a64_block   FIRPFBCH2_BLOCK_BENCH_API(64,   2,  LIQUID_ANALYZER, 64)
+void benchmark_firpfbch2_crcf_a256_block  FIRPFBCH2_BLOCK_BENCH_API(256,  2,  LIQUID_ANALYZER, 256)
+void benchmark_firpfbch2_crcf_a1024_block FIRPFBCH2_BLOCK_BENCH_API(1024, 2,  LIQUID_ANALYZER, 1024)
+
+// analyzer cost vs. number of active channels
+void benchmark_firpfbch2_crcf_a512_block_n1   FIRPFBCH2_BLOCK_BENCH_API(512, 2, LIQUID_ANALYZER,    1)
+void benchmark_firpfbch2_crcf_a512_block_n2   FIRPFBCH2_BLOCK_BENCH_API(512, 2, LIQUID_ANALYZER,    2)
+void benchmark_firpfbch2_crcf_a512_block_n5   FIRPFBCH2_BLOCK_BENCH_API(512, 2, LIQUID_ANALYZER,    5)
+void benchmark_firpfbch2_crcf_a512_block_n10  FIRPFBCH2_BLOCK_BENCH_API(512, 2, LIQUID_ANALYZER,   10)
+void benchmark_firpfbch2_crcf_a512_block_n20  FIRPFBCH2_BLOCK_BENCH_API(512, 2, LIQUID_ANALYZER,   20)
+void benchmark_firpfbch2_crcf_a512_block_n512 FIRPFBCH2_BLOCK_BENCH_API(512, 2, LIQUID_ANALYZER,  512)
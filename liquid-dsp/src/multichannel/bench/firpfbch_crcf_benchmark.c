@@ -17,6 +17,7 @@
  * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -82,3 +83,68 @@ void benchmark_firpfbch_crcf_a512    FIRPFBCH_EXECUTE_BENCH_API(512,  2,  LIQUID
 void benchmark_firpfbch_crcf_a1024   FIRPFBCH_EXECUTE_BENCH_API(1024, 2,  LIQUID_ANALYZER)
 
 
+#define FIRPFBCH_BLOCK_BENCH_API(NUM_CHANNELS,M,NUM_ACTIVE) \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ firpfbch_crcf_block_bench(_start, _finish, _num_iterations, NUM_CHANNELS, M, NUM_ACTIVE); }
+
+// analyzer block execution, 16 frames per call; iterations count frames
+void firpfbch_crcf_block_bench(
+    struct rusage *_start,
+    struct rusage *_finish,
+    unsigned long int *_num_iterations,
+    unsigned int _num_channels,
+    unsigned int _m,
+    unsigned int _num_active)
+{
+    // initialize channelizer
+    float As    = 60.0f;
+    firpfbch_crcf c = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER,_num_channels,_m,As);
+
+    unsigned long int i;
+
+    // set active channel mask, spreading channels across the band
+    if (_num_active < _num_channels) {
+        unsigned char mask[_num_channels];
+        for (i=0; i<_num_channels; i++)
+            mask[i] = (i*_num_active) % _num_channels < _num_active;
+        firpfbch_crcf_set_channel_mask(c, mask);
+    }
+
+    unsigned int num_frames = 16;
+
+    float complex * x = (float complex*) malloc(num_frames*_num_channels*sizeof(float complex));
+    float complex * y = (float complex*) malloc(num_frames*_num_channels*sizeof(float complex));
+    for (i=0; i<num_frames*_num_channels; i++)
+        x[i] = 1.0f + _Complex_I*1.0f;
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= _num_channels * num_frames;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        firpfbch_crcf_analyzer_execute_block(c,x,num_frames,y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= num_frames;
+
+    free(x);
+    free(y);
+    firpfbch_crcf_destroy(c);
+}
+
+//
+void benchmark_firpfbch_crcf_a64_block   FIRPFBCH_BLOCK_BENCH_API(64,   2, 64)
+void benchmark_firpfbch_crcf_a256_block  FIRPFBCH_BLOCK_BENCH_API(256,  2, 256)
+void benchmark_firpfbch_crcf_a1024_block FIRPFBCH_BLOCK_BENCH_API(1024, 2, 1024)
+
+// analyzer cost vs. number of active channels
+void benchmark_firpfbch_crcf_a512_block_n1   FIRPFBCH_BLOCK_BENCH_API(512, 2, 1)
+void benchmark_firpfbch_crcf_a512_block_n2   FIRPFBCH_BLOCK_BENCH_API(512, 2, 2)
+void benchmark_firpfbch_crcf_a512_block_n5   FIRPFBCH_BLOCK_BENCH_API(512, 2, 5)
+void benchmark_firpfbch_crcf_a512_block_n10  FIRPFBCH_BLOCK_BENCH_API(512, 2, 10)
+void benchmark_firpfbch_crcf_a512_block_n20  FIRPFBCH_BLOCK_BENCH_API(512, 2, 20)
+void benchmark_firpfbch_crcf_a512_block_n512 FIRPFBCH_BLOCK_BENCH_API(512, 2, 512)
+
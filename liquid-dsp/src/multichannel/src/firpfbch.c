@@ -30,6 +30,67 @@
 
 #include "liquid.internal.h"
 
+// maximum number of frames processed at a time by the analyzer
+#define FIRPFBCH_BLOCK_FRAMES   (16)
+
+// alignment of analyzer polyphase matrix and input history (bytes)
+#define FIRPFBCH_ALIGN          (64)
+
+// number of floats per coefficient in the analyzer polyphase matrix
+#define FIRPFBCH_H_STRIDE       (2*(1+TC_COMPLEX))
+
+// accumulate one row of branch filter products, treating the _n
+// complex samples as 2*_n real components; each coefficient is laid
+// out against a (re,im) sample pair as
+//   real coefficients      : [h, h]
+//   complex coefficients   : [hr, hr, -hi, hi]
+// so that every component is a sum of elementwise products. The
+// components are processed in groups of four, loaded before any are
+// stored, so that the groups vectorize at -O2.
+//  _h      :   coefficient row [size: FIRPFBCH_H_STRIDE*_n x 1]
+//  _r      :   input samples, (re,im) pairs [size: 2*_n x 1]
+//  _n      :   number of samples
+//  _y      :   accumulated output, (re,im) pairs [size: 2*_n x 1]
+static void FIRPFBCH(_branch_mac)(const float * _h,
+                                  const float * _r,
+                                  unsigned int  _n,
+                                  float *       _y)
+{
+    unsigned int i;
+    for (i=0; i<_n/2; i++) {
+        float r0 = _r[0], r1 = _r[1], r2 = _r[2], r3 = _r[3];
+#if TC_COMPLEX
+        float y0 = _y[0] + _h[0]*r0 + _h[2]*r1;
+        float y1 = _y[1] + _h[1]*r1 + _h[3]*r0;
+        float y2 = _y[2] + _h[4]*r2 + _h[6]*r3;
+        float y3 = _y[3] + _h[5]*r3 + _h[7]*r2;
+#else
+        float y0 = _y[0] + _h[0]*r0;
+        float y1 = _y[1] + _h[1]*r1;
+        float y2 = _y[2] + _h[2]*r2;
+        float y3 = _y[3] + _h[3]*r3;
+#endif
+        _y[0] = y0;
+        _y[1] = y1;
+        _y[2] = y2;
+        _y[3] = y3;
+        _h += 2*FIRPFBCH_H_STRIDE;
+        _r += 4;
+        _y += 4;
+    }
+
+    if (_n & 1) {
+#if TC_COMPLEX
+        float r0 = _r[0], r1 = _r[1];
+        _y[0] += _h[0]*r0 + _h[2]*r1;
+        _y[1] += _h[1]*r1 + _h[3]*r0;
+#else
+        _y[0] += _h[0]*_r[0];
+        _y[1] += _h[1]*_r[1];
+#endif
+    }
+}
+
 // firpfbch object structure definition
 struct FIRPFBCH(_s) {
     int type;                   // synthesis/analysis
@@ -40,27 +101,29 @@ struct FIRPFBCH(_s) {
     unsigned int h_len;         // filter length
     TC * h;                     // filter coefficients
     
-    // create separate bank of dotprod and window objects
+    // synthesizer: separate bank of dotprod and window objects
     DOTPROD() * dp;             // dot product object array
     WINDOW() * w;               // window buffer object array
-    unsigned int filter_index;  // running filter index (analysis)
+
+    // analyzer: polyphase filters stored as one contiguous matrix
+    // whose row d holds the coefficient for delay d (in frames) of
+    // every branch, and a single input history shared by all branches
+    float * H;                  // polyphase matrix [size: p x num_channels x FIRPFBCH_H_STRIDE]
+    TI * buf;                   // input history [size: (p-1+B) x num_channels]
 
     // fft plan
     FFT_PLAN fft;               // fft|ifft object
     TO * x;                     // fft|ifft transform input array
     TO * X;                     // fft|ifft transform output array
-};
-
-// 
-// forward declaration of internal methods
-//
-
-void FIRPFBCH(_analyzer_push)(FIRPFBCH() _q, TI _x);
-
-void FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
-                             unsigned int _k,
-                             TO *         _X);
 
+    // active channels (all unless a mask is set); when only a few
+    // are active their DFT bins are evaluated directly
+    unsigned char * mask;       // active channel mask, NULL if all active
+    unsigned int num_active;    // number of active channels
+    unsigned int * active;      // active channel indices [size: num_active x 1]
+    TO * tw;                    // analyzer twiddle rows, NULL for full transform [size: num_active x num_channels]
+    dotprod_cccf * dft;         // dot product with each twiddle row
+};
 
 // create FIR polyphase filterbank channelizer object
 //  _type   : channelizer type (LIQUID_ANALYZER | LIQUID_SYNTHESIZER)
@@ -95,29 +158,50 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
     // derived values
     q->h_len = q->num_channels * q->p;
 
-    // create bank of filters
-    q->dp = (DOTPROD()*) malloc((q->num_channels)*sizeof(DOTPROD()));
-    q->w  = (WINDOW()*)  malloc((q->num_channels)*sizeof(WINDOW()));
-
     // copy filter coefficients
     q->h = (TC*) malloc((q->h_len)*sizeof(TC));
     unsigned int i;
     for (i=0; i<q->h_len; i++)
         q->h[i] = _h[i];
 
-    // generate bank of sub-samped filters
     unsigned int n;
-    unsigned int h_sub_len = q->p;
-    TC h_sub[h_sub_len];
-    for (i=0; i<q->num_channels; i++) {
-        // sub-sample prototype filter, loading coefficients in reverse order
-        for (n=0; n<h_sub_len; n++) {
-            h_sub[h_sub_len-n-1] = q->h[i + n*(q->num_channels)];
+    if (q->type == LIQUID_SYNTHESIZER) {
+        // generate bank of sub-samped filters
+        q->dp = (DOTPROD()*) malloc((q->num_channels)*sizeof(DOTPROD()));
+        q->w  = (WINDOW()*)  malloc((q->num_channels)*sizeof(WINDOW()));
+        unsigned int h_sub_len = q->p;
+        TC h_sub[h_sub_len];
+        for (i=0; i<q->num_channels; i++) {
+            // sub-sample prototype filter, loading coefficients in reverse order
+            for (n=0; n<h_sub_len; n++) {
+                h_sub[h_sub_len-n-1] = q->h[i + n*(q->num_channels)];
+            }
+            // create window buffer and dotprod object (coefficients
+            // loaded in reverse order)
+            q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
+            q->w[i]  = WINDOW(_create)(h_sub_len);
         }
-        // create window buffer and dotprod object (coefficients
-        // loaded in reverse order)
-        q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
-        q->w[i]  = WINDOW(_create)(h_sub_len);
+    } else {
+        // polyphase matrix: branch i, delay n is h[i + n*M], stored
+        // in reverse branch order so that each row lines up with a
+        // frame of input samples (the first sample of a frame feeds
+        // the last branch)
+        q->H = (float*) liquid_malloc_aligned(FIRPFBCH_H_STRIDE*q->h_len*sizeof(float), FIRPFBCH_ALIGN);
+        for (n=0; n<q->p; n++) {
+            for (i=0; i<q->num_channels; i++) {
+                TC h = q->h[n*q->num_channels + q->num_channels - i - 1];
+                float * hp = &q->H[FIRPFBCH_H_STRIDE*(n*q->num_channels + i)];
+                hp[0] = crealf(h);
+                hp[1] = crealf(h);
+#if TC_COMPLEX
+                hp[2] = -cimagf(h);
+                hp[3] =  cimagf(h);
+#endif
+            }
+        }
+
+        // input history (p-1 frames) followed by room for a block
+        q->buf = (TI*) liquid_malloc_aligned((q->p - 1 + FIRPFBCH_BLOCK_FRAMES)*q->num_channels*sizeof(TI), FIRPFBCH_ALIGN);
     }
 
     // allocate memory for buffers
@@ -131,6 +215,13 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
     else
         q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
 
+    // all channels active
+    q->mask       = NULL;
+    q->num_active = q->num_channels;
+    q->active     = NULL;
+    q->tw         = NULL;
+    q->dft        = NULL;
+
     // reset filterbank object
     FIRPFBCH(_reset)(q);
 
@@ -257,13 +348,22 @@ void FIRPFBCH(_destroy)(FIRPFBCH() _q)
 {
     unsigned int i;
 
-    // free dot product, window objects and arrays
-    for (i=0; i<_q->num_channels; i++) {
-        DOTPROD(_destroy)(_q->dp[i]);
-        WINDOW(_destroy)(_q->w[i]);
+    if (_q->type == LIQUID_SYNTHESIZER) {
+        // free dot product, window objects and arrays
+        for (i=0; i<_q->num_channels; i++) {
+            DOTPROD(_destroy)(_q->dp[i]);
+            WINDOW(_destroy)(_q->w[i]);
+        }
+        free(_q->dp);
+        free(_q->w);
+    } else {
+        // free polyphase matrix, input history
+        liquid_free_aligned(_q->H);
+        liquid_free_aligned(_q->buf);
     }
-    free(_q->dp);
-    free(_q->w);
+
+    // free channel mask and pruned transform
+    FIRPFBCH(_set_channel_mask)(_q, NULL);
 
     // free transform object
     FFT_DESTROY_PLAN(_q->fft);
@@ -282,11 +382,17 @@ void FIRPFBCH(_reset)(FIRPFBCH() _q)
 {
     unsigned int i;
     for (i=0; i<_q->num_channels; i++) {
-        WINDOW(_clear)(_q->w[i]);
+        if (_q->type == LIQUID_SYNTHESIZER)
+            WINDOW(_clear)(_q->w[i]);
         _q->x[i] = 0;
         _q->X[i] = 0;
     }
-    _q->filter_index = _q->num_channels-1;
+
+    // clear analyzer input history
+    if (_q->type == LIQUID_ANALYZER) {
+        for (i=0; i<(_q->p-1)*_q->num_channels; i++)
+            _q->buf[i] = 0;
+    }
 }
 
 // print firpfbch object
@@ -300,6 +406,69 @@ void FIRPFBCH(_print)(FIRPFBCH() _q)
         printf("  h[%3u] = %12.8f + %12.8f*j\n", i, crealf(_q->h[i]), cimagf(_q->h[i]));
 }
 
+// set active channels; only channels with a non-zero mask entry are
+// computed: the analyzer outputs zero on inactive channels and the
+// synthesizer ignores their inputs. When few channels of an analyzer
+// are active, their DFT bins are evaluated directly instead of running
+// the full transform; the branch filters are always run in full as
+// every output bin depends on all of them.
+//  _q      :   filterbank channelizer object
+//  _mask   :   active channel mask [size: num_channels x 1], NULL
+//              to activate all channels
+void FIRPFBCH(_set_channel_mask)(FIRPFBCH()      _q,
+                                 unsigned char * _mask)
+{
+    unsigned int M = _q->num_channels;
+    unsigned int i;
+    unsigned int k;
+
+    // free existing mask and pruned transform
+    if (_q->dft != NULL) {
+        for (k=0; k<_q->num_active; k++)
+            dotprod_cccf_destroy(_q->dft[k]);
+        free(_q->dft);
+    }
+    free(_q->mask);
+    free(_q->active);
+    free(_q->tw);
+    _q->mask       = NULL;
+    _q->num_active = M;
+    _q->active     = NULL;
+    _q->tw         = NULL;
+    _q->dft        = NULL;
+
+    if (_mask == NULL)
+        return;
+
+    // copy mask and list active channels
+    _q->mask   = (unsigned char*) malloc(M*sizeof(unsigned char));
+    _q->active = (unsigned int*)  malloc(M*sizeof(unsigned int));
+    _q->num_active = 0;
+    for (i=0; i<M; i++) {
+        _q->mask[i] = _mask[i] ? 1 : 0;
+        if (_q->mask[i])
+            _q->active[_q->num_active++] = i;
+    }
+
+    // analyzer: evaluate bins directly only if it is cheaper than
+    // the full transform, i.e. a length-M dot product (with some
+    // fixed overhead) per bin vs. M log2(M)
+    if (_q->type != LIQUID_ANALYZER || _q->num_active == 0 ||
+        _q->num_active*(M + 128) >= M*liquid_nextpow2(M))
+        return;
+
+    // twiddle rows: exp(-j*2*pi*i*k/M) for active channel k
+    _q->tw  = (TO*) malloc(_q->num_active*M*sizeof(TO));
+    _q->dft = (dotprod_cccf*) malloc(_q->num_active*sizeof(dotprod_cccf));
+    for (k=0; k<_q->num_active; k++) {
+        for (i=0; i<M; i++) {
+            float theta = 2*M_PI*(float)((i*_q->active[k]) % M) / (float)M;
+            _q->tw[k*M + i] = cexpf(-_Complex_I*theta);
+        }
+        _q->dft[k] = dotprod_cccf_create(&_q->tw[k*M], M);
+    }
+}
+
 // 
 // SYNTHESIZER
 //
@@ -312,10 +481,19 @@ void FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,
                                     TI * _x,
                                     TO * _y)
 {
+    unsigned int M = _q->num_channels;
     unsigned int i;
 
     // copy channelized symbols to transform input
-    memmove(_q->X, _x, _q->num_channels*sizeof(TI));
+    memmove(_q->X, _x, M*sizeof(TI));
+
+    // ignore inactive channels
+    if (_q->mask != NULL) {
+        for (i=0; i<M; i++) {
+            if (!_q->mask[i])
+                _q->X[i] = 0;
+        }
+    }
 
     // execute inverse DFT, store result in buffer 'x'
     FFT_EXECUTE(_q->fft);
@@ -344,65 +522,72 @@ void FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,
                                  TI * _x,
                                  TO * _y)
 {
-    unsigned int i;
-
-    // push samples into buffers
-    for (i=0; i<_q->num_channels; i++)
-        FIRPFBCH(_analyzer_push)(_q, _x[i]);
-
-    // execute analysis filters on the given input starting
-    // with filterbank at index zero
-    FIRPFBCH(_analyzer_run)(_q, 0, _y);
-}
-
-// 
-// internal methods
-//
-
-// push single sample into analysis filterbank, updating index
-// counter appropriately
-//  _q      :   filterbank channelizer object
-//  _x      :   input sample
-void FIRPFBCH(_analyzer_push)(FIRPFBCH() _q,
-                              TI _x)
-{
-    // push sample into filter
-    WINDOW(_push)(_q->w[_q->filter_index], _x);
-
-    // decrement filter index
-    _q->filter_index = (_q->filter_index + _q->num_channels - 1) % _q->num_channels;
+    FIRPFBCH(_analyzer_execute_block)(_q, _x, 1, _y);
 }
 
-// run filterbank analyzer dot products, DFT
-//  _q      :   filterbank channelizer object
-//  _k      :   filterbank alignment index
-//  _y      :   output array, [size: num_channels x 1]
-void FIRPFBCH(_analyzer_run)(FIRPFBCH() _q,
-                             unsigned int _k,
-                             TO * _y)
+// execute filterbank as analyzer on several frames of samples; the
+// frames are processed in blocks of up to FIRPFBCH_BLOCK_FRAMES so
+// that the coefficients stay in cache
+//  _q          :   filterbank channelizer object
+//  _x          :   input time series, [size: _num_frames*num_channels x 1]
+//  _num_frames :   number of output frames
+//  _y          :   channelized output, [size: _num_frames*num_channels x 1]
+void FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,
+                                       TI *         _x,
+                                       unsigned int _num_frames,
+                                       TO *         _y)
 {
-    unsigned int i;
-
-    // execute filter outputs, reversing order of output (not
-    // sure why this is necessary)
-    T * r;  // read pointer
-    unsigned int index;
-    for (i=0; i<_q->num_channels; i++) {
-        // compute appropriate index
-        index = (i+_k) % _q->num_channels;
+    unsigned int M = _q->num_channels;
+    unsigned int p = _q->p;
+    unsigned int n;     // number of frames in block
+    unsigned int f;     // frame index
+    unsigned int d;     // delay (frames)
+    unsigned int k;
+
+    for ( ; _num_frames > 0; _num_frames -= n) {
+        n = _num_frames < FIRPFBCH_BLOCK_FRAMES ? _num_frames : FIRPFBCH_BLOCK_FRAMES;
+
+        // append input frames to history
+        memmove(&_q->buf[(p-1)*M], _x, n*M*sizeof(TI));
+
+        for (f=0; f<n; f++) {
+            // run branch filters one delay at a time across all
+            // branches; buffer frame p-1+f-d is delayed by d frames
+            TO * X = _q->X;
+            memset(X, 0x00, M*sizeof(TO));
+            for (d=0; d<p; d++) {
+                FIRPFBCH(_branch_mac)(&_q->H[FIRPFBCH_H_STRIDE*d*M],
+                                      (float*) &_q->buf[(p-1+f-d)*M],
+                                      M,
+                                      (float*) X);
+            }
+
+            if (_q->mask == NULL) {
+                // execute DFT, store result in buffer 'x'
+                FFT_EXECUTE(_q->fft);
+
+                // move to output array
+                memmove(&_y[f*M], _q->x, M*sizeof(TO));
+                continue;
+            }
+
+            // active channels only; inactive channels are zero
+            memset(&_y[f*M], 0x00, M*sizeof(TO));
+            if (_q->tw == NULL) {
+                FFT_EXECUTE(_q->fft);
+                for (k=0; k<_q->num_active; k++)
+                    _y[f*M + _q->active[k]] = _q->x[_q->active[k]];
+            } else {
+                // evaluate active bins directly
+                for (k=0; k<_q->num_active; k++)
+                    dotprod_cccf_execute(_q->dft[k], X, &_y[f*M + _q->active[k]]);
+            }
+        }
 
-        // read buffer at specified index
-        WINDOW(_read)(_q->w[index], &r);
+        // retain last p-1 frames as history
+        memmove(_q->buf, &_q->buf[n*M], (p-1)*M*sizeof(TI));
 
-        // compute dot product
-        DOTPROD(_execute)(_q->dp[i], r, &_q->X[_q->num_channels-i-1]);
+        _x += n*M;
+        _y += n*M;
     }
-
-    // execute DFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->fft);
-
-    // move to output array
-    memmove(_y, _q->x, _q->num_channels*sizeof(TO));
 }
-
-
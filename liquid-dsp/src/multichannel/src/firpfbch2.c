@@ -29,6 +29,13 @@
 #include <string.h>
 #include <math.h>
 
+// maximum number of frames processed at a time by the analyzer
+#define FIRPFBCH2_BLOCK_FRAMES  (16)
+
+// the analyzer branch filters use FIRPFBCH(_branch_mac)() and the
+// polyphase matrix layout (FIRPFBCH_H_STRIDE) from firpfbch.c, which
+// is included ahead of this file
+
 // firpfbch2 object structure definition
 struct FIRPFBCH2(_s) {
     int type;           // synthesis/analysis
@@ -39,7 +46,7 @@ struct FIRPFBCH2(_s) {
     // filter
     unsigned int h_len; // prototype filter length: 2*M*m
     
-    // create separate bank of dotprod and window objects
+    // synthesizer: separate bank of dotprod objects
     DOTPROD() * dp;     // dot product object array
 
     // inverse FFT plan
@@ -47,11 +54,25 @@ struct FIRPFBCH2(_s) {
     TO * X;             // IFFT input array  [size: M x 1]
     TO * x;             // IFFT output array [size: M x 1]
 
-    // common data structures shared between analysis and
-    // synthesis algorithms
+    // synthesizer: window buffers
     WINDOW() * w0;      // window buffer object array
-    WINDOW() * w1;      // window buffer object array (synthesizer only)
+    WINDOW() * w1;      // window buffer object array
     int flag;           // flag indicating filter/buffer alignment
+
+    // analyzer: polyphase filters stored as one contiguous matrix
+    // whose row d holds the coefficient for delay d (in units of M
+    // samples) of every branch, and a single input history shared by
+    // all branches
+    float * H;          // polyphase matrix [size: 2m x M x FIRPFBCH_H_STRIDE]
+    TI * buf;           // input history [size: 2*M*m - M/2 + B*M/2]
+
+    // active channels (all unless a mask is set); when only a few
+    // are active their IFFT bins are evaluated directly
+    unsigned char * mask;       // active channel mask, NULL if all active
+    unsigned int num_active;    // number of active channels
+    unsigned int * active;      // active channel indices [size: num_active x 1]
+    TO * tw;                    // analyzer twiddle rows, NULL for full transform [size: num_active x M]
+    dotprod_cccf * dft;         // dot product with each twiddle row
 };
 
 // create firpfbch2 object
@@ -89,20 +110,51 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
     q->h_len    = 2*q->M*q->m;  // prototype filter length
     q->M2       = q->M / 2;     // number of channels / 2
 
-    // generate bank of sub-samped filters
-    q->dp = (DOTPROD()*) malloc((q->M)*sizeof(DOTPROD()));
     unsigned int i;
     unsigned int n;
     unsigned int h_sub_len = 2 * q->m;
-    TC h_sub[h_sub_len];
-    for (i=0; i<q->M; i++) {
-        // sub-sample prototype filter, loading coefficients
-        // in reverse order
-        for (n=0; n<h_sub_len; n++)
-            h_sub[h_sub_len-n-1] = _h[i + n*(q->M)];
-
-        // create dotprod object
-        q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
+    if (q->type == LIQUID_SYNTHESIZER) {
+        // generate bank of sub-samped filters
+        q->dp = (DOTPROD()*) malloc((q->M)*sizeof(DOTPROD()));
+        TC h_sub[h_sub_len];
+        for (i=0; i<q->M; i++) {
+            // sub-sample prototype filter, loading coefficients
+            // in reverse order
+            for (n=0; n<h_sub_len; n++)
+                h_sub[h_sub_len-n-1] = _h[i + n*(q->M)];
+
+            // create dotprod object
+            q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
+        }
+
+        // create buffer objects
+        q->w0 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
+        q->w1 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
+        for (i=0; i<q->M; i++) {
+            q->w0[i] = WINDOW(_create)(h_sub_len);
+            q->w1[i] = WINDOW(_create)(h_sub_len);
+        }
+    } else {
+        // polyphase matrix: branch i, delay n is h[i + n*M] and is
+        // applied to the sample i + n*M older than the newest; rows
+        // are stored in reverse branch order so that they line up
+        // with the input history
+        q->H = (float*) liquid_malloc_aligned(FIRPFBCH_H_STRIDE*q->h_len*sizeof(float), FIRPFBCH_ALIGN);
+        for (n=0; n<h_sub_len; n++) {
+            for (i=0; i<q->M; i++) {
+                TC h = _h[n*q->M + q->M - i - 1];
+                float * hp = &q->H[FIRPFBCH_H_STRIDE*(n*q->M + i)];
+                hp[0] = crealf(h);
+                hp[1] = crealf(h);
+#if TC_COMPLEX
+                hp[2] = -cimagf(h);
+                hp[3] =  cimagf(h);
+#endif
+            }
+        }
+
+        // input history followed by room for a block
+        q->buf = (TI*) liquid_malloc_aligned((q->h_len - q->M2 + FIRPFBCH2_BLOCK_FRAMES*q->M2)*sizeof(TI), FIRPFBCH_ALIGN);
     }
 
     // create FFT plan (inverse transform)
@@ -111,13 +163,12 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
     q->x = (T*) malloc((q->M)*sizeof(T));   // IFFT output
     q->ifft = FFT_CREATE_PLAN(q->M, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
 
-    // create buffer objects
-    q->w0 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
-    q->w1 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
-    for (i=0; i<q->M; i++) {
-        q->w0[i] = WINDOW(_create)(h_sub_len);
-        q->w1[i] = WINDOW(_create)(h_sub_len);
-    }
+    // all channels active
+    q->mask       = NULL;
+    q->num_active = q->M;
+    q->active     = NULL;
+    q->tw         = NULL;
+    q->dft        = NULL;
 
     // reset filterbank object and return
     FIRPFBCH2(_reset)(q);
@@ -184,23 +235,32 @@ void FIRPFBCH2(_destroy)(FIRPFBCH2() _q)
 {
     unsigned int i;
 
-    // free dotprod objects
-    for (i=0; i<_q->M; i++)
-        DOTPROD(_destroy)(_q->dp[i]);
-    free(_q->dp);
+    if (_q->type == LIQUID_SYNTHESIZER) {
+        // free dotprod objects
+        for (i=0; i<_q->M; i++)
+            DOTPROD(_destroy)(_q->dp[i]);
+        free(_q->dp);
+
+        // free window objects (buffers)
+        for (i=0; i<_q->M; i++) {
+            WINDOW(_destroy)(_q->w0[i]);
+            WINDOW(_destroy)(_q->w1[i]);
+        }
+        free(_q->w0);
+        free(_q->w1);
+    } else {
+        // free polyphase matrices, input history
+        liquid_free_aligned(_q->H);
+        liquid_free_aligned(_q->buf);
+    }
+
+    // free channel mask and pruned transform
+    FIRPFBCH2(_set_channel_mask)(_q, NULL);
 
     // free transform object and arrays
     FFT_DESTROY_PLAN(_q->ifft);
     free(_q->X);
     free(_q->x);
-    
-    // free window objects (buffers)
-    for (i=0; i<_q->M; i++) {
-        WINDOW(_destroy)(_q->w0[i]);
-        WINDOW(_destroy)(_q->w1[i]);
-    }
-    free(_q->w0);
-    free(_q->w1);
 
     // free main object memory
     free(_q);
@@ -211,10 +271,16 @@ void FIRPFBCH2(_reset)(FIRPFBCH2() _q)
 {
     unsigned int i;
 
-    // clear window buffers
-    for (i=0; i<_q->M; i++) {
-        WINDOW(_clear)(_q->w0[i]);
-        WINDOW(_clear)(_q->w1[i]);
+    if (_q->type == LIQUID_SYNTHESIZER) {
+        // clear window buffers
+        for (i=0; i<_q->M; i++) {
+            WINDOW(_clear)(_q->w0[i]);
+            WINDOW(_clear)(_q->w1[i]);
+        }
+    } else {
+        // clear input history
+        for (i=0; i<_q->h_len - _q->M2; i++)
+            _q->buf[i] = 0;
     }
 
     // reset filter/buffer alignment flag
@@ -231,51 +297,165 @@ void FIRPFBCH2(_print)(FIRPFBCH2() _q)
 
     // TODO: print filter coefficients...
     unsigned int i;
-    for (i=0; i<_q->M; i++)
-        DOTPROD(_print)(_q->dp[i]);
+    if (_q->type == LIQUID_SYNTHESIZER) {
+        for (i=0; i<_q->M; i++)
+            DOTPROD(_print)(_q->dp[i]);
+    }
 }
 
-// execute filterbank channelizer (analyzer)
-//  _x      :   channelizer input,  [size: M/2 x 1]
-//  _y      :   channelizer output, [size: M   x 1]
-void FIRPFBCH2(_execute_analyzer)(FIRPFBCH2() _q,
-                                  TI *        _x,
-                                  TO *        _y)
+// set active channels; only channels with a non-zero mask entry are
+// computed: the analyzer outputs zero on inactive channels and the
+// synthesizer ignores their inputs. When few channels of an analyzer
+// are active, their IFFT bins are evaluated directly instead of running
+// the full transform; the branch filters are always run in full as
+// every output bin depends on all of them.
+//  _q      :   filterbank channelizer object
+//  _mask   :   active channel mask [size: M x 1], NULL to activate
+//              all channels
+void FIRPFBCH2(_set_channel_mask)(FIRPFBCH2()     _q,
+                                  unsigned char * _mask)
 {
+    unsigned int M = _q->M;
     unsigned int i;
+    unsigned int k;
 
-    // load buffers in blocks of num_channels/2 starting
-    // in the middle of the filter bank and moving in the
-    // negative direction
-    unsigned int base_index = _q->flag ? _q->M : _q->M2;
-    for (i=0; i<_q->M2; i++) {
-        // push sample into buffer at filter index
-        WINDOW(_push)(_q->w0[base_index-i-1], _x[i]);
+    // free existing mask and pruned transform
+    if (_q->dft != NULL) {
+        for (k=0; k<_q->num_active; k++)
+            dotprod_cccf_destroy(_q->dft[k]);
+        free(_q->dft);
     }
+    free(_q->mask);
+    free(_q->active);
+    free(_q->tw);
+    _q->mask       = NULL;
+    _q->num_active = M;
+    _q->active     = NULL;
+    _q->tw         = NULL;
+    _q->dft        = NULL;
+
+    if (_mask == NULL)
+        return;
 
-    // execute filter outputs
-    unsigned int offset = _q->flag ? _q->M2 : 0;
-    TI * r;      // buffer read pointer
-    for (i=0; i<_q->M; i++) {
-        // compute buffer index
-        unsigned int buffer_index  = (offset+i)%(_q->M);
+    // copy mask and list active channels
+    _q->mask   = (unsigned char*) malloc(M*sizeof(unsigned char));
+    _q->active = (unsigned int*)  malloc(M*sizeof(unsigned int));
+    _q->num_active = 0;
+    for (i=0; i<M; i++) {
+        _q->mask[i] = _mask[i] ? 1 : 0;
+        if (_q->mask[i])
+            _q->active[_q->num_active++] = i;
+    }
 
-        // read buffer at index
-        WINDOW(_read)(_q->w0[buffer_index], &r);
+    // analyzer: evaluate bins directly only if it is cheaper than
+    // the full transform, i.e. a length-M dot product (with some
+    // fixed overhead) per bin vs. M log2(M)
+    if (_q->type != LIQUID_ANALYZER || _q->num_active == 0 ||
+        _q->num_active*(M + 128) >= M*liquid_nextpow2(M))
+        return;
 
-        // run dot product storing result in IFFT input buffer
-        DOTPROD(_execute)(_q->dp[i], r, &_q->X[buffer_index]);
+    // twiddle rows: exp(j*2*pi*i*k/M)/M for active channel k, with
+    // the output scaling folded in
+    _q->tw  = (TO*) malloc(_q->num_active*M*sizeof(TO));
+    _q->dft = (dotprod_cccf*) malloc(_q->num_active*sizeof(dotprod_cccf));
+    for (k=0; k<_q->num_active; k++) {
+        for (i=0; i<M; i++) {
+            float theta = 2*M_PI*(float)((i*_q->active[k]) % M) / (float)M;
+            _q->tw[k*M + i] = cexpf(_Complex_I*theta) / (float)M;
+        }
+        _q->dft[k] = dotprod_cccf_create(&_q->tw[k*M], M);
     }
+}
 
-    // execute IFFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->ifft);
-
-    // scale result by 1/num_channels (C transform)
-    for (i=0; i<_q->M; i++)
-        _y[i] = _q->x[i] / (float)(_q->M);
+// execute filterbank channelizer (analyzer) on several frames; the
+// frames are processed in blocks of up to FIRPFBCH2_BLOCK_FRAMES so
+// that the coefficients stay in cache
+//  _x          :   channelizer input,  [size: _num_frames*M/2 x 1]
+//  _num_frames :   number of frames
+//  _y          :   channelizer output, [size: _num_frames*M   x 1]
+void FIRPFBCH2(_execute_analyzer_block)(FIRPFBCH2()  _q,
+                                        TI *         _x,
+                                        unsigned int _num_frames,
+                                        TO *         _y)
+{
+    unsigned int M  = _q->M;
+    unsigned int M2 = _q->M2;
+    unsigned int L  = _q->h_len - M2;   // length of input history
+    unsigned int P  = 2*_q->m;          // number of delays
+    unsigned int n;     // number of frames in block
+    unsigned int f;     // frame index
+    unsigned int d;     // delay (units of M samples)
+    unsigned int i;
+    unsigned int k;
+
+    for ( ; _num_frames > 0; _num_frames -= n) {
+        n = _num_frames < FIRPFBCH2_BLOCK_FRAMES ? _num_frames : FIRPFBCH2_BLOCK_FRAMES;
+
+        // append input samples to history
+        memmove(&_q->buf[L], _x, n*M2*sizeof(TI));
+
+        for (f=0; f<n; f++) {
+            // run branch filters one delay at a time across all
+            // branches; the M samples ending with the newest of
+            // this frame start at L + (f+1)*M/2 - M, and are delayed
+            // by d*M for row d
+            TO * v = _q->x;     // filter outputs, reverse branch order
+            memset(v, 0x00, M*sizeof(TO));
+            for (d=0; d<P; d++) {
+                FIRPFBCH(_branch_mac)(&_q->H[FIRPFBCH_H_STRIDE*d*M],
+                                      (float*) &_q->buf[L + (f+1)*M2 - M - d*M],
+                                      M,
+                                      (float*) v);
+            }
+
+            // store in IFFT input buffer; branch i feeds buffer
+            // index i+M/2 (modulo M) on alternating frames
+            unsigned int offset = _q->flag ? M2 : 0;
+            for (i=0; i<M; i++)
+                _q->X[(i+offset)%M] = v[M-i-1];
+
+            // update flag
+            _q->flag = 1 - _q->flag;
+
+            if (_q->mask == NULL) {
+                // execute IFFT, store result in buffer 'x'
+                FFT_EXECUTE(_q->ifft);
+
+                // scale result by 1/num_channels (C transform)
+                for (i=0; i<M; i++)
+                    _y[f*M + i] = _q->x[i] / (float)(M);
+                continue;
+            }
+
+            // active channels only; inactive channels are zero
+            memset(&_y[f*M], 0x00, M*sizeof(TO));
+            if (_q->tw == NULL) {
+                FFT_EXECUTE(_q->ifft);
+                for (k=0; k<_q->num_active; k++)
+                    _y[f*M + _q->active[k]] = _q->x[_q->active[k]] / (float)(M);
+            } else {
+                // evaluate active bins directly (scaling included)
+                for (k=0; k<_q->num_active; k++)
+                    dotprod_cccf_execute(_q->dft[k], _q->X, &_y[f*M + _q->active[k]]);
+            }
+        }
+
+        // retain input history
+        memmove(_q->buf, &_q->buf[n*M2], L*sizeof(TI));
+
+        _x += n*M2;
+        _y += n*M;
+    }
+}
 
-    // update flag
-    _q->flag = 1 - _q->flag;
+// execute filterbank channelizer (analyzer)
+//  _x      :   channelizer input,  [size: M/2 x 1]
+//  _y      :   channelizer output, [size: M   x 1]
+void FIRPFBCH2(_execute_analyzer)(FIRPFBCH2() _q,
+                                  TI *        _x,
+                                  TO *        _y)
+{
+    FIRPFBCH2(_execute_analyzer_block)(_q, _x, 1, _y);
 }
 
 // execute filterbank channelizer (synthesizer)
@@ -290,6 +470,14 @@ void FIRPFBCH2(_execute_synthesizer)(FIRPFBCH2() _q,
     // copy input array to internal IFFT input buffer
     memmove(_q->X, _x, _q->M * sizeof(TI));
 
+    // ignore inactive channels
+    if (_q->mask != NULL) {
+        for (i=0; i<_q->M; i++) {
+            if (!_q->mask[i])
+                _q->X[i] = 0;
+        }
+    }
+
     // execute IFFT, store result in buffer 'x'
     FFT_EXECUTE(_q->ifft);
 
@@ -353,3 +541,29 @@ void FIRPFBCH2(_execute)(FIRPFBCH2() _q,
     }
 }
 
+// execute filterbank channelizer on several frames
+// LIQUID_ANALYZER:     input: _num_frames*M/2, output: _num_frames*M
+// LIQUID_SYNTHESIZER:  input: _num_frames*M,   output: _num_frames*M/2
+//  _x          :   channelizer input
+//  _num_frames :   number of frames
+//  _y          :   channelizer output
+void FIRPFBCH2(_execute_block)(FIRPFBCH2()  _q,
+                               TI *         _x,
+                               unsigned int _num_frames,
+                               TO *         _y)
+{
+    unsigned int i;
+    switch (_q->type) {
+    case LIQUID_ANALYZER:
+        FIRPFBCH2(_execute_analyzer_block)(_q, _x, _num_frames, _y);
+        return;
+    case LIQUID_SYNTHESIZER:
+        for (i=0; i<_num_frames; i++)
+            FIRPFBCH2(_execute_synthesizer)(_q, &_x[i*_q->M], &_y[i*_q->M2]);
+        return;
+    default:
+        fprintf(stderr,"error: firpfbch2_%s_execute_block(), invalid type\n", EXTENSION_FULL);
+        exit(1);
+    }
+}
+
@@ -61,6 +61,7 @@ struct ofdmframesync_s {
     float complex * X;      // frequency-domain buffer
     float complex * x;      // time-domain buffer
     windowcf input_buffer;  // input sequence buffer
+    float complex * buffer; // block mixing buffer
 
     // PLCP sequences
     float complex * S0;     // short sequence (freq)
@@ -223,6 +224,9 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     for (i=0; i<q->M; i++)
         q->B[i] = liquid_cexpjf(i*phi);
 
+    // block mixing buffer (longest span between received symbols)
+    q->buffer = (float complex*) malloc((q->M + q->cp_len + q->backoff)*sizeof(float complex));
+
     // set callback data
     q->callback = _callback;
     q->userdata = _userdata;
@@ -232,7 +236,7 @@ ofdmframesync ofdmframesync_create(unsigned int           _M,
     //
 
     // numerically-controlled oscillator
-    q->nco_rx = nco_crcf_create(LIQUID_NCO);
+    q->nco_rx = nco_crcf_create(LIQUID_NCO_FIXED);
 
     // set pilot sequence
     q->ms_pilot = msequence_create_default(8);
@@ -285,6 +289,7 @@ void ofdmframesync_destroy(ofdmframesync _q)
 
     // free transform object
     windowcf_destroy(_q->input_buffer);
+    free(_q->buffer);
     free(_q->X);
     free(_q->x);
     FFT_DESTROY_PLAN(_q->fft);
@@ -351,47 +356,19 @@ void ofdmframesync_execute(ofdmframesync _q,
                            float complex * _x,
                            unsigned int _n)
 {
-    unsigned int i;
-    float complex x;
-    for (i=0; i<_n; i++) {
-        x = _x[i];
-
-        // correct for carrier frequency offset
-        if (_q->state != OFDMFRAMESYNC_STATE_SEEKPLCP) {
-            nco_crcf_mix_down(_q->nco_rx, x, &x);
-            nco_crcf_step(_q->nco_rx);
-        }
-
-        // save input sample to buffer
-        windowcf_push(_q->input_buffer,x);
-
+    unsigned int i=0;
+    while (i < _n) {
+        // receive payload symbols in blocks; seek PLCP (and record
+        // debugging buffers) one sample at a time
+        int rx_block = (_q->state == OFDMFRAMESYNC_STATE_RXSYMBOLS);
 #if DEBUG_OFDMFRAMESYNC
-        if (_q->debug_enabled) {
-            windowcf_push(_q->debug_x, x);
-            windowf_push(_q->debug_rssi, crealf(x)*crealf(x) + cimagf(x)*cimagf(x));
-        }
+        rx_block = rx_block && !_q->debug_enabled;
 #endif
-
-        switch (_q->state) {
-        case OFDMFRAMESYNC_STATE_SEEKPLCP:
-            ofdmframesync_execute_seekplcp(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_PLCPSHORT0:
-            ofdmframesync_execute_S0a(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_PLCPSHORT1:
-            ofdmframesync_execute_S0b(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_PLCPLONG:
-            ofdmframesync_execute_S1(_q);
-            break;
-        case OFDMFRAMESYNC_STATE_RXSYMBOLS:
-            ofdmframesync_execute_rxsymbols(_q);
-            break;
-        default:;
-        }
-
-    } // for (i=0; i<_n; i++)
+        if (rx_block)
+            i += ofdmframesync_execute_rxsymbols_block(_q, &_x[i], _n - i);
+        else
+            ofdmframesync_execute_sample(_q, _x[i++]);
+    }
 } // ofdmframesync_execute()
 
 // get receiver RSSI
@@ -411,6 +388,48 @@ float ofdmframesync_get_cfo(ofdmframesync _q)
 // internal methods
 //
 
+// execute synchronizer on a single sample
+void ofdmframesync_execute_sample(ofdmframesync _q,
+                                  float complex _x)
+{
+    float complex x = _x;
+
+    // correct for carrier frequency offset
+    if (_q->state != OFDMFRAMESYNC_STATE_SEEKPLCP) {
+        nco_crcf_mix_down(_q->nco_rx, x, &x);
+        nco_crcf_step(_q->nco_rx);
+    }
+
+    // save input sample to buffer
+    windowcf_push(_q->input_buffer,x);
+
+#if DEBUG_OFDMFRAMESYNC
+    if (_q->debug_enabled) {
+        windowcf_push(_q->debug_x, x);
+        windowf_push(_q->debug_rssi, crealf(x)*crealf(x) + cimagf(x)*cimagf(x));
+    }
+#endif
+
+    switch (_q->state) {
+    case OFDMFRAMESYNC_STATE_SEEKPLCP:
+        ofdmframesync_execute_seekplcp(_q);
+        break;
+    case OFDMFRAMESYNC_STATE_PLCPSHORT0:
+        ofdmframesync_execute_S0a(_q);
+        break;
+    case OFDMFRAMESYNC_STATE_PLCPSHORT1:
+        ofdmframesync_execute_S0b(_q);
+        break;
+    case OFDMFRAMESYNC_STATE_PLCPLONG:
+        ofdmframesync_execute_S1(_q);
+        break;
+    case OFDMFRAMESYNC_STATE_RXSYMBOLS:
+        ofdmframesync_execute_rxsymbols(_q);
+        break;
+    default:;
+    }
+}
+
 // frame detection
 void ofdmframesync_execute_seekplcp(ofdmframesync _q)
 {
@@ -714,37 +733,94 @@ void ofdmframesync_execute_rxsymbols(ofdmframesync _q)
     _q->timer--;
 
     if (_q->timer == 0) {
+        // copy symbol from input buffer (skipping cyclic prefix)
+        float complex * rc;
+        windowcf_read(_q->input_buffer, &rc);
+        memmove(_q->x, &rc[_q->cp_len-_q->backoff], (_q->M)*sizeof(float complex));
+
+        // run fft, recover symbol, and invoke callback
+        ofdmframesync_rxsymbol_fft(_q);
+    }
+}
+
+// receive payload symbols from block of samples, returning the number
+// of samples consumed; processing stops after each received symbol so
+// that the state and carrier offset correction can be updated
+//  _q      :   ofdmframesync object
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of input samples
+unsigned int ofdmframesync_execute_rxsymbols_block(ofdmframesync   _q,
+                                                   float complex * _x,
+                                                   unsigned int    _n)
+{
+    // number of samples until next symbol is complete
+    unsigned int t = _q->timer;
+
+    if (_n < t) {
+        // symbol incomplete: correct carrier offset and buffer samples
+        nco_crcf_mix_block_down(_q->nco_rx, _x, _q->buffer, _n);
+        windowcf_write(_q->input_buffer, _q->buffer, _n);
+        _q->timer -= _n;
+        return _n;
+    }
+
+    // end of transform input (exclusive) relative to start of block
+    unsigned int n1 = t - _q->backoff;
+
+    if (n1 >= _q->M) {
+        // transform input is entirely within block: mix down directly
+        // into transform buffer, discarding cyclic prefix and backoff
+        // samples; the input buffer is not needed again until it has
+        // been refilled with the next symbol
+        nco_crcf_mix_block_down(_q->nco_rx, _x,            _q->buffer, n1 - _q->M);
+        nco_crcf_mix_block_down(_q->nco_rx, &_x[n1-_q->M], _q->x,      _q->M);
+        nco_crcf_mix_block_down(_q->nco_rx, &_x[n1],       _q->buffer, _q->backoff);
+    } else {
+        // symbol started in previous block: complete input buffer
+        nco_crcf_mix_block_down(_q->nco_rx, _x, _q->buffer, t);
+        windowcf_write(_q->input_buffer, _q->buffer, t);
 
-        // run fft
         float complex * rc;
         windowcf_read(_q->input_buffer, &rc);
         memmove(_q->x, &rc[_q->cp_len-_q->backoff], (_q->M)*sizeof(float complex));
-        FFT_EXECUTE(_q->fft);
+    }
 
-        // recover symbol in internal _q->X buffer
-        ofdmframesync_rxsymbol(_q);
+    // run fft, recover symbol, and invoke callback
+    ofdmframesync_rxsymbol_fft(_q);
+    return t;
+}
+
+// run transform on time-domain buffer, recover symbol, and invoke
+// callback
+void ofdmframesync_rxsymbol_fft(ofdmframesync _q)
+{
+    // run fft
+    FFT_EXECUTE(_q->fft);
+
+    // recover symbol in internal _q->X buffer
+    ofdmframesync_rxsymbol(_q);
 
 #if DEBUG_OFDMFRAMESYNC
-        if (_q->debug_enabled) {
-            unsigned int i;
-            for (i=0; i<_q->M; i++) {
-                if (_q->p[i] == OFDMFRAME_SCTYPE_DATA)
-                    windowcf_push(_q->debug_framesyms, _q->X[i]);
-            }
+    if (_q->debug_enabled) {
+        unsigned int i;
+        for (i=0; i<_q->M; i++) {
+            if (_q->p[i] == OFDMFRAME_SCTYPE_DATA)
+                windowcf_push(_q->debug_framesyms, _q->X[i]);
         }
+    }
 #endif
-        // invoke callback
-        if (_q->callback != NULL) {
-            int retval = _q->callback(_q->X, _q->p, _q->M, _q->userdata);
 
-            if (retval != 0)
-                ofdmframesync_reset(_q);
-        }
+    // reset timer (before invoking callback which might reset the
+    // synchronizer object)
+    _q->timer = _q->M + _q->cp_len;
 
-        // reset timer
-        _q->timer = _q->M + _q->cp_len;
-    }
+    // invoke callback
+    if (_q->callback != NULL) {
+        int retval = _q->callback(_q->X, _q->p, _q->M, _q->userdata);
 
+        if (retval != 0)
+            ofdmframesync_reset(_q);
+    }
 }
 
 // compute S0 metrics
@@ -94,3 +94,107 @@ void autotest_firpfbch2_crcf_n16()   { firpfbch2_crcf_runtest(  16, 5, 60.0f); }
 void autotest_firpfbch2_crcf_n32()   { firpfbch2_crcf_runtest(  32, 5, 60.0f); }
 void autotest_firpfbch2_crcf_n64()   { firpfbch2_crcf_runtest(  64, 5, 60.0f); }
 
+
+// block execution matches frame-by-frame execution
+void autotest_firpfbch2_crcf_block()
+{
+    float tol = 1e-6f;
+    unsigned int M = 16;            // number of channels
+    unsigned int m = 3;             // filter semi-length
+    unsigned int num_frames = 41;   // number of frames (spans several blocks)
+
+    unsigned int i;
+    float complex x[num_frames*M/2];
+    for (i=0; i<num_frames*M/2; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // analysis: frame by frame, then in blocks of 1, 23, and 17 frames
+    firpfbch2_crcf qa0 = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, M, m, 60.0f);
+    firpfbch2_crcf qa1 = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, M, m, 60.0f);
+    float complex Y0[num_frames*M];
+    float complex Y1[num_frames*M];
+    for (i=0; i<num_frames; i++)
+        firpfbch2_crcf_execute(qa0, &x[i*M/2], &Y0[i*M]);
+    firpfbch2_crcf_execute_block(qa1, x, 1, Y1);
+    firpfbch2_crcf_execute_block(qa1, &x[M/2],  23, &Y1[M]);
+    firpfbch2_crcf_execute_block(qa1, &x[12*M], 17, &Y1[24*M]);
+    for (i=0; i<num_frames*M; i++)
+        CONTEND_DELTA( cabsf(Y1[i] - Y0[i]), 0.0f, tol );
+
+    // synthesis: frame by frame, then as a single block
+    firpfbch2_crcf qs0 = firpfbch2_crcf_create_kaiser(LIQUID_SYNTHESIZER, M, m, 60.0f);
+    firpfbch2_crcf qs1 = firpfbch2_crcf_create_kaiser(LIQUID_SYNTHESIZER, M, m, 60.0f);
+    float complex y0[num_frames*M/2];
+    float complex y1[num_frames*M/2];
+    for (i=0; i<num_frames; i++)
+        firpfbch2_crcf_execute(qs0, &Y0[i*M], &y0[i*M/2]);
+    firpfbch2_crcf_execute_block(qs1, Y0, num_frames, y1);
+    for (i=0; i<num_frames*M/2; i++)
+        CONTEND_DELTA( cabsf(y1[i] - y0[i]), 0.0f, tol );
+
+    // destroy objects
+    firpfbch2_crcf_destroy(qa0);
+    firpfbch2_crcf_destroy(qa1);
+    firpfbch2_crcf_destroy(qs0);
+    firpfbch2_crcf_destroy(qs1);
+}
+
+// helper function: active channel mask matches the full channelizer
+// on active channels (analyzer) or with inactive inputs set to zero
+// (synthesizer)
+void firpfbch2_crcf_mask_runtest(unsigned int _num_active)
+{
+    float tol = 1e-4f;
+    unsigned int M = 256;           // number of channels
+    unsigned int m = 3;             // filter semi-length
+    unsigned int num_frames = 20;   // number of frames
+
+    unsigned int i;
+    unsigned char mask[M];
+    for (i=0; i<M; i++)
+        mask[i] = (i*_num_active) % M < _num_active;
+
+    float complex x[num_frames*M/2];
+    for (i=0; i<num_frames*M/2; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // analysis
+    firpfbch2_crcf qa0 = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, M, m, 60.0f);
+    firpfbch2_crcf qa1 = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, M, m, 60.0f);
+    firpfbch2_crcf_set_channel_mask(qa1, mask);
+    float complex Y0[num_frames*M];
+    float complex Y1[num_frames*M];
+    firpfbch2_crcf_execute_block(qa0, x, num_frames, Y0);
+    firpfbch2_crcf_execute_block(qa1, x, num_frames, Y1);
+    for (i=0; i<num_frames*M; i++) {
+        if (mask[i % M]) {
+            CONTEND_DELTA( crealf(Y1[i]), crealf(Y0[i]), tol );
+            CONTEND_DELTA( cimagf(Y1[i]), cimagf(Y0[i]), tol );
+        } else {
+            CONTEND_EQUALITY( cabsf(Y1[i]), 0.0f );
+        }
+    }
+
+    // synthesis: masked synthesizer sees all analyzer outputs
+    firpfbch2_crcf qs0 = firpfbch2_crcf_create_kaiser(LIQUID_SYNTHESIZER, M, m, 60.0f);
+    firpfbch2_crcf qs1 = firpfbch2_crcf_create_kaiser(LIQUID_SYNTHESIZER, M, m, 60.0f);
+    firpfbch2_crcf_set_channel_mask(qs1, mask);
+    float complex y0[num_frames*M/2];
+    float complex y1[num_frames*M/2];
+    firpfbch2_crcf_execute_block(qs0, Y1, num_frames, y0);
+    firpfbch2_crcf_execute_block(qs1, Y0, num_frames, y1);
+    for (i=0; i<num_frames*M/2; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), tol );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), tol );
+    }
+
+    // destroy objects
+    firpfbch2_crcf_destroy(qa0);
+    firpfbch2_crcf_destroy(qa1);
+    firpfbch2_crcf_destroy(qs0);
+    firpfbch2_crcf_destroy(qs1);
+}
+
+// direct evaluation of few active channels, full transform otherwise
+void autotest_firpfbch2_crcf_mask_n3()  { firpfbch2_crcf_mask_runtest( 3); }
+void autotest_firpfbch2_crcf_mask_n40() { firpfbch2_crcf_mask_runtest(40); }
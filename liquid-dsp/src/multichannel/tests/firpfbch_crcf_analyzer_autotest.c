@@ -147,3 +147,102 @@ void autotest_firpfbch_crcf_analysis()
 }
 
 
+
+//
+// AUTOTEST: block execution matches frame-by-frame execution
+//
+void autotest_firpfbch_crcf_analysis_block()
+{
+    float tol = 1e-6f;              // error tolerance
+    unsigned int num_channels=16;   // number of channels
+    unsigned int m=3;               // filter delay (symbols)
+    unsigned int num_frames=41;     // number of frames (spans several blocks)
+
+    unsigned int i;
+    unsigned int num_samples = num_channels * num_frames;
+
+    // create filterbank objects
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, num_channels, m, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, num_channels, m, 60.0f);
+
+    // generate input
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run frame by frame
+    float complex Y0[num_samples];
+    for (i=0; i<num_frames; i++)
+        firpfbch_crcf_analyzer_execute(q0, &x[i*num_channels], &Y0[i*num_channels]);
+
+    // run in blocks of 1, 23, and 17 frames
+    float complex Y1[num_samples];
+    firpfbch_crcf_analyzer_execute_block(q1, x, 1, Y1);
+    firpfbch_crcf_analyzer_execute_block(q1, &x[num_channels], 23, &Y1[num_channels]);
+    firpfbch_crcf_analyzer_execute_block(q1, &x[24*num_channels], 17, &Y1[24*num_channels]);
+
+    // compare
+    for (i=0; i<num_samples; i++)
+        CONTEND_DELTA( cabsf(Y1[i] - Y0[i]), 0.0f, tol );
+
+    // destroy objects
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+}
+
+// helper function: analyzer with active channel mask matches the
+// full analyzer on active channels and is zero elsewhere
+void firpfbch_crcf_analysis_mask_runtest(unsigned int _num_active)
+{
+    float tol = 1e-4f;              // error tolerance
+    unsigned int num_channels=256;  // number of channels
+    unsigned int m=3;               // filter delay (symbols)
+    unsigned int num_frames=20;     // number of frames
+
+    unsigned int i;
+    unsigned int num_samples = num_channels * num_frames;
+
+    // create filterbank objects; spread active channels across band
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, num_channels, m, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(LIQUID_ANALYZER, num_channels, m, 60.0f);
+    unsigned char mask[num_channels];
+    for (i=0; i<num_channels; i++)
+        mask[i] = (i*_num_active) % num_channels < _num_active;
+    firpfbch_crcf_set_channel_mask(q1, mask);
+
+    // generate input
+    float complex x[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run analyzers
+    float complex Y0[num_samples];
+    float complex Y1[num_samples];
+    firpfbch_crcf_analyzer_execute_block(q0, x, num_frames, Y0);
+    firpfbch_crcf_analyzer_execute_block(q1, x, num_frames, Y1);
+
+    // compare
+    for (i=0; i<num_samples; i++) {
+        if (mask[i % num_channels]) {
+            CONTEND_DELTA( crealf(Y1[i]), crealf(Y0[i]), tol );
+            CONTEND_DELTA( cimagf(Y1[i]), cimagf(Y0[i]), tol );
+        } else {
+            CONTEND_EQUALITY( cabsf(Y1[i]), 0.0f );
+        }
+    }
+
+    // clear mask; should match full analyzer again
+    firpfbch_crcf_set_channel_mask(q1, NULL);
+    firpfbch_crcf_analyzer_execute_block(q0, x, num_frames, Y0);
+    firpfbch_crcf_analyzer_execute_block(q1, x, num_frames, Y1);
+    for (i=0; i<num_samples; i++)
+        CONTEND_DELTA( cabsf(Y1[i] - Y0[i]), 0.0f, tol );
+
+    // destroy objects
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+}
+
+// direct evaluation of few active channels, full transform otherwise
+void autotest_firpfbch_crcf_analysis_mask_n3()  { firpfbch_crcf_analysis_mask_runtest( 3); }
+void autotest_firpfbch_crcf_analysis_mask_n40() { firpfbch_crcf_analysis_mask_runtest(40); }
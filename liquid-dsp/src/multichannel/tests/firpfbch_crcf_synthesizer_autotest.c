@@ -140,3 +140,54 @@ void autotest_firpfbch_crcf_synthesis()
     }
 }
 
+
+// helper function: synthesizer with active channel mask matches the
+// full synthesizer with inactive channel inputs set to zero
+void firpfbch_crcf_synthesis_mask_runtest(unsigned int _num_active)
+{
+    float tol = 1e-4f;              // error tolerance
+    unsigned int num_channels=256;  // number of channels
+    unsigned int m=3;               // filter delay (symbols)
+    unsigned int num_symbols=20;    // number of symbols
+
+    unsigned int i;
+    unsigned int j;
+    unsigned int num_samples = num_channels * num_symbols;
+
+    // create filterbank objects; spread active channels across band
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(LIQUID_SYNTHESIZER, num_channels, m, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(LIQUID_SYNTHESIZER, num_channels, m, 60.0f);
+    unsigned char mask[num_channels];
+    for (i=0; i<num_channels; i++)
+        mask[i] = (i*_num_active) % num_channels < _num_active;
+    firpfbch_crcf_set_channel_mask(q1, mask);
+
+    // generate input on all channels, zeroing inactive ones for the
+    // full synthesizer
+    float complex Y0[num_channels];
+    float complex Y1[num_channels];
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    for (i=0; i<num_symbols; i++) {
+        for (j=0; j<num_channels; j++) {
+            Y1[j] = randnf() + _Complex_I*randnf();
+            Y0[j] = mask[j] ? Y1[j] : 0.0f;
+        }
+        firpfbch_crcf_synthesizer_execute(q0, Y0, &y0[i*num_channels]);
+        firpfbch_crcf_synthesizer_execute(q1, Y1, &y1[i*num_channels]);
+    }
+
+    // compare
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), tol );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), tol );
+    }
+
+    // destroy objects
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+}
+
+// direct evaluation of few active channels, full transform otherwise
+void autotest_firpfbch_crcf_synthesis_mask_n3()  { firpfbch_crcf_synthesis_mask_runtest( 3); }
+void autotest_firpfbch_crcf_synthesis_mask_n40() { firpfbch_crcf_synthesis_mask_runtest(40); }
@@ -140,3 +140,98 @@ void autotest_ofdmframesync_acquire_n128()  { ofdmframesync_acquire_test(128, 16
 void autotest_ofdmframesync_acquire_n256()  { ofdmframesync_acquire_test(256, 32, 0); }
 void autotest_ofdmframesync_acquire_n512()  { ofdmframesync_acquire_test(512, 64, 0); }
 
+
+// received symbols buffer for block test
+struct ofdmframesync_autotest_block_s {
+    float complex * X;          // received symbols [size: num_symbols*M x 1]
+    unsigned int num_symbols;   // expected number of symbols
+    unsigned int n;             // number of symbols received
+};
+
+// internal callback: append received symbols to buffer, resetting the
+// synchronizer after the last symbol
+int ofdmframesync_autotest_block_callback(float complex * _X,
+                                          unsigned char * _p,
+                                          unsigned int    _M,
+                                          void * _userdata)
+{
+    struct ofdmframesync_autotest_block_s * q =
+        (struct ofdmframesync_autotest_block_s *) _userdata;
+
+    // copy values, increment counter and return
+    memmove(&q->X[q->n*_M], _X, _M*sizeof(float complex));
+    q->n++;
+    return q->n == q->num_symbols ? 1 : 0;
+}
+
+//
+// AUTOTEST: block execution matches sample-by-sample execution
+//
+void autotest_ofdmframesync_block()
+{
+    // options
+    unsigned int M           = 64;  // number of subcarriers
+    unsigned int cp_len      = 16;  // cyclic prefix length
+    unsigned int taper_len   = 4;   // taper length
+    unsigned int num_symbols = 8;   // number of data symbols
+    float        dphi        = 0.7f / (float)M;
+    float        tol         = 1e-3f;
+
+    unsigned char p[M];
+    ofdmframe_init_default_sctype(M, p);
+
+    // assemble frame
+    unsigned int num_samples = (3 + num_symbols + 1)*(M + cp_len);
+    float complex y[num_samples];
+    ofdmframegen fg = ofdmframegen_create(M, cp_len, taper_len, p);
+    unsigned int i, j, n=0;
+    ofdmframegen_write_S0a(fg, &y[n]); n += M + cp_len;
+    ofdmframegen_write_S0b(fg, &y[n]); n += M + cp_len;
+    ofdmframegen_write_S1( fg, &y[n]); n += M + cp_len;
+    float complex X[M];
+    for (i=0; i<num_symbols; i++) {
+        for (j=0; j<M; j++)
+            X[j] = cexpf(_Complex_I*2*M_PI*randf());
+        ofdmframegen_writesymbol(fg, X, &y[n]);
+        n += M + cp_len;
+    }
+    for (i=0; i<M+cp_len; i++)
+        y[n+i] = 0.0f;
+    ofdmframegen_writetail(fg, &y[n]);
+    n += M + cp_len;
+    assert(n == num_samples);
+
+    // add carrier offset and a small amount of noise
+    for (i=0; i<num_samples; i++)
+        y[i] = y[i]*cexpf(_Complex_I*dphi*i) + 0.01f*(randnf() + _Complex_I*randnf());
+
+    // receivers: sample-by-sample (debugging enabled) and blocks of
+    // varying size
+    float complex X0[num_symbols*M];
+    float complex X1[num_symbols*M];
+    struct ofdmframesync_autotest_block_s q0 = {X0, num_symbols, 0};
+    struct ofdmframesync_autotest_block_s q1 = {X1, num_symbols, 0};
+    ofdmframesync fs0 = ofdmframesync_create(M,cp_len,taper_len,p,ofdmframesync_autotest_block_callback,(void*)&q0);
+    ofdmframesync fs1 = ofdmframesync_create(M,cp_len,taper_len,p,ofdmframesync_autotest_block_callback,(void*)&q1);
+    ofdmframesync_debug_enable(fs0);
+
+    ofdmframesync_execute(fs0, y, num_samples);
+    unsigned int block_len = 1;
+    for (i=0; i<num_samples; i+=block_len) {
+        block_len = 1 + (block_len * 37) % 151;
+        if (i + block_len > num_samples)
+            block_len = num_samples - i;
+        ofdmframesync_execute(fs1, &y[i], block_len);
+    }
+
+    // validate received symbols
+    CONTEND_EQUALITY( q0.n, num_symbols );
+    CONTEND_EQUALITY( q1.n, num_symbols );
+    for (i=0; i<num_symbols*M; i++)
+        CONTEND_DELTA( cabsf(X0[i] - X1[i]), 0.0f, tol );
+
+    // destroy objects
+    ofdmframegen_destroy(fg);
+    ofdmframesync_destroy(fs0);
+    ofdmframesync_destroy(fs1);
+}
@@ -96,3 +96,26 @@ void benchmark_nco_mix_block_up(struct rusage *_start,
     nco_crcf_destroy(p);
 }
 
+void benchmark_nco_fixed_mix_block_up(struct rusage *_start,
+                                      struct rusage *_finish,
+                                      unsigned long int *_num_iterations)
+{
+    float complex x[256], y[256];
+    memset(x, 0, 256*sizeof(float complex));
+
+    nco_crcf p = nco_crcf_create(LIQUID_NCO_FIXED);
+    nco_crcf_set_phase(p, 0.0f);
+    nco_crcf_set_frequency(p, 0.1f);
+
+    unsigned int i;
+
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        nco_crcf_mix_block_up(p, x, y, 256);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    *_num_iterations *= 256;
+    nco_crcf_destroy(p);
+}
+
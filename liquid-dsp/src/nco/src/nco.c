@@ -42,6 +42,15 @@ struct NCO(_s) {
     T cosine;
     void (*compute_sincos)(NCO() _q);
 
+    // fixed-point phase (LIQUID_NCO_FIXED)
+    unsigned int theta_fixed;       // phase accumulator
+    unsigned int d_theta_fixed;     // phase step
+    unsigned int d_theta_rot;       // phase step of rotation tables
+    TC * tab;                       // two-level sine table
+    TC rot_up[NCO_FIXED_GROUP_LEN];   // exp{+j*k*d_theta}
+    TC rot_down[NCO_FIXED_GROUP_LEN]; // exp{-j*k*d_theta}
+    NCO(_mix_kernel_t) * mix_kernel;  // block-mixing kernel
+
     // phase-locked loop
     T bandwidth;
     T zeta;
@@ -61,6 +70,19 @@ NCO() NCO(_create)(liquid_ncotype _type)
     for (i=0; i<256; i++)
         q->sintab[i] = SIN(2.0f*M_PI*(float)(i)/256.0f);
 
+    // initialize two-level table for fixed-point phase: coarse
+    // steps of 2*pi/2^10 followed by fine steps of 2*pi/2^20
+    q->tab = NULL;
+    if (q->type == LIQUID_NCO_FIXED) {
+        q->tab = (TC*) malloc(2*NCO_FIXED_TABLE_LEN*sizeof(TC));
+        for (i=0; i<NCO_FIXED_TABLE_LEN; i++) {
+            double phi_coarse = 2*M_PI*i / NCO_FIXED_TABLE_LEN;
+            double phi_fine   = phi_coarse / NCO_FIXED_TABLE_LEN;
+            q->tab[i]                       = cos(phi_coarse) + _Complex_I*sin(phi_coarse);
+            q->tab[i+NCO_FIXED_TABLE_LEN]   = cos(phi_fine)   + _Complex_I*sin(phi_fine);
+        }
+    }
+
     // set default pll bandwidth
     q->a[0] = 1.0f;     q->b[0] = 0.0f;
     q->a[1] = 0.0f;     q->b[1] = 0.0f;
@@ -74,11 +96,25 @@ NCO() NCO(_create)(liquid_ncotype _type)
         q->compute_sincos = &NCO(_compute_sincos_nco);
     } else if (q->type == LIQUID_VCO) {
         q->compute_sincos = &NCO(_compute_sincos_vco);
+    } else if (q->type == LIQUID_NCO_FIXED) {
+        q->compute_sincos = &NCO(_compute_sincos_fixed);
     } else {
         fprintf(stderr,"error: NCO(_create)(), unknown type : %u\n", q->type);
         exit(1);
     }
 
+    // select block-mixing kernel based on host CPU
+    q->mix_kernel = NCO(_mix_kernel);
+#if LIQUID_NCO_SIMD
+    switch (liquid_simd_level()) {
+#if LIQUID_NCO_AVX2
+    case LIQUID_SIMD_AVX512:
+    case LIQUID_SIMD_AVX2:   q->mix_kernel = nco_crcf_mix_kernel_avx; break;
+#endif
+    default:                 q->mix_kernel = nco_crcf_mix_kernel_sse;
+    }
+#endif
+
     return q;
 }
 
@@ -86,6 +122,7 @@ NCO() NCO(_create)(liquid_ncotype _type)
 void NCO(_destroy)(NCO() _q)
 {
     iirfiltsos_rrrf_destroy(_q->pll_filter);
+    free(_q->tab);
     free(_q);
 }
 
@@ -95,6 +132,11 @@ void NCO(_reset)(NCO() _q)
     _q->theta = 0;
     _q->d_theta = 0;
 
+    // reset fixed-point phase and rotation tables
+    _q->theta_fixed   = 0;
+    _q->d_theta_fixed = 0;
+    NCO(_update_rotation)(_q);
+
     // reset sine table index
     _q->index = 0;
 
@@ -111,6 +153,7 @@ void NCO(_set_frequency)(NCO() _q,
                          T _f)
 {
     _q->d_theta = _f;
+    _q->d_theta_fixed = NCO(_phase_to_fixed)(_q->d_theta);
 }
 
 // adjust frequency of nco object
@@ -118,6 +161,7 @@ void NCO(_adjust_frequency)(NCO() _q,
                             T _df)
 {
     _q->d_theta += _df;
+    _q->d_theta_fixed = NCO(_phase_to_fixed)(_q->d_theta);
 }
 
 // set phase of nco object, constraining phase
@@ -125,6 +169,7 @@ void NCO(_set_phase)(NCO() _q, T _phi)
 {
     _q->theta = _phi;
     NCO(_constrain_phase)(_q);
+    _q->theta_fixed = NCO(_phase_to_fixed)(_phi);
 }
 
 // adjust phase of nco object, constraining phase
@@ -132,11 +177,18 @@ void NCO(_adjust_phase)(NCO() _q, T _dphi)
 {
     _q->theta += _dphi;
     NCO(_constrain_phase)(_q);
+    _q->theta_fixed += NCO(_phase_to_fixed)(_dphi);
 }
 
 // increment internal phase of nco object
 void NCO(_step)(NCO() _q)
 {
+    if (_q->type == LIQUID_NCO_FIXED) {
+        // phase accumulator wraps naturally
+        _q->theta_fixed += _q->d_theta_fixed;
+        return;
+    }
+
     _q->theta += _q->d_theta;
     NCO(_constrain_phase)(_q);
 }
@@ -144,6 +196,9 @@ void NCO(_step)(NCO() _q)
 // get phase
 T NCO(_get_phase)(NCO() _q)
 {
+    if (_q->type == LIQUID_NCO_FIXED)
+        return NCO(_phase_from_fixed)(_q->theta_fixed);
+
     return _q->theta;
 }
 
@@ -199,6 +254,27 @@ void NCO(_cexpf)(NCO() _q,
     *_y = _q->cosine + _Complex_I*(_q->sine);
 }
 
+// compute complex exponential of internal phase for each sample
+// in block, stepping phase
+//  _q      :   nco object
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of output samples
+void NCO(_cexpf_block)(NCO()        _q,
+                       TC *         _y,
+                       unsigned int _n)
+{
+    if (_q->type == LIQUID_NCO_FIXED) {
+        NCO(_mix_block_fixed)(_q, NULL, _y, _n, 0);
+        return;
+    }
+
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        NCO(_cexpf)(_q, &_y[i]);
+        NCO(_step)(_q);
+    }
+}
+
 // pll methods
 
 // reset pll state, retaining base frequency
@@ -274,7 +350,7 @@ void NCO(_mix_up)(NCO() _q,
     _q->compute_sincos(_q);
 
     // multiply _x by [cos(theta) + _Complex_I*sin(theta)]
-    *_y = _x * (_q->cosine + _Complex_I*(_q->sine));
+    *_y = liquid_cmulf(_x, _q->cosine + _Complex_I*(_q->sine));
 }
 
 // Rotate input vector down by NCO angle, y = x exp{-j theta}
@@ -289,7 +365,7 @@ void NCO(_mix_down)(NCO() _q,
     _q->compute_sincos(_q);
 
     // multiply _x by [cos(-theta) + _Complex_I*sin(-theta)]
-    *_y = _x * (_q->cosine - _Complex_I*(_q->sine));
+    *_y = liquid_cmulf(_x, _q->cosine - _Complex_I*(_q->sine));
 }
 
 
@@ -305,6 +381,11 @@ void NCO(_mix_block_up)(NCO() _q,
                         TC *_y,
                         unsigned int _n)
 {
+    if (_q->type == LIQUID_NCO_FIXED) {
+        NCO(_mix_block_fixed)(_q, _x, _y, _n, 0);
+        return;
+    }
+
     unsigned int i;
     // FIXME: this method should be more efficient but is causing occasional
     //        errors so instead favor slower but more reliable algorithm
@@ -342,6 +423,11 @@ void NCO(_mix_block_down)(NCO() _q,
                           TC *_y,
                           unsigned int _n)
 {
+    if (_q->type == LIQUID_NCO_FIXED) {
+        NCO(_mix_block_fixed)(_q, _x, _y, _n, 1);
+        return;
+    }
+
     unsigned int i;
     // FIXME: this method should be more efficient but is causing occasional
     //        errors so instead favor slower but more reliable algorithm
@@ -412,3 +498,115 @@ void NCO(_compute_sincos_vco)(NCO() _q)
     _q->cosine = COS(_q->theta);
 }
 
+// compute sin, cos of fixed-point phase from two-level table
+void NCO(_compute_sincos_fixed)(NCO() _q)
+{
+    NCO_FIXED_LOOKUP(_q->tab, _q->theta_fixed, _q->cosine, _q->sine);
+}
+
+// convert phase (radians) to 32-bit fixed point, 2^32 = 2*pi
+unsigned int NCO(_phase_to_fixed)(T _theta)
+{
+    // normalize to [0,1) cycles before scaling and rounding
+    double v = (double)_theta / (2*M_PI);
+    v -= floor(v);
+    return (unsigned int)(unsigned long long int)(v*4294967296.0 + 0.5);
+}
+
+// convert 32-bit fixed-point phase to radians in [-pi,pi)
+T NCO(_phase_from_fixed)(unsigned int _theta)
+{
+    return (T)((int)_theta * (2*M_PI/4294967296.0));
+}
+
+// compute rotation tables exp{+/-j*k*d_theta} for block mixing
+void NCO(_update_rotation)(NCO() _q)
+{
+    unsigned int k;
+    for (k=0; k<NCO_FIXED_GROUP_LEN; k++) {
+        double phi = (int)(k*_q->d_theta_fixed) * (2*M_PI/4294967296.0);
+        _q->rot_up[k]   = cos(phi) + _Complex_I*sin(phi);
+        _q->rot_down[k] = cos(phi) - _Complex_I*sin(phi);
+    }
+    _q->d_theta_rot = _q->d_theta_fixed;
+}
+
+// mix block with fixed-point phase; the phase accumulator is advanced
+// by exactly _n steps so that consecutive calls are phase continuous
+//  _q      :   nco object
+//  _x      :   input array (NULL to generate exp{j*theta})
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+//  _down   :   mix down (exp{-j*theta}) rather than up
+void NCO(_mix_block_fixed)(NCO()        _q,
+                           TC *         _x,
+                           TC *         _y,
+                           unsigned int _n,
+                           int          _down)
+{
+    // mixing down is mixing up by the negated phase
+    unsigned int theta   = _down ? -_q->theta_fixed   : _q->theta_fixed;
+    unsigned int d_theta = _down ? -_q->d_theta_fixed : _q->d_theta_fixed;
+
+    // run whole groups through kernel
+    unsigned int n = _n - (_n % NCO_FIXED_GROUP_LEN);
+    if (n > 0) {
+        // update rotation tables if frequency has changed
+        if (_q->d_theta_rot != _q->d_theta_fixed)
+            NCO(_update_rotation)(_q);
+
+        _q->mix_kernel(_q->tab, _down ? _q->rot_down : _q->rot_up,
+                       theta, d_theta, _x, _y, n);
+        theta += n*d_theta;
+    }
+
+    // remaining samples
+    unsigned int i;
+    T re, im;
+    for (i=n; i<_n; i++) {
+        NCO_FIXED_LOOKUP(_q->tab, theta, re, im);
+        if (_x == NULL) {
+            _y[i] = re + _Complex_I*im;
+        } else {
+            T xr = crealf(_x[i]);
+            T xi = cimagf(_x[i]);
+            _y[i] = (xr*re - xi*im) + _Complex_I*(xr*im + xi*re);
+        }
+        theta += d_theta;
+    }
+
+    // advance phase accumulator
+    _q->theta_fixed += _n*_q->d_theta_fixed;
+}
+
+// portable block-mixing kernel (see NCO(_mix_kernel_t))
+void NCO(_mix_kernel)(TC *         _tab,
+                      TC *         _rot,
+                      unsigned int _theta,
+                      unsigned int _d_theta,
+                      TC *         _x,
+                      TC *         _y,
+                      unsigned int _n)
+{
+    unsigned int d_theta_group = NCO_FIXED_GROUP_LEN * _d_theta;
+    unsigned int i, k;
+    T re, im;
+    for (i=0; i<_n; i+=NCO_FIXED_GROUP_LEN) {
+        // phase at start of group
+        NCO_FIXED_LOOKUP(_tab, _theta, re, im);
+        _theta += d_theta_group;
+
+        for (k=0; k<NCO_FIXED_GROUP_LEN; k++) {
+            T pr = re*crealf(_rot[k]) - im*cimagf(_rot[k]);
+            T pi = re*cimagf(_rot[k]) + im*crealf(_rot[k]);
+            if (_x == NULL) {
+                _y[i+k] = pr + _Complex_I*pi;
+            } else {
+                T xr = crealf(_x[i+k]);
+                T xi = cimagf(_x[i+k]);
+                _y[i+k] = (xr*pr - xi*pi) + _Complex_I*(xr*pi + xi*pr);
+            }
+        }
+    }
+}
+
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Fixed-point phase NCO block-mixing kernel (AVX2/FMA)
+//
+// Same structure as nco_mix.mmx.c with four complex values per
+// register.
+//
+
+#include <immintrin.h>
+
+#include "liquid.internal.h"
+
+// complex multiply of packed values, {a0*b0, ..., a3*b3}
+static inline __m256 nco_mix_cmul_avx(__m256 _a,
+                                      __m256 _b)
+{
+    __m256 br = _mm256_moveldup_ps(_b);
+    __m256 bi = _mm256_movehdup_ps(_b);
+    __m256 as = _mm256_permute_ps(_a, _MM_SHUFFLE(2,3,0,1));
+
+    // {ar*br - ai*bi, ai*br + ar*bi}
+    return _mm256_fmaddsub_ps(_a, br, _mm256_mul_ps(as, bi));
+}
+
+void nco_crcf_mix_kernel_avx(float complex * _tab,
+                             float complex * _rot,
+                             unsigned int    _theta,
+                             unsigned int    _d_theta,
+                             float complex * _x,
+                             float complex * _y,
+                             unsigned int    _n)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+
+    // load rotations within group, as well as with real/imaginary
+    // components swapped
+    __m256 rot[NCO_FIXED_GROUP_LEN/4];
+    __m256 rot_swap[NCO_FIXED_GROUP_LEN/4];
+    unsigned int i, k;
+    for (k=0; k<NCO_FIXED_GROUP_LEN/4; k++) {
+        rot[k]      = _mm256_loadu_ps((float*)&_rot[4*k]);
+        rot_swap[k] = _mm256_permute_ps(rot[k], _MM_SHUFFLE(2,3,0,1));
+    }
+
+    unsigned int d_theta_group = NCO_FIXED_GROUP_LEN * _d_theta;
+    float re, im;
+    for (i=0; i<_n; i+=NCO_FIXED_GROUP_LEN) {
+        // phase at start of group
+        NCO_FIXED_LOOKUP(_tab, _theta, re, im);
+        _theta += d_theta_group;
+        __m256 br = _mm256_set1_ps(re);
+        __m256 bi = _mm256_set1_ps(im);
+
+        float * yp = &y[2*i];
+        if (x == NULL) {
+            for (k=0; k<NCO_FIXED_GROUP_LEN/4; k++) {
+                __m256 p = _mm256_fmaddsub_ps(rot[k], br, _mm256_mul_ps(rot_swap[k], bi));
+                _mm256_storeu_ps(&yp[8*k], p);
+            }
+        } else {
+            float * xp = &x[2*i];
+            for (k=0; k<NCO_FIXED_GROUP_LEN/4; k++) {
+                __m256 p = _mm256_fmaddsub_ps(rot[k], br, _mm256_mul_ps(rot_swap[k], bi));
+                _mm256_storeu_ps(&yp[8*k], nco_mix_cmul_avx(_mm256_loadu_ps(&xp[8*k]), p));
+            }
+        }
+    }
+}
+
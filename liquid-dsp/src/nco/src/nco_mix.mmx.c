@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// Fixed-point phase NCO block-mixing kernel (SSE)
+//
+// Each register holds two complex values {re,im,re,im}. The phasor at
+// the start of each group is computed from the two-level table and
+// rotated by the per-sample steps exp{j*k*d_theta} within the group;
+// see NCO(_mix_kernel) in nco.c.
+//
+
+#include <xmmintrin.h>
+
+#include "liquid.internal.h"
+
+// complex multiply of two packed pairs, {a0*b0, a1*b1}
+static inline __m128 nco_mix_cmul_sse(__m128 _a,
+                                      __m128 _b,
+                                      __m128 _sign_re)
+{
+    __m128 br = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(2,2,0,0));
+    __m128 bi = _mm_shuffle_ps(_b, _b, _MM_SHUFFLE(3,3,1,1));
+    __m128 as = _mm_shuffle_ps(_a, _a, _MM_SHUFFLE(2,3,0,1));
+
+    // {ar*br - ai*bi, ai*br + ar*bi}
+    return _mm_add_ps(_mm_mul_ps(_a, br), _mm_xor_ps(_mm_mul_ps(as, bi), _sign_re));
+}
+
+void nco_crcf_mix_kernel_sse(float complex * _tab,
+                             float complex * _rot,
+                             unsigned int    _theta,
+                             unsigned int    _d_theta,
+                             float complex * _x,
+                             float complex * _y,
+                             unsigned int    _n)
+{
+    float * x = (float*) _x;
+    float * y = (float*) _y;
+
+    // sign mask for real components
+    __m128 sign_re = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+    // load rotations within group, as well as with real/imaginary
+    // components swapped
+    __m128 rot[NCO_FIXED_GROUP_LEN/2];
+    __m128 rot_swap[NCO_FIXED_GROUP_LEN/2];
+    unsigned int i, k;
+    for (k=0; k<NCO_FIXED_GROUP_LEN/2; k++) {
+        rot[k]      = _mm_loadu_ps((float*)&_rot[2*k]);
+        rot_swap[k] = _mm_shuffle_ps(rot[k], rot[k], _MM_SHUFFLE(2,3,0,1));
+    }
+
+    unsigned int d_theta_group = NCO_FIXED_GROUP_LEN * _d_theta;
+    float re, im;
+    for (i=0; i<_n; i+=NCO_FIXED_GROUP_LEN) {
+        // phase at start of group
+        NCO_FIXED_LOOKUP(_tab, _theta, re, im);
+        _theta += d_theta_group;
+        __m128 br = _mm_set1_ps(re);
+        __m128 bi = _mm_set1_ps(im);
+
+        float * yp = &y[2*i];
+        if (x == NULL) {
+            for (k=0; k<NCO_FIXED_GROUP_LEN/2; k++) {
+                __m128 p = _mm_add_ps(_mm_mul_ps(rot[k], br),
+                                      _mm_xor_ps(_mm_mul_ps(rot_swap[k], bi), sign_re));
+                _mm_storeu_ps(&yp[4*k], p);
+            }
+        } else {
+            float * xp = &x[2*i];
+            for (k=0; k<NCO_FIXED_GROUP_LEN/2; k++) {
+                __m128 p = _mm_add_ps(_mm_mul_ps(rot[k], br),
+                                      _mm_xor_ps(_mm_mul_ps(rot_swap[k], bi), sign_re));
+                _mm_storeu_ps(&yp[4*k], nco_mix_cmul_sse(_mm_loadu_ps(&xp[4*k]), p, sign_re));
+            }
+        }
+    }
+}
+
@@ -98,3 +98,16 @@ void autotest_vco_crcf_frequency()
     nco_crcf_frequency_test(LIQUID_VCO, 0.0f, 0.377964473009227, nco_sincos_fsqrt1_7, 256, tol); // 1/sqrt(7)
 }
 
+// test fixed-point phase nco
+void autotest_nco_fixed_crcf_frequency()
+{
+    // error tolerance
+    float tol = 0.0001f;
+
+    // test frequencies with irrational values
+    nco_crcf_frequency_test(LIQUID_NCO_FIXED, 0.0f, 0.707106781186547, nco_sincos_fsqrt1_2, 256, tol); // 1/sqrt(2)
+    nco_crcf_frequency_test(LIQUID_NCO_FIXED, 0.0f, 0.577350269189626, nco_sincos_fsqrt1_3, 256, tol); // 1/sqrt(3)
+    nco_crcf_frequency_test(LIQUID_NCO_FIXED, 0.0f, 0.447213595499958, nco_sincos_fsqrt1_5, 256, tol); // 1/sqrt(5)
+    nco_crcf_frequency_test(LIQUID_NCO_FIXED, 0.0f, 0.377964473009227, nco_sincos_fsqrt1_7, 256, tol); // 1/sqrt(7)
+}
+
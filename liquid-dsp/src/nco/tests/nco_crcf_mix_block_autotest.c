@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// nco_crcf_mix_block_autotest.c : test block mixing, phase continuity
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <complex.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// autotest helper function: mix block in chunks of varying size and
+// compare to expected output
+//  _type       :   NCO type (e.g. LIQUID_NCO_FIXED)
+//  _phase      :   initial phase
+//  _frequency  :   frequency
+//  _down       :   mix down (1) or up (0)
+//  _tol        :   error tolerance
+void nco_crcf_mix_block_test(int   _type,
+                             float _phase,
+                             float _frequency,
+                             int   _down,
+                             float _tol)
+{
+    unsigned int chunks[] = {1, 16, 7, 48, 33, 100, 15, 17, 256, 3};
+    unsigned int num_chunks = sizeof(chunks) / sizeof(unsigned int);
+    unsigned int num_samples = 0;
+    unsigned int i;
+    for (i=0; i<num_chunks; i++)
+        num_samples += chunks[i];
+
+    // generate input signal
+    float complex x[num_samples];
+    float complex y[num_samples];
+    for (i=0; i<num_samples; i++)
+        x[i] = (1.0f + 0.5f*cosf(0.01f*i)) * cexpf(_Complex_I*0.3f*i);
+
+    // create object
+    nco_crcf nco = nco_crcf_create(_type);
+    nco_crcf_set_phase(nco, _phase);
+    nco_crcf_set_frequency(nco, _frequency);
+
+    // run in chunks
+    unsigned int n = 0;
+    for (i=0; i<num_chunks; i++) {
+        if (_down) nco_crcf_mix_block_down(nco, &x[n], &y[n], chunks[i]);
+        else       nco_crcf_mix_block_up  (nco, &x[n], &y[n], chunks[i]);
+        n += chunks[i];
+    }
+
+    // compare to expected output
+    double sign = _down ? -1.0 : 1.0;
+    for (i=0; i<num_samples; i++) {
+        double theta = sign*((double)_phase + (double)_frequency*i);
+        float complex y_test = x[i] * (float complex)cexp(_Complex_I*theta);
+        CONTEND_DELTA( crealf(y[i]), crealf(y_test), _tol );
+        CONTEND_DELTA( cimagf(y[i]), cimagf(y_test), _tol );
+    }
+
+    // phase should have advanced by exactly the number of samples
+    double theta = fmod((double)_phase + (double)_frequency*num_samples, 2*M_PI);
+    float dphi = cargf( cexpf(_Complex_I*(nco_crcf_get_phase(nco) - (float)theta)) );
+    CONTEND_DELTA( dphi, 0.0f, _tol );
+
+    // destroy object
+    nco_crcf_destroy(nco);
+}
+
+void autotest_nco_crcf_mix_block_up()
+{
+    nco_crcf_mix_block_test(LIQUID_NCO_FIXED,  0.0f,  0.1f,            0, 1e-5f);
+    nco_crcf_mix_block_test(LIQUID_NCO_FIXED,  2.3f, -0.707106781f,    0, 1e-5f);
+    nco_crcf_mix_block_test(LIQUID_NCO_FIXED, -1.1f,  3.0f,            0, 1e-5f);
+    nco_crcf_mix_block_test(LIQUID_VCO,        2.3f, -0.707106781f,    0, 1e-4f);
+}
+
+void autotest_nco_crcf_mix_block_down()
+{
+    nco_crcf_mix_block_test(LIQUID_NCO_FIXED,  0.0f,  0.1f,            1, 1e-5f);
+    nco_crcf_mix_block_test(LIQUID_NCO_FIXED,  2.3f, -0.707106781f,    1, 1e-5f);
+    nco_crcf_mix_block_test(LIQUID_NCO_FIXED, -1.1f,  3.0f,            1, 1e-5f);
+    nco_crcf_mix_block_test(LIQUID_VCO,        2.3f, -0.707106781f,    1, 1e-4f);
+}
+
+// block mixing and generation should match per-sample methods, including
+// after frequency adjustments between blocks
+void autotest_nco_crcf_fixed_block_consistency()
+{
+    float tol = 1e-5f;
+    unsigned int n = 80;
+    float complex x[n], y_block[n], y_gen[n], y;
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.7f*i);
+
+    nco_crcf nco0 = nco_crcf_create(LIQUID_NCO_FIXED);
+    nco_crcf nco1 = nco_crcf_create(LIQUID_NCO_FIXED);
+    nco_crcf nco2 = nco_crcf_create(LIQUID_NCO_FIXED);
+
+    unsigned int t;
+    for (t=0; t<4; t++) {
+        // adjust frequency, phase of all objects equally
+        nco_crcf_adjust_frequency(nco0, 0.05f*t - 0.07f);
+        nco_crcf_adjust_frequency(nco1, 0.05f*t - 0.07f);
+        nco_crcf_adjust_frequency(nco2, 0.05f*t - 0.07f);
+        nco_crcf_adjust_phase(nco0, 0.3f);
+        nco_crcf_adjust_phase(nco1, 0.3f);
+        nco_crcf_adjust_phase(nco2, 0.3f);
+
+        nco_crcf_mix_block_up(nco1, x, y_block, n);
+        nco_crcf_cexpf_block(nco2, y_gen, n);
+        for (i=0; i<n; i++) {
+            nco_crcf_mix_up(nco0, x[i], &y);
+            CONTEND_DELTA( crealf(y_block[i]), crealf(y), tol );
+            CONTEND_DELTA( cimagf(y_block[i]), cimagf(y), tol );
+            CONTEND_DELTA( crealf(y_gen[i]*x[i]), crealf(y), tol );
+            CONTEND_DELTA( cimagf(y_gen[i]*x[i]), cimagf(y), tol );
+            nco_crcf_step(nco0);
+        }
+
+        // phase accumulators should be identical
+        CONTEND_EQUALITY( nco_crcf_get_phase(nco1), nco_crcf_get_phase(nco0) );
+        CONTEND_EQUALITY( nco_crcf_get_phase(nco2), nco_crcf_get_phase(nco0) );
+    }
+
+    nco_crcf_destroy(nco0);
+    nco_crcf_destroy(nco1);
+    nco_crcf_destroy(nco2);
+}
+
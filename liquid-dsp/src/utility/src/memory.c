@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2007 - 2014 Joseph Gaeddert
+ *
+ * This file is part of liquid.
+ *
+ * liquid is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * liquid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with liquid.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//
+// memory.c
+//
+// aligned memory allocation
+//
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "liquid.internal.h"
+
+// allocate _n bytes aligned to _align bytes (a power of two); the
+// block returned by malloc() is kept just ahead of the aligned block
+// so that it can be released with liquid_free_aligned()
+//  _n      :   number of bytes to allocate
+//  _align  :   alignment (bytes), power of two
+void * liquid_malloc_aligned(unsigned int _n,
+                             unsigned int _align)
+{
+    void * p = malloc(_n + _align + sizeof(void*));
+    if (p == NULL)
+        return NULL;
+
+    uintptr_t a = ((uintptr_t)p + sizeof(void*) + _align - 1) & ~((uintptr_t)_align - 1);
+    ((void**)a)[-1] = p;
+    return (void*)a;
+}
+
+// free memory allocated with liquid_malloc_aligned()
+void liquid_free_aligned(void * _p)
+{
+    if (_p != NULL)
+        free(((void**)_p)[-1]);
+}
+